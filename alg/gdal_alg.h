@@ -385,6 +385,16 @@ CPLErr CPL_DLL GDALRasterizeLayersBuf(
     GDALTransformerFunc pfnTransformer, void *pTransformArg, double dfBurnValue,
     char **papszOptions, GDALProgressFunc pfnProgress, void *pProgressArg);
 
+/************************************************************************/
+/*      Zonal statistics of a raster band over polygons.                */
+/************************************************************************/
+
+CPLErr CPL_DLL GDALZonalStatistics(GDALRasterBandH hSrcBand,
+                                   OGRLayerH hZoneLayer, OGRLayerH hDstLayer,
+                                   CSLConstList papszOptions,
+                                   GDALProgressFunc pfnProgress,
+                                   void *pProgressArg);
+
 /************************************************************************/
 /*  Gridding interface.                                                 */
 /************************************************************************/
@@ -35,6 +35,7 @@
 #ifndef DOXYGEN_SKIP
 
 #include <cstdint>
+#include <vector>
 
 #include "gdal_alg.h"
 #include "ogr_spatialref.h"
@@ -115,6 +116,20 @@ void GDALdllImageFilledPolygon(int nRasterXSize, int nRasterYSize,
 
 CPL_C_END
 
+class GDALDataset;
+class OGRGeometry;
+class OGRLayer;
+
+void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
+                                  std::vector<double> &aPointX,
+                                  std::vector<double> &aPointY,
+                                  std::vector<double> &aPointVariant,
+                                  std::vector<int> &aPartSize,
+                                  GDALBurnValueSrc eBurnValueSrc);
+
+void *GDALRasterizeCreateLayerTransformer(GDALDataset *poDS,
+                                          OGRLayer *poLayer);
+
 /************************************************************************/
 /*                          Polygon Enumerator                          */
 /************************************************************************/
@@ -48,6 +48,7 @@
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -345,12 +346,12 @@ static void gvBurnPoint(void *pCBData, int nY, int nX, double dfVariant)
 /*                    GDALCollectRingsFromGeometry()                    */
 /************************************************************************/
 
-static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
-                                         std::vector<double> &aPointX,
-                                         std::vector<double> &aPointY,
-                                         std::vector<double> &aPointVariant,
-                                         std::vector<int> &aPartSize,
-                                         GDALBurnValueSrc eBurnValueSrc)
+void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
+                                  std::vector<double> &aPointX,
+                                  std::vector<double> &aPointY,
+                                  std::vector<double> &aPointVariant,
+                                  std::vector<int> &aPartSize,
+                                  GDALBurnValueSrc eBurnValueSrc)
 
 {
     if (poShape == nullptr || poShape->IsEmpty())
@@ -484,6 +485,95 @@ static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
     }
 }
 
+/************************************************************************/
+/*                          gvRasterizeRings()                          */
+/************************************************************************/
+
+// Burns rings already transformed to pixel/line coordinates of the raster.
+// The coordinate arrays are modified in place.
+static void gvRasterizeRings(GDALRasterizeInfo *psInfo,
+                             OGRwkbGeometryType eGeomType, int nXOff,
+                             int nYOff, int bAllTouched,
+                             std::vector<double> &aPointX,
+                             std::vector<double> &aPointY,
+                             std::vector<double> &aPointVariant,
+                             const std::vector<int> &aPartSize)
+{
+    /* -------------------------------------------------------------------- */
+    /*      Shift to account for the buffer offset of this buffer.          */
+    /* -------------------------------------------------------------------- */
+    for (unsigned int i = 0; i < aPointX.size(); i++)
+        aPointX[i] -= nXOff;
+    for (unsigned int i = 0; i < aPointY.size(); i++)
+        aPointY[i] -= nYOff;
+
+    /* -------------------------------------------------------------------- */
+    /*      Perform the rasterization.                                      */
+    /*      According to the C++ Standard/23.2.4, elements of a vector are  */
+    /*      stored in continuous memory block.                              */
+    /* -------------------------------------------------------------------- */
+    const int nPartCount = static_cast<int>(aPartSize.size());
+    const bool bAdd = psInfo->eMergeAlg == GRMA_Add;
+    double *padfVariant = (psInfo->eBurnValueSource == GBV_UserBurnValue)
+                              ? nullptr
+                              : aPointVariant.data();
+
+    switch (eGeomType)
+    {
+        case wkbPoint:
+        case wkbMultiPoint:
+            GDALdllImagePoint(psInfo->nXSize, psInfo->nYSize, nPartCount,
+                              aPartSize.data(), aPointX.data(), aPointY.data(),
+                              padfVariant, gvBurnPoint, psInfo);
+            break;
+        case wkbLineString:
+        case wkbMultiLineString:
+        {
+            if (bAllTouched)
+                GDALdllImageLineAllTouched(
+                    psInfo->nXSize, psInfo->nYSize, nPartCount,
+                    aPartSize.data(), aPointX.data(), aPointY.data(),
+                    padfVariant, gvBurnPoint, psInfo, bAdd, false);
+            else
+                GDALdllImageLine(psInfo->nXSize, psInfo->nYSize, nPartCount,
+                                 aPartSize.data(), aPointX.data(),
+                                 aPointY.data(), padfVariant, gvBurnPoint,
+                                 psInfo);
+        }
+        break;
+
+        default:
+        {
+            GDALdllImageFilledPolygon(
+                psInfo->nXSize, psInfo->nYSize, nPartCount, aPartSize.data(),
+                aPointX.data(), aPointY.data(), padfVariant, gvBurnScanline,
+                psInfo);
+            if (bAllTouched)
+            {
+                // Reverting the variants to the first value because the
+                // polygon is filled using the variant from the first point of
+                // the first segment. Should be removed when the code to full
+                // polygons more appropriately is added.
+                if (padfVariant)
+                {
+                    for (unsigned int i = 0, n = 0;
+                         i < static_cast<unsigned int>(aPartSize.size()); i++)
+                    {
+                        for (int j = 0; j < aPartSize[i]; j++)
+                            aPointVariant[n++] = aPointVariant[0];
+                    }
+                }
+
+                GDALdllImageLineAllTouched(
+                    psInfo->nXSize, psInfo->nYSize, nPartCount,
+                    aPartSize.data(), aPointX.data(), aPointY.data(),
+                    padfVariant, gvBurnPoint, psInfo, bAdd, true);
+            }
+        }
+        break;
+    }
+}
+
 /************************************************************************/
 /*                       gv_rasterize_one_shape()                       */
 /************************************************************************/
@@ -579,92 +669,8 @@ static void gv_rasterize_one_shape(
         CPLFree(panSuccess);
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Shift to account for the buffer offset of this buffer.          */
-    /* -------------------------------------------------------------------- */
-    for (unsigned int i = 0; i < aPointX.size(); i++)
-        aPointX[i] -= nXOff;
-    for (unsigned int i = 0; i < aPointY.size(); i++)
-        aPointY[i] -= nYOff;
-
-    /* -------------------------------------------------------------------- */
-    /*      Perform the rasterization.                                      */
-    /*      According to the C++ Standard/23.2.4, elements of a vector are  */
-    /*      stored in continuous memory block.                              */
-    /* -------------------------------------------------------------------- */
-
-    switch (eGeomType)
-    {
-        case wkbPoint:
-        case wkbMultiPoint:
-            GDALdllImagePoint(
-                sInfo.nXSize, nYSize, static_cast<int>(aPartSize.size()),
-                aPartSize.data(), aPointX.data(), aPointY.data(),
-                (eBurnValueSrc == GBV_UserBurnValue) ? nullptr
-                                                     : aPointVariant.data(),
-                gvBurnPoint, &sInfo);
-            break;
-        case wkbLineString:
-        case wkbMultiLineString:
-        {
-            if (bAllTouched)
-                GDALdllImageLineAllTouched(
-                    sInfo.nXSize, nYSize, static_cast<int>(aPartSize.size()),
-                    aPartSize.data(), aPointX.data(), aPointY.data(),
-                    (eBurnValueSrc == GBV_UserBurnValue) ? nullptr
-                                                         : aPointVariant.data(),
-                    gvBurnPoint, &sInfo, eMergeAlg == GRMA_Add, false);
-            else
-                GDALdllImageLine(
-                    sInfo.nXSize, nYSize, static_cast<int>(aPartSize.size()),
-                    aPartSize.data(), aPointX.data(), aPointY.data(),
-                    (eBurnValueSrc == GBV_UserBurnValue) ? nullptr
-                                                         : aPointVariant.data(),
-                    gvBurnPoint, &sInfo);
-        }
-        break;
-
-        default:
-        {
-            GDALdllImageFilledPolygon(
-                sInfo.nXSize, nYSize, static_cast<int>(aPartSize.size()),
-                aPartSize.data(), aPointX.data(), aPointY.data(),
-                (eBurnValueSrc == GBV_UserBurnValue) ? nullptr
-                                                     : aPointVariant.data(),
-                gvBurnScanline, &sInfo);
-            if (bAllTouched)
-            {
-                // Reverting the variants to the first value because the
-                // polygon is filled using the variant from the first point of
-                // the first segment. Should be removed when the code to full
-                // polygons more appropriately is added.
-                if (eBurnValueSrc == GBV_UserBurnValue)
-                {
-                    GDALdllImageLineAllTouched(
-                        sInfo.nXSize, nYSize,
-                        static_cast<int>(aPartSize.size()), aPartSize.data(),
-                        aPointX.data(), aPointY.data(), nullptr, gvBurnPoint,
-                        &sInfo, eMergeAlg == GRMA_Add, true);
-                }
-                else
-                {
-                    for (unsigned int i = 0, n = 0;
-                         i < static_cast<unsigned int>(aPartSize.size()); i++)
-                    {
-                        for (int j = 0; j < aPartSize[i]; j++)
-                            aPointVariant[n++] = aPointVariant[0];
-                    }
-
-                    GDALdllImageLineAllTouched(
-                        sInfo.nXSize, nYSize,
-                        static_cast<int>(aPartSize.size()), aPartSize.data(),
-                        aPointX.data(), aPointY.data(), aPointVariant.data(),
-                        gvBurnPoint, &sInfo, eMergeAlg == GRMA_Add, true);
-                }
-            }
-        }
-        break;
-    }
+    gvRasterizeRings(&sInfo, eGeomType, nXOff, nYOff, bAllTouched, aPointX,
+                     aPointY, aPointVariant, aPartSize);
 }
 
 /************************************************************************/
@@ -1311,6 +1317,492 @@ static CPLErr GDALRasterizeGeometriesInternal(
     return eErr;
 }
 
+/************************************************************************/
+/*                 GDALRasterizeCreateLayerTransformer()                */
+/************************************************************************/
+
+// Create a GDALGenImgProjTransform() transformer from the georeferenced
+// coordinates of the layer to the pixel/line coordinates of the raster.
+void *GDALRasterizeCreateLayerTransformer(GDALDataset *poDS,
+                                          OGRLayer *poLayer)
+{
+    char *pszProjection = nullptr;
+
+    OGRSpatialReference *poSRS = poLayer->GetSpatialRef();
+    if (!poSRS)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Failed to fetch spatial reference on layer %s "
+                 "to build transformer, assuming matching coordinate "
+                 "systems.",
+                 poLayer->GetLayerDefn()->GetName());
+    }
+    else
+    {
+        poSRS->exportToWkt(&pszProjection);
+    }
+
+    char **papszTransformerOptions = nullptr;
+    if (pszProjection != nullptr)
+        papszTransformerOptions = CSLSetNameValue(papszTransformerOptions,
+                                                  "SRC_SRS", pszProjection);
+    double adfGeoTransform[6] = {};
+    if (poDS->GetGeoTransform(adfGeoTransform) != CE_None &&
+        poDS->GetGCPCount() == 0 && poDS->GetMetadata("RPC") == nullptr)
+    {
+        papszTransformerOptions = CSLSetNameValue(
+            papszTransformerOptions, "DST_METHOD", "NO_GEOTRANSFORM");
+    }
+
+    void *pTransformArg = GDALCreateGenImgProjTransformer2(
+        nullptr, GDALDataset::ToHandle(poDS), papszTransformerOptions);
+
+    CPLFree(pszProjection);
+    CSLDestroy(papszTransformerOptions);
+    return pTransformArg;
+}
+
+/************************************************************************/
+/*                   Multi-threaded rasterization.                      */
+/************************************************************************/
+
+namespace
+{
+// Geometry whose coordinates have been transformed to the pixel/line space
+// of the raster, so that it can be burnt in any area of it.
+struct GDALRasterizeShape
+{
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    std::vector<double> aPointX{};
+    std::vector<double> aPointY{};
+    std::vector<double> aPointVariant{};
+    std::vector<int> aPartSize{};
+    std::vector<double> adfBurnValues{};
+};
+
+// Burning of the shapes intersecting a tile into the area of the chunk
+// buffer described by sInfo.
+struct GDALRasterizeTileJob
+{
+    const std::vector<GDALRasterizeShape> *paoShapes = nullptr;
+    const std::vector<int> *panShapeIndices = nullptr;
+    GDALRasterizeInfo sInfo{};
+    int nXOff = 0;
+    int nYOff = 0;
+    int bAllTouched = FALSE;
+};
+}  // namespace
+
+/************************************************************************/
+/*                        GDALRasterizeAddShape()                       */
+/************************************************************************/
+
+static void GDALRasterizeAddShape(const OGRGeometry *poShape,
+                                  const std::vector<double> &adfBurnValues,
+                                  GDALBurnValueSrc eBurnValueSrc,
+                                  GDALRasterMergeAlg eMergeAlg,
+                                  GDALTransformerFunc pfnTransformer,
+                                  void *pTransformArg,
+                                  std::vector<GDALRasterizeShape> &aoShapes)
+{
+    if (poShape == nullptr || poShape->IsEmpty())
+        return;
+    const auto eGeomType = wkbFlatten(poShape->getGeometryType());
+
+    if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
+         eGeomType == wkbGeometryCollection) &&
+        eMergeAlg == GRMA_Replace)
+    {
+        // Same as in gv_rasterize_one_shape()
+        for (const auto poPart : *(poShape->toGeometryCollection()))
+        {
+            GDALRasterizeAddShape(poPart, adfBurnValues, eBurnValueSrc,
+                                  eMergeAlg, pfnTransformer, pTransformArg,
+                                  aoShapes);
+        }
+        return;
+    }
+
+    GDALRasterizeShape oShape;
+    oShape.eGeomType = eGeomType;
+    GDALCollectRingsFromGeometry(poShape, oShape.aPointX, oShape.aPointY,
+                                 oShape.aPointVariant, oShape.aPartSize,
+                                 eBurnValueSrc);
+    if (oShape.aPointX.empty())
+        return;
+
+    if (pfnTransformer != nullptr)
+    {
+        std::vector<int> anSuccess(oShape.aPointX.size());
+        pfnTransformer(pTransformArg, FALSE,
+                       static_cast<int>(oShape.aPointX.size()),
+                       oShape.aPointX.data(), oShape.aPointY.data(), nullptr,
+                       anSuccess.data());
+    }
+
+    oShape.adfBurnValues = adfBurnValues;
+    aoShapes.emplace_back(std::move(oShape));
+}
+
+/************************************************************************/
+/*                      GDALRasterizeTileJobFunc()                      */
+/************************************************************************/
+
+static void GDALRasterizeTileJobFunc(void *pData)
+{
+    const auto psJob = static_cast<const GDALRasterizeTileJob *>(pData);
+
+    std::vector<double> aPointX;
+    std::vector<double> aPointY;
+    std::vector<double> aPointVariant;
+    for (const int iShape : *(psJob->panShapeIndices))
+    {
+        const auto &oShape = (*psJob->paoShapes)[iShape];
+        // gvRasterizeRings() modifies the coordinates in place
+        aPointX = oShape.aPointX;
+        aPointY = oShape.aPointY;
+        aPointVariant = oShape.aPointVariant;
+
+        GDALRasterizeInfo sInfo = psJob->sInfo;
+        sInfo.burnValues.double_values = oShape.adfBurnValues.data();
+        gvRasterizeRings(&sInfo, oShape.eGeomType, psJob->nXOff, psJob->nYOff,
+                         psJob->bAllTouched, aPointX, aPointY, aPointVariant,
+                         oShape.aPartSize);
+    }
+}
+
+/************************************************************************/
+/*                  GDALRasterizeLayersMultiThreaded()                  */
+/************************************************************************/
+
+// Features are read only once, by batches. The geometries of a batch are
+// transformed to pixel/line coordinates, binned into a grid of tiles of the
+// raster according to their envelope, and then the tiles of each chunk of
+// scanlines are rasterized in parallel. Shapes are burnt in a tile in the
+// order of the features, so the result does not depend on the number of
+// threads, including with MERGE_ALG=ADD.
+static CPLErr GDALRasterizeLayersMultiThreaded(
+    GDALDataset *poDS, int nBandCount, int *panBandList, int nLayerCount,
+    OGRLayerH *pahLayers, GDALTransformerFunc pfnTransformer,
+    void *pTransformArg, const double *padfLayerBurnValues,
+    const char *pszBurnAttribute, int bAllTouched,
+    GDALBurnValueSrc eBurnValueSource, GDALRasterMergeAlg eMergeAlg,
+    GDALDataType eType, int nYChunkSize, CPLWorkerThreadPool *poThreadPool,
+    GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = poDS->GetRasterXSize();
+    const int nYSize = poDS->GetRasterYSize();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eType);
+    const GSpacing nLineSpace = static_cast<GSpacing>(nXSize) * nDTSize;
+    const bool bSingleChunk = nYChunkSize == nYSize;
+
+    unsigned char *pabyChunkBuf = static_cast<unsigned char *>(
+        VSI_MALLOC3_VERBOSE(nYChunkSize, static_cast<size_t>(nLineSpace),
+                            nBandCount));
+    if (pabyChunkBuf == nullptr)
+        return CE_Failure;
+
+    CPLErr eErr = CE_None;
+    if (bSingleChunk)
+    {
+        eErr = poDS->RasterIO(GF_Read, 0, 0, nXSize, nYSize, pabyChunkBuf,
+                              nXSize, nYSize, eType, nBandCount, panBandList,
+                              0, 0, 0, nullptr);
+    }
+
+    // Use larger tiles for huge rasters, so that the bins of the grid do
+    // not take too much memory.
+    int nTileSize = 256;
+    while (DIV_ROUND_UP(nXSize, nTileSize) *
+               static_cast<GIntBig>(DIV_ROUND_UP(nYSize, nTileSize)) >
+           1024 * 1024)
+    {
+        nTileSize *= 2;
+    }
+    const int nTilesX = DIV_ROUND_UP(nXSize, nTileSize);
+    const int nTilesY = DIV_ROUND_UP(nYSize, nTileSize);
+    CPLDebug("GDAL", "Rasterizer operating on tiles of %dx%d pixels.",
+             nTileSize, nTileSize);
+
+    std::vector<GDALRasterizeShape> aoShapes;
+    std::vector<std::vector<int>> aanTileShapeIndices(
+        static_cast<size_t>(nTilesX) * nTilesY);
+
+    // Limit the memory used by the transformed coordinates of a batch to
+    // about the size of the block cache.
+    const size_t nMaxBatchPoints = static_cast<size_t>(
+        std::max<GIntBig>(1024 * 1024, GDALGetCacheMax64() / (3 * 8)));
+    size_t nBatchPoints = 0;
+
+    GIntBig nTotalFeatures = 0;
+    for (int iLayer = 0; iLayer < nLayerCount; iLayer++)
+    {
+        OGRLayer *poLayer = OGRLayer::FromHandle(pahLayers[iLayer]);
+        const GIntBig nCount = poLayer ? poLayer->GetFeatureCount(FALSE) : 0;
+        if (nCount < 0 || nTotalFeatures < 0)
+            nTotalFeatures = -1;
+        else
+            nTotalFeatures += nCount;
+    }
+    GIntBig nFeaturesDone = 0;
+    GIntBig nFeaturesFlushed = 0;
+
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    /* -------------------------------------------------------------------- */
+    /*      Rasterize the current batch of shapes, chunk by chunk.          */
+    /* -------------------------------------------------------------------- */
+    const auto FlushBatch = [&]()
+    {
+        const double dfProgressStart =
+            nTotalFeatures > 0
+                ? static_cast<double>(nFeaturesFlushed) / nTotalFeatures
+                : 0.0;
+        const double dfProgressEnd =
+            nTotalFeatures > 0
+                ? std::min(1.0,
+                           static_cast<double>(nFeaturesDone) / nTotalFeatures)
+                : 1.0;
+
+        for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nYChunkSize)
+        {
+            const int nThisYChunkSize = std::min(nYChunkSize, nYSize - iY);
+
+            // Only re-read image if not a single chunk is being rendered.
+            if (!bSingleChunk)
+            {
+                eErr = poDS->RasterIO(GF_Read, 0, iY, nXSize, nThisYChunkSize,
+                                      pabyChunkBuf, nXSize, nThisYChunkSize,
+                                      eType, nBandCount, panBandList, 0, 0, 0,
+                                      nullptr);
+                if (eErr != CE_None)
+                    break;
+            }
+
+            std::vector<GDALRasterizeTileJob> asJobs;
+            for (int iTileY = iY / nTileSize;
+                 iTileY <= (iY + nThisYChunkSize - 1) / nTileSize; ++iTileY)
+            {
+                const int nYOff = std::max(iTileY * nTileSize, iY);
+                const int nTileYSize =
+                    std::min((iTileY + 1) * nTileSize, iY + nThisYChunkSize) -
+                    nYOff;
+                for (int iTileX = 0; iTileX < nTilesX; ++iTileX)
+                {
+                    const auto &anShapeIndices =
+                        aanTileShapeIndices[static_cast<size_t>(iTileY) *
+                                                nTilesX +
+                                            iTileX];
+                    if (anShapeIndices.empty())
+                        continue;
+
+                    const int nXOff = iTileX * nTileSize;
+                    GDALRasterizeTileJob sJob;
+                    sJob.paoShapes = &aoShapes;
+                    sJob.panShapeIndices = &anShapeIndices;
+                    sJob.nXOff = nXOff;
+                    sJob.nYOff = nYOff;
+                    sJob.bAllTouched = bAllTouched;
+                    sJob.sInfo.pabyChunkBuf =
+                        pabyChunkBuf + (nYOff - iY) * nLineSpace +
+                        static_cast<GSpacing>(nXOff) * nDTSize;
+                    sJob.sInfo.nXSize = std::min(nTileSize, nXSize - nXOff);
+                    sJob.sInfo.nYSize = nTileYSize;
+                    sJob.sInfo.nBands = nBandCount;
+                    sJob.sInfo.eType = eType;
+                    sJob.sInfo.nPixelSpace = nDTSize;
+                    sJob.sInfo.nLineSpace = nLineSpace;
+                    sJob.sInfo.nBandSpace = nThisYChunkSize * nLineSpace;
+                    sJob.sInfo.eBurnValueType = GDT_Float64;
+                    sJob.sInfo.burnValues.double_values = nullptr;
+                    sJob.sInfo.eBurnValueSource = eBurnValueSource;
+                    sJob.sInfo.eMergeAlg = eMergeAlg;
+                    asJobs.push_back(sJob);
+                }
+            }
+
+            // Tiles cover disjoint areas of the chunk buffer.
+            for (auto &sJob : asJobs)
+                poJobQueue->SubmitJob(GDALRasterizeTileJobFunc, &sJob);
+            poJobQueue->WaitCompletion();
+
+            // Only write image if not a single chunk is being rendered.
+            if (!bSingleChunk)
+            {
+                eErr = poDS->RasterIO(GF_Write, 0, iY, nXSize, nThisYChunkSize,
+                                      pabyChunkBuf, nXSize, nThisYChunkSize,
+                                      eType, nBandCount, panBandList, 0, 0, 0,
+                                      nullptr);
+            }
+
+            if (eErr == CE_None &&
+                !pfnProgress(dfProgressStart +
+                                 (dfProgressEnd - dfProgressStart) *
+                                     (iY + nThisYChunkSize) / nYSize,
+                             "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                eErr = CE_Failure;
+            }
+        }
+
+        aoShapes.clear();
+        for (auto &anShapeIndices : aanTileShapeIndices)
+            anShapeIndices.clear();
+        nBatchPoints = 0;
+        nFeaturesFlushed = nFeaturesDone;
+    };
+
+    /* ==================================================================== */
+    /*      Read the specified layers, transforming and binning             */
+    /*      geometries.                                                     */
+    /* ==================================================================== */
+    pfnProgress(0.0, nullptr, pProgressArg);
+
+    std::vector<double> adfBurnValues(nBandCount);
+    for (int iLayer = 0; iLayer < nLayerCount && eErr == CE_None; iLayer++)
+    {
+        OGRLayer *poLayer = OGRLayer::FromHandle(pahLayers[iLayer]);
+
+        if (!poLayer)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Layer element number %d is NULL, skipping.", iLayer);
+            continue;
+        }
+
+        if (poLayer->GetFeatureCount(FALSE) == 0)
+            continue;
+
+        int iBurnField = -1;
+        if (pszBurnAttribute)
+        {
+            iBurnField =
+                poLayer->GetLayerDefn()->GetFieldIndex(pszBurnAttribute);
+            if (iBurnField == -1)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Failed to find field %s on layer %s, skipping.",
+                         pszBurnAttribute, poLayer->GetLayerDefn()->GetName());
+                continue;
+            }
+        }
+        else
+        {
+            std::copy(padfLayerBurnValues + iLayer * nBandCount,
+                      padfLayerBurnValues + (iLayer + 1) * nBandCount,
+                      adfBurnValues.begin());
+        }
+
+        GDALTransformerFunc pfnLayerTransformer = pfnTransformer;
+        void *pLayerTransformArg = pTransformArg;
+        if (pfnTransformer == nullptr)
+        {
+            pLayerTransformArg =
+                GDALRasterizeCreateLayerTransformer(poDS, poLayer);
+            pfnLayerTransformer = GDALGenImgProjTransform;
+            if (pLayerTransformArg == nullptr)
+            {
+                eErr = CE_Failure;
+                break;
+            }
+        }
+
+        poLayer->ResetReading();
+        for (auto &poFeat : poLayer)
+        {
+            ++nFeaturesDone;
+            if (pszBurnAttribute)
+            {
+                std::fill(adfBurnValues.begin(), adfBurnValues.end(),
+                          poFeat->GetFieldAsDouble(iBurnField));
+            }
+
+            const size_t nFirstNewShape = aoShapes.size();
+            GDALRasterizeAddShape(poFeat->GetGeometryRef(), adfBurnValues,
+                                  eBurnValueSource, eMergeAlg,
+                                  pfnLayerTransformer, pLayerTransformArg,
+                                  aoShapes);
+
+            // Bin the new shapes into the tiles intersecting their envelope,
+            // enlarged by one pixel to be on the safe side regarding
+            // ALL_TOUCHED=TRUE.
+            for (size_t iShape = nFirstNewShape; iShape < aoShapes.size();)
+            {
+                const auto &oShape = aoShapes[iShape];
+                const auto oMinMaxX = std::minmax_element(
+                    oShape.aPointX.begin(), oShape.aPointX.end());
+                const auto oMinMaxY = std::minmax_element(
+                    oShape.aPointY.begin(), oShape.aPointY.end());
+                const double dfMinX = std::floor(*oMinMaxX.first) - 1;
+                const double dfMaxX = std::floor(*oMinMaxX.second) + 1;
+                const double dfMinY = std::floor(*oMinMaxY.first) - 1;
+                const double dfMaxY = std::floor(*oMinMaxY.second) + 1;
+                if (!(dfMaxX >= 0 && dfMinX < nXSize && dfMaxY >= 0 &&
+                      dfMinY < nYSize))
+                {
+                    // Outside of the raster (or invalid coordinates)
+                    aoShapes.erase(aoShapes.begin() + iShape);
+                    continue;
+                }
+                const int iTileXMin =
+                    static_cast<int>(std::max(0.0, dfMinX)) / nTileSize;
+                const int iTileXMax =
+                    static_cast<int>(std::min(nXSize - 1.0, dfMaxX)) /
+                    nTileSize;
+                const int iTileYMin =
+                    static_cast<int>(std::max(0.0, dfMinY)) / nTileSize;
+                const int iTileYMax =
+                    static_cast<int>(std::min(nYSize - 1.0, dfMaxY)) /
+                    nTileSize;
+                for (int iTileY = iTileYMin; iTileY <= iTileYMax; ++iTileY)
+                {
+                    for (int iTileX = iTileXMin; iTileX <= iTileXMax;
+                         ++iTileX)
+                    {
+                        aanTileShapeIndices[static_cast<size_t>(iTileY) *
+                                                nTilesX +
+                                            iTileX]
+                            .push_back(static_cast<int>(iShape));
+                    }
+                }
+                nBatchPoints += oShape.aPointX.size();
+                ++iShape;
+            }
+
+            if (nBatchPoints >= nMaxBatchPoints)
+            {
+                FlushBatch();
+                if (eErr != CE_None)
+                    break;
+            }
+        }
+
+        if (pfnTransformer == nullptr)
+            GDALDestroyTransformer(pLayerTransformArg);
+    }
+
+    if (eErr == CE_None && !aoShapes.empty())
+        FlushBatch();
+    if (eErr == CE_None)
+        pfnProgress(1.0, "", pProgressArg);
+
+    /* -------------------------------------------------------------------- */
+    /*      Write out the image once for all layers if user requested       */
+    /*      to render the whole raster in single chunk.                     */
+    /* -------------------------------------------------------------------- */
+    if (eErr == CE_None && bSingleChunk)
+    {
+        eErr = poDS->RasterIO(GF_Write, 0, 0, nXSize, nYSize, pabyChunkBuf,
+                              nXSize, nYSize, eType, nBandCount, panBandList,
+                              0, 0, 0, nullptr);
+    }
+
+    VSIFree(pabyChunkBuf);
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                        GDALRasterizeLayers()                         */
 /************************************************************************/
@@ -1365,6 +1857,14 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * <li>"MERGE_ALG": May be REPLACE (the default) or ADD.  REPLACE results in
  * overwriting of value, while ADD adds the new value to the existing raster,
  * suitable for heatmaps for instance.</li>
+ * <li>"NUM_THREADS": (GDAL >= 3.7) Can be set to a numeric value or ALL_CPUS
+ * to rasterize with several threads. If not set, the GDAL_NUM_THREADS
+ * configuration option is used, and otherwise rasterization is done in a
+ * single thread. In multi-threaded mode, features are read only once (by
+ * batches whose size depends on the GDAL cache size), their geometries are
+ * binned into tiles of the raster according to their envelope, and tiles
+ * are rasterized in parallel. Results do not depend on the number of
+ * threads, including with MERGE_ALG=ADD.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1442,6 +1942,20 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
     CPLDebug("GDAL", "Rasterizer operating on %d swaths of %d scanlines.",
              (poDS->GetRasterYSize() + nYChunkSize - 1) / nYChunkSize,
              nYChunkSize);
+
+    const int nThreads = GDALGetNumThreads(papszOptions, "NUM_THREADS");
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (poThreadPool)
+    {
+        return GDALRasterizeLayersMultiThreaded(
+            poDS, nBandCount, panBandList, nLayerCount, pahLayers,
+            pfnTransformer, pTransformArg, padfLayerBurnValues,
+            CSLFetchNameValue(papszOptions, "ATTRIBUTE"), bAllTouched,
+            eBurnValueSource, eMergeAlg, eType, nYChunkSize, poThreadPool,
+            pfnProgress, pProgressArg);
+    }
+
     unsigned char *pabyChunkBuf = static_cast<unsigned char *>(
         VSI_MALLOC2_VERBOSE(nYChunkSize, nScanlineBytes));
     if (pabyChunkBuf == nullptr)
@@ -1526,41 +2040,9 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
 
         if (pfnTransformer == nullptr)
         {
-            char *pszProjection = nullptr;
             bNeedToFreeTransformer = true;
-
-            OGRSpatialReference *poSRS = poLayer->GetSpatialRef();
-            if (!poSRS)
-            {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "Failed to fetch spatial reference on layer %s "
-                         "to build transformer, assuming matching coordinate "
-                         "systems.",
-                         poLayer->GetLayerDefn()->GetName());
-            }
-            else
-            {
-                poSRS->exportToWkt(&pszProjection);
-            }
-
-            char **papszTransformerOptions = nullptr;
-            if (pszProjection != nullptr)
-                papszTransformerOptions = CSLSetNameValue(
-                    papszTransformerOptions, "SRC_SRS", pszProjection);
-            double adfGeoTransform[6] = {};
-            if (poDS->GetGeoTransform(adfGeoTransform) != CE_None &&
-                poDS->GetGCPCount() == 0 && poDS->GetMetadata("RPC") == nullptr)
-            {
-                papszTransformerOptions = CSLSetNameValue(
-                    papszTransformerOptions, "DST_METHOD", "NO_GEOTRANSFORM");
-            }
-
-            pTransformArg = GDALCreateGenImgProjTransformer2(
-                nullptr, hDS, papszTransformerOptions);
+            pTransformArg = GDALRasterizeCreateLayerTransformer(poDS, poLayer);
             pfnTransformer = GDALGenImgProjTransform;
-
-            CPLFree(pszProjection);
-            CSLDestroy(papszTransformerOptions);
             if (pTransformArg == nullptr)
             {
                 CPLFree(pabyChunkBuf);
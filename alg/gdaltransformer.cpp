@@ -42,7 +42,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -53,6 +55,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdalsse_priv.h"
 #include "ogr_core.h"
 #include "ogr_spatialref.h"
 #include "ogr_srs_api.h"
@@ -3480,6 +3483,33 @@ static void *GDALDeserializeReprojectionTransformer(CPLXMLNode *psTree)
 /* ==================================================================== */
 /************************************************************************/
 
+namespace
+{
+// Exactly transformed nodes of the regular grid used by the grid-based
+// approximation mode, and whether the cells of the grid can be bilinearly
+// interpolated within the error threshold.
+struct ApproxTransformGridCache
+{
+    struct Node
+    {
+        double x = 0;
+        double y = 0;
+        double z = 0;
+        bool bSuccess = false;
+    };
+
+    double dfZ = 0;  // input Z value for which the nodes have been computed
+    std::unordered_map<GIntBig, Node> oMapNodes{};
+    std::unordered_map<GIntBig, bool> oMapCellOK{};
+
+    void Clear()
+    {
+        oMapNodes.clear();
+        oMapCellOK.clear();
+    }
+};
+}  // namespace
+
 typedef struct
 {
     GDALTransformerInfo sTI;
@@ -3490,6 +3520,12 @@ typedef struct
     double dfMaxErrorReverse;
 
     int bOwnSubtransformer;
+
+    // Size in pixels of the cells of the grid-based approximation, or 0
+    // if disabled.
+    double dfGridSize;
+    // Indexed by bDstToSrc. Lazily instantiated.
+    ApproxTransformGridCache *apoGridCache[2];
 } ApproxTransformInfo;
 
 /************************************************************************/
@@ -3510,6 +3546,8 @@ static void *GDALCreateSimilarApproxTransformer(void *hTransformArg,
         CPLMalloc(sizeof(ApproxTransformInfo)));
 
     memcpy(psClonedInfo, psInfo, sizeof(ApproxTransformInfo));
+    psClonedInfo->apoGridCache[0] = nullptr;
+    psClonedInfo->apoGridCache[1] = nullptr;
     if (psClonedInfo->pBaseCBData)
     {
         psClonedInfo->pBaseCBData = GDALCreateSimilarTransformer(
@@ -3601,6 +3639,16 @@ static CPLXMLNode *GDALSerializeApproxTransformer(void *pTransformArg)
  * circumstances as little internal validation is done in order to keep things
  * fast.
  *
+ * Starting with GDAL 3.7, when the base transformer is
+ * GDALGenImgProjTransform() and the GDAL_APPROX_TRANSFORMER_GRID_SIZE
+ * configuration option is set to a positive value, a grid-based approximation
+ * is used instead: the high precision transformer is evaluated at the nodes of
+ * a regular grid of that many pixels, which are cached across calls, and
+ * points are bilinearly interpolated from the nodes of the grid cell they
+ * fall in. The interpolation error is checked once per cell, and cells where
+ * it exceeds the threshold fall back to the above scanline-based
+ * approximation.
+ *
  * @param pfnBaseTransformer the high precision transformer which should be
  * approximated.
  * @param pBaseTransformArg the callback argument for the high precision
@@ -3633,6 +3681,15 @@ GDALCreateApproxTransformer2(GDALTransformerFunc pfnBaseTransformer,
     psATInfo->dfMaxErrorForward = dfMaxErrorForward;
     psATInfo->dfMaxErrorReverse = dfMaxErrorReverse;
     psATInfo->bOwnSubtransformer = FALSE;
+    psATInfo->dfGridSize = 0;
+    if (pfnBaseTransformer == GDALGenImgProjTransform)
+    {
+        psATInfo->dfGridSize = std::max(
+            0.0, CPLAtof(CPLGetConfigOption("GDAL_APPROX_TRANSFORMER_GRID_SIZE",
+                                            "0")));
+    }
+    psATInfo->apoGridCache[0] = nullptr;
+    psATInfo->apoGridCache[1] = nullptr;
 
     memcpy(psATInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
@@ -3682,6 +3739,9 @@ void GDALDestroyApproxTransformer(void *pCBData)
     if (psATInfo->bOwnSubtransformer)
         GDALDestroyTransformer(psATInfo->pBaseCBData);
 
+    delete psATInfo->apoGridCache[0];
+    delete psATInfo->apoGridCache[1];
+
     CPLFree(pCBData);
 }
 
@@ -3698,6 +3758,12 @@ void GDALRefreshApproxTransformer(void *hTransformArg)
     {
         GDALRefreshGenImgProjTransformer(psInfo->pBaseCBData);
     }
+
+    for (auto poGridCache : psInfo->apoGridCache)
+    {
+        if (poGridCache)
+            poGridCache->Clear();
+    }
 }
 
 /************************************************************************/
@@ -3952,20 +4018,12 @@ static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
 }
 
 /************************************************************************/
-/*                        GDALApproxTransform()                         */
+/*                    GDALApproxTransformScanline()                     */
 /************************************************************************/
 
-/**
- * Perform approximate transformation.
- *
- * Actually performs the approximate transformation described in
- * GDALCreateApproxTransformer().  This function matches the
- * GDALTransformerFunc() signature.  Details of the arguments are described
- * there.
- */
-
-int GDALApproxTransform(void *pCBData, int bDstToSrc, int nPoints, double *x,
-                        double *y, double *z, int *panSuccess)
+static int GDALApproxTransformScanline(void *pCBData, int bDstToSrc,
+                                       int nPoints, double *x, double *y,
+                                       double *z, int *panSuccess)
 
 {
     ApproxTransformInfo *psATInfo = static_cast<ApproxTransformInfo *>(pCBData);
@@ -4028,6 +4086,288 @@ end:
     return bRet;
 }
 
+/************************************************************************/
+/*                            GetGridKey()                              */
+/************************************************************************/
+
+static GIntBig GetGridKey(int i, int j)
+{
+    return static_cast<GIntBig>(
+        (static_cast<GUIntBig>(static_cast<GUInt32>(j)) << 32) |
+        static_cast<GUInt32>(i));
+}
+
+/************************************************************************/
+/*                     GDALApproxTransformWithGrid()                    */
+/************************************************************************/
+
+// Returns -1 if the grid-based approximation cannot be used for the
+// provided points, in which case they are left untouched.
+static int GDALApproxTransformWithGrid(ApproxTransformInfo *psATInfo,
+                                       int bDstToSrc, int nPoints, double *x,
+                                       double *y, double *z, int *panSuccess)
+{
+    const double dfGridSize = psATInfo->dfGridSize;
+    const double dfMaxError =
+        (bDstToSrc) ? psATInfo->dfMaxErrorReverse : psATInfo->dfMaxErrorForward;
+    const int nMiddle = (nPoints - 1) / 2;
+
+    // Same preconditions as the scanline-based approximation: points must
+    // be on the same line.
+    if (nPoints <= 5 || dfMaxError == 0.0 || y[0] != y[nPoints - 1] ||
+        y[0] != y[nMiddle] || z[0] != z[nPoints - 1] || z[0] != z[nMiddle])
+    {
+        return -1;
+    }
+
+    const double dfInvGridSize = 1.0 / dfGridSize;
+    const double dfRow = y[0] * dfInvGridSize;
+    if (!(std::fabs(dfRow) < INT_MAX - 1))
+        return -1;
+    const int j = static_cast<int>(std::floor(dfRow));
+    const double dfFracY = dfRow - j;
+
+    std::vector<int> anCol(nPoints);
+    int iMin = INT_MAX;
+    int iMax = INT_MIN;
+    for (int k = 0; k < nPoints; ++k)
+    {
+        const double dfCol = x[k] * dfInvGridSize;
+        if (!(std::fabs(dfCol) < INT_MAX - 1))
+            return -1;
+        anCol[k] = static_cast<int>(std::floor(dfCol));
+        iMin = std::min(iMin, anCol[k]);
+        iMax = std::max(iMax, anCol[k]);
+    }
+    // Not worth it if there are more cells than points.
+    if (static_cast<GIntBig>(iMax) - iMin >= nPoints)
+        return -1;
+
+    auto &poCache = psATInfo->apoGridCache[bDstToSrc ? 1 : 0];
+    if (poCache == nullptr)
+        poCache = new ApproxTransformGridCache();
+    constexpr size_t MAX_CACHED_NODES = 1024 * 1024;
+    if (poCache->dfZ != z[0] || poCache->oMapNodes.size() > MAX_CACHED_NODES)
+    {
+        poCache->Clear();
+        poCache->dfZ = z[0];
+    }
+
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    std::vector<double> adfZ;
+    std::vector<int> anSuccess;
+    const auto TransformPoints = [psATInfo, bDstToSrc, &adfX, &adfY, &adfZ,
+                                  &anSuccess]()
+    {
+        const int nCount = static_cast<int>(adfX.size());
+        anSuccess.resize(nCount);
+        if (!psATInfo->pfnBaseTransformer(psATInfo->pBaseCBData, bDstToSrc,
+                                          nCount, adfX.data(), adfY.data(),
+                                          adfZ.data(), anSuccess.data()))
+        {
+            std::fill(anSuccess.begin(), anSuccess.end(), FALSE);
+        }
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Exactly transform the grid nodes surrounding the line that      */
+    /*      are not yet in the cache.                                       */
+    /* -------------------------------------------------------------------- */
+    std::vector<GIntBig> anKeys;
+    for (int jj = j; jj <= j + 1; ++jj)
+    {
+        for (int i = iMin; i <= iMax + 1; ++i)
+        {
+            const GIntBig nKey = GetGridKey(i, jj);
+            if (poCache->oMapNodes.find(nKey) == poCache->oMapNodes.end())
+            {
+                anKeys.push_back(nKey);
+                adfX.push_back(i * dfGridSize);
+                adfY.push_back(jj * dfGridSize);
+                adfZ.push_back(z[0]);
+            }
+        }
+    }
+    if (!anKeys.empty())
+    {
+        TransformPoints();
+        for (size_t k = 0; k < anKeys.size(); ++k)
+        {
+            auto &oNode = poCache->oMapNodes[anKeys[k]];
+            oNode.x = adfX[k];
+            oNode.y = adfY[k];
+            oNode.z = adfZ[k];
+            oNode.bSuccess = anSuccess[k] != FALSE;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Check the bilinear interpolation error at the center and the    */
+    /*      middle of the edges of the cells not yet evaluated.             */
+    /* -------------------------------------------------------------------- */
+    constexpr int N_CHECK_POINTS = 5;
+    static const double adfCheckPoints[N_CHECK_POINTS][2] = {
+        {0.5, 0.5}, {0.5, 0.0}, {0.5, 1.0}, {0.0, 0.5}, {1.0, 0.5}};
+
+    std::vector<int> anCellsToCheck;
+    adfX.clear();
+    adfY.clear();
+    adfZ.clear();
+    for (int i = iMin; i <= iMax; ++i)
+    {
+        const GIntBig nKey = GetGridKey(i, j);
+        if (poCache->oMapCellOK.find(nKey) != poCache->oMapCellOK.end())
+            continue;
+        if (!poCache->oMapNodes[GetGridKey(i, j)].bSuccess ||
+            !poCache->oMapNodes[GetGridKey(i + 1, j)].bSuccess ||
+            !poCache->oMapNodes[GetGridKey(i, j + 1)].bSuccess ||
+            !poCache->oMapNodes[GetGridKey(i + 1, j + 1)].bSuccess)
+        {
+            poCache->oMapCellOK[nKey] = false;
+            continue;
+        }
+        anCellsToCheck.push_back(i);
+        for (const auto &adfCheckPoint : adfCheckPoints)
+        {
+            adfX.push_back((i + adfCheckPoint[0]) * dfGridSize);
+            adfY.push_back((j + adfCheckPoint[1]) * dfGridSize);
+            adfZ.push_back(z[0]);
+        }
+    }
+    if (!anCellsToCheck.empty())
+    {
+        TransformPoints();
+        for (size_t iCell = 0; iCell < anCellsToCheck.size(); ++iCell)
+        {
+            const int i = anCellsToCheck[iCell];
+            const auto &oUL = poCache->oMapNodes[GetGridKey(i, j)];
+            const auto &oUR = poCache->oMapNodes[GetGridKey(i + 1, j)];
+            const auto &oLL = poCache->oMapNodes[GetGridKey(i, j + 1)];
+            const auto &oLR = poCache->oMapNodes[GetGridKey(i + 1, j + 1)];
+            bool bOK = true;
+            for (int iPt = 0; bOK && iPt < N_CHECK_POINTS; ++iPt)
+            {
+                const size_t nIdx = iCell * N_CHECK_POINTS + iPt;
+                const double u = adfCheckPoints[iPt][0];
+                const double v = adfCheckPoints[iPt][1];
+                const double dfInterpX =
+                    (1 - v) * ((1 - u) * oUL.x + u * oUR.x) +
+                    v * ((1 - u) * oLL.x + u * oLR.x);
+                const double dfInterpY =
+                    (1 - v) * ((1 - u) * oUL.y + u * oUR.y) +
+                    v * ((1 - u) * oLL.y + u * oLR.y);
+                const double dfError = std::fabs(dfInterpX - adfX[nIdx]) +
+                                       std::fabs(dfInterpY - adfY[nIdx]);
+                bOK = anSuccess[nIdx] && dfError <= dfMaxError;
+            }
+            poCache->oMapCellOK[GetGridKey(i, j)] = bOK;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Interpolate the points, by runs of points in the same cell.     */
+    /* -------------------------------------------------------------------- */
+    int bRet = TRUE;
+    for (int k = 0; k < nPoints;)
+    {
+        const int i = anCol[k];
+        int kEnd = k + 1;
+        while (kEnd < nPoints && anCol[kEnd] == i)
+            ++kEnd;
+
+        if (!poCache->oMapCellOK[GetGridKey(i, j)])
+        {
+            if (!GDALApproxTransformScanline(psATInfo, bDstToSrc, kEnd - k,
+                                             x + k, y + k, z + k,
+                                             panSuccess + k))
+            {
+                bRet = FALSE;
+            }
+            k = kEnd;
+            continue;
+        }
+
+        const auto &oUL = poCache->oMapNodes[GetGridKey(i, j)];
+        const auto &oUR = poCache->oMapNodes[GetGridKey(i + 1, j)];
+        const auto &oLL = poCache->oMapNodes[GetGridKey(i, j + 1)];
+        const auto &oLR = poCache->oMapNodes[GetGridKey(i + 1, j + 1)];
+
+        // Interpolate along the vertical edges of the cell, so that only
+        // a linear interpolation along the line remains.
+        const double dfXLeft = oUL.x + dfFracY * (oLL.x - oUL.x);
+        const double dfYLeft = oUL.y + dfFracY * (oLL.y - oUL.y);
+        const double dfZLeft = oUL.z + dfFracY * (oLL.z - oUL.z);
+        const double dfXSlope = oUR.x + dfFracY * (oLR.x - oUR.x) - dfXLeft;
+        const double dfYSlope = oUR.y + dfFracY * (oLR.y - oUR.y) - dfYLeft;
+        const double dfZSlope = oUR.z + dfFracY * (oLR.z - oUR.z) - dfZLeft;
+        const double dfCol = i;
+
+        const auto xLeft = XMMReg2Double::Load1ValHighAndLow(&dfXLeft);
+        const auto yLeft = XMMReg2Double::Load1ValHighAndLow(&dfYLeft);
+        const auto zLeft = XMMReg2Double::Load1ValHighAndLow(&dfZLeft);
+        const auto xSlope = XMMReg2Double::Load1ValHighAndLow(&dfXSlope);
+        const auto ySlope = XMMReg2Double::Load1ValHighAndLow(&dfYSlope);
+        const auto zSlope = XMMReg2Double::Load1ValHighAndLow(&dfZSlope);
+        const auto invGridSize =
+            XMMReg2Double::Load1ValHighAndLow(&dfInvGridSize);
+        const auto col = XMMReg2Double::Load1ValHighAndLow(&dfCol);
+
+        int kk = k;
+        for (; kk + 1 < kEnd; kk += 2)
+        {
+            const auto u = XMMReg2Double::Load2Val(x + kk) * invGridSize - col;
+            (xLeft + u * xSlope).Store2Val(x + kk);
+            (yLeft + u * ySlope).Store2Val(y + kk);
+            (zLeft + u * zSlope).Store2Val(z + kk);
+        }
+        for (; kk < kEnd; ++kk)
+        {
+            const double u = x[kk] * dfInvGridSize - dfCol;
+            x[kk] = dfXLeft + u * dfXSlope;
+            y[kk] = dfYLeft + u * dfYSlope;
+            z[kk] = dfZLeft + u * dfZSlope;
+        }
+        for (kk = k; kk < kEnd; ++kk)
+            panSuccess[kk] = TRUE;
+
+        k = kEnd;
+    }
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                        GDALApproxTransform()                         */
+/************************************************************************/
+
+/**
+ * Perform approximate transformation.
+ *
+ * Actually performs the approximate transformation described in
+ * GDALCreateApproxTransformer().  This function matches the
+ * GDALTransformerFunc() signature.  Details of the arguments are described
+ * there.
+ */
+
+int GDALApproxTransform(void *pCBData, int bDstToSrc, int nPoints, double *x,
+                        double *y, double *z, int *panSuccess)
+
+{
+    ApproxTransformInfo *psATInfo = static_cast<ApproxTransformInfo *>(pCBData);
+
+    if (psATInfo->dfGridSize > 0)
+    {
+        const int nRet = GDALApproxTransformWithGrid(
+            psATInfo, bDstToSrc, nPoints, x, y, z, panSuccess);
+        if (nRet >= 0)
+            return nRet;
+    }
+
+    return GDALApproxTransformScanline(pCBData, bDstToSrc, nPoints, x, y, z,
+                                       panSuccess);
+}
+
 /************************************************************************/
 /*                  GDALDeserializeApproxTransformer()                  */
 /************************************************************************/
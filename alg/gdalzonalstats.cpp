@@ -0,0 +1,924 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Zonal statistics of a raster band over the polygons of a layer.
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdal_alg.h"
+#include "gdal_alg_priv.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_progress.h"
+#include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "ogrsf_frmts.h"
+
+namespace
+{
+// Rings of a zone polygon, in pixel/line coordinates of the raster, and the
+// pixel extent of the zone, clipped to the raster.
+struct GDALZonalStatsZone
+{
+    std::vector<double> aPointX{};
+    std::vector<double> aPointY{};
+    std::vector<int> aPartSize{};
+    int nXMin = 0;
+    int nYMin = 0;
+    int nXMax = -1;
+    int nYMax = -1;
+};
+
+// A zone intersecting a processing window. When the zone spans several
+// windows, its rings are clipped to the window, so that each window only
+// rasterizes the part of the zone that is close to it.
+struct GDALZonalStatsWindowZone
+{
+    int iZone = 0;
+    bool bClipped = false;
+    GDALZonalStatsZone oClippedZone{};
+};
+
+struct GDALZonalStatsAccumulator
+{
+    GUIntBig nCount = 0;
+    double dfSum = 0;
+    double dfMin = std::numeric_limits<double>::infinity();
+    double dfMax = -std::numeric_limits<double>::infinity();
+    std::vector<GUIntBig> anHistogram{};
+
+    void Merge(const GDALZonalStatsAccumulator &oOther)
+    {
+        if (oOther.nCount == 0)
+            return;
+        nCount += oOther.nCount;
+        dfSum += oOther.dfSum;
+        dfMin = std::min(dfMin, oOther.dfMin);
+        dfMax = std::max(dfMax, oOther.dfMax);
+        for (size_t i = 0; i < anHistogram.size(); ++i)
+            anHistogram[i] += oOther.anHistogram[i];
+    }
+};
+
+struct GDALZonalStatsHistogramParams
+{
+    int nBuckets = 0;
+    double dfMin = 0;
+    double dfMax = 0;
+};
+
+// Accumulation of the statistics of the zones intersecting a window of the
+// raster, whose values have been read in adfValues.
+struct GDALZonalStatsWindowJob
+{
+    const std::vector<GDALZonalStatsZone> *paoZones = nullptr;
+    const std::vector<GDALZonalStatsWindowZone> *paoWindowZones = nullptr;
+    const GDALZonalStatsHistogramParams *psHistParams = nullptr;
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    bool bAllTouched = false;
+    std::vector<double> adfValues{};
+    std::vector<GByte> abyMask{};  // empty if all pixels are valid
+    std::vector<GDALZonalStatsAccumulator> aoStats{};
+    std::atomic<bool> bDone{false};
+};
+
+// Area of a window covered by a zone. The rasterizer is run on that area
+// only, so the coverage is limited to the extent of the zone.
+struct GDALZonalStatsCoverage
+{
+    GByte *pabyCoverage = nullptr;
+    int nXSize = 0;
+    int nYSize = 0;
+};
+}  // namespace
+
+/************************************************************************/
+/*                    GDALZonalStatsBurnScanline()                      */
+/************************************************************************/
+
+static void GDALZonalStatsBurnScanline(void *pCBData, int nY, int nXStart,
+                                       int nXEnd, double /* dfVariant */)
+{
+    const auto psCoverage = static_cast<GDALZonalStatsCoverage *>(pCBData);
+    if (nY < 0 || nY >= psCoverage->nYSize)
+        return;
+    nXStart = std::max(nXStart, 0);
+    nXEnd = std::min(nXEnd, psCoverage->nXSize - 1);
+    if (nXStart > nXEnd)
+        return;
+    memset(psCoverage->pabyCoverage +
+               static_cast<size_t>(nY) * psCoverage->nXSize + nXStart,
+           1, nXEnd - nXStart + 1);
+}
+
+/************************************************************************/
+/*                      GDALZonalStatsBurnPoint()                       */
+/************************************************************************/
+
+static void GDALZonalStatsBurnPoint(void *pCBData, int nY, int nX,
+                                    double /* dfVariant */)
+{
+    const auto psCoverage = static_cast<GDALZonalStatsCoverage *>(pCBData);
+    if (nY >= 0 && nY < psCoverage->nYSize && nX >= 0 &&
+        nX < psCoverage->nXSize)
+    {
+        psCoverage->pabyCoverage[static_cast<size_t>(nY) *
+                                     psCoverage->nXSize +
+                                 nX] = 1;
+    }
+}
+
+/************************************************************************/
+/*                    GDALZonalStatsClipRingToLimit()                   */
+/************************************************************************/
+
+// One Sutherland-Hodgman pass: clips a ring to the half-plane where the X
+// (bAlongX) or Y coordinate is >= dfLimit (bKeepAbove) or <= dfLimit.
+static void GDALZonalStatsClipRingToLimit(const std::vector<double> &adfInX,
+                                          const std::vector<double> &adfInY,
+                                          bool bAlongX, double dfLimit,
+                                          bool bKeepAbove,
+                                          std::vector<double> &adfOutX,
+                                          std::vector<double> &adfOutY)
+{
+    adfOutX.clear();
+    adfOutY.clear();
+    const auto &adfCoord = bAlongX ? adfInX : adfInY;
+    const auto IsInside = [&adfCoord, dfLimit, bKeepAbove](size_t i)
+    { return bKeepAbove ? adfCoord[i] >= dfLimit : adfCoord[i] <= dfLimit; };
+
+    const size_t nPoints = adfInX.size();
+    if (nPoints == 0)
+        return;
+    size_t iPrev = nPoints - 1;
+    bool bPrevInside = IsInside(iPrev);
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        const bool bInside = IsInside(i);
+        if (bInside != bPrevInside)
+        {
+            const double dfRatio =
+                (dfLimit - adfCoord[iPrev]) / (adfCoord[i] - adfCoord[iPrev]);
+            const double dfX =
+                adfInX[iPrev] + dfRatio * (adfInX[i] - adfInX[iPrev]);
+            const double dfY =
+                adfInY[iPrev] + dfRatio * (adfInY[i] - adfInY[iPrev]);
+            adfOutX.push_back(bAlongX ? dfLimit : dfX);
+            adfOutY.push_back(bAlongX ? dfY : dfLimit);
+        }
+        if (bInside)
+        {
+            adfOutX.push_back(adfInX[i]);
+            adfOutY.push_back(adfInY[i]);
+        }
+        iPrev = i;
+        bPrevInside = bInside;
+    }
+}
+
+/************************************************************************/
+/*                      GDALZonalStatsClipRings()                       */
+/************************************************************************/
+
+// Clips the rings of a zone to dfMin <= X <= dfMax (bAlongX) or to
+// dfMin <= Y <= dfMax. Each ring is clipped independently, which preserves
+// the even-odd filling of the zone inside of the clipping band. Rings that
+// do not intersect the band are dropped.
+static void GDALZonalStatsClipRings(const GDALZonalStatsZone &oSrc,
+                                    bool bAlongX, double dfMin, double dfMax,
+                                    GDALZonalStatsZone &oDst)
+{
+    oDst.aPointX.clear();
+    oDst.aPointY.clear();
+    oDst.aPartSize.clear();
+    oDst.nXMin = oSrc.nXMin;
+    oDst.nYMin = oSrc.nYMin;
+    oDst.nXMax = oSrc.nXMax;
+    oDst.nYMax = oSrc.nYMax;
+
+    std::vector<double> adfRingX;
+    std::vector<double> adfRingY;
+    std::vector<double> adfTmpX;
+    std::vector<double> adfTmpY;
+    size_t iStart = 0;
+    for (const int nPartSize : oSrc.aPartSize)
+    {
+        const size_t iEnd = iStart + nPartSize;
+        adfRingX.assign(oSrc.aPointX.begin() + iStart,
+                        oSrc.aPointX.begin() + iEnd);
+        adfRingY.assign(oSrc.aPointY.begin() + iStart,
+                        oSrc.aPointY.begin() + iEnd);
+        iStart = iEnd;
+        // The closing point is added back after clipping
+        if (adfRingX.size() > 1 && adfRingX.front() == adfRingX.back() &&
+            adfRingY.front() == adfRingY.back())
+        {
+            adfRingX.pop_back();
+            adfRingY.pop_back();
+        }
+
+        GDALZonalStatsClipRingToLimit(adfRingX, adfRingY, bAlongX, dfMin,
+                                      true, adfTmpX, adfTmpY);
+        GDALZonalStatsClipRingToLimit(adfTmpX, adfTmpY, bAlongX, dfMax, false,
+                                      adfRingX, adfRingY);
+        if (adfRingX.size() < 3)
+            continue;
+
+        oDst.aPointX.insert(oDst.aPointX.end(), adfRingX.begin(),
+                            adfRingX.end());
+        oDst.aPointY.insert(oDst.aPointY.end(), adfRingY.begin(),
+                            adfRingY.end());
+        oDst.aPointX.push_back(adfRingX.front());
+        oDst.aPointY.push_back(adfRingY.front());
+        oDst.aPartSize.push_back(static_cast<int>(adfRingX.size()) + 1);
+    }
+}
+
+/************************************************************************/
+/*                      GDALZonalStatsWindowFunc()                      */
+/************************************************************************/
+
+static void GDALZonalStatsWindowFunc(void *pData)
+{
+    auto psJob = static_cast<GDALZonalStatsWindowJob *>(pData);
+    const auto psHistParams = psJob->psHistParams;
+    const double dfHistScale =
+        psHistParams->nBuckets > 0
+            ? psHistParams->nBuckets /
+                  (psHistParams->dfMax - psHistParams->dfMin)
+            : 0.0;
+
+    std::vector<GByte> abyCoverage;
+    std::vector<double> aPointX;
+    std::vector<double> aPointY;
+    psJob->aoStats.resize(psJob->paoWindowZones->size());
+    for (size_t iZone = 0; iZone < psJob->paoWindowZones->size(); ++iZone)
+    {
+        const auto &oWindowZone = (*psJob->paoWindowZones)[iZone];
+        const auto &oZone = oWindowZone.bClipped
+                                ? oWindowZone.oClippedZone
+                                : (*psJob->paoZones)[oWindowZone.iZone];
+        auto &oStats = psJob->aoStats[iZone];
+        oStats.anHistogram.resize(psHistParams->nBuckets);
+
+        // Intersection of the extent of the zone with the window
+        const int nCovXOff = std::max(oZone.nXMin, psJob->nXOff);
+        const int nCovYOff = std::max(oZone.nYMin, psJob->nYOff);
+        const int nCovXEnd =
+            std::min(oZone.nXMax + 1, psJob->nXOff + psJob->nXSize);
+        const int nCovYEnd =
+            std::min(oZone.nYMax + 1, psJob->nYOff + psJob->nYSize);
+        if (nCovXOff >= nCovXEnd || nCovYOff >= nCovYEnd)
+            continue;
+
+        GDALZonalStatsCoverage sCoverage;
+        sCoverage.nXSize = nCovXEnd - nCovXOff;
+        sCoverage.nYSize = nCovYEnd - nCovYOff;
+        abyCoverage.assign(
+            static_cast<size_t>(sCoverage.nXSize) * sCoverage.nYSize, 0);
+        sCoverage.pabyCoverage = abyCoverage.data();
+
+        aPointX.resize(oZone.aPointX.size());
+        aPointY.resize(oZone.aPointY.size());
+        for (size_t i = 0; i < aPointX.size(); ++i)
+        {
+            aPointX[i] = oZone.aPointX[i] - nCovXOff;
+            aPointY[i] = oZone.aPointY[i] - nCovYOff;
+        }
+
+        // Pixels are burnt in a coverage mask rather than accumulated
+        // directly, so that a pixel touched by several parts or edges of the
+        // zone is only counted once.
+        const int nPartCount = static_cast<int>(oZone.aPartSize.size());
+        GDALdllImageFilledPolygon(
+            sCoverage.nXSize, sCoverage.nYSize, nPartCount,
+            oZone.aPartSize.data(), aPointX.data(), aPointY.data(), nullptr,
+            GDALZonalStatsBurnScanline, &sCoverage);
+        if (psJob->bAllTouched)
+        {
+            GDALdllImageLineAllTouched(
+                sCoverage.nXSize, sCoverage.nYSize, nPartCount,
+                oZone.aPartSize.data(), aPointX.data(), aPointY.data(),
+                nullptr, GDALZonalStatsBurnPoint, &sCoverage, false, true);
+        }
+
+        for (int iY = 0; iY < sCoverage.nYSize; ++iY)
+        {
+            const GByte *pabyCoverageLine =
+                abyCoverage.data() + static_cast<size_t>(iY) * sCoverage.nXSize;
+            const size_t nWindowLineOff =
+                static_cast<size_t>(nCovYOff - psJob->nYOff + iY) *
+                    psJob->nXSize +
+                (nCovXOff - psJob->nXOff);
+            for (int iX = 0; iX < sCoverage.nXSize; ++iX)
+            {
+                if (!pabyCoverageLine[iX])
+                    continue;
+                const size_t nIdx = nWindowLineOff + iX;
+                if (!psJob->abyMask.empty() && !psJob->abyMask[nIdx])
+                    continue;
+                const double dfValue = psJob->adfValues[nIdx];
+                if (std::isnan(dfValue))
+                    continue;
+                oStats.nCount++;
+                oStats.dfSum += dfValue;
+                oStats.dfMin = std::min(oStats.dfMin, dfValue);
+                oStats.dfMax = std::max(oStats.dfMax, dfValue);
+                if (psHistParams->nBuckets > 0 &&
+                    dfValue >= psHistParams->dfMin &&
+                    dfValue <= psHistParams->dfMax)
+                {
+                    const int iBucket = std::min(
+                        psHistParams->nBuckets - 1,
+                        static_cast<int>((dfValue - psHistParams->dfMin) *
+                                         dfHistScale));
+                    oStats.anHistogram[iBucket]++;
+                }
+            }
+        }
+    }
+
+    psJob->bDone = true;
+}
+
+/************************************************************************/
+/*                      GDALZonalStatsCreateField()                     */
+/************************************************************************/
+
+// Returns the index of the field of the output layer, creating it if needed,
+// or -1 in case of error.
+static int GDALZonalStatsCreateField(OGRLayer *poDstLayer, const char *pszName,
+                                     OGRFieldType eType)
+{
+    OGRFeatureDefn *poDefn = poDstLayer->GetLayerDefn();
+    const int iField = poDefn->GetFieldIndex(pszName);
+    if (iField >= 0)
+        return iField;
+    OGRFieldDefn oFieldDefn(pszName, eType);
+    if (poDstLayer->CreateField(&oFieldDefn) != OGRERR_NONE)
+        return -1;
+    return poDstLayer->GetLayerDefn()->GetFieldCount() - 1;
+}
+
+/************************************************************************/
+/*                        GDALZonalStatistics()                         */
+/************************************************************************/
+
+/**
+ * Compute statistics of the pixel values of a raster band inside each
+ * polygon of a layer.
+ *
+ * The geometries of the zone layer are transformed to the pixel/line space of
+ * the raster, reprojecting them if the layer and the raster have different
+ * spatial reference systems. The raster is then read only once, by windows
+ * made of whole blocks, skipping windows that do not intersect any zone. The
+ * polygons intersecting each window are burnt into a coverage mask with the
+ * same scanline rasterizer as GDALRasterizeGeometries(), and the statistics
+ * of the covered pixels are accumulated per zone. Windows are processed in
+ * parallel by worker threads, while the main thread reads the next ones.
+ *
+ * Pixels that are masked by the mask band of hSrcBand (for example nodata
+ * pixels), and NaN pixels, are ignored. Non-polygonal geometries are ignored.
+ *
+ * One feature is written to hDstLayer for each feature of hZoneLayer, in the
+ * same order. Its fields, and its geometry, are copied from the zone feature
+ * for the fields that have the same name in the output layer. The following
+ * fields are created in hDstLayer if they do not exist yet:
+ * <ul>
+ * <li>"count" (Integer64): number of valid pixels of the zone.</li>
+ * <li>"sum", "mean", "min", "max" (Real): statistics of the valid pixels.
+ * They are null, except sum, if the zone has no valid pixel.</li>
+ * <li>"histogram" (Integer64List): only if the HISTOGRAM_BUCKETS option is
+ * set.</li>
+ * </ul>
+ *
+ * Options:
+ * <ul>
+ * <li>ALL_TOUCHED=YES/NO: whether to include all pixels touched by the
+ * polygons, instead of only those whose center is within the polygons.
+ * Defaults to NO.</li>
+ * <li>HISTOGRAM_BUCKETS=n: number of buckets of the histogram to compute for
+ * each zone. Values outside of the [HISTOGRAM_MIN, HISTOGRAM_MAX] range are
+ * not counted in the histogram.</li>
+ * <li>HISTOGRAM_MIN=value and HISTOGRAM_MAX=value: lower bound of the first
+ * bucket and upper bound of the last bucket. Default to -0.5 and 255.5 for a
+ * Byte band, and must be specified for other data types.</li>
+ * <li>NUM_THREADS=number|ALL_CPUS: number of threads to use. If not set, the
+ * GDAL_NUM_THREADS configuration option is used, and otherwise 1.</li>
+ * </ul>
+ *
+ * @param hSrcBand the raster band whose values are summarized. Its dataset
+ * must be georeferenced.
+ * @param hZoneLayer the layer with the zone polygons.
+ * @param hDstLayer the layer to which to write the zone features with their
+ * statistics. It may not be hZoneLayer.
+ * @param papszOptions the options described above, or NULL.
+ * @param pfnProgress the progress function to report completion, or NULL.
+ * @param pProgressArg callback data for progress function.
+ *
+ * @return CE_None on success or CE_Failure on error.
+ *
+ * @since GDAL 3.7
+ */
+
+CPLErr GDALZonalStatistics(GDALRasterBandH hSrcBand, OGRLayerH hZoneLayer,
+                           OGRLayerH hDstLayer, CSLConstList papszOptions,
+                           GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    VALIDATE_POINTER1(hSrcBand, "GDALZonalStatistics", CE_Failure);
+    VALIDATE_POINTER1(hZoneLayer, "GDALZonalStatistics", CE_Failure);
+    VALIDATE_POINTER1(hDstLayer, "GDALZonalStatistics", CE_Failure);
+
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hSrcBand);
+    OGRLayer *poZoneLayer = OGRLayer::FromHandle(hZoneLayer);
+    OGRLayer *poDstLayer = OGRLayer::FromHandle(hDstLayer);
+    GDALDataset *poDS = poBand->GetDataset();
+    if (poDS == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GDALZonalStatistics(): band must belong to a dataset");
+        return CE_Failure;
+    }
+    if (poZoneLayer == poDstLayer)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GDALZonalStatistics(): output layer must be different from "
+                 "zone layer");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Options                                                         */
+    /* -------------------------------------------------------------------- */
+    const bool bAllTouched = CPLFetchBool(papszOptions, "ALL_TOUCHED", false);
+
+    GDALZonalStatsHistogramParams sHistParams;
+    sHistParams.nBuckets =
+        atoi(CSLFetchNameValueDef(papszOptions, "HISTOGRAM_BUCKETS", "0"));
+    if (sHistParams.nBuckets < 0 || sHistParams.nBuckets > 1000000)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "Invalid value for HISTOGRAM_BUCKETS");
+        return CE_Failure;
+    }
+    if (sHistParams.nBuckets > 0)
+    {
+        const char *pszHistMin =
+            CSLFetchNameValue(papszOptions, "HISTOGRAM_MIN");
+        const char *pszHistMax =
+            CSLFetchNameValue(papszOptions, "HISTOGRAM_MAX");
+        if (pszHistMin != nullptr && pszHistMax != nullptr)
+        {
+            sHistParams.dfMin = CPLAtof(pszHistMin);
+            sHistParams.dfMax = CPLAtof(pszHistMax);
+        }
+        else if (pszHistMin == nullptr && pszHistMax == nullptr &&
+                 poBand->GetRasterDataType() == GDT_Byte)
+        {
+            sHistParams.dfMin = -0.5;
+            sHistParams.dfMax = 255.5;
+        }
+        else
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "HISTOGRAM_MIN and HISTOGRAM_MAX must be specified");
+            return CE_Failure;
+        }
+        if (!(sHistParams.dfMax > sHistParams.dfMin))
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "HISTOGRAM_MAX must be greater than HISTOGRAM_MIN");
+            return CE_Failure;
+        }
+    }
+
+    const int nThreads = GDALGetNumThreads(papszOptions, "NUM_THREADS");
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Create the output fields.                                       */
+    /* -------------------------------------------------------------------- */
+    const int iCountField =
+        GDALZonalStatsCreateField(poDstLayer, "count", OFTInteger64);
+    const int iSumField = GDALZonalStatsCreateField(poDstLayer, "sum", OFTReal);
+    const int iMeanField =
+        GDALZonalStatsCreateField(poDstLayer, "mean", OFTReal);
+    const int iMinField = GDALZonalStatsCreateField(poDstLayer, "min", OFTReal);
+    const int iMaxField = GDALZonalStatsCreateField(poDstLayer, "max", OFTReal);
+    const int iHistogramField =
+        sHistParams.nBuckets > 0
+            ? GDALZonalStatsCreateField(poDstLayer, "histogram",
+                                        OFTInteger64List)
+            : 0;
+    if (iCountField < 0 || iSumField < 0 || iMeanField < 0 || iMinField < 0 ||
+        iMaxField < 0 || iHistogramField < 0)
+    {
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the zones, and transform them to pixel/line coordinates.   */
+    /* -------------------------------------------------------------------- */
+    pfnProgress(0.0, nullptr, pProgressArg);
+
+    void *pTransformArg =
+        GDALRasterizeCreateLayerTransformer(poDS, poZoneLayer);
+    if (pTransformArg == nullptr)
+        return CE_Failure;
+
+    const int nXSize = poBand->GetXSize();
+    const int nYSize = poBand->GetYSize();
+    std::vector<GDALZonalStatsZone> aoZones;
+    std::vector<double> aPointVariant;
+    bool bWarnedNonPolygon = false;
+    poZoneLayer->ResetReading();
+    for (auto &poFeature : poZoneLayer)
+    {
+        GDALZonalStatsZone oZone;
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        std::unique_ptr<OGRGeometry> poLinearGeom;
+        if (poGeom != nullptr && poGeom->hasCurveGeometry())
+        {
+            poLinearGeom.reset(poGeom->getLinearGeometry());
+            poGeom = poLinearGeom.get();
+        }
+        if (poGeom != nullptr && !poGeom->IsEmpty())
+        {
+            const auto eFlatType = wkbFlatten(poGeom->getGeometryType());
+            if (eFlatType == wkbPolygon || eFlatType == wkbMultiPolygon)
+            {
+                GDALCollectRingsFromGeometry(poGeom, oZone.aPointX,
+                                             oZone.aPointY, aPointVariant,
+                                             oZone.aPartSize,
+                                             GBV_UserBurnValue);
+            }
+            else if (!bWarnedNonPolygon)
+            {
+                bWarnedNonPolygon = true;
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Non-polygonal geometries of layer %s are ignored",
+                         poZoneLayer->GetName());
+            }
+        }
+
+        if (!oZone.aPointX.empty())
+        {
+            std::vector<int> anSuccess(oZone.aPointX.size());
+            GDALGenImgProjTransform(pTransformArg, FALSE,
+                                    static_cast<int>(oZone.aPointX.size()),
+                                    oZone.aPointX.data(), oZone.aPointY.data(),
+                                    nullptr, anSuccess.data());
+
+            // Pixel extent, enlarged by one pixel to be on the safe side
+            // regarding ALL_TOUCHED=YES.
+            const auto oMinMaxX = std::minmax_element(oZone.aPointX.begin(),
+                                                      oZone.aPointX.end());
+            const auto oMinMaxY = std::minmax_element(oZone.aPointY.begin(),
+                                                      oZone.aPointY.end());
+            const double dfMinX = std::floor(*oMinMaxX.first) - 1;
+            const double dfMaxX = std::floor(*oMinMaxX.second) + 1;
+            const double dfMinY = std::floor(*oMinMaxY.first) - 1;
+            const double dfMaxY = std::floor(*oMinMaxY.second) + 1;
+            if (dfMaxX >= 0 && dfMinX < nXSize && dfMaxY >= 0 &&
+                dfMinY < nYSize)
+            {
+                oZone.nXMin = static_cast<int>(std::max(0.0, dfMinX));
+                oZone.nXMax = static_cast<int>(std::min(nXSize - 1.0, dfMaxX));
+                oZone.nYMin = static_cast<int>(std::max(0.0, dfMinY));
+                oZone.nYMax = static_cast<int>(std::min(nYSize - 1.0, dfMaxY));
+            }
+            else
+            {
+                // Outside of the raster (or invalid coordinates)
+                oZone = GDALZonalStatsZone();
+            }
+        }
+        aoZones.emplace_back(std::move(oZone));
+    }
+    GDALDestroyTransformer(pTransformArg);
+
+    /* -------------------------------------------------------------------- */
+    /*      Establish the processing windows, made of whole blocks, and     */
+    /*      bin the zones into the windows intersecting their extent.       */
+    /* -------------------------------------------------------------------- */
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    constexpr int MAX_WINDOW_PIXELS = 1024 * 1024;
+    int nWinXSize =
+        std::min(nXSize, nBlockXSize * std::max(1, 512 / nBlockXSize));
+    int nWinYSize =
+        std::min(nYSize, nBlockYSize * std::max(1, 512 / nBlockYSize));
+    if (static_cast<GIntBig>(nWinXSize) * nWinYSize > MAX_WINDOW_PIXELS)
+    {
+        nWinYSize = std::max(1, MAX_WINDOW_PIXELS / nWinXSize);
+        if (nWinYSize > nBlockYSize)
+            nWinYSize = nWinYSize / nBlockYSize * nBlockYSize;
+    }
+    const int nWinsX = DIV_ROUND_UP(nXSize, nWinXSize);
+    const int nWinsY = DIV_ROUND_UP(nYSize, nWinYSize);
+    CPLDebug("GDAL", "Zonal statistics operating on windows of %dx%d pixels",
+             nWinXSize, nWinYSize);
+
+    // The rings of zones spanning several windows are clipped to each row
+    // of windows, and then to each window of the row. The clipping area is
+    // enlarged by a margin, so that the edges created by the clipping do not
+    // touch the pixels of the window, even with ALL_TOUCHED=YES.
+    constexpr double CLIP_MARGIN = 2;
+    std::vector<std::vector<GDALZonalStatsWindowZone>> aaoWindowZones(
+        static_cast<size_t>(nWinsX) * nWinsY);
+    GDALZonalStatsZone oRowZone;
+    for (int iZone = 0; iZone < static_cast<int>(aoZones.size()); ++iZone)
+    {
+        const auto &oZone = aoZones[iZone];
+        // Empty, non-polygonal, or outside of the raster
+        if (oZone.nXMax < oZone.nXMin || oZone.nYMax < oZone.nYMin)
+            continue;
+
+        const int iWinXMin = oZone.nXMin / nWinXSize;
+        const int iWinXMax = oZone.nXMax / nWinXSize;
+        const int iWinYMin = oZone.nYMin / nWinYSize;
+        const int iWinYMax = oZone.nYMax / nWinYSize;
+        for (int iWinY = iWinYMin; iWinY <= iWinYMax; ++iWinY)
+        {
+            const GDALZonalStatsZone *poRowZone = &oZone;
+            if (iWinYMin != iWinYMax)
+            {
+                const double dfYOff = static_cast<double>(iWinY) * nWinYSize;
+                GDALZonalStatsClipRings(oZone, false, dfYOff - CLIP_MARGIN,
+                                        dfYOff + nWinYSize + CLIP_MARGIN,
+                                        oRowZone);
+                if (oRowZone.aPartSize.empty())
+                    continue;
+                poRowZone = &oRowZone;
+            }
+
+            for (int iWinX = iWinXMin; iWinX <= iWinXMax; ++iWinX)
+            {
+                GDALZonalStatsWindowZone oWindowZone;
+                oWindowZone.iZone = iZone;
+                if (iWinXMin != iWinXMax)
+                {
+                    const double dfXOff =
+                        static_cast<double>(iWinX) * nWinXSize;
+                    GDALZonalStatsClipRings(*poRowZone, true,
+                                            dfXOff - CLIP_MARGIN,
+                                            dfXOff + nWinXSize + CLIP_MARGIN,
+                                            oWindowZone.oClippedZone);
+                    if (oWindowZone.oClippedZone.aPartSize.empty())
+                        continue;
+                    oWindowZone.bClipped = true;
+                }
+                else if (poRowZone != &oZone)
+                {
+                    oWindowZone.oClippedZone = *poRowZone;
+                    oWindowZone.bClipped = true;
+                }
+                aaoWindowZones[static_cast<size_t>(iWinY) * nWinsX + iWinX]
+                    .emplace_back(std::move(oWindowZone));
+            }
+        }
+    }
+    const size_t nWindowsToProcess = static_cast<size_t>(std::count_if(
+        aaoWindowZones.begin(), aaoWindowZones.end(),
+        [](const std::vector<GDALZonalStatsWindowZone> &aoWindowZones)
+        { return !aoWindowZones.empty(); }));
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the windows, and accumulate their statistics.              */
+    /* -------------------------------------------------------------------- */
+    GDALRasterBand *poMaskBand = nullptr;
+    if (!(poBand->GetMaskFlags() & GMF_ALL_VALID))
+        poMaskBand = poBand->GetMaskBand();
+
+    std::vector<GDALZonalStatsAccumulator> aoZoneStats(aoZones.size());
+    for (auto &oStats : aoZoneStats)
+        oStats.anHistogram.resize(sHistParams.nBuckets);
+
+    // Windows are merged in the order they are read, so that the results do
+    // not depend on the number of threads.
+    std::deque<std::unique_ptr<GDALZonalStatsWindowJob>> apoPendingJobs;
+    const size_t nMaxPendingJobs = 2 * static_cast<size_t>(nThreads);
+    auto poJobQueue =
+        poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    CPLErr eErr = CE_None;
+    size_t nWindowsDone = 0;
+    const double dfProgressRatio = 0.95;
+    const auto MergeJob = [&](const GDALZonalStatsWindowJob &oJob)
+    {
+        for (size_t i = 0; i < oJob.paoWindowZones->size(); ++i)
+        {
+            aoZoneStats[(*oJob.paoWindowZones)[i].iZone].Merge(
+                oJob.aoStats[i]);
+        }
+        ++nWindowsDone;
+        if (eErr == CE_None &&
+            !pfnProgress(dfProgressRatio * nWindowsDone / nWindowsToProcess,
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    };
+
+    for (int iWinY = 0; iWinY < nWinsY && eErr == CE_None; ++iWinY)
+    {
+        for (int iWinX = 0; iWinX < nWinsX && eErr == CE_None; ++iWinX)
+        {
+            const auto &aoWindowZones =
+                aaoWindowZones[static_cast<size_t>(iWinY) * nWinsX + iWinX];
+            if (aoWindowZones.empty())
+                continue;
+
+            auto poJob = cpl::make_unique<GDALZonalStatsWindowJob>();
+            poJob->paoZones = &aoZones;
+            poJob->paoWindowZones = &aoWindowZones;
+            poJob->psHistParams = &sHistParams;
+            poJob->bAllTouched = bAllTouched;
+            poJob->nXOff = iWinX * nWinXSize;
+            poJob->nYOff = iWinY * nWinYSize;
+            poJob->nXSize = std::min(nWinXSize, nXSize - poJob->nXOff);
+            poJob->nYSize = std::min(nWinYSize, nYSize - poJob->nYOff);
+            const size_t nPixels =
+                static_cast<size_t>(poJob->nXSize) * poJob->nYSize;
+            try
+            {
+                poJob->adfValues.resize(nPixels);
+                if (poMaskBand)
+                    poJob->abyMask.resize(nPixels);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating window buffer");
+                eErr = CE_Failure;
+                break;
+            }
+
+            eErr = poBand->RasterIO(
+                GF_Read, poJob->nXOff, poJob->nYOff, poJob->nXSize,
+                poJob->nYSize, poJob->adfValues.data(), poJob->nXSize,
+                poJob->nYSize, GDT_Float64, 0, 0, nullptr);
+            if (eErr == CE_None && poMaskBand)
+            {
+                eErr = poMaskBand->RasterIO(
+                    GF_Read, poJob->nXOff, poJob->nYOff, poJob->nXSize,
+                    poJob->nYSize, poJob->abyMask.data(), poJob->nXSize,
+                    poJob->nYSize, GDT_Byte, 0, 0, nullptr);
+            }
+            if (eErr != CE_None)
+                break;
+
+            if (!poJobQueue)
+            {
+                GDALZonalStatsWindowFunc(poJob.get());
+                MergeJob(*poJob);
+                continue;
+            }
+
+            poJobQueue->SubmitJob(GDALZonalStatsWindowFunc, poJob.get());
+            apoPendingJobs.emplace_back(std::move(poJob));
+
+            // Merge the jobs that are completed, and limit the number of
+            // windows in memory.
+            while (!apoPendingJobs.empty())
+            {
+                if (!apoPendingJobs.front()->bDone)
+                {
+                    if (apoPendingJobs.size() <= nMaxPendingJobs)
+                        break;
+                    poJobQueue->GetPool()->WaitEvent();
+                    continue;
+                }
+                MergeJob(*apoPendingJobs.front());
+                apoPendingJobs.pop_front();
+            }
+        }
+    }
+
+    if (poJobQueue)
+    {
+        poJobQueue->WaitCompletion();
+        for (const auto &poJob : apoPendingJobs)
+            MergeJob(*poJob);
+        apoPendingJobs.clear();
+    }
+
+    if (eErr != CE_None)
+        return eErr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Write the output features.                                      */
+    /* -------------------------------------------------------------------- */
+    const bool bTransaction = poDstLayer->StartTransaction() == OGRERR_NONE;
+    size_t iZone = 0;
+    poZoneLayer->ResetReading();
+    for (auto &poFeature : poZoneLayer)
+    {
+        if (iZone == aoZoneStats.size())
+            break;
+        const auto &oStats = aoZoneStats[iZone];
+        ++iZone;
+
+        OGRFeature oDstFeature(poDstLayer->GetLayerDefn());
+        oDstFeature.SetFrom(poFeature.get(), TRUE);
+        oDstFeature.SetField(iCountField,
+                             static_cast<GIntBig>(oStats.nCount));
+        oDstFeature.SetField(iSumField, oStats.dfSum);
+        if (oStats.nCount > 0)
+        {
+            const double dfCount = static_cast<double>(oStats.nCount);
+            oDstFeature.SetField(iMeanField, oStats.dfSum / dfCount);
+            oDstFeature.SetField(iMinField, oStats.dfMin);
+            oDstFeature.SetField(iMaxField, oStats.dfMax);
+        }
+        else
+        {
+            oDstFeature.SetFieldNull(iMeanField);
+            oDstFeature.SetFieldNull(iMinField);
+            oDstFeature.SetFieldNull(iMaxField);
+        }
+        if (sHistParams.nBuckets > 0)
+        {
+            std::vector<GIntBig> anHistogram(oStats.anHistogram.begin(),
+                                             oStats.anHistogram.end());
+            oDstFeature.SetField(iHistogramField,
+                                 static_cast<int>(anHistogram.size()),
+                                 anHistogram.data());
+        }
+        if (poDstLayer->CreateFeature(&oDstFeature) != OGRERR_NONE)
+        {
+            eErr = CE_Failure;
+            break;
+        }
+
+        const double dfZoneRatio =
+            static_cast<double>(iZone) / aoZoneStats.size();
+        if (!pfnProgress(dfProgressRatio + (1 - dfProgressRatio) * dfZoneRatio,
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+            break;
+        }
+    }
+    if (bTransaction)
+    {
+        if (eErr == CE_None)
+        {
+            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+                eErr = CE_Failure;
+        }
+        else
+        {
+            poDstLayer->RollbackTransaction();
+        }
+    }
+
+    if (eErr == CE_None)
+        pfnProgress(1.0, "", pProgressArg);
+
+    return eErr;
+}
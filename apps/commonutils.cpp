@@ -31,11 +31,13 @@
 #include <cstdio>
 #include <cstring>
 
+#include <algorithm>
 #include <string>
 
 #include "cpl_conv.h"
 #include "cpl_string.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 /* -------------------------------------------------------------------- */
 /*                   DoesDriverHandleExtension()                        */
@@ -191,3 +193,107 @@ void EarlySetConfigOptions(int argc, char **argv)
         }
     }
 }
+
+/* -------------------------------------------------------------------- */
+/*                        GetNumThreadsFromArg()                        */
+/* -------------------------------------------------------------------- */
+
+/** Parse the value of a -num_threads argument (a number or ALL_CPUS).
+ * If pszValue is NULL, the GDAL_NUM_THREADS configuration option is used.
+ */
+int GetNumThreadsFromArg(const char *pszValue)
+{
+    CPLStringList aosOptions;
+    if (pszValue)
+        aosOptions.SetNameValue("NUM_THREADS", pszValue);
+    return GDALGetNumThreads(aosOptions.List(), "NUM_THREADS");
+}
+
+/* -------------------------------------------------------------------- */
+/*                        OpenDatasetsInParallel()                      */
+/* -------------------------------------------------------------------- */
+
+namespace
+{
+struct OpenDatasetJob
+{
+    const char *pszFilename = nullptr;
+    unsigned int nOpenFlags = 0;
+    const char *const *papszOpenOptions = nullptr;
+    OpenedDataset *psResult = nullptr;
+};
+}  // namespace
+
+static void OpenDatasetJobFunc(void *pData)
+{
+    auto psJob = static_cast<OpenDatasetJob *>(pData);
+    auto psResult = psJob->psResult;
+    // Errors are collected, to be emitted by the calling thread, through its
+    // own error handler and in the order of the input list.
+    CPLInstallErrorHandlerAccumulator(psResult->aoErrors);
+    psResult->hDS = GDALOpenEx(psJob->pszFilename, psJob->nOpenFlags, nullptr,
+                               psJob->papszOpenOptions, nullptr);
+    if (psResult->hDS && (psJob->nOpenFlags & GDAL_OF_RASTER) != 0)
+    {
+        // Some drivers fetch georeferencing lazily: do it now, while we
+        // are still in the worker thread.
+        double adfGeoTransform[6];
+        CPL_IGNORE_RET_VAL(
+            GDALGetGeoTransform(psResult->hDS, adfGeoTransform));
+        CPL_IGNORE_RET_VAL(GDALGetSpatialRef(psResult->hDS));
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/** Emit the errors collected while opening the dataset, and return the
+ * dataset handle, whose ownership is transferred to the caller.
+ */
+GDALDatasetH OpenedDataset::Release()
+{
+    for (const auto &oError : aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    aoErrors.clear();
+    GDALDatasetH hRet = hDS;
+    hDS = nullptr;
+    return hRet;
+}
+
+/** Open nCount datasets with GDALOpenEx() on nThreads worker threads of the
+ * global thread pool.
+ *
+ * Returned datasets are in the order of papszFilenames. Their handles (that
+ * may be NULL) are owned by the caller, and should be retrieved with
+ * OpenedDataset::Release(), which emits the errors raised while opening them.
+ * With nThreads <= 1, datasets are opened sequentially in the calling thread.
+ */
+std::vector<OpenedDataset>
+OpenDatasetsInParallel(const char *const *papszFilenames, int nCount,
+                       unsigned int nOpenFlags,
+                       const char *const *papszOpenOptions, int nThreads)
+{
+    std::vector<OpenedDataset> aoResults(nCount);
+    std::vector<OpenDatasetJob> asJobs(nCount);
+    for (int i = 0; i < nCount; ++i)
+    {
+        asJobs[i].pszFilename = papszFilenames[i];
+        asJobs[i].nOpenFlags = nOpenFlags;
+        asJobs[i].papszOpenOptions = papszOpenOptions;
+        asJobs[i].psResult = &aoResults[i];
+    }
+
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 && nCount > 1
+            ? GDALGetGlobalThreadPool(std::min(nThreads, nCount))
+            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    for (auto &sJob : asJobs)
+    {
+        if (!poJobQueue || !poJobQueue->SubmitJob(OpenDatasetJobFunc, &sJob))
+            OpenDatasetJobFunc(&sJob);
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    return aoResults;
+}
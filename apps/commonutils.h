@@ -90,13 +90,31 @@ CPL_C_END
 
 #ifdef __cplusplus
 
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
+#include "gdal.h"
 #include <vector>
 
 std::vector<CPLString> CPL_DLL GetOutputDriversFor(const char *pszDestFilename,
                                                    int nFlagRasterVector);
 CPLString CPL_DLL GetOutputDriverForRaster(const char *pszDestFilename);
 
+int CPL_DLL GetNumThreadsFromArg(const char *pszValue);
+
+/** Dataset opened by OpenDatasetsInParallel(), with the errors emitted while
+ * opening it. */
+struct CPL_DLL OpenedDataset
+{
+    GDALDatasetH hDS = nullptr;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+    GDALDatasetH Release();
+};
+
+std::vector<OpenedDataset> CPL_DLL OpenDatasetsInParallel(
+    const char *const *papszFilenames, int nCount, unsigned int nOpenFlags,
+    const char *const *papszOpenOptions, int nThreads);
+
 #endif /* __cplusplus */
 
 #endif /* COMMONUTILS_H_INCLUDED */
@@ -0,0 +1,336 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Utilities
+ * Purpose:  Zonal statistics of a raster band over the polygons of a layer.
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "gdal_version.h"
+#include "gdal.h"
+#include "gdal_alg.h"
+#include "ogr_api.h"
+#include "commonutils.h"
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+static void Usage(const char *pszErrorMsg = nullptr)
+
+{
+    printf("Usage: gdal_zonalstats [-b <band>] [-l <zone_layer>] "
+           "[-at]\n"
+           "                       [-hist <buckets> [-hist_min <min> "
+           "-hist_max <max>]]\n"
+           "                       [-nt <num_threads>|ALL_CPUS]\n"
+           "                       [-f <formatname>] [-nln <outlayername>]\n"
+           "                       [[-dsco NAME=VALUE] ...] "
+           "[[-lco NAME=VALUE] ...] [-q]\n"
+           "                       <src_raster> <zone_dataset> "
+           "<dst_filename>\n");
+
+    if (pszErrorMsg != nullptr)
+        fprintf(stderr, "\nFAILURE: %s\n", pszErrorMsg);
+
+    exit(1);
+}
+
+/************************************************************************/
+/*                                main()                                */
+/************************************************************************/
+
+#define CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(nExtraArg)                            \
+    do                                                                         \
+    {                                                                          \
+        if (i + nExtraArg >= argc)                                             \
+            Usage(CPLSPrintf("%s option requires %d argument(s)", argv[i],     \
+                             nExtraArg));                                      \
+    } while (false)
+
+MAIN_START(argc, argv)
+
+{
+    int nBandIn = 1;
+    const char *pszSrcFilename = nullptr;
+    const char *pszZoneFilename = nullptr;
+    const char *pszDstFilename = nullptr;
+    const char *pszZoneLayerName = nullptr;
+    const char *pszNewLayerName = nullptr;
+    const char *pszFormat = nullptr;
+    char **papszDSCO = nullptr;
+    char **papszLCO = nullptr;
+    bool bAllTouched = false;
+    const char *pszHistBuckets = nullptr;
+    const char *pszHistMin = nullptr;
+    const char *pszHistMax = nullptr;
+    const char *pszNumThreads = nullptr;
+    bool bQuiet = false;
+    GDALProgressFunc pfnProgress = nullptr;
+
+    GDALAllRegister();
+
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+
+    /* -------------------------------------------------------------------- */
+    /*      Parse arguments.                                                */
+    /* -------------------------------------------------------------------- */
+    for (int i = 1; i < argc; i++)
+    {
+        if (EQUAL(argv[i], "--utility_version"))
+        {
+            printf("%s was compiled against GDAL %s and "
+                   "is running against GDAL %s\n",
+                   argv[0], GDAL_RELEASE_NAME, GDALVersionInfo("RELEASE_NAME"));
+            CSLDestroy(argv);
+            return 0;
+        }
+        else if (EQUAL(argv[i], "--help"))
+            Usage();
+        else if (EQUAL(argv[i], "-b"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            // coverity[tainted_data]
+            nBandIn = atoi(argv[++i]);
+        }
+        else if (EQUAL(argv[i], "-l"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            pszZoneLayerName = argv[++i];
+        }
+        else if (EQUAL(argv[i], "-at"))
+        {
+            bAllTouched = true;
+        }
+        else if (EQUAL(argv[i], "-hist"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            pszHistBuckets = argv[++i];
+        }
+        else if (EQUAL(argv[i], "-hist_min"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            pszHistMin = argv[++i];
+        }
+        else if (EQUAL(argv[i], "-hist_max"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            pszHistMax = argv[++i];
+        }
+        else if (EQUAL(argv[i], "-nt"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            pszNumThreads = argv[++i];
+        }
+        else if (EQUAL(argv[i], "-f") || EQUAL(argv[i], "-of"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            pszFormat = argv[++i];
+        }
+        else if (EQUAL(argv[i], "-nln"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            pszNewLayerName = argv[++i];
+        }
+        else if (EQUAL(argv[i], "-dsco"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            papszDSCO = CSLAddString(papszDSCO, argv[++i]);
+        }
+        else if (EQUAL(argv[i], "-lco"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            papszLCO = CSLAddString(papszLCO, argv[++i]);
+        }
+        else if (EQUAL(argv[i], "-q") || EQUAL(argv[i], "-quiet"))
+        {
+            bQuiet = true;
+        }
+        else if (argv[i][0] == '-' && argv[i][1] != '\0')
+        {
+            Usage(CPLSPrintf("Unknown option name '%s'", argv[i]));
+        }
+        else if (pszSrcFilename == nullptr)
+        {
+            pszSrcFilename = argv[i];
+        }
+        else if (pszZoneFilename == nullptr)
+        {
+            pszZoneFilename = argv[i];
+        }
+        else if (pszDstFilename == nullptr)
+        {
+            pszDstFilename = argv[i];
+        }
+        else
+            Usage("Too many command options.");
+    }
+
+    if (pszSrcFilename == nullptr)
+        Usage("Missing source raster filename.");
+    if (pszZoneFilename == nullptr)
+        Usage("Missing zone dataset name.");
+    if (pszDstFilename == nullptr)
+        Usage("Missing destination filename.");
+    if ((pszHistMin != nullptr || pszHistMax != nullptr) &&
+        pszHistBuckets == nullptr)
+    {
+        Usage("-hist_min and -hist_max require -hist.");
+    }
+
+    if (strcmp(pszDstFilename, "/vsistdout/") == 0 ||
+        strcmp(pszDstFilename, "/dev/stdout") == 0)
+    {
+        bQuiet = true;
+    }
+
+    if (!bQuiet)
+        pfnProgress = GDALTermProgress;
+
+    /* -------------------------------------------------------------------- */
+    /*      Open source raster and zone datasets.                           */
+    /* -------------------------------------------------------------------- */
+    GDALDatasetH hSrcDS = GDALOpenEx(pszSrcFilename, GDAL_OF_RASTER, nullptr,
+                                     nullptr, nullptr);
+    if (hSrcDS == nullptr)
+        exit(2);
+
+    GDALRasterBandH hBand = GDALGetRasterBand(hSrcDS, nBandIn);
+    if (hBand == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Band %d does not exist on dataset.", nBandIn);
+        exit(2);
+    }
+
+    GDALDatasetH hZoneDS = GDALOpenEx(pszZoneFilename, GDAL_OF_VECTOR, nullptr,
+                                      nullptr, nullptr);
+    if (hZoneDS == nullptr)
+        exit(2);
+
+    OGRLayerH hZoneLayer = pszZoneLayerName
+                               ? GDALDatasetGetLayerByName(hZoneDS,
+                                                           pszZoneLayerName)
+                               : GDALDatasetGetLayer(hZoneDS, 0);
+    if (hZoneLayer == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot find zone layer %s.",
+                 pszZoneLayerName ? pszZoneLayerName : "");
+        exit(2);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Create the output file, with the fields of the zone layer.      */
+    /* -------------------------------------------------------------------- */
+    CPLString osFormat;
+    if (pszFormat == nullptr)
+    {
+        std::vector<CPLString> aoDrivers =
+            GetOutputDriversFor(pszDstFilename, GDAL_OF_VECTOR);
+        if (aoDrivers.empty())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot guess driver for %s",
+                     pszDstFilename);
+            exit(10);
+        }
+        else
+        {
+            if (aoDrivers.size() > 1)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Several drivers matching %s extension. Using %s",
+                         CPLGetExtension(pszDstFilename), aoDrivers[0].c_str());
+            }
+            osFormat = aoDrivers[0];
+        }
+    }
+    else
+    {
+        osFormat = pszFormat;
+    }
+
+    GDALDriverH hDriver = GDALGetDriverByName(osFormat.c_str());
+    if (hDriver == nullptr)
+    {
+        fprintf(stderr, "Unable to find format driver named %s.\n",
+                osFormat.c_str());
+        exit(10);
+    }
+
+    GDALDatasetH hDstDS = GDALCreate(hDriver, pszDstFilename, 0, 0, 0,
+                                     GDT_Unknown, papszDSCO);
+    if (hDstDS == nullptr)
+        exit(1);
+
+    OGRFeatureDefnH hZoneDefn = OGR_L_GetLayerDefn(hZoneLayer);
+    OGRLayerH hDstLayer = GDALDatasetCreateLayer(
+        hDstDS, pszNewLayerName ? pszNewLayerName : OGR_L_GetName(hZoneLayer),
+        OGR_L_GetSpatialRef(hZoneLayer), OGR_L_GetGeomType(hZoneLayer),
+        papszLCO);
+    if (hDstLayer == nullptr)
+        exit(1);
+
+    for (int iField = 0; iField < OGR_FD_GetFieldCount(hZoneDefn); ++iField)
+    {
+        if (OGR_L_CreateField(hDstLayer, OGR_FD_GetFieldDefn(hZoneDefn, iField),
+                              TRUE) != OGRERR_NONE)
+        {
+            exit(1);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Invoke.                                                         */
+    /* -------------------------------------------------------------------- */
+    CPLStringList aosOptions;
+    if (bAllTouched)
+        aosOptions.SetNameValue("ALL_TOUCHED", "YES");
+    if (pszHistBuckets)
+        aosOptions.SetNameValue("HISTOGRAM_BUCKETS", pszHistBuckets);
+    if (pszHistMin)
+        aosOptions.SetNameValue("HISTOGRAM_MIN", pszHistMin);
+    if (pszHistMax)
+        aosOptions.SetNameValue("HISTOGRAM_MAX", pszHistMax);
+    if (pszNumThreads)
+        aosOptions.SetNameValue("NUM_THREADS", pszNumThreads);
+
+    bool bSuccess = GDALZonalStatistics(hBand, hZoneLayer, hDstLayer,
+                                        aosOptions.List(), pfnProgress,
+                                        nullptr) == CE_None;
+
+    if (GDALClose(hDstDS) != CE_None)
+        bSuccess = false;
+    GDALClose(hZoneDS);
+    GDALClose(hSrcDS);
+
+    CSLDestroy(argv);
+    CSLDestroy(papszDSCO);
+    CSLDestroy(papszLCO);
+    GDALDestroyDriverManager();
+    OGRCleanupAll();
+
+    return bSuccess ? 0 : 1;
+}
+MAIN_END
@@ -58,7 +58,7 @@ static void Usage(const char *pszErrorMsg)
         "{nearest,bilinear,cubic,cubicspline,lanczos,average,mode}]\n"
         "                    [-oo NAME=VALUE]*\n"
         "                    [-input_file_list my_list.txt] [-overwrite]\n"
-        "                    [-strict | -non_strict]\n"
+        "                    [-strict | -non_strict] [-num_threads value]\n"
         "                    output.vrt [gdalfile]*\n"
         "\n"
         "e.g.\n"
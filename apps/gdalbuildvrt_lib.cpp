@@ -33,6 +33,7 @@
 #include "cpl_port.h"
 #include "gdal_utils.h"
 #include "gdal_utils_priv.h"
+#include "commonutils.h"
 
 #include <cassert>
 #include <cmath>
@@ -254,6 +255,7 @@ class VRTBuilder
     char *pszResampling = nullptr;
     char **papszOpenOptions = nullptr;
     bool bUseSrcMaskBand = true;
+    int nThreads = 1;
 
     /* Internal variables */
     char *pszProjectionRef = nullptr;
@@ -290,7 +292,7 @@ class VRTBuilder
                int nSubdataset, const char *pszSrcNoData,
                const char *pszVRTNoData, bool bUseSrcMaskBand,
                const char *pszOutputSRS, const char *pszResampling,
-               const char *const *papszOpenOptionsIn);
+               const char *const *papszOpenOptionsIn, int nThreadsIn);
 
     ~VRTBuilder();
 
@@ -311,8 +313,9 @@ VRTBuilder::VRTBuilder(
     int bAddAlphaIn, int bHideNoDataIn, int nSubdatasetIn,
     const char *pszSrcNoDataIn, const char *pszVRTNoDataIn,
     bool bUseSrcMaskBandIn, const char *pszOutputSRSIn,
-    const char *pszResamplingIn, const char *const *papszOpenOptionsIn)
-    : bStrict(bStrictIn)
+    const char *pszResamplingIn, const char *const *papszOpenOptionsIn,
+    int nThreadsIn)
+    : bStrict(bStrictIn), nThreads(nThreadsIn)
 {
     pszOutputFilename = CPLStrdup(pszOutputFilenameIn);
     nInputFiles = nInputFilesIn;
@@ -1487,6 +1490,23 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    // When several threads are allowed, sources are opened by batches on
+    // the thread pool, but they are still analysed sequentially in the order
+    // of the input list, so that the result is deterministic.
+    const bool bOpenInParallel = pahSrcDS == nullptr && nThreads > 1;
+    const int nOpenBatchSize = 4 * nThreads;
+    int iFirstOpened = 0;
+    std::vector<OpenedDataset> aoOpenedDS;
+    const auto CloseOpenedDatasets = [&aoOpenedDS]()
+    {
+        for (const auto &oOpenedDS : aoOpenedDS)
+        {
+            if (oOpenedDS.hDS)
+                GDALClose(oOpenedDS.hDS);
+        }
+        aoOpenedDS.clear();
+    };
+
     int nCountValid = 0;
     for (int i = 0; ppszInputFilenames != nullptr && i < nInputFiles; i++)
     {
@@ -1494,13 +1514,33 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
 
         if (!pfnProgress(1.0 * (i + 1) / nInputFiles, nullptr, pProgressData))
         {
+            CloseOpenedDatasets();
             return nullptr;
         }
 
-        GDALDatasetH hDS = (pahSrcDS)
-                               ? pahSrcDS[i]
-                               : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
-                                            papszOpenOptions, nullptr);
+        GDALDatasetH hDS = nullptr;
+        if (pahSrcDS)
+        {
+            hDS = pahSrcDS[i];
+        }
+        else if (bOpenInParallel)
+        {
+            if (i >= iFirstOpened + static_cast<int>(aoOpenedDS.size()))
+            {
+                CloseOpenedDatasets();
+                iFirstOpened = i;
+                aoOpenedDS = OpenDatasetsInParallel(
+                    ppszInputFilenames + i,
+                    std::min(nOpenBatchSize, nInputFiles - i), GDAL_OF_RASTER,
+                    papszOpenOptions, nThreads);
+            }
+            hDS = aoOpenedDS[i - iFirstOpened].Release();
+        }
+        else
+        {
+            hDS = GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
+                             papszOpenOptions, nullptr);
+        }
         asDatasetProperties[i].isFileOK = FALSE;
 
         if (hDS)
@@ -1520,6 +1560,7 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
                 {
                     CPLError(CE_Failure, CPLE_AppDefined, "%s",
                              osErrorMsg.c_str());
+                    CloseOpenedDatasets();
                     return nullptr;
                 }
                 else
@@ -1535,6 +1576,7 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
             {
                 CPLError(CE_Failure, CPLE_AppDefined, "Can't open %s.",
                          dsFileName);
+                CloseOpenedDatasets();
                 return nullptr;
             }
             else
@@ -1545,6 +1587,8 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    CloseOpenedDatasets();
+
     if (nCountValid == 0)
         return nullptr;
 
@@ -1734,6 +1778,7 @@ struct GDALBuildVRTOptions
     char *pszResampling;
     char **papszOpenOptions;
     bool bUseSrcMaskBand;
+    int nThreads;
 
     /*! allow or suppress progress monitor and other non-error output */
     int bQuiet;
@@ -1906,7 +1951,8 @@ GDALDatasetH GDALBuildVRT(const char *pszDest, int nSrcCount,
         psOptions->bAddAlpha, psOptions->bHideNoData, psOptions->nSubdataset,
         psOptions->pszSrcNoData, psOptions->pszVRTNoData,
         psOptions->bUseSrcMaskBand, psOptions->pszOutputSRS,
-        psOptions->pszResampling, psOptions->papszOpenOptions);
+        psOptions->pszResampling, psOptions->papszOpenOptions,
+        psOptions->nThreads);
 
     GDALDatasetH hDstDS = static_cast<GDALDatasetH>(
         oBuilder.Build(psOptions->pfnProgress, psOptions->pProgressData));
@@ -1977,6 +2023,7 @@ GDALBuildVRTOptionsNew(char **papszArgv,
     psOptions->pProgressData = nullptr;
     psOptions->bUseSrcMaskBand = true;
     psOptions->bStrict = false;
+    psOptions->nThreads = GetNumThreadsFromArg(nullptr);
 
     /* -------------------------------------------------------------------- */
     /*      Parse arguments.                                                */
@@ -2162,6 +2209,10 @@ GDALBuildVRTOptionsNew(char **papszArgv,
         {
             psOptions->bUseSrcMaskBand = false;
         }
+        else if (EQUAL(papszArgv[iArg], "-num_threads") && iArg + 1 < argc)
+        {
+            psOptions->nThreads = GetNumThreadsFromArg(papszArgv[++iArg]);
+        }
         else if (papszArgv[iArg][0] == '-')
         {
             CPLError(CE_Failure, CPLE_NotSupported, "Unknown option name '%s'",
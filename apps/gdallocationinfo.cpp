@@ -33,8 +33,12 @@
 #include "gdal.h"
 #include "commonutils.h"
 #include "ogr_spatialref.h"
+
+#include <cmath>
 #include <vector>
 
+#include <sys/stat.h>
+
 #ifdef _WIN32
 #include <io.h>
 #else
@@ -52,6 +56,7 @@ static void Usage()
            "[-valonly]\n"
            "                        [-b band]* [-overview overview_level]\n"
            "                        [-l_srs srs_def] [-geoloc] [-wgs84]\n"
+           "                        [-r nearest|bilinear|cubic]\n"
            "                        [-oo NAME=VALUE]* srcfile x y\n"
            "\n");
     exit(1);
@@ -98,6 +103,7 @@ MAIN_START(argc, argv)
     bool bQuiet = false, bValOnly = false;
     int nOverview = -1;
     char **papszOpenOptions = nullptr;
+    GDALRIOResampleAlg eInterpolation = GRIORA_NearestNeighbour;
 
     GDALAllRegister();
     argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
@@ -160,6 +166,23 @@ MAIN_START(argc, argv)
         {
             papszOpenOptions = CSLAddString(papszOpenOptions, argv[++i]);
         }
+        else if (i < argc - 1 && EQUAL(argv[i], "-r"))
+        {
+            const char *pszResampling = argv[++i];
+            if (STARTS_WITH_CI(pszResampling, "near"))
+                eInterpolation = GRIORA_NearestNeighbour;
+            else if (EQUAL(pszResampling, "bilinear"))
+                eInterpolation = GRIORA_Bilinear;
+            else if (EQUAL(pszResampling, "cubic"))
+                eInterpolation = GRIORA_Cubic;
+            else
+            {
+                fprintf(stderr,
+                        "-r can only be used with values nearest, bilinear "
+                        "or cubic\n");
+                Usage();
+            }
+        }
         else if (argv[i][0] == '-' && !isdigit(argv[i][1]))
             Usage();
 
@@ -216,18 +239,76 @@ MAIN_START(argc, argv)
             anBandList.push_back(i + 1);
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Resolve the bands, or overview bands, to query.                 */
+    /* -------------------------------------------------------------------- */
+    const int nRasterXSize = GDALGetRasterXSize(hSrcDS);
+    const int nRasterYSize = GDALGetRasterYSize(hSrcDS);
+    std::vector<GDALRasterBandH> ahQueryBands;
+    for (int nBand : anBandList)
+    {
+        GDALRasterBandH hBand = GDALGetRasterBand(hSrcDS, nBand);
+        if (nOverview >= 0 && hBand != nullptr)
+        {
+            GDALRasterBandH hOvrBand = GDALGetOverview(hBand, nOverview);
+            if (hOvrBand == nullptr)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot get overview %d of band %d", nOverview + 1,
+                         nBand);
+            }
+            hBand = hOvrBand;
+        }
+        ahQueryBands.push_back(hBand);
+    }
+
+    // Pixel/line position of a location of the full resolution band in the
+    // band to query.
+    const auto GetQueryPosition = [nRasterXSize, nRasterYSize, nOverview](
+                                      GDALRasterBandH hBand, int iPixel,
+                                      int iLine, int &iPixelToQuery,
+                                      int &iLineToQuery)
+    {
+        iPixelToQuery = iPixel;
+        iLineToQuery = iLine;
+        if (nOverview >= 0)
+        {
+            const int nOvrXSize = GDALGetRasterBandXSize(hBand);
+            const int nOvrYSize = GDALGetRasterBandYSize(hBand);
+            iPixelToQuery = static_cast<int>(0.5 + 1.0 * iPixel / nRasterXSize *
+                                                       nOvrXSize);
+            iLineToQuery = static_cast<int>(0.5 + 1.0 * iLine / nRasterYSize *
+                                                      nOvrYSize);
+            if (iPixelToQuery >= nOvrXSize)
+                iPixelToQuery = nOvrXSize - 1;
+            if (iLineToQuery >= nOvrYSize)
+                iLineToQuery = nOvrYSize - 1;
+        }
+    };
+
     /* -------------------------------------------------------------------- */
     /*      Turn the location into a pixel and line location.               */
     /* -------------------------------------------------------------------- */
-    int inputAvailable = 1;
-    double dfGeoX;
-    double dfGeoY;
     CPLString osXML;
 
+    // Points read from a regular file are processed in batches, so that band
+    // values are fetched block by block, instead of point by point. Points
+    // typed in an interactive terminal or written to a pipe are processed
+    // one at a time, as the writer may wait for each answer before sending
+    // the next point.
+    size_t nMaxBatchSize = 1;
     if (pszLocX == nullptr && pszLocY == nullptr)
     {
+        const int nStdinFD = static_cast<int>(fileno(stdin));
+        struct stat sStat;
+        if (fstat(nStdinFD, &sStat) == 0 &&
+            (sStat.st_mode & S_IFMT) == S_IFREG)
+        {
+            nMaxBatchSize = 100000;
+        }
+
         // Is it an interactive terminal ?
-        if (isatty(static_cast<int>(fileno(stdin))))
+        if (isatty(nStdinFD))
         {
             if (pszSourceSRS != nullptr)
             {
@@ -241,29 +322,45 @@ MAIN_START(argc, argv)
                                 "and press Return.\n");
             }
         }
-
-        if (fscanf(stdin, "%lf %lf", &dfGeoX, &dfGeoY) != 2)
-        {
-            inputAvailable = 0;
-        }
-    }
-    else
-    {
-        dfGeoX = CPLAtof(pszLocX);
-        dfGeoY = CPLAtof(pszLocY);
     }
 
-    while (inputAvailable)
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    bool bMoreInput = true;
+    while (bMoreInput)
     {
-        int iPixel, iLine;
+        adfX.clear();
+        adfY.clear();
+        if (pszLocX != nullptr && pszLocY != nullptr)
+        {
+            adfX.push_back(CPLAtof(pszLocX));
+            adfY.push_back(CPLAtof(pszLocY));
+            bMoreInput = false;
+        }
+        else
+        {
+            double dfGeoX = 0;
+            double dfGeoY = 0;
+            while (adfX.size() < nMaxBatchSize &&
+                   fscanf(stdin, "%lf %lf", &dfGeoX, &dfGeoY) == 2)
+            {
+                adfX.push_back(dfGeoX);
+                adfY.push_back(dfGeoY);
+            }
+            if (adfX.size() < nMaxBatchSize)
+                bMoreInput = false;
+        }
+        const int nPoints = static_cast<int>(adfX.size());
 
-        if (hCT)
+        if (hCT && nPoints > 0)
         {
-            if (!OCTTransform(hCT, 1, &dfGeoX, &dfGeoY, nullptr))
+            if (!OCTTransform(hCT, nPoints, adfX.data(), adfY.data(), nullptr))
                 exit(1);
         }
 
-        if (pszSourceSRS != nullptr)
+        std::vector<double> adfPixelPos(nPoints);
+        std::vector<double> adfLinePos(nPoints);
+        if (pszSourceSRS != nullptr && nPoints > 0)
         {
             double adfGeoTransform[6] = {};
             if (GDALGetGeoTransform(hSrcDS, adfGeoTransform) != CE_None)
@@ -281,243 +378,277 @@ MAIN_START(argc, argv)
                 exit(1);
             }
 
-            iPixel = static_cast<int>(floor(adfInvGeoTransform[0] +
-                                            adfInvGeoTransform[1] * dfGeoX +
-                                            adfInvGeoTransform[2] * dfGeoY));
-            iLine = static_cast<int>(floor(adfInvGeoTransform[3] +
-                                           adfInvGeoTransform[4] * dfGeoX +
-                                           adfInvGeoTransform[5] * dfGeoY));
+            for (int iPoint = 0; iPoint < nPoints; ++iPoint)
+            {
+                adfPixelPos[iPoint] = adfInvGeoTransform[0] +
+                                   adfInvGeoTransform[1] * adfX[iPoint] +
+                                   adfInvGeoTransform[2] * adfY[iPoint];
+                adfLinePos[iPoint] = adfInvGeoTransform[3] +
+                                  adfInvGeoTransform[4] * adfX[iPoint] +
+                                  adfInvGeoTransform[5] * adfY[iPoint];
+            }
         }
         else
         {
-            iPixel = static_cast<int>(floor(dfGeoX));
-            iLine = static_cast<int>(floor(dfGeoY));
+            adfPixelPos = adfX;
+            adfLinePos = adfY;
         }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Prepare report. */
-        /* --------------------------------------------------------------------
-         */
-        CPLString osLine;
-
-        if (bAsXML)
-        {
-            osLine.Printf("<Report pixel=\"%d\" line=\"%d\">", iPixel, iLine);
-            osXML += osLine;
-        }
-        else if (!bQuiet)
+        /* ---------------------------------------------------------------- */
+        /*      Fetch the values of all the points, band by band.           */
+        /*      Complex values are read point by point below.               */
+        /* ---------------------------------------------------------------- */
+        std::vector<std::vector<double>> aadfValues(ahQueryBands.size());
+        std::vector<std::vector<int>> aabValueOK(ahQueryBands.size());
+        for (size_t i = 0; i < ahQueryBands.size(); i++)
         {
-            printf("Report:\n");
-            printf("  Location: (%dP,%dL)\n", iPixel, iLine);
-        }
-
-        bool bPixelReport = true;
-
-        if (iPixel < 0 || iLine < 0 || iPixel >= GDALGetRasterXSize(hSrcDS) ||
-            iLine >= GDALGetRasterYSize(hSrcDS))
-        {
-            if (bAsXML)
-                osXML += "<Alert>Location is off this file! No further details "
-                         "to report.</Alert>";
-            else if (bValOnly)
-                printf("\n");
-            else if (!bQuiet)
-                printf("\nLocation is off this file! No further details to "
-                       "report.\n");
-            bPixelReport = false;
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Process each band. */
-        /* --------------------------------------------------------------------
-         */
-        for (int i = 0; bPixelReport && i < static_cast<int>(anBandList.size());
-             i++)
-        {
-            GDALRasterBandH hBand = GDALGetRasterBand(hSrcDS, anBandList[i]);
-
-            int iPixelToQuery = iPixel;
-            int iLineToQuery = iLine;
+            GDALRasterBandH hBand = ahQueryBands[i];
+            if (hBand == nullptr || nPoints == 0 ||
+                GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)))
+                continue;
 
-            if (nOverview >= 0 && hBand != nullptr)
+            std::vector<double> adfPixelToQuery(nPoints);
+            std::vector<double> adfLineToQuery(nPoints);
+            for (int iPoint = 0; iPoint < nPoints; ++iPoint)
             {
-                GDALRasterBandH hOvrBand = GDALGetOverview(hBand, nOverview);
-                if (hOvrBand != nullptr)
+                if (eInterpolation == GRIORA_NearestNeighbour)
                 {
-                    int nOvrXSize = GDALGetRasterBandXSize(hOvrBand);
-                    int nOvrYSize = GDALGetRasterBandYSize(hOvrBand);
-                    iPixelToQuery = static_cast<int>(
-                        0.5 +
-                        1.0 * iPixel / GDALGetRasterXSize(hSrcDS) * nOvrXSize);
-                    iLineToQuery = static_cast<int>(
-                        0.5 +
-                        1.0 * iLine / GDALGetRasterYSize(hSrcDS) * nOvrYSize);
-                    if (iPixelToQuery >= nOvrXSize)
-                        iPixelToQuery = nOvrXSize - 1;
-                    if (iLineToQuery >= nOvrYSize)
-                        iLineToQuery = nOvrYSize - 1;
+                    int iPixelToQuery = 0;
+                    int iLineToQuery = 0;
+                    GetQueryPosition(
+                        hBand, static_cast<int>(floor(adfPixelPos[iPoint])),
+                        static_cast<int>(floor(adfLinePos[iPoint])),
+                        iPixelToQuery, iLineToQuery);
+                    adfPixelToQuery[iPoint] = iPixelToQuery + 0.5;
+                    adfLineToQuery[iPoint] = iLineToQuery + 0.5;
                 }
                 else
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot get overview %d of band %d", nOverview + 1,
-                             anBandList[i]);
+                    adfPixelToQuery[iPoint] =
+                        adfPixelPos[iPoint] / nRasterXSize *
+                        GDALGetRasterBandXSize(hBand);
+                    adfLineToQuery[iPoint] =
+                        adfLinePos[iPoint] / nRasterYSize *
+                        GDALGetRasterBandYSize(hBand);
                 }
-                hBand = hOvrBand;
             }
 
-            if (hBand == nullptr)
-                continue;
+            aadfValues[i].resize(nPoints);
+            aabValueOK[i].resize(nPoints);
+            // On a read error, only the points depending on the unreadable
+            // blocks are flagged as failed
+            CPL_IGNORE_RET_VAL(GDALRasterInterpolateAtPoints(
+                hBand, nPoints, adfPixelToQuery.data(), adfLineToQuery.data(),
+                eInterpolation, aadfValues[i].data(), aabValueOK[i].data()));
+        }
+
+        for (int iPoint = 0; iPoint < nPoints; ++iPoint)
+        {
+            const int iPixel = static_cast<int>(floor(adfPixelPos[iPoint]));
+            const int iLine = static_cast<int>(floor(adfLinePos[iPoint]));
+
+            /* ------------------------------------------------------------ */
+            /*      Prepare report.                                         */
+            /* ------------------------------------------------------------ */
+            CPLString osLine;
 
             if (bAsXML)
             {
-                osLine.Printf("<BandReport band=\"%d\">", anBandList[i]);
+                osLine.Printf("<Report pixel=\"%d\" line=\"%d\">", iPixel,
+                              iLine);
                 osXML += osLine;
             }
             else if (!bQuiet)
             {
-                printf("  Band %d:\n", anBandList[i]);
+                printf("Report:\n");
+                printf("  Location: (%dP,%dL)\n", iPixel, iLine);
             }
 
-            /* --------------------------------------------------------------------
-             */
-            /*      Request location info for this location.  It is possible */
-            /*      only the VRT driver actually supports this. */
-            /* --------------------------------------------------------------------
-             */
-            CPLString osItem;
-
-            osItem.Printf("Pixel_%d_%d", iPixelToQuery, iLineToQuery);
+            bool bPixelReport = true;
 
-            const char *pszLI =
-                GDALGetMetadataItem(hBand, osItem, "LocationInfo");
+            if (iPixel < 0 || iLine < 0 || iPixel >= nRasterXSize ||
+                iLine >= nRasterYSize)
+            {
+                if (bAsXML)
+                    osXML += "<Alert>Location is off this file! No further "
+                             "details to report.</Alert>";
+                else if (bValOnly)
+                    printf("\n");
+                else if (!bQuiet)
+                    printf("\nLocation is off this file! No further details "
+                           "to report.\n");
+                bPixelReport = false;
+            }
 
-            if (pszLI != nullptr)
+            /* ------------------------------------------------------------ */
+            /*      Process each band.                                      */
+            /* ------------------------------------------------------------ */
+            for (int i = 0;
+                 bPixelReport && i < static_cast<int>(anBandList.size()); i++)
             {
+                GDALRasterBandH hBand = ahQueryBands[i];
+                if (hBand == nullptr)
+                    continue;
+
+                int iPixelToQuery = 0;
+                int iLineToQuery = 0;
+                GetQueryPosition(hBand, iPixel, iLine, iPixelToQuery,
+                                 iLineToQuery);
+
                 if (bAsXML)
-                    osXML += pszLI;
+                {
+                    osLine.Printf("<BandReport band=\"%d\">", anBandList[i]);
+                    osXML += osLine;
+                }
                 else if (!bQuiet)
-                    printf("    %s\n", pszLI);
-                else if (bLIFOnly)
                 {
-                    /* Extract all files, if any. */
+                    printf("  Band %d:\n", anBandList[i]);
+                }
+
+                /* -------------------------------------------------------- */
+                /*      Request location info for this location.  It is     */
+                /*      possible only the VRT driver actually supports      */
+                /*      this.                                               */
+                /* -------------------------------------------------------- */
+                CPLString osItem;
+
+                osItem.Printf("Pixel_%d_%d", iPixelToQuery, iLineToQuery);
 
-                    CPLXMLNode *psRoot = CPLParseXMLString(pszLI);
+                const char *pszLI =
+                    GDALGetMetadataItem(hBand, osItem, "LocationInfo");
 
-                    if (psRoot != nullptr && psRoot->psChild != nullptr &&
-                        psRoot->eType == CXT_Element &&
-                        EQUAL(psRoot->pszValue, "LocationInfo"))
+                if (pszLI != nullptr)
+                {
+                    if (bAsXML)
+                        osXML += pszLI;
+                    else if (!bQuiet)
+                        printf("    %s\n", pszLI);
+                    else if (bLIFOnly)
                     {
-                        for (CPLXMLNode *psNode = psRoot->psChild;
-                             psNode != nullptr; psNode = psNode->psNext)
+                        /* Extract all files, if any. */
+
+                        CPLXMLNode *psRoot = CPLParseXMLString(pszLI);
+
+                        if (psRoot != nullptr && psRoot->psChild != nullptr &&
+                            psRoot->eType == CXT_Element &&
+                            EQUAL(psRoot->pszValue, "LocationInfo"))
                         {
-                            if (psNode->eType == CXT_Element &&
-                                EQUAL(psNode->pszValue, "File") &&
-                                psNode->psChild != nullptr)
+                            for (CPLXMLNode *psNode = psRoot->psChild;
+                                 psNode != nullptr; psNode = psNode->psNext)
                             {
-                                char *pszUnescaped =
-                                    CPLUnescapeString(psNode->psChild->pszValue,
-                                                      nullptr, CPLES_XML);
-                                printf("%s\n", pszUnescaped);
-                                CPLFree(pszUnescaped);
+                                if (psNode->eType == CXT_Element &&
+                                    EQUAL(psNode->pszValue, "File") &&
+                                    psNode->psChild != nullptr)
+                                {
+                                    char *pszUnescaped = CPLUnescapeString(
+                                        psNode->psChild->pszValue, nullptr,
+                                        CPLES_XML);
+                                    printf("%s\n", pszUnescaped);
+                                    CPLFree(pszUnescaped);
+                                }
                             }
                         }
+                        CPLDestroyXMLNode(psRoot);
                     }
-                    CPLDestroyXMLNode(psRoot);
                 }
-            }
 
-            /* --------------------------------------------------------------------
-             */
-            /*      Report the pixel value of this band. */
-            /* --------------------------------------------------------------------
-             */
-            double adfPixel[2] = {0, 0};
-            const bool bIsComplex = CPL_TO_BOOL(
-                GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
-
-            if (GDALRasterIO(hBand, GF_Read, iPixelToQuery, iLineToQuery, 1, 1,
-                             adfPixel, 1, 1,
-                             bIsComplex ? GDT_CFloat64 : GDT_Float64, 0,
-                             0) == CE_None)
-            {
-                CPLString osValue;
+                /* -------------------------------------------------------- */
+                /*      Report the pixel value of this band.                */
+                /* -------------------------------------------------------- */
+                double adfPixel[2] = {0, 0};
+                const bool bIsComplex = CPL_TO_BOOL(
+                    GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
 
+                bool bValueOK = false;
                 if (bIsComplex)
-                    osValue.Printf("%.15g+%.15gi", adfPixel[0], adfPixel[1]);
-                else
-                    osValue.Printf("%.15g", adfPixel[0]);
-
-                if (bAsXML)
                 {
-                    osXML += "<Value>";
-                    osXML += osValue;
-                    osXML += "</Value>";
+                    bValueOK =
+                        GDALRasterIO(hBand, GF_Read, iPixelToQuery,
+                                     iLineToQuery, 1, 1, adfPixel, 1, 1,
+                                     GDT_CFloat64, 0, 0) == CE_None;
                 }
-                else if (!bQuiet)
-                    printf("    Value: %s\n", osValue.c_str());
-                else if (bValOnly)
-                    printf("%s\n", osValue.c_str());
-
-                // Report unscaled if we have scale/offset values.
-                int bSuccess;
-
-                double dfOffset = GDALGetRasterOffset(hBand, &bSuccess);
-                // TODO: Should we turn on checking of bSuccess?
-                // Alternatively, delete these checks and put a comment as to
-                // why checking bSuccess does not matter.
-#if 0
-                if (bSuccess == FALSE)
+                else if (aabValueOK[i][iPoint])
                 {
-                    CPLError( CE_Debug, CPLE_AppDefined,
-                              "Unable to get raster offset." );
+                    adfPixel[0] = aadfValues[i][iPoint];
+                    bValueOK = true;
                 }
-#endif
-                double dfScale = GDALGetRasterScale(hBand, &bSuccess);
-#if 0
-                if (bSuccess == FALSE)
-                {
-                    CPLError( CE_Debug, CPLE_AppDefined,
-                              "Unable to get raster scale." );
-                }
-#endif
-                if (dfOffset != 0.0 || dfScale != 1.0)
+
+                if (bValueOK)
                 {
-                    adfPixel[0] = adfPixel[0] * dfScale + dfOffset;
+                    CPLString osValue;
 
                     if (bIsComplex)
-                    {
-                        adfPixel[1] = adfPixel[1] * dfScale + dfOffset;
                         osValue.Printf("%.15g+%.15gi", adfPixel[0],
                                        adfPixel[1]);
-                    }
                     else
                         osValue.Printf("%.15g", adfPixel[0]);
 
                     if (bAsXML)
                     {
-                        osXML += "<DescaledValue>";
+                        osXML += "<Value>";
                         osXML += osValue;
-                        osXML += "</DescaledValue>";
+                        osXML += "</Value>";
                     }
                     else if (!bQuiet)
-                        printf("    Descaled Value: %s\n", osValue.c_str());
+                        printf("    Value: %s\n", osValue.c_str());
+                    else if (bValOnly)
+                        printf("%s\n", osValue.c_str());
+
+                    // Report unscaled if we have scale/offset values.
+                    int bSuccess;
+
+                    double dfOffset = GDALGetRasterOffset(hBand, &bSuccess);
+                    // TODO: Should we turn on checking of bSuccess?
+                    // Alternatively, delete these checks and put a comment as
+                    // to why checking bSuccess does not matter.
+#if 0
+                    if (bSuccess == FALSE)
+                    {
+                        CPLError( CE_Debug, CPLE_AppDefined,
+                                  "Unable to get raster offset." );
+                    }
+#endif
+                    double dfScale = GDALGetRasterScale(hBand, &bSuccess);
+#if 0
+                    if (bSuccess == FALSE)
+                    {
+                        CPLError( CE_Debug, CPLE_AppDefined,
+                                  "Unable to get raster scale." );
+                    }
+#endif
+                    if (dfOffset != 0.0 || dfScale != 1.0)
+                    {
+                        adfPixel[0] = adfPixel[0] * dfScale + dfOffset;
+
+                        if (bIsComplex)
+                        {
+                            adfPixel[1] = adfPixel[1] * dfScale + dfOffset;
+                            osValue.Printf("%.15g+%.15gi", adfPixel[0],
+                                           adfPixel[1]);
+                        }
+                        else
+                            osValue.Printf("%.15g", adfPixel[0]);
+
+                        if (bAsXML)
+                        {
+                            osXML += "<DescaledValue>";
+                            osXML += osValue;
+                            osXML += "</DescaledValue>";
+                        }
+                        else if (!bQuiet)
+                            printf("    Descaled Value: %s\n",
+                                   osValue.c_str());
+                    }
                 }
+
+                if (bAsXML)
+                    osXML += "</BandReport>";
             }
 
-            if (bAsXML)
-                osXML += "</BandReport>";
+            osXML += "</Report>";
         }
 
-        osXML += "</Report>";
-
-        if ((pszLocX != nullptr && pszLocY != nullptr) ||
-            (fscanf(stdin, "%lf %lf", &dfGeoX, &dfGeoY) != 2))
-        {
-            inputAvailable = 0;
-        }
+        fflush(stdout);
     }
 
     /* -------------------------------------------------------------------- */
@@ -597,11 +597,12 @@ GetDimensionDesc(DimensionRemapper &oDimRemapper,
 /************************************************************************/
 
 // foo
-// name=foo,transpose=[1,0],view=[0],dstname=bar,ot=Float32
+// name=foo,transpose=[1,0],view=[0],reduce=time:mean,dstname=bar,ot=Float32
 static bool ParseArraySpec(const std::string &arraySpec, std::string &srcName,
                            std::string &dstName, int &band,
                            std::vector<int> &anTransposedAxis,
-                           std::string &viewExpr,
+                           std::string &viewExpr, std::string &reduceDimName,
+                           std::string &reduceOperation,
                            GDALExtendedDataType &outputType)
 {
     if (!STARTS_WITH(arraySpec.c_str(), "name=") &&
@@ -682,6 +683,21 @@ static bool ParseArraySpec(const std::string &arraySpec, std::string &srcName,
         {
             viewExpr = token.substr(strlen("view="));
         }
+        else if (STARTS_WITH(token.c_str(), "reduce="))
+        {
+            const auto reduceExpr = token.substr(strlen("reduce="));
+            const auto pos = reduceExpr.rfind(':');
+            if (pos == std::string::npos || pos == 0 ||
+                pos + 1 == reduceExpr.size())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid value for reduce. Expected "
+                         "{dim_name}:{sum|mean|min|max}");
+                return false;
+            }
+            reduceDimName = reduceExpr.substr(0, pos);
+            reduceOperation = reduceExpr.substr(pos + 1);
+        }
         else if (STARTS_WITH(token.c_str(), "ot="))
         {
             auto outputTypeStr = token.substr(strlen("ot="));
@@ -724,9 +740,12 @@ static bool TranslateArray(
     int band = -1;
     std::vector<int> anTransposedAxis;
     std::string viewExpr;
+    std::string reduceDimName;
+    std::string reduceOperation;
     GDALExtendedDataType outputType(GDALExtendedDataType::Create(GDT_Unknown));
     if (!ParseArraySpec(arraySpec, srcArrayName, dstArrayName, band,
-                        anTransposedAxis, viewExpr, outputType))
+                        anTransposedAxis, viewExpr, reduceDimName,
+                        reduceOperation, outputType))
     {
         return false;
     }
@@ -862,6 +881,40 @@ static bool TranslateArray(
         }
     }
 
+    // Index of the reduced dimension in the array resulting from the view
+    int iReducedDim = -1;
+    if (!reduceDimName.empty())
+    {
+        const auto &viewArrayDims(tmpArray->GetDimensions());
+        for (size_t i = 0; i < viewArrayDims.size(); ++i)
+        {
+            if (viewArrayDims[i]->GetName() == reduceDimName)
+            {
+                iReducedDim = static_cast<int>(i);
+                break;
+            }
+        }
+        if (iReducedDim < 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot find dimension %s to reduce",
+                     reduceDimName.c_str());
+            return false;
+        }
+        tmpArray = tmpArray->GetReduced(static_cast<size_t>(iReducedDim),
+                                        reduceOperation);
+        if (!tmpArray)
+            return false;
+    }
+    // Map an index of a dimension of tmpArray to the corresponding index
+    // before reduction.
+    const auto GetViewDimIdx = [iReducedDim](size_t i)
+    {
+        return (iReducedDim >= 0 && i >= static_cast<size_t>(iReducedDim))
+                   ? i + 1
+                   : i;
+    };
+
     // Map source dimensions to target dimensions
     std::vector<std::shared_ptr<GDALDimension>> dstArrayDims;
     const auto &tmpArrayDims(tmpArray->GetDimensions());
@@ -908,7 +961,8 @@ static bool TranslateArray(
         if (idxSliceSpec >= 0)
         {
             const auto &viewSpec(viewSpecs[idxSliceSpec]);
-            auto iParentDim = viewSpec.m_mapDimIdxToParentDimIdx[i];
+            auto iParentDim =
+                viewSpec.m_mapDimIdxToParentDimIdx[GetViewDimIdx(i)];
             if (iParentDim != static_cast<size_t>(-1))
                 srcDimForGetDimensionDesc = srcArrayDims[iParentDim];
         }
@@ -962,7 +1016,8 @@ static bool TranslateArray(
         if (idxSliceSpec >= 0)
         {
             const auto &viewSpec(viewSpecs[idxSliceSpec]);
-            auto iParentDim = viewSpec.m_mapDimIdxToParentDimIdx[i];
+            auto iParentDim =
+                viewSpec.m_mapDimIdxToParentDimIdx[GetViewDimIdx(i)];
             if (iParentDim != static_cast<size_t>(-1) &&
                 (srcIndexVar =
                      srcArrayDims[iParentDim]->GetIndexingVariable()) !=
@@ -1084,8 +1139,11 @@ static bool TranslateArray(
         return false;
 
     GUInt64 nCurCost = 0;
-    dstArray->CopyFromAllExceptValues(srcArray.get(), false, nCurCost, 0,
-                                      nullptr, nullptr);
+    // A reduced array has unscaled values, and only forwards the relevant
+    // properties of its source array.
+    dstArray->CopyFromAllExceptValues(
+        iReducedDim >= 0 ? tmpArray.get() : srcArray.get(), false, nCurCost, 0,
+        nullptr, nullptr);
 
     if (idxSliceSpec >= 0)
     {
@@ -1097,12 +1155,18 @@ static bool TranslateArray(
         const auto &viewSpec(viewSpecs[idxSliceSpec]);
         for (size_t i = 0; i < tmpArrayDims.size(); ++i)
         {
-            auto iParentDim = viewSpec.m_mapDimIdxToParentDimIdx[i];
+            auto iParentDim =
+                viewSpec.m_mapDimIdxToParentDimIdx[GetViewDimIdx(i)];
             if (iParentDim != static_cast<size_t>(-1))
             {
                 oSetParentDimIdxNotInArray.erase(iParentDim);
             }
         }
+        if (iReducedDim >= 0)
+        {
+            oSetParentDimIdxNotInArray.erase(
+                viewSpec.m_mapDimIdxToParentDimIdx[iReducedDim]);
+        }
         for (const auto parentDimIdx : oSetParentDimIdxNotInArray)
         {
             const auto &srcDim(srcArrayDims[parentDimIdx]);
@@ -1169,6 +1233,8 @@ static bool TranslateArray(
             band >= 1 ? CPLSPrintf("%d", band) : std::string(),
             std::move(anTransposedAxis), viewExpr, std::move(anSrcOffset),
             std::move(anCount), std::move(anStep), std::move(anDstOffset)));
+    if (iReducedDim >= 0)
+        poSource->SetReduction(iReducedDim, reduceOperation);
     dstArrayVRT->AddSource(std::move(poSource));
 
     return true;
@@ -1490,10 +1556,13 @@ CopyToNonMultiDimensionalDriver(GDALDriver *poDriver, const char *pszDest,
         int band = -1;
         std::vector<int> anTransposedAxis;
         std::string viewExpr;
+        std::string reduceDimName;
+        std::string reduceOperation;
         GDALExtendedDataType outputType(
             GDALExtendedDataType::Create(GDT_Unknown));
         ParseArraySpec(psOptions->aosArraySpec[0], srcArrayName, dstArrayName,
-                       band, anTransposedAxis, viewExpr, outputType);
+                       band, anTransposedAxis, viewExpr, reduceDimName,
+                       reduceOperation, outputType);
         srcArray = poRG->OpenMDArray(dstArrayName);
     }
     else
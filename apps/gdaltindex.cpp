@@ -36,7 +36,10 @@
 #include "ogr_srs_api.h"
 #include "commonutils.h"
 
+#include <algorithm>
 #include <cmath>
+#include <string>
+#include <vector>
 
 /************************************************************************/
 /*                               Usage()                                */
@@ -53,7 +56,8 @@ static void Usage(const char *pszErrorMsg)
         "                  [-skip_different_projection] [-t_srs target_srs]\n"
         "                  [-src_srs_name field_name] [-src_srs_format "
         "[AUTO|WKT|EPSG|PROJ]\n"
-        "                  [-lyr_name name] index_file [gdal_file]*\n"
+        "                  [-lyr_name name] [-num_threads value]\n"
+        "                  index_file [gdal_file]*\n"
         "\n"
         "e.g.\n"
         "  % gdaltindex doq_index.shp doq/*.tif\n"
@@ -77,7 +81,10 @@ static void Usage(const char *pszErrorMsg)
         "  o Simple rectangular polygons are generated in the same coordinate "
         "reference system\n"
         "    as the rasters, or in target reference system if the -t_srs "
-        "option is used.\n");
+        "option is used.\n"
+        "  o If -num_threads is specified, input files are opened in parallel, "
+        "but\n"
+        "    still inserted in the order of the command line.\n");
 
     if (pszErrorMsg != nullptr)
         fprintf(stderr, "\nFAILURE: %s\n", pszErrorMsg);
@@ -142,6 +149,7 @@ MAIN_START(argc, argv)
     int i_SrcSRSName = -1;
     bool bSrcSRSFormatSpecified = false;
     SrcSRSFormat eSrcSRSFormat = FORMAT_AUTO;
+    int nThreads = GetNumThreadsFromArg(nullptr);
 
     int iArg = 1;  // Used after for.
     for (; iArg < argc; iArg++)
@@ -206,6 +214,11 @@ MAIN_START(argc, argv)
             else if (EQUAL(pszFormat, "PROJ"))
                 eSrcSRSFormat = FORMAT_PROJ;
         }
+        else if (strcmp(argv[iArg], "-num_threads") == 0)
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            nThreads = GetNumThreadsFromArg(argv[++iArg]);
+        }
         else if (argv[iArg][0] == '-')
             Usage(CPLSPrintf("Unknown option name '%s'", argv[iArg]));
         else if (index_filename == nullptr)
@@ -457,47 +470,103 @@ MAIN_START(argc, argv)
 
     int nRetCode = 0;
 
-    /* -------------------------------------------------------------------- */
-    /*      loop over GDAL files, processing.                               */
-    /* -------------------------------------------------------------------- */
-    for (; nRetCode == 0 && iArg < argc; iArg++)
+    // Names under which the input files are written in the index, and
+    // whether they are already in it, so that such files are not opened.
+    const int iFirstFileArg = iArg;
+    std::vector<std::string> aosFileNamesToWrite;
+    std::vector<bool> abAlreadyInIndex;
+    for (int i = iFirstFileArg; i < argc; i++)
     {
-        char *fileNameToWrite = nullptr;
         VSIStatBuf sStatBuf;
 
         // Make sure it is a file before building absolute path name.
-        if (write_absolute_path && CPLIsFilenameRelative(argv[iArg]) &&
-            VSIStat(argv[iArg], &sStatBuf) == 0)
+        if (write_absolute_path && CPLIsFilenameRelative(argv[i]) &&
+            VSIStat(argv[i], &sStatBuf) == 0)
         {
-            fileNameToWrite =
-                CPLStrdup(CPLProjectRelativeFilename(current_path, argv[iArg]));
+            aosFileNamesToWrite.push_back(
+                CPLProjectRelativeFilename(current_path, argv[i]));
         }
         else
         {
-            fileNameToWrite = CPLStrdup(argv[iArg]);
+            aosFileNamesToWrite.push_back(argv[i]);
+        }
+
+        bool bAlreadyInIndex = false;
+        for (int j = 0; !bAlreadyInIndex && j < nExistingFiles; j++)
+        {
+            bAlreadyInIndex =
+                EQUAL(aosFileNamesToWrite.back().c_str(), existingFilesTab[j]);
         }
+        abAlreadyInIndex.push_back(bAlreadyInIndex);
+    }
+
+    // With several threads, input files are opened by batches on the thread
+    // pool, and then processed sequentially in the command line order.
+    const int nOpenBatchSize = 4 * nThreads;
+    int iNextArgToOpen = iFirstFileArg;
+    std::vector<OpenedDataset> aoOpenedDS;
+    std::vector<int> anOpenedDSArg;  // argv index of each aoOpenedDS[] item
+    const auto CloseOpenedDatasets = [&aoOpenedDS, &anOpenedDSArg]()
+    {
+        for (const auto &oOpenedDS : aoOpenedDS)
+        {
+            if (oOpenedDS.hDS)
+                GDALClose(oOpenedDS.hDS);
+        }
+        aoOpenedDS.clear();
+        anOpenedDSArg.clear();
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      loop over GDAL files, processing.                               */
+    /* -------------------------------------------------------------------- */
+    for (; nRetCode == 0 && iArg < argc; iArg++)
+    {
+        char *fileNameToWrite =
+            CPLStrdup(aosFileNamesToWrite[iArg - iFirstFileArg].c_str());
 
         // Checks that file is not already in tileindex.
+        if (abAlreadyInIndex[iArg - iFirstFileArg])
         {
-            int i = 0;  // Used after for.
-            for (; i < nExistingFiles; i++)
+            fprintf(stderr, "File %s is already in tileindex. Skipping it.\n",
+                    fileNameToWrite);
+            CPLFree(fileNameToWrite);
+            continue;
+        }
+
+        GDALDatasetH hDS = nullptr;
+        if (nThreads > 1)
+        {
+            if (iArg >= iNextArgToOpen)
             {
-                if (EQUAL(fileNameToWrite, existingFilesTab[i]))
+                CloseOpenedDatasets();
+                std::vector<const char *> apszFilenamesToOpen;
+                for (; iNextArgToOpen < argc &&
+                       static_cast<int>(apszFilenamesToOpen.size()) <
+                           nOpenBatchSize;
+                     ++iNextArgToOpen)
                 {
-                    fprintf(stderr,
-                            "File %s is already in tileindex. Skipping it.\n",
-                            fileNameToWrite);
-                    break;
+                    if (!abAlreadyInIndex[iNextArgToOpen - iFirstFileArg])
+                    {
+                        anOpenedDSArg.push_back(iNextArgToOpen);
+                        apszFilenamesToOpen.push_back(argv[iNextArgToOpen]);
+                    }
                 }
+                aoOpenedDS = OpenDatasetsInParallel(
+                    apszFilenamesToOpen.data(),
+                    static_cast<int>(apszFilenamesToOpen.size()),
+                    GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR, nullptr,
+                    nThreads);
             }
-            if (i != nExistingFiles)
-            {
-                CPLFree(fileNameToWrite);
-                continue;
-            }
+            const auto oIter =
+                std::find(anOpenedDSArg.begin(), anOpenedDSArg.end(), iArg);
+            CPLAssert(oIter != anOpenedDSArg.end());
+            hDS = aoOpenedDS[oIter - anOpenedDSArg.begin()].Release();
+        }
+        else
+        {
+            hDS = GDALOpen(argv[iArg], GA_ReadOnly);
         }
-
-        GDALDatasetH hDS = GDALOpen(argv[iArg], GA_ReadOnly);
         if (hDS == nullptr)
         {
             fprintf(stderr, "Unable to open %s, skipping.\n", argv[iArg]);
@@ -718,6 +787,7 @@ MAIN_START(argc, argv)
         GDALClose(hDS);
     }
 
+    CloseOpenedDatasets();
     CPLFree(current_path);
 
     if (nExistingFiles)
@@ -850,3 +850,62 @@ def test_rasterize_bugfix_gh6981():
         )
         == gdal.CE_None
     )
+
+
+###############################################################################
+# Test multi-threaded rasterization
+
+
+@pytest.mark.parametrize("all_touched", [False, True])
+@pytest.mark.parametrize("merge_alg", ["REPLACE", "ADD"])
+@pytest.mark.parametrize("chunkysize", [None, "100"])
+def test_rasterize_num_threads(all_touched, merge_alg, chunkysize):
+
+    sr = osr.SpatialReference()
+    sr.SetFromUserInput("EPSG:32631")
+
+    mem_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = mem_ds.CreateLayer("test", srs=sr)
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+    for i in range(200):
+        x = 500000 + (i * 37) % 1000
+        y = 4500000 + (i * 53) % 1000
+        size = 5 + (i * 7) % 200
+        feat = ogr.Feature(lyr.GetLayerDefn())
+        feat["val"] = i % 10
+        if i % 3 == 0:
+            wkt = f"LINESTRING({x} {y},{x + size} {y + size / 2})"
+        elif i % 3 == 1:
+            wkt = f"MULTIPOINT(({x} {y}),({x + size} {y}))"
+        else:
+            wkt = (
+                f"MULTIPOLYGON((({x} {y},{x} {y + size},{x + size} {y + size},"
+                f"{x + size} {y},{x} {y})),(({x + size + 10} {y},"
+                f"{x + size + 10} {y + 10},{x + size + 20} {y},"
+                f"{x + size + 10} {y})))"
+            )
+        feat.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(feat)
+
+    options = ["ATTRIBUTE=val", "MERGE_ALG=" + merge_alg]
+    if all_touched:
+        options.append("ALL_TOUCHED=YES")
+    if chunkysize:
+        options.append("CHUNKYSIZE=" + chunkysize)
+
+    def rasterize(num_threads):
+        ds = gdal.GetDriverByName("MEM").Create("", 1300, 1200, 2, gdal.GDT_Float32)
+        ds.SetGeoTransform([499900, 1, 0, 4501100, 0, -1])
+        ds.SetSpatialRef(sr)
+        ret = gdal.RasterizeLayer(
+            ds,
+            [1, 2],
+            lyr,
+            options=options + ["NUM_THREADS=" + num_threads],
+        )
+        assert ret == gdal.CE_None
+        return [ds.GetRasterBand(i + 1).ReadRaster() for i in range(2)]
+
+    ref = rasterize("1")
+    assert ref == rasterize("4")
+    assert ref == rasterize("ALL_CPUS")
@@ -1912,3 +1912,31 @@ def test_warp_max_downsampling_missed_edges():
 
     ds = gdal.Open("data/bug_6526_warped.vrt")
     assert ds.GetRasterBand(1).ComputeRasterMinMax() == (1, 1)
+
+
+###############################################################################
+# Test the grid-based approximation of the approximate transformer
+
+
+@pytest.mark.parametrize("grid_size", ["4", "16", "1000"])
+def test_warp_approx_transformer_grid(grid_size):
+    numpy = pytest.importorskip("numpy")
+
+    def warp(errorThreshold):
+        return gdal.Warp(
+            "",
+            "../gcore/data/byte.tif",
+            format="MEM",
+            dstSRS="EPSG:4326",
+            resampleAlg="bilinear",
+            errorThreshold=errorThreshold,
+        )
+
+    ref_ds = warp(0)
+    with gdaltest.config_option("GDAL_APPROX_TRANSFORMER_GRID_SIZE", grid_size):
+        ds = warp(0.125)
+    assert ds.RasterXSize == ref_ds.RasterXSize
+    assert ds.RasterYSize == ref_ds.RasterYSize
+    ref = ref_ds.GetRasterBand(1).ReadAsArray().astype(numpy.float64)
+    got = ds.GetRasterBand(1).ReadAsArray().astype(numpy.float64)
+    assert numpy.mean(numpy.abs(got - ref)) < 1
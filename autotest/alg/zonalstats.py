@@ -0,0 +1,343 @@
+#!/usr/bin/env pytest
+###############################################################################
+# $Id$
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  Test ZonalStatistics() algorithm.
+# Author:   agent <agent@local>
+#
+###############################################################################
+# Copyright (c) 2026, agent <agent@local>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import struct
+
+import gdaltest
+import pytest
+
+from osgeo import gdal, ogr
+
+###############################################################################
+# Return the values of a window of a Byte band
+
+
+def _read_values(band, xoff, yoff, xsize, ysize):
+
+    data = band.ReadRaster(xoff, yoff, xsize, ysize, buf_type=gdal.GDT_Byte)
+    return list(struct.unpack("B" * (xsize * ysize), data))
+
+
+###############################################################################
+# Create a zone layer, with polygons given in pixel coordinates of byte.tif
+
+
+def _create_zone_layer(ds, pixel_rects):
+
+    gt = ds.GetGeoTransform()
+    zone_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    zone_lyr = zone_ds.CreateLayer("zones", ds.GetSpatialRef(), ogr.wkbPolygon)
+    zone_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i, (x1, y1, x2, y2) in enumerate(pixel_rects):
+        X1 = gt[0] + x1 * gt[1]
+        X2 = gt[0] + x2 * gt[1]
+        Y1 = gt[3] + y1 * gt[5]
+        Y2 = gt[3] + y2 * gt[5]
+        f = ogr.Feature(zone_lyr.GetLayerDefn())
+        f["id"] = i + 1
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt(
+                "POLYGON((%f %f,%f %f,%f %f,%f %f,%f %f))"
+                % (X1, Y1, X1, Y2, X2, Y2, X2, Y1, X1, Y1)
+            )
+        )
+        zone_lyr.CreateFeature(f)
+    return zone_ds, zone_lyr
+
+
+def _create_output_layer():
+
+    out_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    out_lyr = out_ds.CreateLayer("out", None, ogr.wkbPolygon)
+    out_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    return out_ds, out_lyr
+
+
+###############################################################################
+# Test count/sum/min/max/mean of rectangular zones against the pixel values
+
+
+def test_zonalstats_basic():
+
+    ds = gdal.Open("../gcore/data/byte.tif")
+    band = ds.GetRasterBand(1)
+    # Overlapping zones, and a zone outside of the raster
+    rects = [(0, 0, 10, 10), (5, 5, 20, 12), (100, 100, 110, 110)]
+    zone_ds, zone_lyr = _create_zone_layer(ds, rects)
+    out_ds, out_lyr = _create_output_layer()
+
+    assert gdal.ZonalStatistics(band, zone_lyr, out_lyr) == 0
+
+    assert out_lyr.GetFeatureCount() == 3
+    out_lyr.ResetReading()
+    for x1, y1, x2, y2 in rects[0:2]:
+        f = out_lyr.GetNextFeature()
+        values = _read_values(band, x1, y1, x2 - x1, y2 - y1)
+        assert f["count"] == len(values)
+        assert f["sum"] == sum(values)
+        assert f["min"] == min(values)
+        assert f["max"] == max(values)
+        assert f["mean"] == pytest.approx(sum(values) / len(values))
+        assert f.GetGeometryRef() is not None
+
+    f = out_lyr.GetNextFeature()
+    assert f["id"] == 3
+    assert f["count"] == 0
+    assert f["sum"] == 0
+    assert not f.IsFieldSet("mean")
+    assert not f.IsFieldSet("min")
+    assert not f.IsFieldSet("max")
+
+    zone_ds = None
+    out_ds = None
+
+
+###############################################################################
+# Test histogram computation
+
+
+def test_zonalstats_histogram():
+
+    ds = gdal.Open("../gcore/data/byte.tif")
+    band = ds.GetRasterBand(1)
+    zone_ds, zone_lyr = _create_zone_layer(ds, [(0, 0, 20, 20)])
+    out_ds, out_lyr = _create_output_layer()
+
+    assert (
+        gdal.ZonalStatistics(
+            band,
+            zone_lyr,
+            out_lyr,
+            options=["HISTOGRAM_BUCKETS=256"],
+        )
+        == 0
+    )
+    f = out_lyr.GetNextFeature()
+    assert f.GetFieldAsInteger64List("histogram") == band.GetHistogram(
+        approx_ok=0
+    )
+
+    out_ds, out_lyr = _create_output_layer()
+    assert (
+        gdal.ZonalStatistics(band, zone_lyr, out_lyr, options=["HISTOGRAM_BUCKETS=0"])
+        == 0
+    )
+    assert out_lyr.GetLayerDefn().GetFieldIndex("histogram") < 0
+
+    # Non Byte band: HISTOGRAM_MIN/MAX are required
+    float_ds = gdal.Translate("", ds, format="MEM", outputType=gdal.GDT_Float32)
+    out_ds, out_lyr = _create_output_layer()
+    with gdaltest.error_handler():
+        assert (
+            gdal.ZonalStatistics(
+                float_ds.GetRasterBand(1),
+                zone_lyr,
+                out_lyr,
+                options=["HISTOGRAM_BUCKETS=10"],
+            )
+            != 0
+        )
+
+    out_ds, out_lyr = _create_output_layer()
+    assert (
+        gdal.ZonalStatistics(
+            float_ds.GetRasterBand(1),
+            zone_lyr,
+            out_lyr,
+            options=[
+                "HISTOGRAM_BUCKETS=2",
+                "HISTOGRAM_MIN=0",
+                "HISTOGRAM_MAX=256",
+            ],
+        )
+        == 0
+    )
+    f = out_lyr.GetNextFeature()
+    values = _read_values(band, 0, 0, 20, 20)
+    assert f.GetFieldAsInteger64List("histogram") == [
+        len([v for v in values if v < 128]),
+        len([v for v in values if v >= 128]),
+    ]
+
+
+###############################################################################
+# Test that nodata pixels are ignored
+
+
+def test_zonalstats_nodata():
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    ds = gdal.Translate("", src_ds, format="MEM")
+    band = ds.GetRasterBand(1)
+    values = _read_values(band, 0, 0, 20, 20)
+    nodata = values[0]
+    band.SetNoDataValue(nodata)
+
+    zone_ds, zone_lyr = _create_zone_layer(ds, [(0, 0, 20, 20)])
+    out_ds, out_lyr = _create_output_layer()
+    assert gdal.ZonalStatistics(band, zone_lyr, out_lyr) == 0
+
+    valid = [v for v in values if v != nodata]
+    f = out_lyr.GetNextFeature()
+    assert f["count"] == len(valid)
+    assert f["sum"] == sum(valid)
+    assert f["min"] == min(valid)
+
+
+###############################################################################
+# Test ALL_TOUCHED
+
+
+def test_zonalstats_all_touched():
+
+    ds = gdal.Open("../gcore/data/byte.tif")
+    band = ds.GetRasterBand(1)
+    # Zone not covering any pixel center
+    zone_ds, zone_lyr = _create_zone_layer(ds, [(2.6, 2.6, 3.4, 4.4)])
+
+    out_ds, out_lyr = _create_output_layer()
+    assert gdal.ZonalStatistics(band, zone_lyr, out_lyr) == 0
+    f = out_lyr.GetNextFeature()
+    assert f["count"] == 0
+
+    out_ds, out_lyr = _create_output_layer()
+    assert (
+        gdal.ZonalStatistics(band, zone_lyr, out_lyr, options=["ALL_TOUCHED=YES"])
+        == 0
+    )
+    f = out_lyr.GetNextFeature()
+    values = _read_values(band, 2, 2, 2, 3)
+    assert f["count"] == len(values)
+    assert f["sum"] == sum(values)
+
+
+###############################################################################
+# Test that results do not depend on the number of threads, on a raster made
+# of several processing windows
+
+
+def test_zonalstats_num_threads():
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    ds = gdal.GetDriverByName("MEM").Create("", 2000, 1500)
+    ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    data = src_ds.GetRasterBand(1).ReadRaster(buf_xsize=2000, buf_ysize=1500)
+    ds.GetRasterBand(1).WriteRaster(0, 0, 2000, 1500, data)
+    band = ds.GetRasterBand(1)
+
+    rects = [
+        (0, 0, 2000, 1500),
+        (10.5, 20.5, 1500.5, 1400.5),
+        (900, 100, 1100, 1300),
+        (1990, 1490, 2000, 1500),
+    ]
+    zone_ds, zone_lyr = _create_zone_layer(ds, rects)
+
+    results = []
+    for num_threads in (1, 4):
+        out_ds, out_lyr = _create_output_layer()
+        assert (
+            gdal.ZonalStatistics(
+                band,
+                zone_lyr,
+                out_lyr,
+                options=["NUM_THREADS=%d" % num_threads, "HISTOGRAM_BUCKETS=16"],
+            )
+            == 0
+        )
+        results.append(
+            [
+                (
+                    f["count"],
+                    f["sum"],
+                    f["min"],
+                    f["max"],
+                    f.GetFieldAsInteger64List("histogram"),
+                )
+                for f in out_lyr
+            ]
+        )
+    assert results[0] == results[1]
+
+    assert results[0][0][0] == 2000 * 1500
+    values = _read_values(band, 1990, 1490, 10, 10)
+    assert results[0][3][0] == len(values)
+    assert results[0][3][1] == sum(values)
+
+
+###############################################################################
+# Test that zones spanning several processing windows, whose rings are clipped
+# to each window, cover the same pixels as gdal.Rasterize()
+
+
+@pytest.mark.parametrize("all_touched", [False, True])
+def test_zonalstats_zone_across_windows(all_touched):
+
+    numpy = pytest.importorskip("numpy")
+
+    ds = gdal.GetDriverByName("MEM").Create("", 1500, 1200)
+    ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    ar = (numpy.arange(1500 * 1200) % 251).astype(numpy.uint8).reshape(1200, 1500)
+    ds.GetRasterBand(1).WriteArray(ar)
+    band = ds.GetRasterBand(1)
+
+    zone_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    zone_lyr = zone_ds.CreateLayer("zones", None, ogr.wkbPolygon)
+    for wkt in [
+        # Concave polygon with a hole, crossing all windows
+        "POLYGON((-10.3 10.7,1400.2 -50.1,700.6 600.4,1490.9 1150.3,"
+        "20.1 1190.8,-10.3 10.7),"
+        "(300.5 300.5,500.5 900.5,900.2 800.1,300.5 300.5))",
+        # Thin diagonal sliver
+        "POLYGON((0 -1,1499 -1199,1499.5 -1199,0.5 -1,0 -1))",
+    ]:
+        f = ogr.Feature(zone_lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        zone_lyr.CreateFeature(f)
+
+    out_ds, out_lyr = _create_output_layer()
+    options = ["ALL_TOUCHED=YES"] if all_touched else []
+    assert gdal.ZonalStatistics(band, zone_lyr, out_lyr, options=options) == 0
+
+    for i, f in enumerate(out_lyr):
+        mask_ds = gdal.GetDriverByName("MEM").Create("", 1500, 1200)
+        mask_ds.SetGeoTransform(ds.GetGeoTransform())
+        zone_lyr.SetAttributeFilter("FID = %d" % i)
+        gdal.RasterizeLayer(
+            mask_ds,
+            [1],
+            zone_lyr,
+            burn_values=[1],
+            options=["ALL_TOUCHED=TRUE"] if all_touched else [],
+        )
+        zone_lyr.SetAttributeFilter(None)
+        values = ar[mask_ds.GetRasterBand(1).ReadAsArray() == 1]
+        assert f["count"] == values.size
+        assert f["sum"] == int(values.sum(dtype=numpy.int64))
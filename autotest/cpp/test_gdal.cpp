@@ -38,6 +38,8 @@
 
 #include <limits>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "test_data.h"
 
@@ -3311,4 +3313,256 @@ TEST_F(test_gdal, jpegxl_jpeg_compatible_ReadCompressedData)
     }
 }
 
+// Test GDAL_OF_THREAD_SAFE
+TEST_F(test_gdal, thread_safe_dataset)
+{
+    // Incompatible flags
+    {
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_EQ(GDALDataset::Open(GCORE_DATA_DIR "rgbsmall.tif",
+                                    GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE |
+                                        GDAL_OF_UPDATE),
+                  nullptr);
+        EXPECT_EQ(GDALDataset::Open(GCORE_DATA_DIR "rgbsmall.tif",
+                                    GDAL_OF_VECTOR | GDAL_OF_THREAD_SAFE),
+                  nullptr);
+    }
+
+    GDALDatasetUniquePtr poRefDS(
+        GDALDataset::Open(GCORE_DATA_DIR "rgbsmall.tif"));
+    ASSERT_TRUE(poRefDS != nullptr);
+    const int nXSize = poRefDS->GetRasterXSize();
+    const int nYSize = poRefDS->GetRasterYSize();
+    const int nBands = poRefDS->GetRasterCount();
+    std::vector<GByte> abyRef(static_cast<size_t>(nXSize) * nYSize * nBands);
+    ASSERT_EQ(poRefDS->RasterIO(GF_Read, 0, 0, nXSize, nYSize, abyRef.data(),
+                                nXSize, nYSize, GDT_Byte, nBands, nullptr, 0,
+                                0, 0, nullptr),
+              CE_None);
+
+    GDALDatasetUniquePtr poDS(GDALDataset::Open(
+        GCORE_DATA_DIR "rgbsmall.tif", GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE));
+    ASSERT_TRUE(poDS != nullptr);
+    EXPECT_EQ(poDS->GetRasterXSize(), nXSize);
+    EXPECT_EQ(poDS->GetRasterYSize(), nYSize);
+    EXPECT_EQ(poDS->GetRasterCount(), nBands);
+    EXPECT_STREQ(poDS->GetDriverName(), "GTiff");
+    double adfGT[6] = {0};
+    EXPECT_EQ(poDS->GetGeoTransform(adfGT), CE_None);
+    {
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_EQ(poDS->SetMetadataItem("FOO", "BAR"), CE_Failure);
+        EXPECT_EQ(poDS->GetRasterBand(1)->SetNoDataValue(0), CE_Failure);
+    }
+
+    constexpr int N_THREADS = 8;
+    std::vector<std::thread> aoThreads;
+    std::vector<int> anErrors(N_THREADS, 0);
+    for (int iThread = 0; iThread < N_THREADS; ++iThread)
+    {
+        aoThreads.emplace_back(
+            [&poDS, &abyRef, &anErrors, iThread, nXSize, nYSize, nBands]()
+            {
+                std::vector<GByte> abyData(abyRef.size());
+                for (int iIter = 0; iIter < 20; ++iIter)
+                {
+                    if (poDS->RasterIO(GF_Read, 0, 0, nXSize, nYSize,
+                                       abyData.data(), nXSize, nYSize,
+                                       GDT_Byte, nBands, nullptr, 0, 0, 0,
+                                       nullptr) != CE_None ||
+                        abyData != abyRef)
+                    {
+                        anErrors[iThread]++;
+                    }
+                    // Band-level access
+                    const int iBand = 1 + (iIter % nBands);
+                    if (poDS->GetRasterBand(iBand)->RasterIO(
+                            GF_Read, 0, 0, nXSize, nYSize, abyData.data(),
+                            nXSize, nYSize, GDT_Byte, 0, 0,
+                            nullptr) != CE_None ||
+                        memcmp(abyData.data(),
+                               abyRef.data() + static_cast<size_t>(iBand - 1) *
+                                                   nXSize * nYSize,
+                               static_cast<size_t>(nXSize) * nYSize) != 0)
+                    {
+                        anErrors[iThread]++;
+                    }
+                }
+            });
+    }
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    for (int iThread = 0; iThread < N_THREADS; ++iThread)
+    {
+        EXPECT_EQ(anErrors[iThread], 0);
+    }
+}
+
+// Test overviews of mask bands of a GDAL_OF_THREAD_SAFE dataset
+TEST_F(test_gdal, thread_safe_dataset_mask_overview)
+{
+    auto poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+    const char *pszFilename = "/vsimem/thread_safe_dataset_mask_overview.tif";
+    {
+        GDALDatasetUniquePtr poSrcDS(
+            poGTiffDrv->Create(pszFilename, 20, 20, 1, GDT_Byte, nullptr));
+        ASSERT_TRUE(poSrcDS != nullptr);
+        ASSERT_EQ(poSrcDS->CreateMaskBand(GMF_PER_DATASET), CE_None);
+        ASSERT_EQ(poSrcDS->GetRasterBand(1)->GetMaskBand()->Fill(255),
+                  CE_None);
+        const int nOvrFactor = 2;
+        ASSERT_EQ(poSrcDS->BuildOverviews("NEAREST", 1, &nOvrFactor, 0,
+                                          nullptr, nullptr, nullptr, nullptr),
+                  CE_None);
+    }
+
+    {
+        GDALDatasetUniquePtr poDS(GDALDataset::Open(
+            pszFilename, GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poMaskBand = poDS->GetRasterBand(1)->GetMaskBand();
+        ASSERT_EQ(poMaskBand->GetOverviewCount(), 1);
+        auto poMaskOvrBand = poMaskBand->GetOverview(0);
+        ASSERT_TRUE(poMaskOvrBand != nullptr);
+        EXPECT_EQ(poMaskOvrBand->GetXSize(), 10);
+
+        // The same wrapping band must be returned to other threads, and be
+        // usable from them.
+        GDALRasterBand *poMaskOvrBandOtherThread = nullptr;
+        std::vector<GByte> abyData(10 * 10);
+        CPLErr eErr = CE_Failure;
+        std::thread oThread(
+            [&poMaskBand, &poMaskOvrBandOtherThread, &abyData, &eErr]()
+            {
+                poMaskOvrBandOtherThread = poMaskBand->GetOverview(0);
+                if (poMaskOvrBandOtherThread)
+                {
+                    eErr = poMaskOvrBandOtherThread->RasterIO(
+                        GF_Read, 0, 0, 10, 10, abyData.data(), 10, 10,
+                        GDT_Byte, 0, 0, nullptr);
+                }
+            });
+        oThread.join();
+        EXPECT_EQ(poMaskOvrBandOtherThread, poMaskOvrBand);
+        EXPECT_EQ(eErr, CE_None);
+        EXPECT_EQ(abyData[0], 255);
+    }
+
+    VSIUnlink(pszFilename);
+}
+
+// Test GDALRasterBand::InterpolateAtPoints() with nodata, kernels crossing
+// block boundaries and an unreadable block
+TEST_F(test_gdal, InterpolateAtPoints)
+{
+    auto poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+    const char *pszFilename = "/vsimem/InterpolateAtPoints.tif";
+    constexpr int SIZE = 32;
+    {
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("TILED", "YES");
+        aosOptions.SetNameValue("BLOCKXSIZE", "16");
+        aosOptions.SetNameValue("BLOCKYSIZE", "16");
+        aosOptions.SetNameValue("COMPRESS", "DEFLATE");
+        GDALDatasetUniquePtr poDS(poGTiffDrv->Create(
+            pszFilename, SIZE, SIZE, 1, GDT_Byte, aosOptions.List()));
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GByte> abyData(SIZE * SIZE);
+        for (int iY = 0; iY < SIZE; ++iY)
+            for (int iX = 0; iX < SIZE; ++iX)
+                abyData[iY * SIZE + iX] = static_cast<GByte>(iX + iY);
+        abyData[15 * SIZE + 15] = 255;
+        auto poBand = poDS->GetRasterBand(1);
+        ASSERT_EQ(poBand->SetNoDataValue(255), CE_None);
+        ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, SIZE, SIZE, abyData.data(),
+                                   SIZE, SIZE, GDT_Byte, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    // Points in random block order. The bilinear kernel of the last one
+    // covers the 4 blocks, and its top-left pixel is nodata.
+    const double adfPixel[] = {20.5, 0.5, -1, 10.5, 16};
+    const double adfLine[] = {0.5, 20.5, 0.5, 10.5, 16};
+    constexpr size_t N_POINTS = sizeof(adfPixel) / sizeof(adfPixel[0]);
+    double adfValues[N_POINTS];
+    int abSuccess[N_POINTS];
+    {
+        GDALDatasetUniquePtr poDS(GDALDataset::Open(pszFilename));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poBand = poDS->GetRasterBand(1);
+        ASSERT_EQ(poBand->InterpolateAtPoints(N_POINTS, adfPixel, adfLine,
+                                              GRIORA_Bilinear, adfValues,
+                                              abSuccess),
+                  CE_None);
+        EXPECT_TRUE(abSuccess[0]);
+        EXPECT_NEAR(adfValues[0], 20, 1e-10);
+        EXPECT_TRUE(abSuccess[1]);
+        EXPECT_NEAR(adfValues[1], 20, 1e-10);
+        EXPECT_FALSE(abSuccess[2]);
+        EXPECT_TRUE(abSuccess[3]);
+        EXPECT_NEAR(adfValues[3], 20, 1e-10);
+        EXPECT_TRUE(abSuccess[4]);
+        EXPECT_NEAR(adfValues[4], (31 + 31 + 32) / 3.0, 1e-10);
+
+        ASSERT_EQ(poBand->InterpolateAtPoints(N_POINTS, adfPixel, adfLine,
+                                              GRIORA_NearestNeighbour,
+                                              adfValues, abSuccess),
+                  CE_None);
+        EXPECT_EQ(adfValues[0], 20);
+        EXPECT_FALSE(abSuccess[2]);
+        EXPECT_EQ(adfValues[4], 32);
+    }
+
+    // Corrupt the top-right block
+    {
+        GDALDatasetUniquePtr poDS(GDALDataset::Open(pszFilename));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poBand = poDS->GetRasterBand(1);
+        const char *pszOffset =
+            poBand->GetMetadataItem("BLOCK_OFFSET_1_0", "TIFF");
+        const char *pszSize = poBand->GetMetadataItem("BLOCK_SIZE_1_0", "TIFF");
+        ASSERT_TRUE(pszOffset != nullptr);
+        ASSERT_TRUE(pszSize != nullptr);
+        const vsi_l_offset nOffset =
+            static_cast<vsi_l_offset>(CPLAtoGIntBig(pszOffset));
+        std::vector<GByte> abyGarbage(atoi(pszSize), 0xFF);
+        poDS.reset();
+        VSILFILE *fp = VSIFOpenL(pszFilename, "rb+");
+        ASSERT_TRUE(fp != nullptr);
+        EXPECT_EQ(VSIFSeekL(fp, nOffset, SEEK_SET), 0);
+        EXPECT_EQ(VSIFWriteL(abyGarbage.data(), 1, abyGarbage.size(), fp),
+                  abyGarbage.size());
+        VSIFCloseL(fp);
+    }
+
+    // Only the points depending on the corrupted block fail
+    {
+        GDALDatasetUniquePtr poDS(GDALDataset::Open(pszFilename));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poBand = poDS->GetRasterBand(1);
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_EQ(poBand->InterpolateAtPoints(N_POINTS, adfPixel, adfLine,
+                                              GRIORA_Bilinear, adfValues,
+                                              abSuccess),
+                  CE_Failure);
+        EXPECT_FALSE(abSuccess[0]);
+        EXPECT_TRUE(abSuccess[1]);
+        EXPECT_NEAR(adfValues[1], 20, 1e-10);
+        EXPECT_FALSE(abSuccess[2]);
+        EXPECT_TRUE(abSuccess[3]);
+        EXPECT_NEAR(adfValues[3], 20, 1e-10);
+        EXPECT_FALSE(abSuccess[4]);
+    }
+
+    VSIUnlink(pszFilename);
+}
+
 }  // namespace
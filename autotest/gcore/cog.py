@@ -1643,3 +1643,73 @@ def test_cog_overview_count_existing():
     assert ds.GetRasterBand(1).GetOverview(0).Checksum() == 0
     ds = None
     gdal.Unlink(tmpfilename)
+
+
+###############################################################################
+# Test that temporary files can be created in /vsimem/ or on disk depending
+# on COG_TMP_MAX_MEM, with the same result
+
+
+def test_cog_tmp_max_mem():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1024, 1024, 2)
+    src_ds.GetRasterBand(1).Fill(255)
+    src_ds.GetRasterBand(2).Fill(128)
+    src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+    src_ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+        0, 0, 512, 512, b"\xff" * (512 * 512)
+    )
+
+    checksums = []
+    for tmp_max_mem in (None, "0"):
+        tmpfilename = "tmp/test_cog_tmp_max_mem.tif"
+        vsimem_files_before = set(gdal.ReadDir("/vsimem/") or [])
+        tmp_files_before = set(gdal.ReadDir("tmp") or [])
+        # Temporary files present while the overviews are computed
+        vsimem_tmp_files = set()
+        tmp_tmp_files = set()
+
+        def progress(pct, msg, user_data):
+            vsimem_tmp_files.update(
+                set(gdal.ReadDir("/vsimem/") or []) - vsimem_files_before
+            )
+            tmp_tmp_files.update(
+                set(gdal.ReadDir("tmp") or [])
+                - tmp_files_before
+                - set(["test_cog_tmp_max_mem.tif"])
+            )
+            return 1
+
+        with gdaltest.config_option("COG_TMP_MAX_MEM", tmp_max_mem):
+            assert gdal.GetDriverByName("COG").CreateCopy(
+                tmpfilename, src_ds, options=["BLOCKSIZE=256"], callback=progress
+            )
+        # Overviews of the mask and of the imagery
+        if tmp_max_mem == "0":
+            assert vsimem_tmp_files == set()
+            assert tmp_tmp_files == set(
+                [
+                    "test_cog_tmp_max_mem.tif.msk.ovr.tmp",
+                    "test_cog_tmp_max_mem.tif.ovr.tmp",
+                ]
+            )
+        else:
+            assert len(vsimem_tmp_files) == 2
+            assert tmp_tmp_files == set()
+        # Check that no temporary file has been left behind
+        assert set(gdal.ReadDir("/vsimem/") or []) == vsimem_files_before
+        assert set(gdal.ReadDir("tmp")) == tmp_files_before | set(
+            ["test_cog_tmp_max_mem.tif"]
+        )
+
+        ds = gdal.Open(tmpfilename)
+        band = ds.GetRasterBand(1)
+        assert band.GetOverviewCount() == 2
+        checksums.append(
+            [band.GetOverview(i).Checksum() for i in range(2)]
+            + [band.GetMaskBand().GetOverview(i).Checksum() for i in range(2)]
+        )
+        ds = None
+        gdal.Unlink(tmpfilename)
+
+    assert checksums[0] == checksums[1]
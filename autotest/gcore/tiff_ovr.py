@@ -2801,6 +2801,52 @@ def test_tiff_ovr_external_3_px_wide_1_px_tall():
     gdal.GetDriverByName("GTiff").Delete(temp_path)
 
 
+###############################################################################
+# Test that computing cascaded overview levels from RAM gives the same result
+# as reading back the previous level from the file
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("compress", ["NONE", "DEFLATE"])
+def test_tiff_ovr_cascading_in_memory(num_threads, compress):
+
+    src_ds = gdal.Open("data/byte.tif")
+    ref_ds = gdal.Translate(
+        "", src_ds, format="MEM", width=500, height=400, resampleAlg="cubic"
+    )
+
+    def build(filename, cascading_max_mem):
+        gdal.Translate(
+            filename,
+            ref_ds,
+            options="-b 1 -b 1 -b 1 -co INTERLEAVE=PIXEL -co TILED=YES "
+            "-co COMPRESS=" + compress,
+        )
+        ds = gdal.Open(filename, gdal.GA_Update)
+        with gdaltest.config_options(
+            {
+                "GDAL_NUM_THREADS": num_threads,
+                "GDAL_OVR_CASCADING_MAX_MEM": cascading_max_mem,
+            }
+        ):
+            assert ds.BuildOverviews("AVERAGE", [2, 4, 8, 16]) == 0
+        ret = [
+            [
+                ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+                for j in range(ds.GetRasterBand(1).GetOverviewCount())
+            ]
+            for i in range(ds.RasterCount)
+        ]
+        ds = None
+        gdal.Unlink(filename)
+        return ret
+
+    ref = build("/vsimem/test_tiff_ovr_cascading_in_memory_ref.tif", "0")
+    assert len(ref[0]) == 4
+    got = build("/vsimem/test_tiff_ovr_cascading_in_memory.tif", "1000000000")
+    assert got == ref
+
+
 ###############################################################################
 # Cleanup
 
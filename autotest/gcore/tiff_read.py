@@ -5056,3 +5056,67 @@ def test_tiff_read_projection_from_esri_xml_get_file_list():
             "data/gtiff/projection_from_esri_xml.xml",
         ]
     )
+
+
+###############################################################################
+# Test read-ahead of blocks when reading block by block in sequential order
+
+
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+def test_tiff_read_block_read_ahead(interleave):
+
+    tmpfilename = "/vsimem/test_tiff_read_block_read_ahead.tif"
+    src_ds = gdal.Translate(
+        "", "data/byte.tif", options="-of MEM -outsize 100 100 -b 1 -b 1"
+    )
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        tmpfilename,
+        src_ds,
+        options=[
+            "TILED=YES",
+            "BLOCKXSIZE=16",
+            "BLOCKYSIZE=16",
+            "COMPRESS=LZW",
+            "INTERLEAVE=" + interleave,
+        ],
+    )
+
+    class my_error_handler(object):
+        def __init__(self):
+            self.debug_msg_list = []
+
+        def handler(self, eErrClass, err_no, msg):
+            if eErrClass == gdal.CE_Debug:
+                self.debug_msg_list.append(msg)
+
+    handler = my_error_handler()
+    with gdaltest.config_options(
+        {"GTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE": "YES", "CPL_DEBUG": "GTiff"}
+    ):
+        ds = gdal.Open(tmpfilename)
+        blocks = []
+        try:
+            gdal.PushErrorHandler(handler.handler)
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            for band_idx in (1, 2):
+                band = ds.GetRasterBand(band_idx)
+                for y in range(7):
+                    for x in range(7):
+                        blocks.append(band.ReadBlock(x, y))
+        finally:
+            gdal.PopErrorHandler()
+        ds = None
+
+    assert [x for x in handler.debug_msg_list if "Read-ahead" in x]
+
+    ds = gdal.Open(tmpfilename)
+    expected_blocks = []
+    for band_idx in (1, 2):
+        band = ds.GetRasterBand(band_idx)
+        for y in range(7):
+            for x in range(7):
+                expected_blocks.append(band.ReadBlock(x, y))
+    ds = None
+    assert blocks == expected_blocks
+
+    gdal.Unlink(tmpfilename)
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+###############################################################################
+# $Id$
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  Generate hdf5_chunked_compressed.h5
+# Author:   agent <agent@local>
+#
+###############################################################################
+# Copyright (c) 2026, agent <agent@local>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+# Chunked datasets using the shuffle and deflate filters, whose chunk sizes
+# are not multiple of the dataset dimensions, used by
+# test_hdf5_multithreaded_chunk_decoding()
+
+import os
+
+import h5py
+import numpy as np
+
+os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+with h5py.File("hdf5_chunked_compressed.h5", "w") as f:
+
+    y, x = np.mgrid[0:100, 0:70]
+    f.create_dataset(
+        "u16_shuffle_deflate",
+        data=((x * 7 + y * 1000) % 65536).astype("<u2"),
+        chunks=(32, 16),
+        shuffle=True,
+        compression="gzip",
+        compression_opts=6,
+    )
+
+    y, x = np.mgrid[0:50, 0:60]
+    f.create_dataset(
+        "i32be_deflate",
+        data=(-100000 + x * 3 + y * 5000).astype(">i4"),
+        chunks=(16, 16),
+        compression="gzip",
+        compression_opts=6,
+    )
+
+    z, y, x = np.mgrid[0:3, 0:40, 0:50]
+    f.create_dataset(
+        "f32_3d_shuffle_deflate",
+        data=(z * 10000.0 + y * 100.0 + x + 0.5).astype("<f4"),
+        chunks=(2, 16, 16),
+        shuffle=True,
+        compression="gzip",
+        compression_opts=6,
+    )
@@ -2166,3 +2166,44 @@ def test_grib_grib2_parameter_in_wmo_tables_only():
         ds.GetRasterBand(1).GetMetadataItem("GRIB_ELEMENT")
         == "Latent heat net flux due to evaporation"
     )
+
+
+###############################################################################
+# Test decoding the messages of several bands in parallel. subgrids.grib2 has
+# several subgrids in the same message, whose decoding relies on the state
+# kept by degrib between calls.
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/grib/broken_combined_grib2_grib1.grb2",
+        "data/grib/subgrids.grib2",
+        "data/grib/gfs.t06z.pgrb2.10p0.f010.grib2",
+    ],
+)
+@pytest.mark.parametrize("grib_cachemax", [None, "1"])
+def test_grib_read_multithreaded(filename, grib_cachemax):
+
+    ds = gdal.Open(filename)
+    expected_data = [
+        ds.GetRasterBand(i + 1).ReadRaster() for i in range(ds.RasterCount)
+    ]
+    ds = None
+
+    with gdaltest.config_option("GRIB_CACHEMAX", grib_cachemax):
+        ds = gdal.Open(filename)
+    tab = [0]
+
+    def my_progress(pct, msg, user_data):
+        assert pct >= tab[0]
+        tab[0] = pct
+        return 1
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        data = ds.ReadRaster(callback=my_progress)
+    assert tab[0] == 1.0
+    band_size = len(expected_data[0])
+    assert [
+        data[i * band_size : (i + 1) * band_size] for i in range(ds.RasterCount)
+    ] == expected_data
@@ -642,3 +642,99 @@ def test_hdf5_eos_sinu_projection():
         )
     ) == [i for i in range(5 * 4 * 3)]
     ds = None
+
+
+###############################################################################
+# Test multi-threaded decoding of chunks read with H5Dread_chunk()
+# The file has been generated with
+# data/hdf5/generate_hdf5_chunked_compressed.py, with a uint16 dataset using
+# the shuffle and deflate filters, a big-endian int32 dataset using deflate, and
+# a 3D float32 dataset using shuffle and deflate, with chunk sizes that are not
+# multiple of the dataset dimensions.
+
+
+@pytest.mark.parametrize(
+    "varname,struct_type,expected_func",
+    [
+        ("u16_shuffle_deflate", "H", lambda z, y, x: (x * 7 + y * 1000) % 65536),
+        ("i32be_deflate", "i", lambda z, y, x: -100000 + x * 3 + y * 5000),
+        (
+            "f32_3d_shuffle_deflate",
+            "f",
+            lambda z, y, x: z * 10000.0 + y * 100.0 + x + 0.5,
+        ),
+    ],
+)
+def test_hdf5_multithreaded_chunk_decoding(varname, struct_type, expected_func):
+
+    import struct
+
+    filename = 'HDF5:"data/hdf5/hdf5_chunked_compressed.h5"://' + varname
+
+    ds = gdal.Open(filename)
+    expected = []
+    for z in range(ds.RasterCount):
+        for y in range(ds.RasterYSize):
+            for x in range(ds.RasterXSize):
+                expected.append(expected_func(z, y, x))
+    ds = None
+
+    for num_threads in ("1", "4"):
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.Open(filename)
+            got = []
+            for i in range(ds.RasterCount):
+                band = ds.GetRasterBand(i + 1)
+                data = band.ReadRaster()
+                got += list(
+                    struct.unpack(
+                        struct_type * (ds.RasterXSize * ds.RasterYSize), data
+                    )
+                )
+            assert got == expected
+
+            # Sub-window not aligned on chunks, with data type conversion
+            data = ds.GetRasterBand(ds.RasterCount).ReadRaster(
+                3, 5, 30, 20, buf_type=gdal.GDT_Float64
+            )
+            z = ds.RasterCount - 1
+            assert list(struct.unpack("d" * (30 * 20), data)) == [
+                expected_func(z, y, x) for y in range(5, 25) for x in range(3, 33)
+            ]
+            ds = None
+
+
+###############################################################################
+# Test that an error raised when decoding a chunk in a worker thread is
+# emitted in the calling thread
+
+
+def test_hdf5_multithreaded_chunk_decoding_error(tmp_path):
+
+    filename = str(tmp_path / "hdf5_chunked_compressed_corrupted.h5")
+    with open("data/hdf5/hdf5_chunked_compressed.h5", "rb") as f:
+        data = bytearray(f.read())
+    # Corrupt the first deflate stream (chunks are compressed at level 6)
+    pos = data.find(b"\x78\x9c")
+    assert pos > 0
+    data[pos + 2 : pos + 10] = b"\xff" * 8
+    with open(filename, "wb") as f:
+        f.write(data)
+
+    msgs = []
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        for varname in (
+            "u16_shuffle_deflate",
+            "i32be_deflate",
+            "f32_3d_shuffle_deflate",
+        ):
+            ds = gdal.Open('HDF5:"%s"://%s' % (filename, varname))
+            for i in range(ds.RasterCount):
+                gdal.ErrorReset()
+                with gdal.quiet_errors():
+                    data = ds.GetRasterBand(i + 1).ReadRaster()
+                if data is None:
+                    msgs.append(gdal.GetLastErrorMsg())
+            ds = None
+    assert msgs
+    assert set(msgs) == set(["Decompression of chunk with zlib failed"])
@@ -29,6 +29,7 @@
 ###############################################################################
 
 import array
+import itertools
 import math
 import struct
 
@@ -2192,6 +2193,126 @@ def test_mem_md_array_statistics_float32():
     assert stats.valid_count == 5
 
 
+def test_mem_md_array_statistics_multithreaded():
+
+    drv = gdal.GetDriverByName("MEM")
+    ds = drv.CreateMultiDimensional("myds")
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", "unspecified type", "unspecified direction", 10)
+    dim1 = rg.CreateDimension("dim1", "unspecified type", "unspecified direction", 20)
+    dim2 = rg.CreateDimension("dim2", "unspecified type", "unspecified direction", 30)
+    float64dt = gdal.ExtendedDataType.Create(gdal.GDT_Float64)
+    ar = rg.CreateMDArray("myarray", [dim0, dim1, dim2], float64dt)
+    ar.SetNoDataValueDouble(0)
+    n = 10 * 20 * 30
+    data = struct.pack("d" * n, *[(i * 7) % 101 for i in range(n)])
+    ar.Write(data)
+
+    with gdaltest.config_options({"GDAL_SWATH_SIZE": "1000", "GDAL_NUM_THREADS": "1"}):
+        ref_stats = ar.ComputeStatistics(False)
+
+    with gdaltest.config_options({"GDAL_SWATH_SIZE": "1000", "GDAL_NUM_THREADS": "4"}):
+        stats = ar.ComputeStatistics(False)
+    assert stats.min == ref_stats.min
+    assert stats.max == ref_stats.max
+    assert stats.mean == pytest.approx(ref_stats.mean, rel=1e-12)
+    assert stats.std_dev == pytest.approx(ref_stats.std_dev, rel=1e-12)
+    assert stats.valid_count == ref_stats.valid_count
+
+    with gdaltest.config_options({"GDAL_SWATH_SIZE": "1000", "GDAL_NUM_THREADS": "4"}):
+        out_ds = drv.CreateCopy("", ds)
+    out_ar = out_ds.GetRootGroup().OpenMDArray("myarray")
+    assert out_ar.Read() == data
+
+
+def test_mem_md_array_get_reduced():
+
+    drv = gdal.GetDriverByName("MEM")
+    ds = drv.CreateMultiDimensional("myds")
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", "unspecified type", "unspecified direction", 3)
+    dim1 = rg.CreateDimension("dim1", "unspecified type", "unspecified direction", 2)
+    dim2 = rg.CreateDimension("dim2", "unspecified type", "unspecified direction", 5)
+    ar = rg.CreateMDArray(
+        "myarray", [dim0, dim1, dim2], gdal.ExtendedDataType.Create(gdal.GDT_Int16)
+    )
+    ar.SetNoDataValueDouble(-1)
+    vals = [i if i % 7 != 0 else -1 for i in range(3 * 2 * 5)]
+    # Only nodata values at [:,0,0]
+    for i in range(3):
+        vals[i * 10] = -1
+    ar.Write(struct.pack("h" * 30, *vals))
+
+    def get_val(i, j, k):
+        return vals[i * 10 + j * 5 + k]
+
+    def expected(iDim, op):
+        dims = [3, 2, 5]
+        out = []
+        out_dims = [dims[d] for d in range(3) if d != iDim]
+        for a in range(out_dims[0]):
+            for b in range(out_dims[1]):
+                lst = []
+                for r in range(dims[iDim]):
+                    idx = [a, b]
+                    idx.insert(iDim, r)
+                    v = get_val(*idx)
+                    if v != -1:
+                        lst.append(v)
+                if not lst:
+                    out.append(-1.0)
+                elif op == "sum":
+                    out.append(float(sum(lst)))
+                elif op == "mean":
+                    out.append(sum(lst) / len(lst))
+                elif op == "min":
+                    out.append(float(min(lst)))
+                else:
+                    out.append(float(max(lst)))
+        return out
+
+    # Test reading with the default slab size, and with a slab of 1 element
+    # along the reduced dimension.
+    for swath_size, iDim, op in itertools.product(
+        (None, "8"), range(3), ("sum", "mean", "min", "max")
+    ):
+        reduced = ar.GetReduced(iDim, op)
+        assert reduced.GetDataType().GetNumericDataType() == gdal.GDT_Float64
+        assert reduced.GetDimensionCount() == 2
+        assert reduced.GetNoDataValueAsDouble() == -1
+        nvals = 30 // ar.GetDimensions()[iDim].GetSize()
+        with gdaltest.config_option("GDAL_SWATH_SIZE", swath_size):
+            got = struct.unpack("d" * nvals, reduced.Read())
+        assert got == pytest.approx(expected(iDim, op)), (swath_size, iDim, op)
+
+    # Test with steps and a non-default buffer type
+    reduced = ar.GetReduced(0, "max")
+    got = struct.unpack(
+        "h" * 3,
+        reduced.Read(
+            array_start_idx=[1, 4],
+            count=[1, 3],
+            array_step=[1, -2],
+            buffer_datatype=gdal.ExtendedDataType.Create(gdal.GDT_Int16),
+        ),
+    )
+    exp = expected(0, "max")
+    assert got == (exp[9], exp[7], exp[5])
+
+    # 1D array reduced to a scalar
+    ar1d = rg.CreateMDArray(
+        "myarray1d", [dim2], gdal.ExtendedDataType.Create(gdal.GDT_Float32)
+    )
+    ar1d.Write(struct.pack("f" * 5, 1, 2, float("nan"), 4, 5))
+    reduced = ar1d.GetReduced(0, "mean")
+    assert reduced.GetDimensionCount() == 0
+    assert struct.unpack("d", reduced.Read())[0] == 3.0
+
+    with gdaltest.error_handler():
+        assert ar.GetReduced(3, "sum") is None
+        assert ar.GetReduced(0, "median") is None
+
+
 def test_mem_md_array_copy_autoscale():
 
     drv = gdal.GetDriverByName("MEM")
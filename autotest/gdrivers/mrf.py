@@ -635,6 +635,54 @@ def test_mrf_versioned():
     cleanup()
 
 
+@pytest.mark.parametrize(
+    "compress,options",
+    [
+        ("DEFLATE", ["INTERLEAVE=PIXEL"]),
+        ("NONE", ["INTERLEAVE=BAND", "OPTIONS=DEFLATE:ON"]),
+        ("LERC", ["INTERLEAVE=BAND"]),
+        ("LERC", ["INTERLEAVE=PIXEL"]),
+        ("QB3", ["INTERLEAVE=PIXEL"]),
+    ],
+)
+def test_mrf_num_threads(compress, options):
+
+    mrf_co = gdal.GetDriverByName("MRF").GetMetadataItem("DMD_CREATIONOPTIONLIST")
+    if "<Value>%s</Value>" % compress not in mrf_co:
+        pytest.skip()
+
+    src_ds = gdal.Translate("", "data/rgbsmall.tif", format="MEM", width=500, height=500)
+    co = ["COMPRESS=" + compress, "BLOCKSIZE=32"] + options
+
+    def get_content(filename):
+        ds = gdal.Open(filename)
+        cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+        files = [f for f in ds.GetFileList() if not f.endswith(".mrf")]
+        ds = None
+        content = []
+        for f in sorted(files):
+            fp = gdal.VSIFOpenL(f, "rb")
+            content.append(gdal.VSIFReadL(1, gdal.VSIStatL(f).size, fp))
+            gdal.VSIFCloseL(fp)
+        return cs, content
+
+    gdal.Translate(
+        "/vsimem/out.mrf", src_ds, format="MRF", creationOptions=co + ["NUM_THREADS=1"]
+    )
+    ref_cs, ref_content = get_content("/vsimem/out.mrf")
+    cleanup()
+
+    # Tiles are appended in the same order, whatever the number of threads
+    gdal.Translate(
+        "/vsimem/out.mrf", src_ds, format="MRF", creationOptions=co + ["NUM_THREADS=4"]
+    )
+    cs, content = get_content("/vsimem/out.mrf")
+    cleanup()
+
+    assert cs == ref_cs
+    assert content == ref_content
+
+
 def test_mrf_cleanup():
 
     files = (
@@ -1050,6 +1050,155 @@ def test_twms_inline_configuration():
     ds = None
 
 
+###############################################################################
+# Test decoding of tiles in parallel
+
+
+@pytest.mark.require_driver("PNG")
+def test_wms_parallel_decoding():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 512, 512, 3)
+    for i in range(3):
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0,
+            0,
+            512,
+            512,
+            bytes([(j * (i + 1)) % 256 for j in range(512 * 512)]),
+        )
+    for y in range(2):
+        for x in range(2):
+            tile_ds = gdal.Translate(
+                "", src_ds, format="MEM", srcWin=[x * 256, y * 256, 256, 256]
+            )
+            gdal.GetDriverByName("PNG").CreateCopy(
+                "/vsimem/wms_parallel/1/%d/%d.png" % (x, y), tile_ds
+            )
+
+    xml = """<GDAL_WMS>
+<Service name="TMS"><ServerUrl>/vsimem/wms_parallel/${z}/${x}/${y}.png</ServerUrl></Service>
+<DataWindow><UpperLeftX>0</UpperLeftX><UpperLeftY>512</UpperLeftY>
+<LowerRightX>512</LowerRightX><LowerRightY>0</LowerRightY>
+<TileLevel>1</TileLevel><TileCountX>1</TileCountX><TileCountY>1</TileCountY>
+<YOrigin>top</YOrigin></DataWindow>
+<BandsCount>3</BandsCount><BlockSizeX>256</BlockSizeX><BlockSizeY>256</BlockSizeY>
+</GDAL_WMS>"""
+
+    expected_data = src_ds.ReadRaster()
+    try:
+        for num_threads in ("1", "4"):
+            with gdaltest.config_options(
+                {"CPL_CURL_ENABLE_VSIMEM": "YES", "GDAL_NUM_THREADS": num_threads}
+            ):
+                ds = gdal.Open(xml)
+                assert ds.ReadRaster() == expected_data, num_threads
+                ds = None
+    finally:
+        gdal.RmdirRecursive("/vsimem/wms_parallel")
+
+
+###############################################################################
+# Test the sqlite cache type
+
+
+@pytest.mark.require_driver("PNG")
+def test_wms_sqlite_cache(tmp_path):
+
+    sqlite3 = pytest.importorskip("sqlite3")
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 512, 512, 1)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, 512, 512, bytes([j % 251 for j in range(512 * 512)])
+    )
+    for y in range(2):
+        for x in range(2):
+            tile_ds = gdal.Translate(
+                "", src_ds, format="MEM", srcWin=[x * 256, y * 256, 256, 256]
+            )
+            gdal.GetDriverByName("PNG").CreateCopy(
+                "/vsimem/wms_sqlite_cache/1/%d/%d.png" % (x, y), tile_ds
+            )
+
+    cache_path = str(tmp_path / "cache")
+
+    def get_xml(cache_options="", offline=False):
+        return """<GDAL_WMS>
+<Service name="TMS"><ServerUrl>/vsimem/wms_sqlite_cache/${z}/${x}/${y}.png</ServerUrl></Service>
+<DataWindow><UpperLeftX>0</UpperLeftX><UpperLeftY>512</UpperLeftY>
+<LowerRightX>512</LowerRightX><LowerRightY>0</LowerRightY>
+<TileLevel>1</TileLevel><TileCountX>1</TileCountX><TileCountY>1</TileCountY>
+<YOrigin>top</YOrigin></DataWindow>
+<BandsCount>1</BandsCount><BlockSizeX>256</BlockSizeX><BlockSizeY>256</BlockSizeY>
+<Cache><Type>sqlite</Type><Path>%s</Path><Unique>false</Unique>%s</Cache>
+<OfflineMode>%s</OfflineMode>
+</GDAL_WMS>""" % (
+            cache_path,
+            cache_options,
+            "true" if offline else "false",
+        )
+
+    def get_stats():
+        con = sqlite3.connect(os.path.join(cache_path, "cache.sqlite"))
+        tile_count = con.execute("SELECT COUNT(*) FROM tiles").fetchone()[0]
+        stats = dict(con.execute("SELECT name, value FROM cache_info").fetchall())
+        con.close()
+        return tile_count, stats
+
+    expected_data = src_ds.ReadRaster()
+    try:
+        with gdaltest.config_options(
+            {"CPL_CURL_ENABLE_VSIMEM": "YES", "GDAL_NUM_THREADS": "1"}
+        ):
+            with gdaltest.error_handler():
+                ds = gdal.Open(get_xml())
+            if ds is None:
+                pytest.skip("sqlite cache type not supported")
+            assert ds.ReadRaster() == expected_data
+            ds = None
+
+            tile_count, stats = get_stats()
+            assert tile_count == 4
+            assert stats["insertions"] == 4
+            assert stats["misses"] == 4
+            assert stats["evictions"] == 0
+            assert stats["total_size"] > 0
+
+            # Read back from the cache only
+            ds = gdal.Open(get_xml(offline=True))
+            assert ds.ReadRaster() == expected_data
+            ds = None
+
+            tile_count, stats = get_stats()
+            assert tile_count == 4
+            assert stats["hits"] == 4
+
+            # Access times are not rewritten on hits of recently accessed tiles
+            con = sqlite3.connect(os.path.join(cache_path, "cache.sqlite"))
+            assert (
+                con.execute(
+                    "SELECT COUNT(*) FROM tiles WHERE access_time <> insert_time"
+                ).fetchone()[0]
+                == 0
+            )
+            con.close()
+
+            # All tiles are expired and the size budget is exceeded by each
+            # tile: only the last inserted one is kept.
+            ds = gdal.Open(get_xml("<Expires>0</Expires><MaxSize>1</MaxSize>"))
+            assert ds.ReadRaster() == expected_data
+            ds = None
+
+            tile_count, stats = get_stats()
+            assert tile_count == 1
+            assert stats["insertions"] == 8
+            assert stats["evictions"] == 6
+    finally:
+        gdal.RmdirRecursive("/vsimem/wms_sqlite_cache")
+
+
+###############################################################################
+
+
 def test_wms_cleanup():
 
     gdaltest.wms_ds = None
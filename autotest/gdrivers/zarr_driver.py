@@ -3194,3 +3194,92 @@ def test_zarr_read_do_not_crash_on_invalid_byteswap_on_ascii_string():
 
     finally:
         gdal.RmdirRecursive("/vsimem/test.zarr")
+
+
+###############################################################################
+# Test that chunks can be read from several threads
+
+
+def test_zarr_statistics_multithreaded():
+
+    filename = "/vsimem/test_zarr_statistics_multithreaded.zarr"
+    try:
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(filename)
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, 10)
+        dim1 = rg.CreateDimension("dim1", None, None, 20)
+        dim2 = rg.CreateDimension("dim2", None, None, 30)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1, dim2],
+            gdal.ExtendedDataType.Create(gdal.GDT_Float64),
+            ["BLOCKSIZE=3,7,11"],
+        )
+        n = 10 * 20 * 30
+        values = [(i * 7) % 101 for i in range(n)]
+        data = struct.pack("d" * n, *values)
+        assert ar.Write(data) == gdal.CE_None
+        ds = None
+
+        for num_threads in ("1", "4"):
+            ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+            ar = ds.GetRootGroup().OpenMDArray("test")
+            with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+                stats = ar.ComputeStatistics(False)
+            assert stats.min == min(values)
+            assert stats.max == max(values)
+            assert stats.mean == pytest.approx(sum(values) / n, rel=1e-12)
+            assert stats.valid_count == n
+
+            with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+                out_ds = gdal.GetDriverByName("MEM").CreateCopy("", ds)
+            out_ar = out_ds.GetRootGroup().OpenMDArray("test")
+            assert out_ar.Read() == data
+            ds = None
+
+    finally:
+        gdal.RmdirRecursive(filename)
+
+
+###############################################################################
+# Test that errors raised when reading chunks from worker threads are emitted
+# from the calling thread
+
+
+def test_zarr_statistics_multithreaded_error():
+
+    filename = "/vsimem/test_zarr_statistics_multithreaded_error.zarr"
+    try:
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(filename)
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, 10)
+        dim1 = rg.CreateDimension("dim1", None, None, 20)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_Float64),
+            ["BLOCKSIZE=3,7", "COMPRESS=GZIP"],
+        )
+        n = 10 * 20
+        assert ar.Write(struct.pack("d" * n, *range(n))) == gdal.CE_None
+        ds = None
+
+        # Corrupt a chunk that is not the first one, which is read from the
+        # calling thread
+        gdal.FileFromMemBuffer(filename + "/test/2.1", "invalid")
+
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        msgs = []
+
+        def handler(eErrClass, err_no, msg):
+            msgs.append(msg)
+
+        with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+            with gdaltest.error_handler(handler):
+                assert ar.ComputeStatistics(False) is None
+        assert "Decompression of tile %s/test/2.1 failed" % filename in msgs
+        ds = None
+
+    finally:
+        gdal.RmdirRecursive(filename)
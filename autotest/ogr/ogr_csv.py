@@ -2784,3 +2784,155 @@ def test_ogr_csv_get_feature_count_and_attribute_filter():
     assert lyr.GetFeatureCount() == 0
     lyr.SetAttributeFilter(None)
     assert lyr.GetFeatureCount() == 2
+
+
+###############################################################################
+# Test multi-threaded reading
+
+
+def _check_csv_id_str_val(filename, num_threads, expected):
+    """Check that the (id, str, val) fields of the features of a CSV file
+    match expected, including after a rewind and with a random read in the
+    middle of the sequential reading."""
+
+    ds = gdal.OpenEx(
+        filename,
+        gdal.OF_VECTOR,
+        open_options=["NUM_THREADS=" + num_threads],
+    )
+    lyr = ds.GetLayer(0)
+    got = [(f.GetFID(), f["id"], f["str"], f["val"]) for f in lyr]
+    assert got == [(i + 1,) + rec for i, rec in enumerate(expected)]
+
+    lyr.ResetReading()
+    assert lyr.GetNextFeature().GetFID() == 1
+    f = lyr.GetFeature(10)
+    assert (f["id"], f["str"], f["val"]) == expected[9]
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+@pytest.mark.parametrize("eol", ["\n", "\r\n"])
+def test_ogr_csv_num_threads(eol, num_threads):
+
+    filename = "/vsimem/test_ogr_csv_num_threads.csv"
+    lines = ["id,str,val"]
+    expected = []
+    for i in range(100000):
+        if i % 7 == 0:
+            # Quoted field with an embedded end of line, returned as \n
+            lines.append('%d,"multi%sline, ""quoted""",%d.5' % (i, eol, i))
+            expected.append((str(i), 'multi\nline, "quoted"', "%d.5" % i))
+        elif i % 11 == 0:
+            # Empty lines are skipped
+            lines.append("")
+        else:
+            lines.append("%d,foo%d,%d" % (i, i, i))
+            expected.append((str(i), "foo%d" % i, str(i)))
+    gdal.FileFromMemBuffer(filename, eol.join(lines) + eol)
+
+    try:
+        _check_csv_id_str_val(filename, num_threads, expected)
+    finally:
+        gdal.Unlink(filename)
+
+
+###############################################################################
+# Test multi-threaded reading with a quoted multi-line record that spans the
+# boundary between two blocks read from the file
+
+
+def test_ogr_csv_num_threads_record_across_blocks():
+
+    filename = "/vsimem/test_ogr_csv_num_threads_record_across_blocks.csv"
+    # With 2 threads, the file is read by blocks of 2 MiB
+    block_size = 2 * 1024 * 1024
+    content = "id,str,val\n"
+    expected = []
+    while len(content) < block_size - 1000:
+        i = len(expected)
+        content += "%d,foo%d,%d\n" % (i, i, i)
+        expected.append((str(i), "foo%d" % i, str(i)))
+    # The quote opens in the first block, and the delimiter and newlines
+    # inside it must not be taken as record boundaries.
+    i = len(expected)
+    long_str = ",\n".join(["x" * 100] * 20)
+    content += '%d,"%s",%d\n' % (i, long_str, i)
+    expected.append((str(i), long_str, str(i)))
+    assert len(content) > block_size
+    for j in range(i + 1, i + 1000):
+        content += "%d,foo%d,%d\n" % (j, j, j)
+        expected.append((str(j), "foo%d" % j, str(j)))
+    gdal.FileFromMemBuffer(filename, content)
+
+    try:
+        _check_csv_id_str_val(filename, "2", expected)
+    finally:
+        gdal.Unlink(filename)
+
+
+###############################################################################
+# Test that warnings raised while parsing records in worker threads reach the
+# error handler of the thread reading the features, when the record is read
+
+
+def test_ogr_csv_num_threads_warning():
+
+    filename = "/vsimem/test_ogr_csv_num_threads_warning.csv"
+    content = "id,val\n"
+    for i in range(100000):
+        content += "%d,%s\n" % (i, "invalid" if i == 90000 else str(i))
+    gdal.FileFromMemBuffer(filename, content)
+    gdal.FileFromMemBuffer(filename + "t", "Integer,Integer")
+
+    try:
+        ds = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=["NUM_THREADS=4"])
+        lyr = ds.GetLayer(0)
+
+        msgs = []
+
+        def handler(eErrClass, err_no, msg):
+            if eErrClass == gdal.CE_Warning:
+                msgs.append(msg)
+
+        with gdaltest.error_handler(handler):
+            for i in range(90000):
+                lyr.GetNextFeature()
+            assert msgs == []
+            f = lyr.GetNextFeature()
+            assert f["id"] == 90000
+            assert len(msgs) == 1
+            assert "Invalid value type found in record 90001" in msgs[0]
+            for f in lyr:
+                pass
+        assert len(msgs) == 1
+    finally:
+        gdal.Unlink(filename)
+        gdal.Unlink(filename + "t")
+
+
+###############################################################################
+# Test that multi-threaded reading does not buffer an unbalanced double quote
+# without limit
+
+
+def test_ogr_csv_num_threads_unbalanced_quote():
+
+    filename = "/vsimem/test_ogr_csv_num_threads_unbalanced_quote.csv"
+    gdal.FileFromMemBuffer(
+        filename,
+        'id,str\n1,foo\n2,"unbalanced\n' + ("x" * 100 + "\n") * 30000,
+    )
+    try:
+        ds = gdal.OpenEx(
+            filename,
+            gdal.OF_VECTOR,
+            open_options=["NUM_THREADS=2", "MAX_LINE_SIZE=1000"],
+        )
+        lyr = ds.GetLayer(0)
+        f = lyr.GetNextFeature()
+        assert f.GetFID() == 1 and f["str"] == "foo"
+        with gdal.quiet_errors():
+            assert lyr.GetNextFeature() is None
+        assert "Maximum number of characters allowed reached" in gdal.GetLastErrorMsg()
+    finally:
+        gdal.Unlink(filename)
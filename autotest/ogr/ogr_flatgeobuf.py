@@ -1133,3 +1133,67 @@ def test_ogr_flatgeobuf_arrow_stream_numpy():
     ds = None
 
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
+
+
+###############################################################################
+# Test that reading spatial index hits through coalesced ranges gives the
+# same results as reading them one by one
+
+
+def test_ogr_flatgeobuf_spatial_filter_coalesced_reads():
+
+    try:
+        from osgeo import gdal_array  # NOQA
+        import numpy  # NOQA
+
+        has_arrow_numpy = True
+    except ImportError:
+        has_arrow_numpy = False
+
+    filename = "/vsimem/test_ogr_flatgeobuf_spatial_filter_coalesced_reads.fgb"
+    ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        # Some large features to test the fallback when the last feature of
+        # a range does not fit in it
+        f["str"] = "x" * (10000 if (i % 97) == 0 else i % 10)
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i % 40, i // 40)))
+        lyr.CreateFeature(f)
+    ds = None
+
+    def get_features(options):
+        with gdaltest.config_options(options):
+            ds = ogr.Open(filename)
+            lyr = ds.GetLayer(0)
+            res = []
+            for rect in [(2.5, 2.5, 30.5, 20.5), (0, 0, 0.5, 24.5), (39, 24, 40, 25)]:
+                lyr.SetSpatialFilterRect(*rect)
+                res.append(
+                    [
+                        (f.GetFID(), f["str"], f.GetGeometryRef().ExportToWkt())
+                        for f in lyr
+                    ]
+                )
+                if has_arrow_numpy:
+                    # Test the Arrow stream code path
+                    stream = lyr.GetArrowStreamAsNumPy(
+                        options=["MAX_FEATURES_IN_BATCH=100"]
+                    )
+                    res.append(
+                        [fid for batch in stream for fid in batch["OGC_FID"].tolist()]
+                    )
+            return res
+
+    ref = get_features({"OGR_FLATGEOBUF_COALESCE_READS": "NO"})
+    step = 2 if has_arrow_numpy else 1
+    assert len(ref[0]) == 28 * 18
+    assert len(ref[step]) == 25
+    assert len(ref[2 * step]) == 1
+    if has_arrow_numpy:
+        assert ref[1] == [x[0] for x in ref[0]]
+    assert get_features({}) == ref
+    assert get_features({"OGR_FLATGEOBUF_COALESCE_MAX_DISTANCE": "0"}) == ref
+
+    gdal.Unlink(filename)
@@ -391,3 +391,147 @@ def test_ogr_geojsonseq_vsigzip():
     ds = None
 
     gdal.Unlink(filename)
+
+
+###############################################################################
+# Test multi-threaded reading
+
+
+def _geojsonseq_content(records, rs):
+
+    if rs:
+        return "".join("\x1e" + rec + "\n" for rec in records)
+    return "\n".join(records)
+
+
+def _check_geojsonseq_num_threads(filename, num_threads, expected):
+
+    ds = gdal.OpenEx(
+        filename, gdal.OF_VECTOR, open_options=["NUM_THREADS=" + num_threads]
+    )
+    lyr = ds.GetLayer(0)
+    got = [
+        (f.GetFID(), f["id"], f["str"], f.GetGeometryRef().ExportToWkt())
+        for f in lyr
+    ]
+    assert len(got) == len(expected)
+    assert got == expected
+    # Check that reading can be restarted
+    lyr.ResetReading()
+    f = lyr.GetNextFeature()
+    assert (f.GetFID(), f["id"]) == expected[0][0:2]
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+@pytest.mark.parametrize("rs", [False, True])
+def test_ogr_geojsonseq_num_threads(rs, num_threads):
+
+    filename = "/vsimem/test_ogr_geojsonseq_num_threads.geojsonl"
+    records = []
+    expected = []
+    next_fid = 0
+    for i in range(50000):
+        # Empty records are skipped, and bare geometries are turned into
+        # features without properties, numbered sequentially.
+        if i % 13 == 0:
+            records.append("")
+        elif i % 17 == 0:
+            records.append('{"type":"Point","coordinates":[%d,2]}' % i)
+            expected.append((next_fid, None, None, "POINT (%d 2)" % i))
+            next_fid += 1
+        else:
+            records.append(
+                '{"type":"Feature","properties":{"id":%d,"str":"foo%d"},'
+                '"geometry":{"type":"Point","coordinates":[%d,%d]}}' % (i, i, i, -i)
+            )
+            expected.append((i, i, "foo%d" % i, "POINT (%d %d)" % (i, -i)))
+    gdal.FileFromMemBuffer(filename, _geojsonseq_content(records, rs))
+
+    try:
+        ds = gdal.OpenEx(
+            filename, gdal.OF_VECTOR, open_options=["NUM_THREADS=" + num_threads]
+        )
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == len(expected)
+        assert [
+            lyr.GetLayerDefn().GetFieldDefn(i).GetName()
+            for i in range(lyr.GetLayerDefn().GetFieldCount())
+        ] == ["id", "str"]
+        ds = None
+
+        _check_geojsonseq_num_threads(filename, num_threads, expected)
+    finally:
+        gdal.Unlink(filename)
+
+
+###############################################################################
+# Test that JSON parsing errors raised by the worker threads are emitted when
+# the invalid record is reached
+
+
+def test_ogr_geojsonseq_num_threads_parsing_error():
+
+    filename = "/vsimem/test_ogr_geojsonseq_num_threads_parsing_error.geojsonl"
+    records = [
+        '{"type":"Feature","properties":{"id":%d},'
+        '"geometry":{"type":"Point","coordinates":[%d,%d]}}' % (i, i, -i)
+        for i in range(50000)
+    ]
+    records[30000] = '{"type":"Feature",invalid'
+    gdal.FileFromMemBuffer(filename, _geojsonseq_content(records, False))
+
+    try:
+        with gdal.quiet_errors():
+            ds = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=["NUM_THREADS=4"])
+        lyr = ds.GetLayer(0)
+
+        msgs = []
+
+        def handler(eErrClass, err_no, msg):
+            if eErrClass == gdal.CE_Failure:
+                msgs.append(msg)
+
+        with gdaltest.error_handler(handler):
+            for i in range(30000):
+                assert lyr.GetNextFeature()["id"] == i
+            assert msgs == []
+            assert lyr.GetNextFeature()["id"] == 30001
+            assert len(msgs) == 1
+            assert "JSON parsing error" in msgs[0]
+            assert len([f for f in lyr]) == 50000 - 30002
+        assert len(msgs) == 1
+    finally:
+        gdal.Unlink(filename)
+
+
+###############################################################################
+# Test multi-threaded reading with a record that spans the boundary between
+# two blocks read from the file
+
+
+@pytest.mark.parametrize("rs", [False, True])
+def test_ogr_geojsonseq_num_threads_record_across_blocks(rs):
+
+    filename = "/vsimem/test_ogr_geojsonseq_num_threads_record_across_blocks.geojsonl"
+    # With 2 threads, the file is read by blocks of 2 MiB
+    block_size = 2 * 1024 * 1024
+    long_str = "x" * 2000
+    records = []
+    expected = []
+    size = 0
+    i = 0
+    while size < block_size + 1000:
+        str_val = long_str if size > block_size - 1000 else "foo"
+        records.append(
+            '{"type":"Feature","properties":{"id":%d,"str":"%s"},'
+            '"geometry":{"type":"Point","coordinates":[%d,%d]}}' % (i, str_val, i, -i)
+        )
+        expected.append((i, i, str_val, "POINT (%d %d)" % (i, -i)))
+        size += len(records[-1]) + (2 if rs else 1)
+        i += 1
+    gdal.FileFromMemBuffer(filename, _geojsonseq_content(records, rs))
+
+    try:
+        _check_geojsonseq_num_threads(filename, "2", expected)
+    finally:
+        gdal.Unlink(filename)
@@ -984,3 +984,66 @@ def test_ogr_mem_get_supported_srs_list():
     lyr = ds.CreateLayer("foo")
     assert lyr.GetSupportedSRSList() is None
     assert lyr.SetActiveSRS(0, None) != ogr.OGRERR_NONE
+
+
+###############################################################################
+# Test the spatial index built on the fly
+
+
+@pytest.mark.parametrize("use_spatial_index", ["YES", "NO"])
+@pytest.mark.parametrize("sparse_fids", [False, True])
+def test_ogr_mem_spatial_index(use_spatial_index, sparse_fids):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if sparse_fids:
+            f.SetFID(1000000 + 10 * i)
+        f["val"] = i
+        if i % 100 != 99:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(%d %d)" % (i, i % 10)))
+        lyr.CreateFeature(f)
+
+    def get_vals():
+        return [f["val"] for f in lyr]
+
+    with gdaltest.config_option("OGR_MEM_SPATIAL_INDEX", use_spatial_index):
+        lyr.SetSpatialFilterRect(10.5, 0, 20.5, 5)
+        assert get_vals() == [11, 12, 13, 14, 15, 20]
+        assert lyr.GetFeatureCount() == 6
+
+        lyr.SetAttributeFilter("val > 12")
+        assert get_vals() == [13, 14, 15, 20]
+        lyr.SetAttributeFilter(None)
+
+        # Modify, add and delete features after the index has been built
+        f = lyr.GetFeature(1000000 + 10 * 13 if sparse_fids else 13)
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(500 500)"))
+        assert lyr.SetFeature(f) == ogr.OGRERR_NONE
+
+        fid_to_delete = 1000000 + 10 * 14 if sparse_fids else 14
+        assert lyr.DeleteFeature(fid_to_delete) == ogr.OGRERR_NONE
+
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["val"] = 2000
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(15 1)"))
+        lyr.CreateFeature(f)
+
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["val"] = 3000
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(-1000 1000)"))
+        lyr.CreateFeature(f)
+
+        lyr.ResetReading()
+        assert sorted(get_vals()) == [11, 12, 15, 20, 2000]
+
+        lyr.SetSpatialFilterRect(-1001, 999, -999, 1001)
+        assert get_vals() == [3000]
+
+        lyr.SetSpatialFilterRect(499, 499, 501, 501)
+        assert get_vals() == [13]
+
+        lyr.SetSpatialFilter(None)
+        assert len(get_vals()) == 1001
@@ -1642,3 +1642,200 @@ def test_ogr_parquet_bbox(input_geometries, expected_bbox):
     ds = None
 
     gdal.Unlink(outfilename)
+
+
+###############################################################################
+# Test that row groups are skipped using their statistics
+
+
+@pytest.mark.parametrize(
+    "filter,expected_fids,expected_num_row_groups",
+    [
+        ("int = 5", [5], 1),
+        ("int >= 7", [7, 8, 9], 2),
+        ("int < 2", [0, 1], 1),
+        ("int <= 2 AND real > 1.5", [2], 1),
+        ("str = 'val3'", [3], 1),
+        ("int BETWEEN 3 AND 4", [3, 4], 2),
+        ("int IS NULL", [], 0),
+        ("int = 5 OR int = 7", [5, 7], 5),
+        ("int > 100", [], 0),
+    ],
+)
+def test_ogr_parquet_row_group_selection(filter, expected_fids, expected_num_row_groups):
+
+    outfilename = "/vsimem/out.parquet"
+    ds = gdal.GetDriverByName("Parquet").Create(outfilename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("out", options=["ROW_GROUP_SIZE=2"])
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int"] = i
+        f["real"] = i
+        f["str"] = "val%d" % i
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(%d %d)" % (i, i)))
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(outfilename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetMetadataItem("NUM_ROW_GROUPS", "_PARQUET_") == "5"
+
+    lyr.SetAttributeFilter(filter)
+    assert lyr.GetMetadataItem("NUM_SELECTED_ROW_GROUPS", "_PARQUET_") == str(
+        expected_num_row_groups
+    )
+    for _ in range(2):
+        assert [f.GetFID() for f in lyr] == expected_fids
+        assert [f["int"] for f in lyr] == expected_fids
+    assert lyr.GetFeatureCount() == len(expected_fids)
+    assert lyr.GetExtent() == (0, 9, 0, 9)
+
+    with gdaltest.config_option("OGR_PARQUET_USE_ROW_GROUP_STATISTICS", "NO"):
+        lyr.SetAttributeFilter(filter)
+    assert lyr.GetMetadataItem("NUM_SELECTED_ROW_GROUPS", "_PARQUET_") == "5"
+    assert [f.GetFID() for f in lyr] == expected_fids
+
+    lyr.SetAttributeFilter(None)
+    assert lyr.GetMetadataItem("NUM_SELECTED_ROW_GROUPS", "_PARQUET_") == "5"
+    assert [f.GetFID() for f in lyr] == list(range(10))
+    ds = None
+
+    gdal.Unlink(outfilename)
+
+
+###############################################################################
+# Test SORT_BY_BBOX and WRITE_COVERING_BBOX
+
+
+@pytest.mark.parametrize("sort_by_bbox", [False, True])
+def test_ogr_parquet_sort_by_bbox_and_covering_bbox(sort_by_bbox):
+
+    outfilename = "/vsimem/out.parquet"
+    ds = gdal.GetDriverByName("Parquet").Create(outfilename, 0, 0, 0, gdal.GDT_Unknown)
+    options = ["ROW_GROUP_SIZE=10", "FID=fid", "WRITE_COVERING_BBOX=YES"]
+    if sort_by_bbox:
+        options.append("SORT_BY_BBOX=YES")
+    lyr = ds.CreateLayer("out", geom_type=ogr.wkbPoint, options=options)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("int_list", ogr.OFTIntegerList))
+    # Interleave features in the 4 quadrants of [0,100]x[0,100]
+    for i in range(100):
+        x = (i % 2) * 50 + (i // 4) % 5 * 10 + 0.5
+        y = ((i // 2) % 2) * 50 + (i // 20) * 10 + 0.5
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = "val%d" % i
+        f["int_list"] = [i, i + 1]
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(%f %f)" % (x, y)))
+        assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+        assert f.GetFID() == i
+    f = ogr.Feature(lyr.GetLayerDefn())
+    lyr.CreateFeature(f)
+    assert lyr.GetFeatureCount() == 101
+    ds = None
+
+    assert gdal.VSIStatL("/vsimem/out_sort_by_bbox.tmp") is None
+
+    ds = ogr.Open(outfilename)
+    lyr = ds.GetLayer(0)
+    geo = lyr.GetMetadataItem("geo", "_PARQUET_METADATA_")
+    j = json.loads(geo)
+    assert j["version"] == "1.1.0"
+    assert j["columns"]["geometry"]["covering"] == {
+        "bbox": {
+            "xmin": ["geometry_bbox", "xmin"],
+            "ymin": ["geometry_bbox", "ymin"],
+            "xmax": ["geometry_bbox", "xmax"],
+            "ymax": ["geometry_bbox", "ymax"],
+        }
+    }
+    # The bbox struct column is not exposed
+    assert lyr.GetLayerDefn().GetFieldCount() == 2
+
+    assert lyr.GetFeatureCount() == 101
+    got = {}
+    for f in lyr:
+        got[f.GetFID()] = f
+    assert len(got) == 101
+    for i in range(100):
+        assert got[i]["str"] == "val%d" % i
+        assert got[i]["int_list"] == [i, i + 1]
+    assert got[100].GetGeometryRef() is None
+    if sort_by_bbox:
+        # Features without geometry come last
+        assert lyr.GetFeature(100) is not None
+        lyr.SetNextByIndex(100)
+        assert lyr.GetNextFeature().GetFID() == 100
+
+    lyr.SetSpatialFilterRect(0, 0, 5, 5)
+    assert [f.GetFID() for f in lyr] == [0]
+    assert lyr.GetMetadataItem("NUM_ROW_GROUPS", "_PARQUET_") == "11"
+    num_selected = int(lyr.GetMetadataItem("NUM_SELECTED_ROW_GROUPS", "_PARQUET_"))
+    if sort_by_bbox:
+        # At most the 3 row groups of the lower left quadrant, and the one
+        # with the feature without geometry (whose bbox is null)
+        assert num_selected <= 4
+    else:
+        assert num_selected == 11
+    ds = None
+
+    gdal.Unlink(outfilename)
+
+
+###############################################################################
+# Test that SORT_BY_BBOX options are validated at layer creation
+
+
+def test_ogr_parquet_sort_by_bbox_invalid_options():
+
+    outfilename = "/vsimem/out.parquet"
+    ds = gdal.GetDriverByName("Parquet").Create(outfilename, 0, 0, 0, gdal.GDT_Unknown)
+    with gdaltest.error_handler():
+        assert (
+            ds.CreateLayer("out", geom_type=ogr.wkbNone, options=["SORT_BY_BBOX=YES"])
+            is None
+        )
+    with gdaltest.error_handler():
+        assert (
+            ds.CreateLayer(
+                "out",
+                geom_type=ogr.wkbPoint,
+                options=["SORT_BY_BBOX=YES", "TEMPORARY_DIR=/i_do/not/exist"],
+            )
+            is None
+        )
+    ds = None
+    gdal.Unlink(outfilename)
+
+
+###############################################################################
+# Test that the covering bbox column is hidden by the dataset-level layer
+
+
+@pytest.mark.skipif(not _has_arrow_dataset(), reason="GDAL not built with ArrowDataset")
+def test_ogr_parquet_covering_bbox_dataset_layer(tmp_path):
+
+    outfilename = str(tmp_path / "part.0.parquet")
+    ds = gdal.GetDriverByName("Parquet").Create(outfilename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer(
+        "out", geom_type=ogr.wkbPoint, options=["WRITE_COVERING_BBOX=YES"]
+    )
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["str"] = "foo"
+    f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(1 2)"))
+    lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open("PARQUET:" + str(tmp_path))
+    lyr = ds.GetLayer(0)
+    assert [
+        lyr.GetLayerDefn().GetFieldDefn(i).GetName()
+        for i in range(lyr.GetLayerDefn().GetFieldCount())
+    ] == ["str"]
+    f = lyr.GetNextFeature()
+    assert f["str"] == "foo"
+    assert f.GetGeometryRef().ExportToWkt() == "POINT (1 2)"
+    ds = None
@@ -0,0 +1,255 @@
+#!/usr/bin/env pytest
+###############################################################################
+# $Id$
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  Test PMTiles driver functionality.
+# Author:   agent <agent@local>
+#
+###############################################################################
+# Copyright (c) 2026, agent <agent@local>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import os
+import struct
+
+import gdaltest
+import ogrtest
+import pytest
+
+from osgeo import gdal, ogr
+
+pytestmark = pytest.mark.require_driver("PMTiles")
+
+###############################################################################
+
+
+def test_ogr_pmtiles_identify():
+
+    with gdaltest.error_handler():
+        assert (
+            gdal.OpenEx("data/mvt/datatypes.mbtiles", allowed_drivers=["PMTiles"])
+            is None
+        )
+
+    # Wrong version
+    gdal.FileFromMemBuffer(
+        "/vsimem/bad.pmtiles", b"PMTiles" + b"\x02" + b"\x00" * 119
+    )
+    with gdaltest.error_handler():
+        assert gdal.OpenEx("/vsimem/bad.pmtiles") is None
+    gdal.Unlink("/vsimem/bad.pmtiles")
+
+
+###############################################################################
+
+
+def _create_vector_pmtiles(filename, options=[]):
+
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    lyr = src_ds.CreateLayer("mylayer")
+    lyr.CreateField(ogr.FieldDefn("strfield", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("intfield", ogr.OFTInteger))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["strfield"] = "foo%d" % i
+        f["intfield"] = i
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt(
+                "POINT(%f %f)" % (-10000000 + i * 2000000, -5000000 + i * 1000000)
+            )
+        )
+        lyr.CreateFeature(f)
+
+    return gdal.VectorTranslate(
+        filename,
+        src_ds,
+        format="PMTiles",
+        datasetCreationOptions=["MINZOOM=0", "MAXZOOM=3"] + options,
+    )
+
+
+###############################################################################
+
+
+def test_ogr_pmtiles_vector_write_read(tmp_path):
+
+    if not ogrtest.have_geos():
+        pytest.skip()
+
+    filename = "/vsimem/test_ogr_pmtiles_vector_write_read.pmtiles"
+    with gdaltest.config_option("CPL_TMPDIR", str(tmp_path)):
+        out_ds = _create_vector_pmtiles(filename)
+        assert out_ds is not None
+        # Temporary files are created in CPL_TMPDIR
+        assert os.listdir(tmp_path) != []
+        out_ds = None
+    assert os.listdir(tmp_path) == []
+
+    # Check header
+    f = gdal.VSIFOpenL(filename, "rb")
+    header = gdal.VSIFReadL(1, 127, f)
+    gdal.VSIFCloseL(f)
+    assert header[0:7] == b"PMTiles"
+    assert header[7] == 3
+    clustered, internal_compression, tile_compression, tile_type = struct.unpack(
+        "<BBBB", header[96:100]
+    )
+    assert clustered == 1
+    assert internal_compression == 2  # gzip
+    assert tile_type == 1  # MVT
+    min_zoom, max_zoom = struct.unpack("<BB", header[100:102])
+    assert (min_zoom, max_zoom) == (0, 3)
+
+    ds = ogr.Open(filename)
+    assert ds.GetDriver().GetDescription() == "PMTiles"
+    assert ds.GetMetadataItem("ZOOM_LEVEL") == "3"
+    assert ds.GetLayerCount() == 1
+    lyr = ds.GetLayer(0)
+    assert lyr.GetName() == "mylayer"
+    assert lyr.GetSpatialRef().GetAuthorityCode(None) == "3857"
+    lyr_defn = lyr.GetLayerDefn()
+    assert lyr_defn.GetFieldIndex("strfield") >= 0
+    assert lyr_defn.GetFieldIndex("intfield") >= 0
+    assert lyr.GetFeatureCount() == 10
+    values = sorted(f["intfield"] for f in lyr)
+    assert values == list(range(10))
+
+    # Spatial filter restricting to a single point
+    lyr.SetSpatialFilterRect(-10000000 - 1, -5000000 - 1, -10000000 + 1, -5000000 + 1)
+    values = [f["intfield"] for f in lyr]
+    assert values == [0]
+    lyr.SetSpatialFilter(None)
+
+    # Zoom level 0
+    ds = gdal.OpenEx(filename, open_options=["ZOOM_LEVEL=0"])
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 10
+    ds = None
+
+    with gdaltest.error_handler():
+        assert gdal.OpenEx(filename, open_options=["ZOOM_LEVEL=4"]) is None
+
+    gdal.Unlink(filename)
+
+
+###############################################################################
+
+
+def test_ogr_pmtiles_vector_json_field():
+
+    if not ogrtest.have_geos():
+        pytest.skip()
+
+    filename = "/vsimem/test_ogr_pmtiles_vector_json_field.pmtiles"
+    assert _create_vector_pmtiles(filename) is not None
+
+    ds = gdal.OpenEx(filename, open_options=["JSON_FIELD=YES"])
+    lyr = ds.GetLayer(0)
+    assert lyr.GetLayerDefn().GetFieldIndex("json") >= 0
+    assert lyr.GetLayerDefn().GetFieldIndex("strfield") < 0
+    ds = None
+
+    gdal.Unlink(filename)
+
+
+###############################################################################
+
+
+def test_ogr_pmtiles_vector_truncated():
+
+    if not ogrtest.have_geos():
+        pytest.skip()
+
+    filename = "/vsimem/test_ogr_pmtiles_vector_truncated.pmtiles"
+    assert _create_vector_pmtiles(filename) is not None
+
+    f = gdal.VSIFOpenL(filename, "rb")
+    data = gdal.VSIFReadL(1, 130, f)
+    gdal.VSIFCloseL(f)
+    gdal.FileFromMemBuffer(filename, data)
+
+    with gdaltest.error_handler():
+        assert gdal.OpenEx(filename) is None
+
+    gdal.Unlink(filename)
+
+
+###############################################################################
+# Test reading metadata whose gzip compression ratio is large
+
+
+def test_ogr_pmtiles_vector_highly_compressible_metadata():
+
+    if not ogrtest.have_geos():
+        pytest.skip()
+
+    filename = "/vsimem/test_ogr_pmtiles_vector_highly_compressible_metadata.pmtiles"
+    description = "x" * 100000
+    assert (
+        _create_vector_pmtiles(filename, ["DESCRIPTION=" + description]) is not None
+    )
+
+    f = gdal.VSIFOpenL(filename, "rb")
+    header = gdal.VSIFReadL(1, 127, f)
+    gdal.VSIFCloseL(f)
+    (metadata_length,) = struct.unpack("<Q", header[32:40])
+    assert metadata_length * 10 < len(description)
+
+    ds = ogr.Open(filename)
+    assert ds.GetMetadataItem("description") == description
+    assert ds.GetLayer(0).GetFeatureCount() == 10
+    ds = None
+
+    gdal.Unlink(filename)
+
+
+###############################################################################
+
+
+@pytest.mark.require_driver("PNG")
+@pytest.mark.require_driver("MBTiles")
+def test_ogr_pmtiles_raster_write_read(tmp_path):
+
+    filename = "/vsimem/test_ogr_pmtiles_raster_write_read.pmtiles"
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    with gdaltest.config_option("CPL_TMPDIR", str(tmp_path)):
+        out_ds = gdal.GetDriverByName("PMTiles").CreateCopy(filename, src_ds)
+    assert out_ds is not None
+    # The temporary MBTiles file has been created in CPL_TMPDIR, and removed
+    assert os.listdir(tmp_path) == []
+    assert out_ds.GetDriver().GetDescription() == "PMTiles"
+    assert out_ds.RasterCount == 4
+    assert out_ds.GetSpatialRef().GetAuthorityCode(None) == "3857"
+    assert out_ds.GetRasterBand(1).GetOverviewCount() > 0
+    assert out_ds.GetRasterBand(4).GetColorInterpretation() == gdal.GCI_AlphaBand
+
+    ref_ds = gdal.Warp("", src_ds, format="MEM", dstSRS="EPSG:3857")
+    ref_gt = ref_ds.GetGeoTransform()
+    gt = out_ds.GetGeoTransform()
+    assert gt[1] == pytest.approx(-gt[5])
+    assert gt[1] <= ref_gt[1]
+
+    # Non-empty
+    assert out_ds.GetRasterBand(4).Checksum() != 0
+    out_ds = None
+
+    gdal.Unlink(filename)
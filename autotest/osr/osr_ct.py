@@ -388,6 +388,50 @@ def test_osr_ct_options_operation():
     assert z == 3
 
 
+###############################################################################
+# Test the optimized code path for pipelines only made of affine steps
+
+
+@pytest.mark.parametrize(
+    "pipeline",
+    [
+        "+proj=pipeline +step +proj=axisswap +order=2,1 "
+        "+step +proj=unitconvert +xy_in=deg +xy_out=rad "
+        "+step +proj=unitconvert +xy_in=rad +xy_out=grad",
+        "+proj=pipeline +step +proj=unitconvert +xy_in=us-ft +xy_out=m "
+        "+z_in=ft +z_out=m +step +proj=affine +xoff=10 +yoff=20 +zoff=30 "
+        "+s11=2 +s12=0.5 +s21=-0.5 +s22=3",
+        "+proj=pipeline +step +inv +proj=helmert +x=1 +y=2 +z=3 "
+        "+step +proj=axisswap +order=-1,2,-3",
+    ],
+)
+@pytest.mark.parametrize("reverse", [False, True])
+def test_osr_ct_options_operation_affine_optimization(pipeline, reverse):
+
+    options = osr.CoordinateTransformationOptions()
+    assert options.SetOperation(pipeline, reverse)
+    ct = osr.CoordinateTransformation(None, None, options)
+    with gdaltest.config_option("OGR_CT_AFFINE_OPTIMIZATION", "NO"):
+        ct_ref = osr.CoordinateTransformation(None, None, options)
+
+    points = [(1, 2, 3), (-1000.5, 45.25, 10), (123456.75, -8765.5, -100)]
+    for got, expected in zip(
+        ct.TransformPoints(points), ct_ref.TransformPoints(points)
+    ):
+        assert got == pytest.approx(expected, rel=1e-12, abs=1e-9)
+
+    ct_inverse = ct.GetInverse()
+    for got, expected in zip(
+        ct_inverse.TransformPoints(ct.TransformPoints(points)), points
+    ):
+        assert got == pytest.approx(expected, rel=1e-12, abs=1e-9)
+
+    x, y, z, t, error_code = ct.TransformPointWithErrorCode(float("inf"), 2, 3, 0)
+    assert x == float("inf")
+    assert y == float("inf")
+    assert error_code != 0
+
+
 ###############################################################################
 # Test coordinate transformation with area of interest
 
@@ -738,3 +782,79 @@ def test_osr_ct_OGR_CT_PREFER_OFFICIAL_SRS_DEF():
         x, y, _ = ct.TransformPoint(826158.063, 2405844.125, 0)
         assert abs(x - 9.867) < 0.001, x
         assert abs(y - 71.125) < 0.001, y
+
+    # Back to the default: the representation cached with
+    # OGR_CT_PREFER_OFFICIAL_SRS_DEF=NO must not be used
+    ct = osr.CoordinateTransformation(s, t)
+    x, y, _ = ct.TransformPoint(826158.063, 2405844.125, 0)
+    assert abs(x - 9.873) < 0.001, x
+    assert abs(y - 71.127) < 0.001, y
+
+
+###############################################################################
+# Test that the cached representation of a SRS used to look up the cache of
+# coordinate transformations is invalidated when the SRS is modified
+
+
+def test_osr_ct_cache_invalidated_on_srs_modification():
+
+    s = osr.SpatialReference()
+    s.ImportFromEPSG(32631)
+    t = osr.SpatialReference()
+    t.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    t.ImportFromEPSG(4326)
+
+    ct = osr.CoordinateTransformation(s, t)
+    x, y, _ = ct.TransformPoint(500000, 0, 0)
+    assert x == pytest.approx(3, abs=1e-8)
+    assert y == pytest.approx(0, abs=1e-8)
+    ct = None
+
+    # Same objects: the transformation should come from the cache
+    ct = osr.CoordinateTransformation(s, t)
+    x, y, _ = ct.TransformPoint(500000, 0, 0)
+    assert x == pytest.approx(3, abs=1e-8)
+    ct = None
+
+    s.SetUTM(32)
+    ct = osr.CoordinateTransformation(s, t)
+    x, y, _ = ct.TransformPoint(500000, 0, 0)
+    assert x == pytest.approx(9, abs=1e-8)
+    ct = None
+
+    t.SetDataAxisToSRSAxisMapping([2, 1])
+    ct = osr.CoordinateTransformation(s, t)
+    x, y, _ = ct.TransformPoint(500000, 0, 0)
+    assert x == pytest.approx(0, abs=1e-8)
+    assert y == pytest.approx(9, abs=1e-8)
+
+
+###############################################################################
+# Test that the cached representation of a SRS is carried over to its clones,
+# that modifying a SRS does not affect its clones, and that the value of the
+# configuration options that affect the representation is taken into account
+
+
+def test_osr_ct_cache_text_representation_clone():
+
+    s = osr.SpatialReference()
+    s.ImportFromEPSG(32631)
+    t = osr.SpatialReference()
+    t.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    t.ImportFromEPSG(4326)
+
+    def transform(src):
+        ct = osr.CoordinateTransformation(src, t)
+        return ct.TransformPoint(500000, 0, 0)[0]
+
+    assert transform(s) == pytest.approx(3, abs=1e-8)
+
+    s_clone = s.Clone()
+    assert transform(s_clone) == pytest.approx(3, abs=1e-8)
+
+    s.SetUTM(32)
+    assert transform(s) == pytest.approx(9, abs=1e-8)
+    assert transform(s_clone) == pytest.approx(3, abs=1e-8)
+
+    s_clone2 = s.Clone()
+    assert transform(s_clone2) == pytest.approx(9, abs=1e-8)
@@ -0,0 +1,111 @@
+#!/usr/bin/env pytest
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  gdal_zonalstats testing
+# Author:   agent <agent@local>
+#
+###############################################################################
+# Copyright (c) 2026, agent <agent@local>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import os
+
+import gdaltest
+import pytest
+import test_cli_utilities
+
+from osgeo import gdal, ogr
+
+pytestmark = pytest.mark.skipif(
+    test_cli_utilities.get_gdal_zonalstats_path() is None,
+    reason="gdal_zonalstats not available",
+)
+
+###############################################################################
+
+
+def _create_zones(filename):
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    ds = ogr.GetDriverByName("GeoJSON").CreateDataSource(filename)
+    lyr = ds.CreateLayer("zones", src_ds.GetSpatialRef(), ogr.wkbPolygon)
+    lyr.CreateField(ogr.FieldDefn("name", ogr.OFTString))
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["name"] = "all"
+    f.SetGeometry(
+        ogr.CreateGeometryFromWkt(
+            "POLYGON((440720 3751320,441920 3751320,441920 3750120,"
+            "440720 3750120,440720 3751320))"
+        )
+    )
+    lyr.CreateFeature(f)
+    ds = None
+
+
+@pytest.mark.require_driver("GeoJSON")
+@pytest.mark.require_driver("CSV")
+@pytest.mark.parametrize("options", ["", "-nt 2"])
+def test_gdal_zonalstats_csv(options):
+
+    zones = "tmp/test_gdal_zonalstats_zones.geojson"
+    out = "tmp/test_gdal_zonalstats_out.csv"
+    _create_zones(zones)
+    if os.path.exists(out):
+        os.unlink(out)
+
+    _, err = gdaltest.runexternal_out_and_err(
+        test_cli_utilities.get_gdal_zonalstats_path()
+        + " -q -hist 256 %s ../gcore/data/byte.tif %s %s" % (options, zones, out)
+    )
+    assert err is None or err == ""
+
+    src_band = gdal.Open("../gcore/data/byte.tif").GetRasterBand(1)
+    stats = src_band.ComputeStatistics(False)
+
+    ds = ogr.Open(out)
+    assert ds is not None
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 1
+    f = lyr.GetNextFeature()
+    assert f["name"] == "all"
+    assert int(f["count"]) == 400
+    assert float(f["min"]) == stats[0]
+    assert float(f["max"]) == stats[1]
+    assert float(f["mean"]) == pytest.approx(stats[2])
+    ds = None
+
+    os.unlink(zones)
+    os.unlink(out)
+
+
+###############################################################################
+
+
+def test_gdal_zonalstats_missing_args():
+
+    _, err = gdaltest.runexternal_out_and_err(
+        test_cli_utilities.get_gdal_zonalstats_path()
+        + " ../gcore/data/byte.tif"
+    )
+    assert "Missing zone dataset name" in err
@@ -637,3 +637,38 @@ def test_gdalbuildvrt_lib_addAlpha(num_bands_1, num_bands_2, drv_name):
     finally:
         gdal.Unlink(fname1)
         gdal.Unlink(fname2)
+
+
+###############################################################################
+# Test opening sources in parallel
+
+
+@pytest.mark.parametrize("num_threads", [1, 2, "ALL_CPUS"])
+def test_gdalbuildvrt_lib_num_threads(num_threads):
+
+    filenames = []
+    for i in range(10):
+        filename = "/vsimem/test_gdalbuildvrt_lib_num_threads_%d.tif" % i
+        src_ds = gdal.GetDriverByName("GTiff").Create(filename, 1, 1)
+        src_ds.SetGeoTransform([2 + i, 1, 0, 49, 0, -1])
+        src_ds.GetRasterBand(1).Fill(i + 1)
+        src_ds = None
+        filenames.append(filename)
+    filenames.insert(3, "/vsimem/test_gdalbuildvrt_lib_num_threads_invalid.tif")
+
+    try:
+        with gdaltest.error_handler():
+            ds = gdal.BuildVRT("", filenames, numThreads=num_threads)
+        assert ds.RasterXSize == 10
+        assert ds.GetRasterBand(1).ReadRaster() == bytes(range(1, 11))
+        assert [
+            ds.GetRasterBand(1).GetMetadataItem("Pixel_%d_0" % i, "LocationInfo")
+            for i in range(10)
+        ] == [
+            "<LocationInfo><File>%s</File></LocationInfo>" % x
+            for x in filenames
+            if not x.endswith("invalid.tif")
+        ]
+    finally:
+        for filename in filenames:
+            gdal.Unlink(filename)
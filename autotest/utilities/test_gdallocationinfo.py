@@ -29,6 +29,7 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import subprocess
 import sys
 
 import pytest
@@ -172,3 +173,100 @@ def test_gdallocationinfo_wgs84():
 
     expected_ret = """115"""
     assert expected_ret in ret
+
+
+###############################################################################
+# Test reading several points from stdin, from a pipe (processed one at a
+# time) and from a regular file (processed as a batch)
+
+
+@pytest.mark.parametrize("from_file", [False, True])
+def test_gdallocationinfo_stdin_batch(tmp_path, from_file):
+    if test_cli_utilities.get_gdallocationinfo_path() is None:
+        pytest.skip()
+
+    points = [(19, 19), (0, 0), (10, 5), (-1, 3), (5, 10), (0, 0)]
+    strin = "\n".join("%d %d" % (x, y) for x, y in points)
+    cmd = [
+        test_cli_utilities.get_gdallocationinfo_path(),
+        "-valonly",
+        "../gcore/data/byte.tif",
+    ]
+    if from_file:
+        input_filename = tmp_path / "points.txt"
+        input_filename.write_text(strin)
+        with open(input_filename, "rb") as f:
+            ret = subprocess.run(cmd, stdin=f, stdout=subprocess.PIPE).stdout
+    else:
+        ret = subprocess.run(
+            cmd, input=strin.encode("ascii"), stdout=subprocess.PIPE
+        ).stdout
+
+    ar = gdal.Open("../gcore/data/byte.tif").ReadAsArray()
+    expected = [
+        str(ar[y][x]) if 0 <= x < 20 and 0 <= y < 20 else "" for x, y in points
+    ]
+    assert ret.decode("ascii").split("\n")[0 : len(points)] == expected
+
+
+###############################################################################
+# Test that points written to a pipe are answered before the next one is sent
+
+
+def test_gdallocationinfo_stdin_coprocess():
+    if test_cli_utilities.get_gdallocationinfo_path() is None:
+        pytest.skip()
+
+    ar = gdal.Open("../gcore/data/byte.tif").ReadAsArray()
+    p = subprocess.Popen(
+        [
+            test_cli_utilities.get_gdallocationinfo_path(),
+            "-valonly",
+            "../gcore/data/byte.tif",
+        ],
+        stdin=subprocess.PIPE,
+        stdout=subprocess.PIPE,
+    )
+    try:
+        for x, y in [(0, 0), (10, 5), (5, 10)]:
+            p.stdin.write(b"%d %d\n" % (x, y))
+            p.stdin.flush()
+            assert p.stdout.readline().decode("ascii").strip() == str(ar[y][x])
+    finally:
+        p.stdin.close()
+        p.wait()
+
+
+###############################################################################
+# Test -r bilinear and -r cubic
+
+
+def test_gdallocationinfo_interpolation():
+    if test_cli_utilities.get_gdallocationinfo_path() is None:
+        pytest.skip()
+
+    ar = gdal.Open("../gcore/data/byte.tif").ReadAsArray()
+
+    # At the center of a pixel, the interpolated value is the pixel value
+    for alg in ("bilinear", "cubic"):
+        ret = gdaltest.runexternal(
+            test_cli_utilities.get_gdallocationinfo_path()
+            + " -valonly -r "
+            + alg
+            + " ../gcore/data/byte.tif 10.5 10.5"
+        )
+        assert float(ret) == pytest.approx(ar[10][10])
+
+    # At the corner between 4 pixels, bilinear averages them
+    ret = gdaltest.runexternal(
+        test_cli_utilities.get_gdallocationinfo_path()
+        + " -valonly -r bilinear ../gcore/data/byte.tif 10 10"
+    )
+    expected = (int(ar[9][9]) + int(ar[9][10]) + int(ar[10][9]) + int(ar[10][10])) / 4.0
+    assert float(ret) == pytest.approx(expected)
+
+    (ret, err) = gdaltest.runexternal_out_and_err(
+        test_cli_utilities.get_gdallocationinfo_path()
+        + " -r invalid ../gcore/data/byte.tif 10 10"
+    )
+    assert "-r can only be used with values" in err
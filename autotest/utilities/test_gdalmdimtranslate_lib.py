@@ -327,6 +327,54 @@ def test_gdalmdimtranslate_array_with_transpose_and_view():
 ###############################################################################
 
 
+def test_gdalmdimtranslate_array_with_reduce():
+
+    tmpfile = "/vsimem/out.vrt"
+    assert gdal.MultiDimTranslate(
+        tmpfile,
+        "data/mdim.vrt",
+        arraySpecs=[
+            "name=my_variable_with_time_increasing,dstname=foo,reduce=time_increasing:sum"
+        ],
+    )
+
+    f = gdal.VSIFOpenL(tmpfile, "rb")
+    got_data = gdal.VSIFReadL(1, 10000, f).decode("ascii")
+    gdal.VSIFCloseL(f)
+    assert '<SourceReduction dimension="0" operation="sum" />' in got_data
+    assert "time_increasing" not in got_data
+
+    ds = gdal.OpenEx(tmpfile, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("foo")
+    assert ar.GetDataType().GetNumericDataType() == gdal.GDT_Float64
+    assert [dim.GetName() for dim in ar.GetDimensions()] == [
+        "latitude",
+        "longitude",
+    ]
+    assert struct.unpack("d" * 100, ar.Read()) == (4.0,) * 100
+    ds = None
+
+    gdal.Unlink(tmpfile)
+
+    with gdaltest.error_handler():
+        assert not gdal.MultiDimTranslate(
+            tmpfile,
+            "data/mdim.vrt",
+            arraySpecs=["name=my_variable_with_time_increasing,reduce=invalid:sum"],
+        )
+        assert not gdal.MultiDimTranslate(
+            tmpfile,
+            "data/mdim.vrt",
+            arraySpecs=[
+                "name=my_variable_with_time_increasing,reduce=time_increasing:median"
+            ],
+        )
+    gdal.Unlink(tmpfile)
+
+
+###############################################################################
+
+
 def test_gdalmdimtranslate_group():
 
     tmpfile = "/vsimem/out.vrt"
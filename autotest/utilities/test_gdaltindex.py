@@ -322,6 +322,62 @@ def test_gdaltindex_6():
         ds = None
 
 
+###############################################################################
+# Test -num_threads
+
+
+def test_gdaltindex_num_threads():
+    if test_cli_utilities.get_gdaltindex_path() is None:
+        pytest.skip()
+
+    gdal.PushErrorHandler("CPLQuietErrorHandler")
+    ogr.GetDriverByName("ESRI Shapefile").DeleteDataSource(
+        "tmp/test_gdaltindex_num_threads.shp"
+    )
+    gdal.PopErrorHandler()
+
+    (_, err) = gdaltest.runexternal_out_and_err(
+        test_cli_utilities.get_gdaltindex_path()
+        + " -num_threads 3 tmp/test_gdaltindex_num_threads.shp"
+        + " tmp/gdaltindex1.tif tmp/gdaltindex2.tif tmp/non_existing.tif"
+        + " tmp/gdaltindex3.tif tmp/non_existing2.tif tmp/gdaltindex4.tif"
+    )
+    # Errors raised while opening files in worker threads are emitted in the
+    # order of the command line
+    pos_open_error = err.find("tmp/non_existing.tif: No such file or directory")
+    pos_skip = err.find("Unable to open tmp/non_existing.tif")
+    pos_open_error2 = err.find("tmp/non_existing2.tif: No such file or directory")
+    pos_skip2 = err.find("Unable to open tmp/non_existing2.tif")
+    assert 0 <= pos_open_error < pos_skip < pos_open_error2 < pos_skip2, err
+
+    ds = ogr.Open("tmp/test_gdaltindex_num_threads.shp")
+    lyr = ds.GetLayer(0)
+    assert [f.GetField("location") for f in lyr] == [
+        "tmp/gdaltindex1.tif",
+        "tmp/gdaltindex2.tif",
+        "tmp/gdaltindex3.tif",
+        "tmp/gdaltindex4.tif",
+    ]
+    ds = None
+
+    # Files already in the index are skipped
+    (_, err) = gdaltest.runexternal_out_and_err(
+        test_cli_utilities.get_gdaltindex_path()
+        + " -num_threads 3 tmp/test_gdaltindex_num_threads.shp"
+        + " tmp/gdaltindex1.tif tmp/gdaltindex2.tif"
+    )
+    assert "File tmp/gdaltindex1.tif is already in tileindex" in err
+    assert "File tmp/gdaltindex2.tif is already in tileindex" in err
+
+    ds = ogr.Open("tmp/test_gdaltindex_num_threads.shp")
+    assert ds.GetLayer(0).GetFeatureCount() == 4
+    ds = None
+
+    ogr.GetDriverByName("ESRI Shapefile").DeleteDataSource(
+        "tmp/test_gdaltindex_num_threads.shp"
+    )
+
+
 ###############################################################################
 # Cleanup
 
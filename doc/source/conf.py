@@ -185,6 +185,13 @@ man_pages = [
         [author_tamass],
         1,
     ),
+    (
+        "programs/gdal_zonalstats",
+        "gdal_zonalstats",
+        "Computes statistics of the pixel values of a raster inside polygons.",
+        [author_evenr],
+        1,
+    ),
     (
         "programs/gdal_create",
         "gdal_create",
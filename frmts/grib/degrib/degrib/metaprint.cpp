@@ -123,7 +123,7 @@ static const char *Lookup(const char * const *table, size_t n, size_t index)
  */
 char *Print(const char *label, const char *varName, int fmt, ...)
 {
-   static char *buffer = nullptr; /* Copy of message generated so far. */
+   static thread_local char *buffer = nullptr; /* Copy of message generated so far. */
    va_list ap;          /* pointer to variable argument list. */
    sInt4 lival;         /* Store a sInt4 val from argument list. */
    char *sval;          /* Store a string val from argument. */
@@ -43,12 +43,14 @@
 #endif
 
 #include <algorithm>
+#include <limits>
 #include <set>
 #include <string>
 #include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
@@ -67,6 +69,7 @@ CPL_C_END
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_spatialref.h"
 #include "memdataset.h"
 
@@ -855,45 +858,61 @@ CPLErr GRIBRasterBand::LoadData()
             m_Grib_MetaData = nullptr;
         }
         ReadGribData(poGDS->fp, start, subgNum, &m_Grib_Data, &m_Grib_MetaData);
-        if (!m_Grib_Data)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
-            if (m_Grib_MetaData != nullptr)
-            {
-                MetaFree(m_Grib_MetaData);
-                delete m_Grib_MetaData;
-                m_Grib_MetaData = nullptr;
-            }
-            return CE_Failure;
-        }
+        return RegisterLoadedData();
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                         RegisterLoadedData()                         */
+/************************************************************************/
+
+// Validates the data that has just been decoded into m_Grib_Data and
+// m_Grib_MetaData, and accounts for it in the dataset cache.
+CPLErr GRIBRasterBand::RegisterLoadedData()
+
+{
+    GRIBDataset *poGDS = static_cast<GRIBDataset *>(poDS);
 
-        // Check the band matches the dataset as a whole, size wise. (#3246)
-        nGribDataXSize = m_Grib_MetaData->gds.Nx;
-        nGribDataYSize = m_Grib_MetaData->gds.Ny;
-        if (nGribDataXSize <= 0 || nGribDataYSize <= 0)
+    if (!m_Grib_Data)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
+        if (m_Grib_MetaData != nullptr)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d.", nBand, nGribDataXSize,
-                     nGribDataYSize);
             MetaFree(m_Grib_MetaData);
             delete m_Grib_MetaData;
             m_Grib_MetaData = nullptr;
-            return CE_Failure;
         }
+        return CE_Failure;
+    }
 
-        poGDS->nCachedBytes += static_cast<GIntBig>(nGribDataXSize) *
-                               nGribDataYSize * sizeof(double);
-        poGDS->poLastUsedBand = this;
+    // Check the band matches the dataset as a whole, size wise. (#3246)
+    nGribDataXSize = m_Grib_MetaData->gds.Nx;
+    nGribDataYSize = m_Grib_MetaData->gds.Ny;
+    if (nGribDataXSize <= 0 || nGribDataYSize <= 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d.", nBand, nGribDataXSize,
+                 nGribDataYSize);
+        MetaFree(m_Grib_MetaData);
+        delete m_Grib_MetaData;
+        m_Grib_MetaData = nullptr;
+        return CE_Failure;
+    }
 
-        if (nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize)
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d, while the first band "
-                     "and dataset is %dx%d.  Georeferencing of band %d may "
-                     "be incorrect, and data access may be incomplete.",
-                     nBand, nGribDataXSize, nGribDataYSize, nRasterXSize,
-                     nRasterYSize, nBand);
-        }
+    poGDS->nCachedBytes += static_cast<GIntBig>(nGribDataXSize) *
+                           nGribDataYSize * sizeof(double);
+    poGDS->poLastUsedBand = this;
+
+    if (nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d, while the first band "
+                 "and dataset is %dx%d.  Georeferencing of band %d may "
+                 "be incorrect, and data access may be incomplete.",
+                 nBand, nGribDataXSize, nGribDataYSize, nRasterXSize,
+                 nRasterYSize, nBand);
     }
 
     return CE_None;
@@ -1295,6 +1314,268 @@ CPLErr GRIBDataset::GetGeoTransform(double *padfTransform)
     return CE_None;
 }
 
+/************************************************************************/
+/*                        GRIBDecodeJobFunc()                           */
+/************************************************************************/
+
+namespace
+{
+struct GRIBDecodeJob
+{
+    std::string osFilename{};
+    vsi_l_offset nStart = 0;
+    vsi_l_offset nEnd = 0;  // 0 to read till the end of the file
+    int nSubgNum = 0;
+    double *padfData = nullptr;
+    grib_MetaData *psMetaData = nullptr;
+    // Errors raised while decoding, to be emitted in the calling thread
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+}  // namespace
+
+// Reads the message in memory, and decodes it. The state that the degrib
+// library keeps between calls is thread-local, so messages can be decoded
+// concurrently.
+static void GRIBDecode(GRIBDecodeJob *psJob)
+{
+    // The file handle of the dataset cannot be shared between threads.
+    VSILFILE *fp = VSIFOpenL(psJob->osFilename.c_str(), "rb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_OpenFailed, "Cannot open %s",
+                 psJob->osFilename.c_str());
+        return;
+    }
+    if (psJob->nEnd == 0)
+    {
+        VSIFSeekL(fp, 0, SEEK_END);
+        psJob->nEnd = VSIFTellL(fp);
+    }
+    if (psJob->nEnd <= psJob->nStart ||
+        psJob->nEnd - psJob->nStart > std::numeric_limits<size_t>::max())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid extent for GRIB message at offset " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(psJob->nStart));
+        VSIFCloseL(fp);
+        return;
+    }
+    const size_t nSize = static_cast<size_t>(psJob->nEnd - psJob->nStart);
+    GByte *pabyMessage = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nSize));
+    const bool bOK = pabyMessage != nullptr &&
+                     VSIFSeekL(fp, psJob->nStart, SEEK_SET) == 0 &&
+                     VSIFReadL(pabyMessage, 1, nSize, fp) == nSize;
+    VSIFCloseL(fp);
+    if (!bOK)
+    {
+        if (pabyMessage)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read GRIB message at offset " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(psJob->nStart));
+        }
+        VSIFree(pabyMessage);
+        return;
+    }
+
+    const std::string osTmpFilename(
+        CPLSPrintf("/vsimem/grib_decode_%p.grb", psJob));
+    fp = VSIFileFromMemBuffer(osTmpFilename.c_str(), pabyMessage, nSize,
+                              /* bTakeOwnership = */ true);
+    if (fp == nullptr)
+    {
+        VSIFree(pabyMessage);
+        return;
+    }
+    GRIBRasterBand::ReadGribData(fp, 0, psJob->nSubgNum, &psJob->padfData,
+                                 &psJob->psMetaData);
+    VSIFCloseL(fp);
+    VSIUnlink(osTmpFilename.c_str());
+}
+
+static void GRIBDecodeJobFunc(void *pData)
+{
+    GRIBDecodeJob *psJob = static_cast<GRIBDecodeJob *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    GRIBDecode(psJob);
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*                      DecodeBandsMultiThreaded()                      */
+/************************************************************************/
+
+// Decodes the messages of the requested bands that are not already cached
+// in parallel, and caches the results in the bands.
+CPLErr GRIBDataset::DecodeBandsMultiThreaded(int nBandCount,
+                                             const int *panBandMap,
+                                             int nThreads)
+{
+    std::vector<GRIBRasterBand *> apoBandsToDecode;
+    GIntBig nNeededBytes = 0;
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        auto poBand =
+            cpl::down_cast<GRIBRasterBand *>(GetRasterBand(panBandMap[i]));
+        if (poBand->m_Grib_Data == nullptr &&
+            std::find(apoBandsToDecode.begin(), apoBandsToDecode.end(),
+                      poBand) == apoBandsToDecode.end())
+        {
+            apoBandsToDecode.push_back(poBand);
+            nNeededBytes +=
+                static_cast<GIntBig>(nRasterXSize) * nRasterYSize *
+                static_cast<GIntBig>(sizeof(double));
+        }
+    }
+    if (apoBandsToDecode.size() < 2)
+        return CE_None;
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (poThreadPool == nullptr)
+        return CE_None;
+
+    // Make room in the cache by evicting the bands that are not requested,
+    // so that GRIB_CACHEMAX is respected.
+    if (nCachedBytes + nNeededBytes > nCachedBytesThreshold)
+    {
+        for (int i = 0; i < nBands; ++i)
+        {
+            auto poBand = cpl::down_cast<GRIBRasterBand *>(papoBands[i]);
+            if (poBand->m_Grib_Data != nullptr &&
+                std::find(panBandMap, panBandMap + nBandCount, i + 1) ==
+                    panBandMap + nBandCount)
+            {
+                nCachedBytes -= static_cast<GIntBig>(poBand->nGribDataXSize) *
+                                poBand->nGribDataYSize *
+                                static_cast<GIntBig>(sizeof(double));
+                poBand->UncacheData();
+            }
+        }
+        nCachedBytes = std::max<GIntBig>(0, nCachedBytes);
+    }
+
+    // The end of a message is the start of the next one.
+    std::vector<vsi_l_offset> anStarts;
+    for (int i = 0; i < nBands; ++i)
+        anStarts.push_back(
+            cpl::down_cast<GRIBRasterBand *>(papoBands[i])->start);
+    std::sort(anStarts.begin(), anStarts.end());
+
+    std::vector<GRIBDecodeJob> asJobs(apoBandsToDecode.size());
+    auto poQueue = poThreadPool->CreateJobQueue();
+    for (size_t i = 0; i < apoBandsToDecode.size(); ++i)
+    {
+        asJobs[i].osFilename = GetDescription();
+        asJobs[i].nStart = apoBandsToDecode[i]->start;
+        const auto oIterNext = std::upper_bound(
+            anStarts.begin(), anStarts.end(), asJobs[i].nStart);
+        if (oIterNext != anStarts.end())
+            asJobs[i].nEnd = *oIterNext;
+        asJobs[i].nSubgNum = apoBandsToDecode[i]->subgNum;
+        poQueue->SubmitJob(GRIBDecodeJobFunc, &asJobs[i]);
+    }
+    poQueue->WaitCompletion();
+
+    CPLErr eErr = CE_None;
+    for (size_t i = 0; i < apoBandsToDecode.size(); ++i)
+    {
+        auto poBand = apoBandsToDecode[i];
+        auto &sJob = asJobs[i];
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        if (sJob.padfData == nullptr || sJob.psMetaData == nullptr ||
+            sJob.psMetaData->gds.Nx <= 0 || sJob.psMetaData->gds.Ny <= 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Decoding of GRIB message of band %d failed",
+                     poBand->GetBand());
+            eErr = CE_Failure;
+            free(sJob.padfData);
+            if (sJob.psMetaData)
+            {
+                MetaFree(sJob.psMetaData);
+                delete sJob.psMetaData;
+            }
+            continue;
+        }
+        if (poBand->m_Grib_MetaData != nullptr)
+        {
+            MetaFree(poBand->m_Grib_MetaData);
+            delete poBand->m_Grib_MetaData;
+        }
+        poBand->m_Grib_Data = sJob.padfData;
+        poBand->m_Grib_MetaData = sJob.psMetaData;
+        if (poBand->RegisterLoadedData() != CE_None)
+            eErr = CE_Failure;
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GRIBDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                              int nXSize, int nYSize, void *pData,
+                              int nBufXSize, int nBufYSize,
+                              GDALDataType eBufType, int nBandCount,
+                              int *panBandMap, GSpacing nPixelSpace,
+                              GSpacing nLineSpace, GSpacing nBandSpace,
+                              GDALRasterIOExtraArg *psExtraArg)
+{
+    const int nThreads = GDALGetNumThreads(nullptr, nullptr);
+    if (eRWFlag == GF_Read && nBandCount > 1 && nThreads > 1)
+    {
+        // Process bands by batches whose decoded messages fit in
+        // GRIB_CACHEMAX, decoding the messages of each batch in parallel.
+        const GIntBig nBandBytes =
+            std::max<GIntBig>(1, static_cast<GIntBig>(nRasterXSize) *
+                                     nRasterYSize *
+                                     static_cast<GIntBig>(sizeof(double)));
+        const int nBandsPerBatch = static_cast<int>(
+            std::min<GIntBig>(nBandCount, nCachedBytesThreshold / nBandBytes));
+        if (nBandsPerBatch > 1)
+        {
+            CPLErr eErr = CE_None;
+            for (int iStart = 0; eErr == CE_None && iStart < nBandCount;
+                 iStart += nBandsPerBatch)
+            {
+                const int nBatchCount =
+                    std::min(nBandsPerBatch, nBandCount - iStart);
+                eErr = DecodeBandsMultiThreaded(
+                    nBatchCount, panBandMap + iStart, nThreads);
+                if (eErr != CE_None)
+                    break;
+
+                GDALRasterIOExtraArg sExtraArg;
+                GDALCopyRasterIOExtraArg(&sExtraArg, psExtraArg);
+                sExtraArg.pfnProgress = GDALScaledProgress;
+                sExtraArg.pProgressData = GDALCreateScaledProgress(
+                    static_cast<double>(iStart) / nBandCount,
+                    static_cast<double>(iStart + nBatchCount) / nBandCount,
+                    psExtraArg->pfnProgress, psExtraArg->pProgressData);
+                if (sExtraArg.pProgressData == nullptr)
+                    sExtraArg.pfnProgress = nullptr;
+
+                eErr = GDALPamDataset::IRasterIO(
+                    eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                    static_cast<GByte *>(pData) + iStart * nBandSpace,
+                    nBufXSize, nBufYSize, eBufType, nBatchCount,
+                    panBandMap + iStart, nPixelSpace, nLineSpace, nBandSpace,
+                    &sExtraArg);
+
+                GDALDestroyScaledProgress(sExtraArg.pProgressData);
+            }
+            return eErr;
+        }
+    }
+
+    return GDALPamDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
 /************************************************************************/
 /*                            Identify()                                */
 /************************************************************************/
@@ -110,8 +110,16 @@ class GRIBDataset final : public GDALPamDataset
         return m_poRootGroup;
     }
 
+  protected:
+    CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                     GDALDataType, int, int *, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
   private:
     void SetGribMetaData(grib_MetaData *meta);
+    CPLErr DecodeBandsMultiThreaded(int nBandCount, const int *panBandMap,
+                                    int nThreads);
     static GDALDataset *OpenMultiDim(GDALOpenInfo *);
     static std::unique_ptr<gdal::grib::InventoryWrapper>
     Inventory(VSILFILE *, GDALOpenInfo *);
@@ -167,6 +175,7 @@ class GRIBRasterBand final : public GDALPamRasterBand
 
   private:
     CPLErr LoadData();
+    CPLErr RegisterLoadedData();
     void FindNoDataGrib2(bool bSeekToStart = true);
     void FindMetaData();
     // Heuristic search for the start of the message
@@ -70,11 +70,28 @@ static bool HasZSTDCompression()
 /*                           GetTmpFilename()                           */
 /************************************************************************/
 
-static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt)
+// If dfEstimatedSize fits within the remaining nTmpMaxMem budget, the
+// temporary file is created in /vsimem/ and the budget is decreased
+// accordingly.
+
+static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt,
+                                double dfEstimatedSize, GIntBig &nTmpMaxMem)
 {
+    CPLString osTmpFilename;
+    if (dfEstimatedSize <= static_cast<double>(nTmpMaxMem))
+    {
+        nTmpMaxMem -= static_cast<GIntBig>(dfEstimatedSize);
+        osTmpFilename = "/vsimem/";
+        osTmpFilename += CPLGetFilename(
+            CPLGenerateTempFilename(CPLGetBasename(pszFilename)));
+        osTmpFilename += '.';
+        osTmpFilename += pszExt;
+        VSIUnlink(osTmpFilename);
+        return osTmpFilename;
+    }
+
     const bool bSupportsRandomWrite =
         VSISupportsRandomWrite(pszFilename, false);
-    CPLString osTmpFilename;
     if (!bSupportsRandomWrite ||
         CPLGetConfigOption("CPL_TMPDIR", nullptr) != nullptr)
     {
@@ -88,6 +105,19 @@ static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt)
     return osTmpFilename;
 }
 
+/************************************************************************/
+/*                          GetTmpMaxMem()                              */
+/************************************************************************/
+
+// Maximum amount of memory that may be used for temporary files (reprojected
+// dataset, overviews) created in /vsimem/ instead of on disk.
+static GIntBig GetTmpMaxMem()
+{
+    const char *pszTmpMaxMem = CPLGetConfigOption("COG_TMP_MAX_MEM", nullptr);
+    return pszTmpMaxMem ? CPLAtoGIntBig(pszTmpMaxMem)
+                        : CPLGetUsablePhysicalRAM() / 4;
+}
+
 /************************************************************************/
 /*                             GetResampling()                          */
 /************************************************************************/
@@ -560,7 +590,8 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     const CPLString &osTargetSRS, const int nXSize, const int nYSize,
     const double dfMinX, const double dfMinY, const double dfMaxX,
     const double dfMaxY, const double dfRes, GDALProgressFunc pfnProgress,
-    void *pProgressData, double &dfCurPixels, double &dfTotalPixelsToProcess)
+    void *pProgressData, double &dfCurPixels, double &dfTotalPixelsToProcess,
+    GIntBig &nTmpMaxMem)
 {
     char **papszArg = nullptr;
     // We could have done a warped VRT, but overview building on it might be
@@ -658,7 +689,13 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     CPLDebug("COG", "Reprojecting source dataset: start");
     GDALWarpAppOptionsSetProgress(psOptions, GDALScaledProgress,
                                   pScaledProgress);
-    CPLString osTmpFile(GetTmpFilename(pszDstFilename, "warped.tif.tmp"));
+    // Upper bound of the uncompressed size, taking into account a potential
+    // alpha band
+    const double dfEstimatedSize =
+        static_cast<double>(nXSize) * nYSize * (nBands + 1) *
+        GDALGetDataTypeSizeBytes(poFirstBand->GetRasterDataType());
+    CPLString osTmpFile(GetTmpFilename(pszDstFilename, "warped.tif.tmp",
+                                       dfEstimatedSize, nTmpMaxMem));
     auto hSrcDS = GDALDataset::ToHandle(poSrcDS);
     auto hRet = GDALWarp(osTmpFile, nullptr, 1, &hSrcDS, psOptions, nullptr);
     GDALWarpAppOptionsFree(psOptions);
@@ -679,6 +716,7 @@ struct GDALCOGCreator final
     std::unique_ptr<GDALDataset> m_poRGBMaskDS{};
     CPLString m_osTmpOverviewFilename{};
     CPLString m_osTmpMskOverviewFilename{};
+    GIntBig m_nTmpMaxMem = GetTmpMaxMem();
 
     ~GDALCOGCreator();
 
@@ -809,7 +847,8 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
                 pszFilename, poCurDS, papszOptions, osTargetResampling,
                 osTargetSRS, nTargetXSize, nTargetYSize, dfTargetMinX,
                 dfTargetMinY, dfTargetMaxX, dfTargetMaxY, dfRes, pfnProgress,
-                pProgressData, dfCurPixels, dfTotalPixelsToProcess);
+                pProgressData, dfCurPixels, dfTotalPixelsToProcess,
+                m_nTmpMaxMem);
             if (!m_poReprojectedDS)
                 return nullptr;
             poCurDS = m_poReprojectedDS.get();
@@ -989,7 +1028,10 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateMskOvr)
     {
         CPLDebug("COG", "Generating overviews of the mask: start");
-        m_osTmpMskOverviewFilename = GetTmpFilename(pszFilename, "msk.ovr.tmp");
+        m_osTmpMskOverviewFilename =
+            GetTmpFilename(pszFilename, "msk.ovr.tmp",
+                           static_cast<double>(nXSize) * nYSize / 3,
+                           m_nTmpMaxMem);
         GDALRasterBand *poSrcMask = poFirstBand->GetMaskBand();
         const char *pszResampling = CSLFetchNameValueDef(
             papszOptions, "OVERVIEW_RESAMPLING",
@@ -1019,7 +1061,11 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateOvr)
     {
         CPLDebug("COG", "Generating overviews of the imagery: start");
-        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
+        m_osTmpOverviewFilename = GetTmpFilename(
+            pszFilename, "ovr.tmp",
+            static_cast<double>(nXSize) * nYSize * nBands / 3 *
+                GDALGetDataTypeSizeBytes(poFirstBand->GetRasterDataType()),
+            m_nTmpMaxMem);
         std::vector<GDALRasterBand *> apoSrcBands;
         for (int i = 0; i < nBands; i++)
             apoSrcBands.push_back(poCurDS->GetRasterBand(i + 1));
@@ -501,6 +501,7 @@ class GTiffDataset final : public GDALPamDataset
     bool m_bStreamingOut : 1;
     bool m_bScanDeferred : 1;
     bool m_bSingleIFDOpened = false;
+    bool m_bInReadAhead = false;  // whether GTiffRasterBand::ReadAhead() runs
     bool m_bLoadedBlockDirty : 1;
     bool m_bWriteError : 1;
     bool m_bLookedForProjection : 1;
@@ -1378,6 +1379,12 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
                           int nBufXSize, int nBufYSize,
                           GDALRasterIOExtraArg *psExtraArg);
 
+    // State of the adaptive read-ahead done by IReadBlock()
+    int m_nReadAheadNextBlockId = -1;
+    int m_nReadAheadBlockCount = 0;
+
+    void *ReadAhead(int nBlockXOff, int nBlockYOff);
+
   protected:
     GTiffDataset *m_poGDS = nullptr;
     GDALMultiDomainMetadata m_oGTiffMDMD{};
@@ -5895,6 +5902,101 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
     return pBufferedData;
 }
 
+/************************************************************************/
+/*                            ReadAhead()                               */
+/************************************************************************/
+
+// Detects sequential (row-major) block access done through IReadBlock(),
+// and when it occurs, fetches the data of the current block and of the
+// following ones with a single CacheMultiRange() call, and decodes the
+// following ones into the block cache. The number of blocks read ahead is
+// doubled at each sequential access, up to GTIFF_READ_AHEAD_MAX_BLOCKS.
+// Returns the buffer returned by CacheMultiRange(), that must be freed
+// (and the cached ranges reset) once the current block has been read.
+
+void *GTiffRasterBand::ReadAhead(int nBlockXOff, int nBlockYOff)
+{
+    const int nBlockIdBand0 = nBlockXOff + nBlockYOff * nBlocksPerRow;
+    if (nBlockIdBand0 != m_nReadAheadNextBlockId)
+    {
+        // Non-sequential access
+        m_nReadAheadBlockCount = 0;
+        m_nReadAheadNextBlockId = nBlockIdBand0 + 1;
+        return nullptr;
+    }
+    m_nReadAheadNextBlockId = nBlockIdBand0 + 1;
+
+    GIntBig nMaxBlocks =
+        atoi(CPLGetConfigOption("GTIFF_READ_AHEAD_MAX_BLOCKS", "64"));
+    // Make sure the blocks read ahead do not take more than a quarter of
+    // the block cache.
+    const GIntBig nBlockBytes =
+        static_cast<GIntBig>(nBlockXSize) * nBlockYSize *
+        GDALGetDataTypeSizeBytes(eDataType) *
+        (m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG ? m_poGDS->nBands
+                                                         : 1);
+    nMaxBlocks = std::min(nMaxBlocks, GDALGetCacheMax64() / 4 / nBlockBytes);
+    if (nMaxBlocks < 2)
+        return nullptr;
+    m_nReadAheadBlockCount = static_cast<int>(
+        m_nReadAheadBlockCount == 0
+            ? 2
+            : std::min(2 * static_cast<GIntBig>(m_nReadAheadBlockCount),
+                       nMaxBlocks));
+
+    // Determine the window of blocks to fetch, starting with the current
+    // one: either the end of the current block row, or full block rows.
+    const int nWantedBlocks = 1 + m_nReadAheadBlockCount;
+    int nXBlocks = 0;
+    int nYBlocks = 1;
+    if (nBlockXOff == 0 && nWantedBlocks > nBlocksPerRow)
+    {
+        nXBlocks = nBlocksPerRow;
+        nYBlocks = std::min(nWantedBlocks / nBlocksPerRow,
+                            nBlocksPerColumn - nBlockYOff);
+    }
+    else
+    {
+        nXBlocks = std::min(nWantedBlocks, nBlocksPerRow - nBlockXOff);
+    }
+    if (nXBlocks * nYBlocks <= 1)
+        return nullptr;
+    m_nReadAheadNextBlockId =
+        (nBlockYOff + nYBlocks - 1) * nBlocksPerRow + nBlockXOff + nXBlocks;
+
+    const int nXOff = nBlockXOff * nBlockXSize;
+    const int nYOff = nBlockYOff * nBlockYSize;
+    const int nXSize = std::min(nXBlocks * nBlockXSize, nRasterXSize - nXOff);
+    const int nYSize = std::min(nYBlocks * nBlockYSize, nRasterYSize - nYOff);
+    GDALRasterIOExtraArg sExtraArg;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    void *pBufferedData = CacheMultiRange(nXOff, nYOff, nXSize, nYSize, nXSize,
+                                          nYSize, &sExtraArg);
+    if (pBufferedData == nullptr)
+        return nullptr;
+
+    CPLDebug("GTiff", "Read-ahead of %d blocks from block (%d,%d) of band %d",
+             nXBlocks * nYBlocks - 1, nBlockXOff, nBlockYOff, nBand);
+
+    m_poGDS->m_bInReadAhead = true;
+    for (int iY = nBlockYOff; iY < nBlockYOff + nYBlocks; ++iY)
+    {
+        for (int iX = nBlockXOff; iX < nBlockXOff + nXBlocks; ++iX)
+        {
+            if (iX == nBlockXOff && iY == nBlockYOff)
+                continue;
+            GDALRasterBlock *poBlock = TryGetLockedBlockRef(iX, iY);
+            if (poBlock == nullptr)
+                poBlock = GetLockedBlockRef(iX, iY);
+            if (poBlock)
+                poBlock->DropLock();
+        }
+    }
+    m_poGDS->m_bInReadAhead = false;
+
+    return pBufferedData;
+}
+
 /************************************************************************/
 /*                            IRasterIO()                               */
 /************************************************************************/
@@ -6270,6 +6372,33 @@ CPLErr GTiffRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
     if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
         nBlockId = nBlockIdBand0 + (nBand - 1) * m_poGDS->m_nBlocksPerBand;
 
+    /* -------------------------------------------------------------------- */
+    /*      On network file systems, read ahead the next blocks if we       */
+    /*      detect a sequential access pattern.                             */
+    /* -------------------------------------------------------------------- */
+    struct ReadAheadDataReleaser
+    {
+        TIFF *hTIFF;
+        void *pData;
+
+        ~ReadAheadDataReleaser()
+        {
+            if (pData)
+            {
+                VSIFree(pData);
+                VSI_TIFFSetCachedRanges(TIFFClientdata(hTIFF), 0, nullptr,
+                                        nullptr, nullptr);
+            }
+        }
+    } oReadAheadDataReleaser{m_poGDS->m_hTIFF, nullptr};
+    if (!m_poGDS->m_bInReadAhead && m_poGDS->eAccess == GA_ReadOnly &&
+        !m_poGDS->m_bStreamingIn &&
+        !VSI_TIFFHasCachedRanges(TIFFClientdata(m_poGDS->m_hTIFF)) &&
+        m_poGDS->HasOptimizedReadMultiRange())
+    {
+        oReadAheadDataReleaser.pData = ReadAhead(nBlockXOff, nBlockYOff);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      The bottom most partial tiles and strips are sometimes only     */
     /*      partially encoded.  This code reduces the requested data so     */
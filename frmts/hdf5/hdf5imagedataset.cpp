@@ -29,15 +29,31 @@
 
 #include "hdf5_api.h"
 
+#include "cpl_compressor.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gh5_convenience.h"
 #include "hdf5dataset.h"
 #include "ogr_spatialref.h"
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#if defined(H5_VERSION_GE)
+#if H5_VERSION_GE(1, 10, 2)
+#define HAVE_H5DREAD_CHUNK
+#endif
+#endif
+
+// Filter ids of registered third-party HDF5 filters
+#define H5Z_FILTER_BLOSC_GDAL 32001
+#define H5Z_FILTER_ZSTD_GDAL 32015
 
 class HDF5ImageDataset final : public HDF5Dataset
 {
@@ -82,7 +98,15 @@ class HDF5ImageDataset final : public HDF5Dataset
     int m_nYIndex = -1;
     int m_nOtherDimIndex = -1;
 
+    // Used by HDF5ImageRasterBand::DirectChunkRead()
+    bool m_bDirectChunkReadChecked = false;
+    bool m_bDirectChunkReadPossible = false;
+    bool m_bDirectChunkByteSwap = false;
+    std::vector<hsize_t> m_anChunkDims{};
+    std::vector<H5Z_filter_t> m_anChunkFilters{};  // in pipeline order
+
     CPLErr CreateODIMH5Projection();
+    bool IsDirectChunkReadPossible();
 
   public:
     HDF5ImageDataset();
@@ -226,8 +250,17 @@ class HDF5ImageRasterBand final : public GDALPamRasterBand
     virtual ~HDF5ImageRasterBand();
 
     virtual CPLErr IReadBlock(int, int, void *) override;
+    virtual CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                             GDALDataType, GSpacing, GSpacing,
+                             GDALRasterIOExtraArg *psExtraArg) override;
     virtual double GetNoDataValue(int *) override;
     // virtual CPLErr IWriteBlock( int, int, void * );
+
+#ifdef HAVE_H5DREAD_CHUNK
+    int DirectChunkRead(int nXOff, int nYOff, int nXSize, int nYSize,
+                        void *pData, GDALDataType eBufType,
+                        GSpacing nPixelSpace, GSpacing nLineSpace);
+#endif
 };
 
 /************************************************************************/
@@ -397,6 +430,435 @@ CPLErr HDF5ImageRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr HDF5ImageRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                      int nXSize, int nYSize, void *pData,
+                                      int nBufXSize, int nBufYSize,
+                                      GDALDataType eBufType,
+                                      GSpacing nPixelSpace, GSpacing nLineSpace,
+                                      GDALRasterIOExtraArg *psExtraArg)
+{
+#ifdef HAVE_H5DREAD_CHUNK
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+    {
+        const int nRet =
+            DirectChunkRead(nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                            nPixelSpace, nLineSpace);
+        if (nRet >= 0)
+            return static_cast<CPLErr>(nRet);
+    }
+#endif
+
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
+#ifdef HAVE_H5DREAD_CHUNK
+
+/************************************************************************/
+/*                    IsDirectChunkReadPossible()                       */
+/************************************************************************/
+
+// Checks whether chunks of the dataset can be read with H5Dread_chunk() and
+// decoded by our own code, that is if they only use filters available through
+// the cpl_compressor.h API (or shuffle), and a simple numeric data type.
+bool HDF5ImageDataset::IsDirectChunkReadPossible()
+{
+    if (m_bDirectChunkReadChecked)
+        return m_bDirectChunkReadPossible;
+    m_bDirectChunkReadChecked = true;
+
+    if (eAccess != GA_ReadOnly || IsComplexCSKL1A() || ndims < 2 ||
+        ndims > 3 || m_nYIndex < 0)
+        return false;
+
+    const H5T_class_t eClass = H5Tget_class(datatype);
+    if ((eClass != H5T_INTEGER && eClass != H5T_FLOAT) ||
+        H5Tget_size(datatype) !=
+            static_cast<size_t>(GDALGetDataTypeSizeBytes(
+                GetRasterBand(1)->GetRasterDataType())) ||
+        H5Tget_precision(datatype) != 8 * H5Tget_size(datatype) ||
+        H5Tget_offset(datatype) != 0)
+    {
+        return false;
+    }
+    const H5T_order_t eOrder = H5Tget_order(datatype);
+#ifdef CPL_LSB
+    m_bDirectChunkByteSwap = eOrder == H5T_ORDER_BE;
+#else
+    m_bDirectChunkByteSwap = eOrder == H5T_ORDER_LE;
+#endif
+
+    const hid_t listid = H5Dget_create_plist(dataset_id);
+    if (listid < 0)
+        return false;
+    bool bOK = H5Pget_layout(listid) == H5D_CHUNKED;
+    if (bOK)
+    {
+        m_anChunkDims.resize(ndims);
+        bOK = H5Pget_chunk(listid, ndims, m_anChunkDims.data()) == ndims;
+    }
+    const int nFilters = bOK ? H5Pget_nfilters(listid) : 0;
+    for (int i = 0; bOK && i < nFilters; ++i)
+    {
+        unsigned int nFilterFlags = 0;
+        size_t nValues = 0;
+        const H5Z_filter_t nFilterId = H5Pget_filter2(
+            listid, i, &nFilterFlags, &nValues, nullptr, 0, nullptr, nullptr);
+        const char *pszDecompressorId =
+            nFilterId == H5Z_FILTER_DEFLATE     ? "zlib"
+            : nFilterId == H5Z_FILTER_ZSTD_GDAL ? "zstd"
+            : nFilterId == H5Z_FILTER_BLOSC_GDAL ? "blosc"
+                                                 : nullptr;
+        if (nFilterId == H5Z_FILTER_SHUFFLE ||
+            (pszDecompressorId && CPLGetDecompressor(pszDecompressorId)))
+        {
+            m_anChunkFilters.push_back(nFilterId);
+        }
+        else
+        {
+            CPLDebug("HDF5", "Filter %d not handled by direct chunk reading",
+                     static_cast<int>(nFilterId));
+            bOK = false;
+        }
+    }
+    H5Pclose(listid);
+
+    m_bDirectChunkReadPossible = bOK;
+    return bOK;
+}
+
+/************************************************************************/
+/*                        HDF5ChunkDecodeJob                            */
+/************************************************************************/
+
+namespace
+{
+struct HDF5ChunkDecodeJob
+{
+    const std::vector<H5Z_filter_t> *panFilters = nullptr;
+    bool bByteSwap = false;
+    std::vector<GByte> abyRaw{};
+    uint32_t nFilterMask = 0;
+    size_t nChunkBytes = 0;
+    GDALDataType eDT = GDT_Unknown;
+    // Offset, in the chunk, of the first element to copy
+    size_t nSrcOffset = 0;
+    // Strides, in elements, in the chunk, along the X and Y axis
+    size_t nSrcXStride = 0;
+    size_t nSrcYStride = 0;
+    int nXCount = 0;
+    int nYCount = 0;
+    GByte *pabyDst = nullptr;
+    GDALDataType eBufType = GDT_Unknown;
+    GSpacing nPixelSpace = 0;
+    GSpacing nLineSpace = 0;
+    std::atomic<bool> *pbSuccess = nullptr;
+    // Errors raised while decoding, to be emitted in the calling thread
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+}  // namespace
+
+/************************************************************************/
+/*                         HDF5Unshuffle()                              */
+/************************************************************************/
+
+// Reverts the HDF5 shuffle filter, that groups the first byte of each
+// element, then the second byte of each element, etc.
+static void HDF5Unshuffle(const GByte *pabySrc, GByte *pabyDst, size_t nBytes,
+                          size_t nEltSize)
+{
+    const size_t nElts = nBytes / nEltSize;
+    for (size_t j = 0; j < nEltSize; ++j)
+    {
+        const GByte *pabySrcByte = pabySrc + j * nElts;
+        for (size_t i = 0; i < nElts; ++i)
+            pabyDst[i * nEltSize + j] = pabySrcByte[i];
+    }
+    // Trailing bytes are left untouched by the shuffle filter
+    const size_t nShuffledBytes = nElts * nEltSize;
+    memcpy(pabyDst + nShuffledBytes, pabySrc + nShuffledBytes,
+           nBytes - nShuffledBytes);
+}
+
+/************************************************************************/
+/*                          HDF5ChunkDecode()                           */
+/************************************************************************/
+
+static bool HDF5ChunkDecode(HDF5ChunkDecodeJob *psJob)
+{
+    const auto &anFilters = *psJob->panFilters;
+    const int nDTSize = GDALGetDataTypeSizeBytes(psJob->eDT);
+
+    std::vector<GByte> abyIn(std::move(psJob->abyRaw));
+    std::vector<GByte> abyOut;
+    // Undo the filters in the reverse order of the pipeline
+    for (int i = static_cast<int>(anFilters.size()) - 1; i >= 0; --i)
+    {
+        if ((psJob->nFilterMask >> i) & 1)
+            continue;  // filter skipped for this chunk
+        if (anFilters[i] == H5Z_FILTER_SHUFFLE)
+        {
+            abyOut.resize(abyIn.size());
+            HDF5Unshuffle(abyIn.data(), abyOut.data(), abyIn.size(), nDTSize);
+        }
+        else
+        {
+            const char *pszDecompressorId =
+                anFilters[i] == H5Z_FILTER_DEFLATE    ? "zlib"
+                : anFilters[i] == H5Z_FILTER_ZSTD_GDAL ? "zstd"
+                                                       : "blosc";
+            const CPLCompressor *psDecompressor =
+                CPLGetDecompressor(pszDecompressorId);
+            abyOut.resize(psJob->nChunkBytes);
+            void *pOut = abyOut.data();
+            size_t nOutSize = abyOut.size();
+            if (!psDecompressor->pfnFunc(abyIn.data(), abyIn.size(), &pOut,
+                                         &nOutSize, nullptr,
+                                         psDecompressor->user_data))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Decompression of chunk with %s failed",
+                         pszDecompressorId);
+                return false;
+            }
+            abyOut.resize(nOutSize);
+        }
+        std::swap(abyIn, abyOut);
+    }
+    if (abyIn.size() < psJob->nChunkBytes)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decoded chunk size is " CPL_FRMT_GUIB
+                 " bytes, whereas " CPL_FRMT_GUIB " were expected",
+                 static_cast<GUIntBig>(abyIn.size()),
+                 static_cast<GUIntBig>(psJob->nChunkBytes));
+        return false;
+    }
+
+    if (psJob->bByteSwap)
+    {
+        GDALSwapWordsEx(abyIn.data(), nDTSize, psJob->nChunkBytes / nDTSize,
+                        nDTSize);
+    }
+
+    const int nSrcPixelSpace = static_cast<int>(psJob->nSrcXStride * nDTSize);
+    const bool bDstPixelSpaceFitsInt =
+        psJob->nPixelSpace >= std::numeric_limits<int>::min() &&
+        psJob->nPixelSpace <= std::numeric_limits<int>::max();
+    for (int iY = 0; iY < psJob->nYCount; ++iY)
+    {
+        const GByte *pabySrc =
+            abyIn.data() +
+            (psJob->nSrcOffset + iY * psJob->nSrcYStride) * nDTSize;
+        GByte *pabyDst = psJob->pabyDst + iY * psJob->nLineSpace;
+        if (bDstPixelSpaceFitsInt)
+        {
+            GDALCopyWords64(pabySrc, psJob->eDT, nSrcPixelSpace, pabyDst,
+                            psJob->eBufType,
+                            static_cast<int>(psJob->nPixelSpace),
+                            psJob->nXCount);
+        }
+        else
+        {
+            for (int iX = 0; iX < psJob->nXCount; ++iX)
+            {
+                GDALCopyWords(pabySrc + static_cast<size_t>(iX) *
+                                            nSrcPixelSpace,
+                              psJob->eDT, 0,
+                              pabyDst + iX * psJob->nPixelSpace,
+                              psJob->eBufType, 0, 1);
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      HDF5ChunkDecodeJobFunc()                        */
+/************************************************************************/
+
+static void HDF5ChunkDecodeJobFunc(void *pData)
+{
+    HDF5ChunkDecodeJob *psJob = static_cast<HDF5ChunkDecodeJob *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    if (!HDF5ChunkDecode(psJob))
+        *psJob->pbSuccess = false;
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*                         DirectChunkRead()                            */
+/************************************************************************/
+
+// Reads the raw chunks intersecting the requested window with
+// H5Dread_chunk() from the calling thread, and delegates their decoding
+// (decompression, unshuffling, byte swapping and copying into the output
+// buffer) to the global thread pool. As the HDF5 library serializes its API
+// calls, this is the only way for decoding to scale with the number of cores.
+// Returns -1 if this method cannot be used, or a CPLErr value otherwise.
+int HDF5ImageRasterBand::DirectChunkRead(int nXOff, int nYOff, int nXSize,
+                                         int nYSize, void *pData,
+                                         GDALDataType eBufType,
+                                         GSpacing nPixelSpace,
+                                         GSpacing nLineSpace)
+{
+    HDF5ImageDataset *poGDS = static_cast<HDF5ImageDataset *>(poDS);
+
+    const int nBlockX1 = nXOff / nBlockXSize;
+    const int nBlockY1 = nYOff / nBlockYSize;
+    const int nBlockX2 = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockY2 = (nYOff + nYSize - 1) / nBlockYSize;
+    if (nBlockX1 == nBlockX2 && nBlockY1 == nBlockY2)
+        return -1;
+
+    const int nThreads = GDALGetNumThreads(nullptr, nullptr);
+    if (nThreads <= 1 || !poGDS->IsDirectChunkReadPossible())
+        return -1;
+
+    const auto &anChunkDims = poGDS->m_anChunkDims;
+    const int nXIndex = poGDS->GetXIndex();
+    const int nYIndex = poGDS->GetYIndex();
+    const int nOtherDimIndex = poGDS->m_nOtherDimIndex;
+    if (anChunkDims[nXIndex] != static_cast<hsize_t>(nBlockXSize) ||
+        anChunkDims[nYIndex] != static_cast<hsize_t>(nBlockYSize))
+    {
+        return -1;
+    }
+
+    // Strides, in elements, of each dimension within a chunk
+    std::vector<size_t> anChunkStrides(anChunkDims.size());
+    size_t nChunkElts = 1;
+    for (int i = static_cast<int>(anChunkDims.size()) - 1; i >= 0; --i)
+    {
+        anChunkStrides[i] = nChunkElts;
+        nChunkElts *= static_cast<size_t>(anChunkDims[i]);
+    }
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+
+    std::vector<hsize_t> anOffset(anChunkDims.size());
+    size_t nSrcOtherOffset = 0;
+    if (nOtherDimIndex >= 0)
+    {
+        const hsize_t nOtherChunkSize = anChunkDims[nOtherDimIndex];
+        anOffset[nOtherDimIndex] =
+            ((nBand - 1) / nOtherChunkSize) * nOtherChunkSize;
+        nSrcOtherOffset =
+            static_cast<size_t>((nBand - 1) % nOtherChunkSize) *
+            anChunkStrides[nOtherDimIndex];
+    }
+
+    // First check that all chunks exist, so as to be able to fallback to
+    // the generic implementation (that takes care of fill values) otherwise.
+    const int nXBlocks = nBlockX2 - nBlockX1 + 1;
+    const int nYBlocks = nBlockY2 - nBlockY1 + 1;
+    std::vector<hsize_t> anChunkSizes;
+    anChunkSizes.reserve(static_cast<size_t>(nXBlocks) * nYBlocks);
+    for (int iY = nBlockY1; iY <= nBlockY2; ++iY)
+    {
+        for (int iX = nBlockX1; iX <= nBlockX2; ++iX)
+        {
+            anOffset[nYIndex] = static_cast<hsize_t>(iY) * nBlockYSize;
+            anOffset[nXIndex] = static_cast<hsize_t>(iX) * nBlockXSize;
+            hsize_t nChunkSize = 0;
+            if (H5Dget_chunk_storage_size(poGDS->dataset_id, anOffset.data(),
+                                          &nChunkSize) < 0 ||
+                nChunkSize == 0 ||
+                nChunkSize > std::numeric_limits<size_t>::max() / 2)
+            {
+                return -1;
+            }
+            anChunkSizes.push_back(nChunkSize);
+        }
+    }
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (poThreadPool == nullptr)
+        return -1;
+    auto poQueue = poThreadPool->CreateJobQueue();
+
+    std::atomic<bool> bSuccess(true);
+    std::vector<HDF5ChunkDecodeJob> asJobs(anChunkSizes.size());
+    size_t iJob = 0;
+    for (int iY = nBlockY1; iY <= nBlockY2 && bSuccess; ++iY)
+    {
+        for (int iX = nBlockX1; iX <= nBlockX2 && bSuccess; ++iX, ++iJob)
+        {
+            auto &sJob = asJobs[iJob];
+            anOffset[nYIndex] = static_cast<hsize_t>(iY) * nBlockYSize;
+            anOffset[nXIndex] = static_cast<hsize_t>(iX) * nBlockXSize;
+            try
+            {
+                sJob.abyRaw.resize(static_cast<size_t>(anChunkSizes[iJob]));
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate memory for chunk");
+                bSuccess = false;
+                break;
+            }
+            if (H5Dread_chunk(poGDS->dataset_id, H5P_DEFAULT, anOffset.data(),
+                              &sJob.nFilterMask, sJob.abyRaw.data()) < 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "H5Dread_chunk() failed");
+                bSuccess = false;
+                break;
+            }
+
+            // Intersection of the chunk with the requested window
+            const int nChunkXOff = iX * nBlockXSize;
+            const int nChunkYOff = iY * nBlockYSize;
+            const int nXStart = std::max(nXOff, nChunkXOff);
+            const int nYStart = std::max(nYOff, nChunkYOff);
+            const int nXEnd =
+                std::min(nXOff + nXSize, nChunkXOff + nBlockXSize);
+            const int nYEnd =
+                std::min(nYOff + nYSize, nChunkYOff + nBlockYSize);
+
+            sJob.panFilters = &poGDS->m_anChunkFilters;
+            sJob.bByteSwap = poGDS->m_bDirectChunkByteSwap;
+            sJob.nChunkBytes = nChunkElts * nDTSize;
+            sJob.eDT = eDataType;
+            sJob.nSrcXStride = anChunkStrides[nXIndex];
+            sJob.nSrcYStride = anChunkStrides[nYIndex];
+            sJob.nSrcOffset = nSrcOtherOffset +
+                              (nYStart - nChunkYOff) * sJob.nSrcYStride +
+                              (nXStart - nChunkXOff) * sJob.nSrcXStride;
+            sJob.nXCount = nXEnd - nXStart;
+            sJob.nYCount = nYEnd - nYStart;
+            sJob.pabyDst = static_cast<GByte *>(pData) +
+                           (nYStart - nYOff) * nLineSpace +
+                           (nXStart - nXOff) * nPixelSpace;
+            sJob.eBufType = eBufType;
+            sJob.nPixelSpace = nPixelSpace;
+            sJob.nLineSpace = nLineSpace;
+            sJob.pbSuccess = &bSuccess;
+            if (!poQueue->SubmitJob(HDF5ChunkDecodeJobFunc, &sJob))
+            {
+                bSuccess = false;
+                break;
+            }
+        }
+    }
+    poQueue->WaitCompletion();
+
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+
+    return bSuccess ? CE_None : CE_Failure;
+}
+
+#endif  // HAVE_H5DREAD_CHUNK
+
 /************************************************************************/
 /*                              Identify()                              */
 /************************************************************************/
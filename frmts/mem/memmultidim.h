@@ -244,6 +244,12 @@ class MEMMDArray CPL_NON_FINAL : public MEMAbstractMDArray, public GDALMDArray
         return m_bWritable;
     }
 
+    bool IsReadThreadSafe() const override
+    {
+        // IRead() only copies from the memory buffer
+        return true;
+    }
+
     const std::string &GetFilename() const override
     {
         return m_osFilename;
@@ -61,8 +61,14 @@
 #include "gdal_pam.h"
 #include "ogr_srs_api.h"
 #include "ogr_spatialref.h"
+#include "cpl_worker_thread_pool.h"
+#include "cpl_error_internal.h"
 
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
 // For printing values
 #include <ostream>
 #include <iostream>
@@ -353,6 +359,27 @@ enum
 MRFRasterBand *newMRFRasterBand(MRFDataset *, const ILImage &, int,
                                 int level = 0);
 
+// A page to be compressed by a worker thread, when writing with NUM_THREADS
+// The tile is written by the main thread, in submission order
+struct MRFCompressionJob
+{
+    MRFRasterBand *poBand = nullptr;  // Null when the job slot is available
+    GUIntBig infooffset = 0;
+    bool swab = false;  // Swap bytes of the page before compressing it
+    // Uncompressed page, followed by pbsize bytes for the compressed output
+    std::vector<char> buffer{};
+    // Output of the job, usebuff points into buffer
+    void *usebuff = nullptr;
+    size_t size = 0;
+    CPLErr eErr = CE_None;
+    // Errors raised while compressing, emitted when the page is written
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    bool bReady = false;  // Protected by the dataset compression mutex
+    std::chrono::nanoseconds duration{0};
+    // Sticky zstd compress context of this job slot
+    void *pzscctx = nullptr;
+};
+
 class MRFDataset final : public GDALPamDataset
 {
     friend class MRFRasterBand;
@@ -402,6 +429,8 @@ class MRFDataset final : public GDALPamDataset
 
     virtual char **GetFileList() override;
 
+    virtual CPLErr FlushCache(bool bAtClosing) override;
+
     void SetColorTable(GDALColorTable *pct)
     {
         poColorTable = pct;
@@ -503,6 +532,15 @@ class MRFDataset final : public GDALPamDataset
     CPLErr ReadTileIdx(ILIdx &tinfo, const ILSize &pos, const ILImage &img,
                        const GIntBig bias = 0);
 
+    // Multithreaded page compression
+    void SetupCompressionThreads(int nThreads);
+    static void ThreadCompressionFunc(void *pData);
+    MRFCompressionJob *GetCompressionJob(CPLErr &eErr);
+    void SubmitCompressionJob(MRFCompressionJob *psJob);
+    CPLErr WaitCompletionForJobIdx(int i);
+    // Write the pending pages, up to the one for this index entry if given
+    CPLErr WaitCompressionJobs(GUIntBig infooffset = ~GUIntBig(0));
+
     VSILFILE *IdxFP();
     VSILFILE *DataFP();
     GDALRWFlag IdxMode()
@@ -611,6 +649,12 @@ class MRFDataset final : public GDALPamDataset
 #endif
     // Time duration spend for decompression and compression
     std::chrono::nanoseconds read_timer, write_timer;
+
+    // Compression jobs, only when created with NUM_THREADS
+    std::unique_ptr<CPLJobQueue> m_poCompressQueue{};
+    std::mutex m_oCompressMutex{};
+    std::vector<MRFCompressionJob> m_asCompressionJobs{};
+    std::queue<int> m_anQueueJobIdx{};  // Indices in m_asCompressionJobs
 };
 
 class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
@@ -725,6 +769,11 @@ class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) = 0;
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) = 0;
 
+    // Compress the page of a job, including the deflate or zstd final stage
+    CPLErr CompressPage(MRFCompressionJob &job);
+    // Queue a copy of a page for compression by a worker thread
+    CPLErr QueuePage(const void *page, GUIntBig infooffset, bool swab);
+
     // Read the index record itself, can be overwritten
     //    virtual CPLErr ReadTileIdx(const ILSize &, ILIdx &, GIntBig bias = 0);
 
@@ -61,6 +61,7 @@
 #include "marfa.h"
 #include "cpl_multiproc.h" /* for CPLSleep() */
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include <assert.h>
 
 #include <algorithm>
@@ -167,6 +168,7 @@ MRFDataset::~MRFDataset()
 
     MRFDataset::FlushCache(true);
     MRFDataset::CloseDependentDatasets();
+    m_poCompressQueue.reset();
 
     if (ifp.FP)
         VSIFCloseL(ifp.FP);
@@ -181,9 +183,20 @@ MRFDataset::~MRFDataset()
 #if defined(ZSTD_SUPPORT)
     ZSTD_freeCCtx(static_cast<ZSTD_CCtx *>(pzscctx));
     ZSTD_freeDCtx(static_cast<ZSTD_DCtx *>(pzsdctx));
+    for (auto &job : m_asCompressionJobs)
+        ZSTD_freeCCtx(static_cast<ZSTD_CCtx *>(job.pzscctx));
 #endif
 }
 
+// Pages pending compression are written after the dirty blocks are flushed
+CPLErr MRFDataset::FlushCache(bool bAtClosing)
+{
+    CPLErr eErr = GDALPamDataset::FlushCache(bAtClosing);
+    if (WaitCompressionJobs() != CE_None)
+        eErr = CE_Failure;
+    return eErr;
+}
+
 /*
  *\brief Format specific RasterIO, may be bypassed by BlockBasedRasterIO by
  *setting GDAL_FORCE_CACHING to Yes, in which case the band ReadBlock and
@@ -2182,6 +2195,141 @@ void MRFDataset::ProcessCreateOptions(char **papszOptions)
         img.pagesize.c = img.size.c;
 
     // Compression dependent fixups
+
+    // Not a sticky option, it doesn't get saved in the MRF
+    SetupCompressionThreads(GDALGetNumThreads(opt.List(), "NUM_THREADS", 1024));
+}
+
+//
+// Pages get compressed by worker threads, but they are written by the main
+// thread in the order they were submitted, so the data file is identical to
+// the single threaded one.
+// PNG and TIF bands keep a state while compressing, they are not multithreaded
+//
+void MRFDataset::SetupCompressionThreads(int nThreads)
+{
+    if (nThreads <= 1)
+        return;
+
+    switch (full.comp)
+    {
+#ifdef HAVE_PNG
+        case IL_PNG:
+        case IL_PPNG:
+#endif
+        case IL_TIF:
+            CPLDebug("MRF", "Multithreaded compression not available for %s",
+                     CompName(full.comp));
+            return;
+        default:
+            break;
+    }
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (poPool)
+        m_poCompressQueue = poPool->CreateJobQueue();
+    if (!m_poCompressQueue)
+        return;
+
+    CPLDebug("MRF", "Using up to %d threads for compression", nThreads);
+    // An extra job allows the main thread to write pages while all the
+    // worker threads are busy
+    m_asCompressionJobs.resize(nThreads + 1);
+}
+
+void MRFDataset::ThreadCompressionFunc(void *pData)
+{
+    MRFCompressionJob *psJob = static_cast<MRFCompressionJob *>(pData);
+    auto start_time = std::chrono::steady_clock::now();
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    psJob->eErr = psJob->poBand->CompressPage(*psJob);
+    CPLUninstallErrorHandlerAccumulator();
+    psJob->duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start_time);
+
+    std::lock_guard<std::mutex> oLock(psJob->poBand->poMRFDS->m_oCompressMutex);
+    psJob->bReady = true;
+}
+
+// Get an available job slot, writing the oldest pending page if none is free
+// eErr reports the status of that write
+MRFCompressionJob *MRFDataset::GetCompressionJob(CPLErr &eErr)
+{
+    eErr = CE_None;
+    if (m_anQueueJobIdx.size() == m_asCompressionJobs.size())
+        eErr = WaitCompletionForJobIdx(m_anQueueJobIdx.front());
+    for (auto &job : m_asCompressionJobs)
+        if (job.poBand == nullptr)
+            return &job;
+    return nullptr;  // Not reached
+}
+
+void MRFDataset::SubmitCompressionJob(MRFCompressionJob *psJob)
+{
+    psJob->bReady = false;
+    m_anQueueJobIdx.push(static_cast<int>(psJob - m_asCompressionJobs.data()));
+    m_poCompressQueue->SubmitJob(ThreadCompressionFunc, psJob);
+}
+
+// Wait for a job, which has to be the oldest pending one, and write its page
+CPLErr MRFDataset::WaitCompletionForJobIdx(int i)
+{
+    MRFCompressionJob &job = m_asCompressionJobs[i];
+    CPLAssert(!m_anQueueJobIdx.empty() && m_anQueueJobIdx.front() == i);
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> oLock(m_oCompressMutex);
+            if (job.bReady)
+                break;
+        }
+        m_poCompressQueue->GetPool()->WaitEvent();
+    }
+    m_anQueueJobIdx.pop();
+    write_timer += job.duration;
+
+    for (const auto &oError : job.aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    job.aoErrors.clear();
+
+    CPLErr ret = job.eErr;
+    if (job.usebuff)
+    {
+        if (WriteTile(job.usebuff, job.infooffset, job.size) != CE_None)
+            ret = CE_Failure;
+    }
+    else  // Compression failed, write it as an empty tile
+        WriteTile(nullptr, job.infooffset, 0);
+
+    job.poBand = nullptr;
+    job.usebuff = nullptr;
+    job.size = 0;
+    return ret;
+}
+
+CPLErr MRFDataset::WaitCompressionJobs(GUIntBig infooffset)
+{
+    if (m_anQueueJobIdx.empty())
+        return CE_None;
+
+    // Nothing to do if that page is not pending
+    if (infooffset != ~GUIntBig(0) &&
+        std::none_of(m_asCompressionJobs.begin(), m_asCompressionJobs.end(),
+                     [infooffset](const MRFCompressionJob &job)
+                     { return job.poBand && job.infooffset == infooffset; }))
+        return CE_None;
+
+    CPLErr eErr = CE_None;
+    while (!m_anQueueJobIdx.empty())
+    {
+        const int i = m_anQueueJobIdx.front();
+        const bool bLast = m_asCompressionJobs[i].infooffset == infooffset;
+        if (WaitCompletionForJobIdx(i) != CE_None)
+            eErr = CE_Failure;
+        if (bLast)
+            break;
+    }
+    return eErr;
 }
 
 /**
@@ -2554,6 +2702,10 @@ CPLErr MRFDataset::ReadTileIdx(ILIdx &tinfo, const ILSize &pos,
 {
     VSILFILE *l_ifp = IdxFP();
 
+    // Make sure all the pages pending compression are written
+    if (WaitCompressionJobs() != CE_None)
+        return CE_Failure;
+
     // Initialize the tinfo structure, in case the files are missing
     if (missing)
         return CE_None;
@@ -1234,6 +1234,12 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
         return CE_Failure;
     }
 
+    // If a previous content of this page is pending compression, write it
+    // first, so the index ends up pointing to the last one
+    if (poMRFDS->m_poCompressQueue &&
+        poMRFDS->WaitCompressionJobs(infooffset) != CE_None)
+        return CE_Failure;
+
     if (1 == cstride)
     {  // Separate bands, we can write it as is
         // Empty page skip
@@ -1244,6 +1250,11 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
         if (isAllVal(eDataType, buffer, img.pageSizeBytes, val))
             return poMRFDS->WriteTile(nullptr, infooffset, 0);
 
+        if (poMRFDS->m_poCompressQueue)
+            return QueuePage(buffer, infooffset,
+                             is_Endianess_Dependent(img.dt, img.comp) &&
+                                 (img.nbo != NET_ORDER));
+
         // Use the pbuffer to hold the compressed page before writing it
         poMRFDS->tile = ILSize();  // Mark it corrupt
 
@@ -1410,6 +1421,14 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
                  " instead of " CPL_FRMT_GIB,
                  poMRFDS->bdirty, AllBandMask());
 
+    if (poMRFDS->m_poCompressQueue)
+    {
+        CPLErr ret = QueuePage(tbuffer, infooffset, false);
+        CPLFree(tbuffer);
+        poMRFDS->bdirty = 0;
+        return ret;
+    }
+
     buf_mgr src;
     src.buffer = (char *)tbuffer;
     src.size = static_cast<size_t>(img.pageSizeBytes);
@@ -1485,6 +1504,100 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
     return ret;
 }
 
+//
+// Compress the page held at the start of the job buffer, the output goes in
+// the pbsize bytes that follow it.  Runs in a worker thread, so it only
+// touches the job and read-only band members
+//
+CPLErr MRFRasterBand::CompressPage(MRFCompressionJob &job)
+{
+    buf_mgr src = {job.buffer.data(), static_cast<size_t>(img.pageSizeBytes)};
+    if (job.swab)
+        swab_buff(src, img);
+
+    char *outbuff = src.buffer + img.pageSizeBytes;
+    buf_mgr dst = {outbuff, poMRFDS->pbsize};
+    job.usebuff = nullptr;
+    job.size = 0;
+
+    // Same as single threaded writes, a page which can't be compressed is
+    // written as an empty tile
+    if (Compress(dst, src) != CE_None)
+        return CE_None;
+
+    void *usebuff = outbuff;
+    if (dodeflate)
+    {
+        // Move the packed part at the start of the buffer, to make more space
+        // available
+        memmove(src.buffer, outbuff, dst.size);
+        dst.buffer = src.buffer;
+        usebuff = DeflateBlock(dst,
+                               static_cast<size_t>(img.pageSizeBytes) +
+                                   poMRFDS->pbsize - dst.size,
+                               deflate_flags);
+        if (!usebuff)
+            CPLError(CE_Failure, CPLE_AppDefined, "MRF: Deflate error");
+    }
+
+#if defined(ZSTD_SUPPORT)
+    else if (dozstd)
+    {
+        if (!job.pzscctx)
+            job.pzscctx = ZSTD_createCCtx();
+        memmove(src.buffer, outbuff, dst.size);
+        dst.buffer = src.buffer;
+        size_t ranks = 0;  // Assume no need for byte rank sort
+        if (img.comp == IL_NONE || img.comp == IL_ZSTD)
+            ranks = static_cast<size_t>(GDALGetDataTypeSizeBytes(img.dt)) *
+                    img.pagesize.c;
+        usebuff = ZstdCompBlock(dst,
+                                static_cast<size_t>(img.pageSizeBytes) +
+                                    poMRFDS->pbsize - dst.size,
+                                zstd_level,
+                                static_cast<ZSTD_CCtx *>(job.pzscctx), ranks);
+        if (!usebuff)
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "MRF: ZStd compression error");
+    }
+#endif
+
+    if (!usebuff)
+        return CE_Failure;
+
+    job.usebuff = usebuff;
+    job.size = dst.size;
+    return CE_None;
+}
+
+//
+// Copy a page in a compression job and submit it.  The error returned is the
+// one of the pending page that might have been written to free a job slot
+//
+CPLErr MRFRasterBand::QueuePage(const void *page, GUIntBig infooffset,
+                                bool swab)
+{
+    CPLErr ret = CE_None;
+    MRFCompressionJob *psJob = poMRFDS->GetCompressionJob(ret);
+    const size_t nPageSize = static_cast<size_t>(img.pageSizeBytes);
+    try
+    {
+        psJob->buffer.resize(nPageSize + poMRFDS->pbsize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "MRF: Can't allocate write buffer");
+        return CE_Failure;
+    }
+    memcpy(psJob->buffer.data(), page, nPageSize);
+    psJob->poBand = this;
+    psJob->infooffset = infooffset;
+    psJob->swab = swab;
+    poMRFDS->SubmitCompressionJob(psJob);
+    return ret;
+}
+
 //
 // Tests if a given block exists without reading it
 // returns false only when it is definitely not existing
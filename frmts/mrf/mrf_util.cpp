@@ -668,6 +668,9 @@ void GDALRegister_mrf()
         "       <Value>RGB</Value>"
         "       <Value>YCC</Value>"
         "   </Option>\n"
+        "   <Option name='NUM_THREADS' type='string' "
+        "description='Number of worker threads for compression. Can be set to "
+        "ALL_CPUS' default='1'/>\n"
         "   <Option name='OPTIONS' type='string' description='\n"
         "     Compression dependent parameters, space separated:\n"
 #if defined(ZSTD_SUPPORT)
@@ -478,6 +478,12 @@ class netCDFVariable final : public GDALPamMDArray
         return !m_poShared->IsReadOnly();
     }
 
+    bool IsReadThreadSafe() const override
+    {
+        // Calls to the netCDF library are serialized with hNCMutex
+        return true;
+    }
+
     const std::string &GetFilename() const override
     {
         return m_poShared->GetFilename();
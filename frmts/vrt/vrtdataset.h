@@ -1867,6 +1867,8 @@ class VRTMDArraySourceFromArray final : public VRTMDArraySource
     std::string m_osBand{};
     std::vector<int> m_anTransposedAxis{};
     std::string m_osViewExpr{};
+    int m_nReducedDim = -1;
+    std::string m_osReduceOperation{};
     std::vector<GUInt64> m_anSrcOffset{};
     mutable std::vector<GUInt64> m_anCount{};
     std::vector<GUInt64> m_anStep{};
@@ -1896,6 +1898,12 @@ class VRTMDArraySourceFromArray final : public VRTMDArraySource
 
     ~VRTMDArraySourceFromArray() override;
 
+    void SetReduction(int nReducedDim, const std::string &osOperation)
+    {
+        m_nReducedDim = nReducedDim;
+        m_osReduceOperation = osOperation;
+    }
+
     static std::unique_ptr<VRTMDArraySourceFromArray>
     Create(const VRTMDArray *poDstArray, const CPLXMLNode *psNode);
 
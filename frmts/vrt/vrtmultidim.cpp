@@ -1698,11 +1698,29 @@ VRTMDArraySourceFromArray::Create(const VRTMDArray *poDstArray,
         }
     }
 
-    return cpl::make_unique<VRTMDArraySourceFromArray>(
+    auto poSource = cpl::make_unique<VRTMDArraySourceFromArray>(
         poDstArray, bRelativeToVRTSet, bRelativeToVRT, pszFilename, pszArray,
         pszSourceBand, std::move(anTransposedAxis), pszView,
         std::move(anSrcOffset), std::move(anCount), std::move(anStep),
         std::move(anDstOffset));
+
+    const CPLXMLNode *psReduction = CPLGetXMLNode(psNode, "SourceReduction");
+    if (psReduction)
+    {
+        const char *pszDim = CPLGetXMLValue(psReduction, "dimension", nullptr);
+        const char *pszOperation =
+            CPLGetXMLValue(psReduction, "operation", nullptr);
+        if (pszDim == nullptr || pszOperation == nullptr || atoi(pszDim) < 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Missing or invalid dimension or operation attribute "
+                     "of SourceReduction");
+            return nullptr;
+        }
+        poSource->SetReduction(atoi(pszDim), pszOperation);
+    }
+
+    return poSource;
 }
 
 /************************************************************************/
@@ -1759,6 +1777,16 @@ void VRTMDArraySourceFromArray::Serialize(CPLXMLNode *psParent,
                                     m_osViewExpr.c_str());
     }
 
+    if (m_nReducedDim >= 0)
+    {
+        CPLXMLNode *psReduction =
+            CPLCreateXMLNode(psSource, CXT_Element, "SourceReduction");
+        CPLAddXMLAttributeAndValue(psReduction, "dimension",
+                                   CPLSPrintf("%d", m_nReducedDim));
+        CPLAddXMLAttributeAndValue(psReduction, "operation",
+                                   m_osReduceOperation.c_str());
+    }
+
     if (m_poDstArray->GetDimensionCount() > 0)
     {
         CPLXMLNode *psSourceSlab =
@@ -1988,6 +2016,15 @@ bool VRTMDArraySourceFromArray::Read(const GUInt64 *arrayStartIdx,
             return false;
         }
     }
+    if (m_nReducedDim >= 0)
+    {
+        poArray = poArray->GetReduced(static_cast<size_t>(m_nReducedDim),
+                                      m_osReduceOperation);
+        if (poArray == nullptr)
+        {
+            return false;
+        }
+    }
     if (m_poDstArray->GetDimensionCount() != poArray->GetDimensionCount())
     {
         CPLError(CE_Failure, CPLE_AppDefined,
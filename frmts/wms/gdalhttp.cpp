@@ -160,11 +160,77 @@ WMSHTTPRequest::~WMSHTTPRequest()
         CPLFree(pabyData);
 }
 
+// Sets the output members of a request that has been run
+static void FinishRequest(WMSHTTPRequest *psRequest)
+{
+    long response_code;
+    curl_easy_getinfo(psRequest->m_curl_handle, CURLINFO_RESPONSE_CODE,
+                      &response_code);
+    // for local files, don't update the status code if one is already set
+    if (!(psRequest->nStatus != 0 &&
+          STARTS_WITH(psRequest->URL.c_str(), "file://")))
+        psRequest->nStatus = static_cast<int>(response_code);
+
+    char *content_type = nullptr;
+    curl_easy_getinfo(psRequest->m_curl_handle, CURLINFO_CONTENT_TYPE,
+                      &content_type);
+    psRequest->ContentType = content_type ? content_type : "";
+
+    if (psRequest->Error.empty())
+        psRequest->Error = &psRequest->m_curl_error[0];
+
+    /* In the case of a file:// URL, curl will return a status == 0, so if
+     * there's no */
+    /* error returned, patch the status code to be 200, as it would be for
+     * http:// */
+    if (psRequest->nStatus == 0 && psRequest->Error.empty() &&
+        STARTS_WITH(psRequest->URL.c_str(), "file://"))
+        psRequest->nStatus = 200;
+
+    // If there is an error with no error message, use the content if it is
+    // text
+    if (psRequest->Error.empty() && psRequest->nStatus != 0 &&
+        psRequest->nStatus != 200 && strstr(psRequest->ContentType, "text") &&
+        psRequest->pabyData != nullptr)
+        psRequest->Error = reinterpret_cast<const char *>(psRequest->pabyData);
+
+    CPLDebug("HTTP", "Request %s : status = %d, type = %s, error = %s",
+             psRequest->URL.c_str(), psRequest->nStatus,
+             !psRequest->ContentType.empty() ? psRequest->ContentType.c_str()
+                                             : "(null)",
+             !psRequest->Error.empty() ? psRequest->Error.c_str() : "(null)");
+
+    psRequest->m_finished = true;
+}
+
+// Finishes the request corresponding to a CURLMSG_DONE message
+static void OnRequestDone(
+    CURLMsg *msg, WMSHTTPRequest *pasRequest, int nRequestCount,
+    const std::function<void(WMSHTTPRequest &)> &pfnOnRequestFinished)
+{
+    for (int i = 0; i < nRequestCount; ++i)
+    {
+        WMSHTTPRequest *const psRequest = &pasRequest[i];
+        if (psRequest->m_curl_handle == msg->easy_handle)
+        {
+            if (!psRequest->m_finished)
+            {
+                FinishRequest(psRequest);
+                if (pfnOnRequestFinished)
+                    pfnOnRequestFinished(*psRequest);
+            }
+            break;
+        }
+    }
+}
+
 //
 // Like CPLHTTPFetch, but multiple requests in parallel
 // By default it uses 5 connections
 //
-CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *pasRequest, int nRequestCount)
+CPLErr WMSHTTPFetchMulti(
+    WMSHTTPRequest *pasRequest, int nRequestCount,
+    const std::function<void(WMSHTTPRequest &)> &pfnOnRequestFinished)
 {
     CPLErr ret = CE_None;
     CURLM *curl_multi = nullptr;
@@ -207,6 +273,9 @@ CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *pasRequest, int nRequestCount)
             psResult->pabyData = nullptr;
             psResult->nDataLen = 0;
             CPLHTTPDestroyResult(psResult);
+            pasRequest[i].m_finished = true;
+            if (pfnOnRequestFinished)
+                pfnOnRequestFinished(pasRequest[i]);
         }
         return CE_None;
     }
@@ -246,6 +315,8 @@ CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *pasRequest, int nRequestCount)
             if (m && (m->msg == CURLMSG_DONE))
             {
                 ProcessCurlErrors(m, pasRequest, nRequestCount);
+                OnRequestDone(m, pasRequest, nRequestCount,
+                              pfnOnRequestFinished);
 
                 curl_multi_remove_handle(curl_multi, m->easy_handle);
                 if (conn_i < nRequestCount)
@@ -278,6 +349,8 @@ CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *pasRequest, int nRequestCount)
             if (msg->msg == CURLMSG_DONE)
             {
                 ProcessCurlErrors(msg, pasRequest, nRequestCount);
+                OnRequestDone(msg, pasRequest, nRequestCount,
+                              pfnOnRequestFinished);
             }
         }
     } while (msg != nullptr);
@@ -297,48 +370,13 @@ CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *pasRequest, int nRequestCount)
     for (i = 0; i < nRequestCount; ++i)
     {
         WMSHTTPRequest *const psRequest = &pasRequest[i];
-
-        long response_code;
-        curl_easy_getinfo(psRequest->m_curl_handle, CURLINFO_RESPONSE_CODE,
-                          &response_code);
-        // for local files, don't update the status code if one is already set
-        if (!(psRequest->nStatus != 0 &&
-              STARTS_WITH(psRequest->URL.c_str(), "file://")))
-            psRequest->nStatus = static_cast<int>(response_code);
-
-        char *content_type = nullptr;
-        curl_easy_getinfo(psRequest->m_curl_handle, CURLINFO_CONTENT_TYPE,
-                          &content_type);
-        psRequest->ContentType = content_type ? content_type : "";
-
-        if (psRequest->Error.empty())
-            psRequest->Error = &psRequest->m_curl_error[0];
-
-        /* In the case of a file:// URL, curl will return a status == 0, so if
-         * there's no */
-        /* error returned, patch the status code to be 200, as it would be for
-         * http:// */
-        if (psRequest->nStatus == 0 && psRequest->Error.empty() &&
-            STARTS_WITH(psRequest->URL.c_str(), "file://"))
-            psRequest->nStatus = 200;
-
-        // If there is an error with no error message, use the content if it is
-        // text
-        if (psRequest->Error.empty() && psRequest->nStatus != 0 &&
-            psRequest->nStatus != 200 &&
-            strstr(psRequest->ContentType, "text") &&
-            psRequest->pabyData != nullptr)
-            psRequest->Error =
-                reinterpret_cast<const char *>(psRequest->pabyData);
-
-        CPLDebug(
-            "HTTP", "Request [%d] %s : status = %d, type = %s, error = %s", i,
-            psRequest->URL.c_str(), psRequest->nStatus,
-            !psRequest->ContentType.empty() ? psRequest->ContentType.c_str()
-                                            : "(null)",
-            !psRequest->Error.empty() ? psRequest->Error.c_str() : "(null)");
-
-        curl_multi_remove_handle(curl_multi, pasRequest->m_curl_handle);
+        if (!psRequest->m_finished)
+        {
+            FinishRequest(psRequest);
+            if (pfnOnRequestFinished)
+                pfnOnRequestFinished(*psRequest);
+        }
+        curl_multi_remove_handle(curl_multi, psRequest->m_curl_handle);
     }
 
     curl_multi_cleanup(curl_multi);
@@ -34,11 +34,14 @@
 #include "cpl_port.h"
 #include "cpl_http.h"
 
+#include <functional>
+
 struct WMSHTTPRequest
 {
     WMSHTTPRequest()
         : options(nullptr), nStatus(0), pabyData(nullptr), nDataLen(0),
-          nDataAlloc(0), m_curl_handle(nullptr), m_headers(nullptr), x(0), y(0)
+          nDataAlloc(0), m_curl_handle(nullptr), m_headers(nullptr), x(0),
+          y(0), m_finished(false)
     {
     }
     ~WMSHTTPRequest();
@@ -67,10 +70,19 @@ struct WMSHTTPRequest
     // Space for error message, doesn't seem to be used by the multi-request
     // interface
     std::vector<char> m_curl_error;
+
+    // Whether the output members have been set
+    bool m_finished;
 };
 
 // Not public, only for use within WMS
 void WMSHTTPInitializeRequest(WMSHTTPRequest *psRequest);
-CPLErr WMSHTTPFetchMulti(WMSHTTPRequest *psRequest, int nRequestCount = 1);
+// pfnOnRequestFinished, if set, is called, from the calling thread, as soon
+// as each request has completed, so that its result can be processed while
+// other requests are still in progress.
+CPLErr WMSHTTPFetchMulti(
+    WMSHTTPRequest *psRequest, int nRequestCount = 1,
+    const std::function<void(WMSHTTPRequest &)> &pfnOnRequestFinished =
+        nullptr);
 
 #endif /*  GDALHTTP_H */
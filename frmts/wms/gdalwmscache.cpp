@@ -32,6 +32,10 @@
 #include "cpl_md5.h"
 #include "wmsdriver.h"
 
+#ifdef HAVE_SQLITE
+#include <sqlite3.h>
+#endif
+
 static void CleanCacheThread(void *pData)
 {
     GDALWMSCache *pCache = static_cast<GDALWMSCache *>(pData);
@@ -218,6 +222,418 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     int m_nCleanThreadRunTimeout;
 };
 
+#ifdef HAVE_SQLITE
+
+//------------------------------------------------------------------------------
+// GDALWMSSQLiteCache
+//------------------------------------------------------------------------------
+// All tiles are stored in a single SQLite database, that can be shared by
+// several processes. Each insertion is done in a transaction that also evicts
+// the least recently used tiles when the size budget is exceeded, so no
+// clean thread is needed.
+class GDALWMSSQLiteCache : public GDALWMSCacheImpl
+{
+  public:
+    GDALWMSSQLiteCache(const CPLString &soPath, CPLXMLNode *pConfig)
+        : GDALWMSCacheImpl(soPath, pConfig),
+          m_nExpires(604800),    // 7 days
+          m_nMaxSize(67108864),  // 64 Mb
+          m_hDB(nullptr), m_nHits(0), m_nMisses(0), m_nInsertions(0),
+          m_nEvictions(0)
+    {
+        const char *pszCacheExpires =
+            CPLGetXMLValue(pConfig, "Expires", nullptr);
+        if (pszCacheExpires != nullptr)
+        {
+            m_nExpires = atoi(pszCacheExpires);
+            CPLDebug("WMS", "Cache expires in %d sec", m_nExpires);
+        }
+
+        const char *pszCacheMaxSize =
+            CPLGetXMLValue(pConfig, "MaxSize", nullptr);
+        if (pszCacheMaxSize != nullptr)
+            m_nMaxSize = CPLAtoGIntBig(pszCacheMaxSize);
+    }
+
+    virtual ~GDALWMSSQLiteCache()
+    {
+        if (m_hDB == nullptr)
+            return;
+
+        CPLDebug("WMS",
+                 "SQLite cache: " CPL_FRMT_GIB " hits, " CPL_FRMT_GIB
+                 " misses, " CPL_FRMT_GIB " insertions, " CPL_FRMT_GIB
+                 " evictions",
+                 m_nHits, m_nMisses, m_nInsertions, m_nEvictions);
+
+        // Accumulate statistics of all users of the cache
+        if (Exec("BEGIN IMMEDIATE"))
+        {
+            AddToCounter("hits", m_nHits);
+            AddToCounter("misses", m_nMisses);
+            AddToCounter("insertions", m_nInsertions);
+            AddToCounter("evictions", m_nEvictions);
+            Exec("COMMIT");
+        }
+        sqlite3_close(m_hDB);
+    }
+
+    bool Open()
+    {
+        if (STARTS_WITH(m_soPath.c_str(), "/vsi"))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "GDALWMS: sqlite cache type is not supported on %s",
+                     m_soPath.c_str());
+            return false;
+        }
+        VSIMkdirRecursive(m_soPath, 0755);
+        const std::string osDBName =
+            CPLFormFilename(m_soPath, "cache", "sqlite");
+        if (sqlite3_open_v2(osDBName.c_str(), &m_hDB,
+                            SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
+                            nullptr) != SQLITE_OK)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "GDALWMS: Cannot open cache database %s: %s",
+                     osDBName.c_str(),
+                     m_hDB ? sqlite3_errmsg(m_hDB) : "out of memory");
+            sqlite3_close(m_hDB);
+            m_hDB = nullptr;
+            return false;
+        }
+
+        // Concurrent readers and writers from several processes
+        sqlite3_busy_timeout(m_hDB, 30 * 1000);
+        Exec("PRAGMA journal_mode = WAL");
+        Exec("PRAGMA synchronous = NORMAL");
+        // Serve tile reads from a memory mapping of the database
+        Exec("PRAGMA mmap_size = 268435456");
+
+        if (!Exec("BEGIN IMMEDIATE"))
+            return false;
+        if (!Exec("CREATE TABLE IF NOT EXISTS tiles("
+                  "key TEXT NOT NULL PRIMARY KEY, "
+                  "data BLOB NOT NULL, "
+                  "size INTEGER NOT NULL, "
+                  "insert_time INTEGER NOT NULL, "
+                  "access_time INTEGER NOT NULL)") ||
+            !Exec("CREATE INDEX IF NOT EXISTS tiles_access_time ON "
+                  "tiles(access_time)") ||
+            !Exec("CREATE INDEX IF NOT EXISTS tiles_insert_time ON "
+                  "tiles(insert_time)") ||
+            !Exec("CREATE TABLE IF NOT EXISTS cache_info("
+                  "name TEXT NOT NULL PRIMARY KEY, "
+                  "value INTEGER NOT NULL)") ||
+            !Exec("INSERT OR IGNORE INTO cache_info VALUES "
+                  "('total_size', 0), ('hits', 0), ('misses', 0), "
+                  "('insertions', 0), ('evictions', 0)"))
+        {
+            Exec("ROLLBACK");
+            return false;
+        }
+        return Exec("COMMIT");
+    }
+
+    virtual int GetCleanThreadRunTimeout() override
+    {
+        return 0;
+    }
+
+    virtual CPLErr Insert(const char *pszKey,
+                          const CPLString &osFileName) override
+    {
+        // Warns if it fails to write, but returns success
+        GByte *pabyData = nullptr;
+        vsi_l_offset nSize = 0;
+        if (!VSIIngestFile(nullptr, osFileName, &pabyData, &nSize, -1))
+            return CE_None;
+
+        bool bOK = Exec("BEGIN IMMEDIATE");
+        if (bOK)
+        {
+            const GIntBig nNow = static_cast<GIntBig>(time(nullptr));
+            const GIntBig nOldSize = GetTileSize(pszKey);
+            sqlite3_stmt *hStmt = Prepare(
+                "INSERT OR REPLACE INTO tiles "
+                "(key, data, size, insert_time, access_time) "
+                "VALUES (?, ?, ?, ?, ?)");
+            if (hStmt)
+            {
+                sqlite3_bind_text(hStmt, 1, pszKey, -1, SQLITE_STATIC);
+                sqlite3_bind_blob(hStmt, 2, pabyData, static_cast<int>(nSize),
+                                  SQLITE_STATIC);
+                sqlite3_bind_int64(hStmt, 3, nSize);
+                sqlite3_bind_int64(hStmt, 4, nNow);
+                sqlite3_bind_int64(hStmt, 5, nNow);
+                bOK = sqlite3_step(hStmt) == SQLITE_DONE;
+                sqlite3_finalize(hStmt);
+            }
+            else
+            {
+                bOK = false;
+            }
+            bOK = bOK &&
+                  AddToCounter("total_size",
+                               static_cast<GIntBig>(nSize) - nOldSize) &&
+                  Evict(pszKey, nNow);
+            if (bOK)
+                bOK = Exec("COMMIT");
+            else
+                Exec("ROLLBACK");
+        }
+        CPLFree(pabyData);
+
+        if (bOK)
+            m_nInsertions++;
+        else
+            CPLError(CE_Warning, CPLE_FileIO, "Error writing to WMS cache %s",
+                     m_soPath.c_str());
+        return CE_None;
+    }
+
+    virtual enum GDALWMSCacheItemStatus
+    GetItemStatus(const char *pszKey) const override
+    {
+        sqlite3_stmt *hStmt =
+            Prepare("SELECT insert_time FROM tiles WHERE key = ?");
+        if (hStmt == nullptr)
+            return CACHE_ITEM_NOT_FOUND;
+        sqlite3_bind_text(hStmt, 1, pszKey, -1, SQLITE_STATIC);
+        enum GDALWMSCacheItemStatus eStatus = CACHE_ITEM_NOT_FOUND;
+        if (sqlite3_step(hStmt) == SQLITE_ROW)
+        {
+            const GIntBig nSeconds = static_cast<GIntBig>(time(nullptr)) -
+                                     sqlite3_column_int64(hStmt, 0);
+            eStatus =
+                nSeconds < m_nExpires ? CACHE_ITEM_OK : CACHE_ITEM_EXPIRED;
+        }
+        sqlite3_finalize(hStmt);
+        if (eStatus == CACHE_ITEM_OK)
+            m_nHits++;
+        else
+            m_nMisses++;
+        return eStatus;
+    }
+
+    virtual GDALDataset *GetDataset(const char *pszKey,
+                                    char **papszOpenOptions) const override
+    {
+        sqlite3_stmt *hStmt =
+            Prepare("SELECT data, access_time FROM tiles WHERE key = ?");
+        if (hStmt == nullptr)
+            return nullptr;
+        sqlite3_bind_text(hStmt, 1, pszKey, -1, SQLITE_STATIC);
+        GByte *pabyData = nullptr;
+        int nSize = 0;
+        GIntBig nAccessTime = 0;
+        if (sqlite3_step(hStmt) == SQLITE_ROW)
+        {
+            nSize = sqlite3_column_bytes(hStmt, 0);
+            pabyData = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nSize + 1));
+            if (pabyData && nSize > 0)
+                memcpy(pabyData, sqlite3_column_blob(hStmt, 0), nSize);
+            nAccessTime = sqlite3_column_int64(hStmt, 1);
+        }
+        sqlite3_finalize(hStmt);
+        if (pabyData == nullptr)
+            return nullptr;
+
+        // Least recently used tiles are evicted first. The access time only
+        // needs to be coarse for that, so avoid a write on every hit.
+        const GIntBig nNow = static_cast<GIntBig>(time(nullptr));
+        if (nNow - nAccessTime >= ACCESS_TIME_RESOLUTION)
+        {
+            hStmt = Prepare("UPDATE tiles SET access_time = ? WHERE key = ?");
+            if (hStmt)
+            {
+                sqlite3_bind_int64(hStmt, 1, nNow);
+                sqlite3_bind_text(hStmt, 2, pszKey, -1, SQLITE_STATIC);
+                sqlite3_step(hStmt);
+                sqlite3_finalize(hStmt);
+            }
+        }
+
+        // The in-memory file is released when the dataset is closed, as it
+        // is unlinked right after having been opened.
+        const CPLString osFileName(
+            CPLSPrintf("/vsimem/wms_sqlite_cache/%p/tile", pabyData));
+        VSIFCloseL(VSIFileFromMemBuffer(osFileName, pabyData, nSize, TRUE));
+        GDALDataset *poDS = reinterpret_cast<GDALDataset *>(GDALOpenEx(
+            osFileName,
+            GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_VERBOSE_ERROR, nullptr,
+            papszOpenOptions, nullptr));
+        VSIUnlink(osFileName);
+        return poDS;
+    }
+
+    virtual void Clean() override
+    {
+    }
+
+  private:
+    bool Exec(const char *pszSQL) const
+    {
+        char *pszErrMsg = nullptr;
+        if (sqlite3_exec(m_hDB, pszSQL, nullptr, nullptr, &pszErrMsg) !=
+            SQLITE_OK)
+        {
+            CPLDebug("WMS", "%s failed: %s", pszSQL,
+                     pszErrMsg ? pszErrMsg : "");
+            sqlite3_free(pszErrMsg);
+            return false;
+        }
+        return true;
+    }
+
+    sqlite3_stmt *Prepare(const char *pszSQL) const
+    {
+        sqlite3_stmt *hStmt = nullptr;
+        if (sqlite3_prepare_v2(m_hDB, pszSQL, -1, &hStmt, nullptr) !=
+            SQLITE_OK)
+        {
+            CPLDebug("WMS", "%s failed: %s", pszSQL, sqlite3_errmsg(m_hDB));
+            return nullptr;
+        }
+        return hStmt;
+    }
+
+    bool AddToCounter(const char *pszName, GIntBig nIncrement) const
+    {
+        sqlite3_stmt *hStmt =
+            Prepare("UPDATE cache_info SET value = value + ? WHERE name = ?");
+        if (hStmt == nullptr)
+            return false;
+        sqlite3_bind_int64(hStmt, 1, nIncrement);
+        sqlite3_bind_text(hStmt, 2, pszName, -1, SQLITE_STATIC);
+        const bool bOK = sqlite3_step(hStmt) == SQLITE_DONE;
+        sqlite3_finalize(hStmt);
+        return bOK;
+    }
+
+    GIntBig GetTileSize(const char *pszKey) const
+    {
+        sqlite3_stmt *hStmt = Prepare("SELECT size FROM tiles WHERE key = ?");
+        if (hStmt == nullptr)
+            return 0;
+        sqlite3_bind_text(hStmt, 1, pszKey, -1, SQLITE_STATIC);
+        GIntBig nSize = 0;
+        if (sqlite3_step(hStmt) == SQLITE_ROW)
+            nSize = sqlite3_column_int64(hStmt, 0);
+        sqlite3_finalize(hStmt);
+        return nSize;
+    }
+
+    // Must be called within a transaction. Deletes expired tiles, and then
+    // the least recently used ones, until the total size fits in the budget.
+    bool Evict(const char *pszKeyToKeep, GIntBig nNow)
+    {
+        sqlite3_stmt *hStmt =
+            Prepare("SELECT value FROM cache_info WHERE name = 'total_size'");
+        if (hStmt == nullptr)
+            return false;
+        GIntBig nTotalSize = 0;
+        if (sqlite3_step(hStmt) == SQLITE_ROW)
+            nTotalSize = sqlite3_column_int64(hStmt, 0);
+        sqlite3_finalize(hStmt);
+        if (nTotalSize <= m_nMaxSize)
+            return true;
+
+        // Expired tiles go first, whatever their access time
+        const GIntBig nExpiryTime = nNow - m_nExpires;
+        hStmt = Prepare("SELECT COUNT(*), SUM(size) FROM tiles "
+                        "WHERE insert_time < ? AND key <> ?");
+        if (hStmt == nullptr)
+            return false;
+        sqlite3_bind_int64(hStmt, 1, nExpiryTime);
+        sqlite3_bind_text(hStmt, 2, pszKeyToKeep, -1, SQLITE_STATIC);
+        GIntBig nExpiredCount = 0;
+        GIntBig nFreed = 0;
+        if (sqlite3_step(hStmt) == SQLITE_ROW)
+        {
+            nExpiredCount = sqlite3_column_int64(hStmt, 0);
+            nFreed = sqlite3_column_int64(hStmt, 1);
+        }
+        sqlite3_finalize(hStmt);
+        if (nExpiredCount > 0)
+        {
+            hStmt = Prepare("DELETE FROM tiles WHERE insert_time < ? AND "
+                            "key <> ?");
+            if (hStmt == nullptr)
+                return false;
+            sqlite3_bind_int64(hStmt, 1, nExpiryTime);
+            sqlite3_bind_text(hStmt, 2, pszKeyToKeep, -1, SQLITE_STATIC);
+            const bool bOK = sqlite3_step(hStmt) == SQLITE_DONE;
+            sqlite3_finalize(hStmt);
+            if (!bOK)
+                return false;
+        }
+
+        // Then the least recently used ones. Stepping stops as soon as
+        // enough space is freed, so only the first rows of the access_time
+        // index are visited.
+        std::vector<std::string> aosKeys;
+        if (nTotalSize - nFreed > m_nMaxSize)
+        {
+            hStmt = Prepare("SELECT key, size FROM tiles "
+                            "ORDER BY access_time");
+            if (hStmt == nullptr)
+                return false;
+            while (nTotalSize - nFreed > m_nMaxSize &&
+                   sqlite3_step(hStmt) == SQLITE_ROW)
+            {
+                const char *pszKey = reinterpret_cast<const char *>(
+                    sqlite3_column_text(hStmt, 0));
+                if (pszKey && strcmp(pszKey, pszKeyToKeep) != 0)
+                {
+                    aosKeys.push_back(pszKey);
+                    nFreed += sqlite3_column_int64(hStmt, 1);
+                }
+            }
+            sqlite3_finalize(hStmt);
+        }
+
+        hStmt = Prepare("DELETE FROM tiles WHERE key = ?");
+        if (hStmt == nullptr)
+            return false;
+        bool bOK = true;
+        for (const auto &osKey : aosKeys)
+        {
+            sqlite3_reset(hStmt);
+            sqlite3_bind_text(hStmt, 1, osKey.c_str(), -1, SQLITE_STATIC);
+            if (sqlite3_step(hStmt) != SQLITE_DONE)
+            {
+                bOK = false;
+                break;
+            }
+        }
+        sqlite3_finalize(hStmt);
+        if (!bOK)
+            return false;
+
+        m_nEvictions += nExpiredCount + static_cast<GIntBig>(aosKeys.size());
+        CPLDebug("WMS", "Evicted " CPL_FRMT_GIB " items from cache",
+                 nExpiredCount + static_cast<GIntBig>(aosKeys.size()));
+        return AddToCounter("total_size", -nFreed);
+    }
+
+  private:
+    // Granularity, in seconds, of the access time updates done on cache hits
+    static constexpr GIntBig ACCESS_TIME_RESOLUTION = 60;
+
+    int m_nExpires;
+    GIntBig m_nMaxSize;
+    sqlite3 *m_hDB;
+    mutable GIntBig m_nHits;
+    mutable GIntBig m_nMisses;
+    GIntBig m_nInsertions;
+    GIntBig m_nEvictions;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALWMSSQLiteCache)
+};
+
+#endif  // HAVE_SQLITE
+
 //------------------------------------------------------------------------------
 // GDALWMSCache
 //------------------------------------------------------------------------------
@@ -256,12 +672,28 @@ CPLErr GDALWMSCache::Initialize(const char *pszUrl, CPLXMLNode *pConfig)
             CPLFormFilename(m_osCachePath, CPLMD5String(pszUrl), nullptr);
     }
 
-    // TODO: Add sqlite db cache type
     const char *pszType = CPLGetXMLValue(pConfig, "Type", "file");
     if (EQUAL(pszType, "file"))
     {
         m_poCache = new GDALWMSFileCache(m_osCachePath, pConfig);
     }
+    else if (EQUAL(pszType, "sqlite"))
+    {
+#ifdef HAVE_SQLITE
+        auto poCache = new GDALWMSSQLiteCache(m_osCachePath, pConfig);
+        if (!poCache->Open())
+        {
+            delete poCache;
+            return CE_Failure;
+        }
+        m_poCache = poCache;
+#else
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GDALWMS: sqlite cache type not supported, as GDAL is built "
+                 "without SQLite support");
+        return CE_Failure;
+#endif
+    }
 
     return CE_None;
 }
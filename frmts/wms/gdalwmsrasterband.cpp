@@ -31,6 +31,10 @@
 
 #include "wmsdriver.h"
 
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+
 #include <algorithm>
 
 GDALWMSRasterBand::GDALWMSRasterBand(GDALWMSDataset *parent_dataset, int band,
@@ -78,6 +82,49 @@ GDALWMSRasterBand::~GDALWMSRasterBand()
     }
 }
 
+namespace
+{
+// Decoding of a downloaded block into a temporary buffer, in a worker thread
+struct WMSDecodeJob
+{
+    GDALWMSRasterBand *poBand = nullptr;
+    int x = 0;
+    int y = 0;
+    CPLString osFileName{};
+    std::vector<GByte> abyAllBands{};
+    bool bSubmitted = false;
+    CPLErr eErr = CE_None;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+}  // namespace
+
+static bool IsSuccessfulResponse(const WMSHTTPRequest &request)
+{
+    return ((request.nStatus == 200) ||
+            (!request.Range.empty() && request.nStatus == 206)) &&
+           request.pabyData != nullptr && request.nDataLen > 0;
+}
+
+static bool IsServerException(const WMSHTTPRequest &request)
+{
+    if (request.nDataLen < 20)
+        return false;
+    const char *download_data = reinterpret_cast<char *>(request.pabyData);
+    return STARTS_WITH_CI(download_data, "<?xml ") ||
+           STARTS_WITH_CI(download_data, "<!DOCTYPE ") ||
+           STARTS_WITH_CI(download_data, "<ServiceException");
+}
+
+void GDALWMSRasterBand::DecodeBlockJob(void *pData)
+{
+    WMSDecodeJob *psJob = static_cast<WMSDecodeJob *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    psJob->eErr = psJob->poBand->ReadBlockFromFile(
+        psJob->osFileName, psJob->x, psJob->y, 0, nullptr, 0,
+        psJob->abyAllBands.data());
+    CPLUninstallErrorHandlerAccumulator();
+}
+
 // Request for x, y but all blocks between bx0-bx1 and by0-by1 should be read
 CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                                      int by0, int bx1, int by1, int advise_read)
@@ -194,47 +241,95 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
         }
     }
 
+    // Downloaded blocks are decoded on the global thread pool as soon as
+    // they are received, while the other ones are still being downloaded.
+    // Decoded blocks are stored in the block cache afterwards, from this
+    // thread.
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    std::vector<WMSDecodeJob> asJobs;
+    if (!advise_read && count > 1)
+    {
+        const int nThreads = GDALGetNumThreads(nullptr, nullptr);
+        CPLWorkerThreadPool *poThreadPool =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        if (poThreadPool)
+        {
+            poJobQueue = poThreadPool->CreateJobQueue();
+            asJobs.resize(count);
+        }
+    }
+    std::function<void(WMSHTTPRequest &)> OnRequestFinished;
+    if (poJobQueue)
+    {
+        const size_t nAllBandsSize = static_cast<size_t>(nBlockXSize) *
+                                     nBlockYSize * m_parent_dataset->nBands *
+                                     GDALGetDataTypeSizeBytes(eDataType);
+        OnRequestFinished = [&, nAllBandsSize](WMSHTTPRequest &request)
+        {
+            if (ret != CE_None || !IsSuccessfulResponse(request) ||
+                IsServerException(request))
+            {
+                return;
+            }
+            WMSDecodeJob &job = asJobs[&request - &requests[0]];
+            job.osFileName =
+                BufferToVSIFile(request.pabyData, request.nDataLen);
+            if (job.osFileName.empty())
+                return;
+            try
+            {
+                job.abyAllBands.resize(nAllBandsSize);
+            }
+            catch (const std::exception &)
+            {
+                // Will be decoded from this thread
+                return;
+            }
+            job.poBand = this;
+            job.x = request.x;
+            job.y = request.y;
+            job.bSubmitted = poJobQueue->SubmitJob(DecodeBlockJob, &job);
+        };
+    }
+
     // Fetch all the requests, OK to call with count of 0
     if (WMSHTTPFetchMulti(count ? &requests[0] : nullptr,
-                          static_cast<int>(count)) != CE_None)
+                          static_cast<int>(count),
+                          OnRequestFinished) != CE_None)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "GDALWMS: CPLHTTPFetchMulti failed.");
         ret = CE_Failure;
     }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
 
     for (size_t i = 0; i < count; ++i)
     {
         WMSHTTPRequest &request = requests[i];
         void *p = ((request.x == x) && (request.y == y)) ? buffer : nullptr;
+        WMSDecodeJob *psJob =
+            (i < asJobs.size() && asJobs[i].bSubmitted) ? &asJobs[i] : nullptr;
         if (ret == CE_None)
         {
-            int success = (request.nStatus == 200) ||
-                          (!request.Range.empty() && request.nStatus == 206);
-            if (success && (request.pabyData != nullptr) &&
-                (request.nDataLen > 0))
+            if (IsSuccessfulResponse(request))
             {
                 CPLString file_name(
-                    BufferToVSIFile(request.pabyData, request.nDataLen));
+                    psJob ? psJob->osFileName
+                          : BufferToVSIFile(request.pabyData,
+                                            request.nDataLen));
                 if (!file_name.empty())
                 {
                     /* check for error xml */
-                    if (request.nDataLen >= 20)
+                    if (IsServerException(request))
                     {
-                        const char *download_data =
-                            reinterpret_cast<char *>(request.pabyData);
-                        if (STARTS_WITH_CI(download_data, "<?xml ") ||
-                            STARTS_WITH_CI(download_data, "<!DOCTYPE ") ||
-                            STARTS_WITH_CI(download_data, "<ServiceException"))
+                        if (ReportWMSException(file_name) != CE_None)
                         {
-                            if (ReportWMSException(file_name) != CE_None)
-                            {
-                                CPLError(CE_Failure, CPLE_AppDefined,
-                                         "GDALWMS: The server returned unknown "
-                                         "exception.");
-                            }
-                            ret = CE_Failure;
+                            CPLError(CE_Failure, CPLE_AppDefined,
+                                     "GDALWMS: The server returned unknown "
+                                     "exception.");
                         }
+                        ret = CE_Failure;
                     }
                     if (ret == CE_None)
                     {
@@ -246,9 +341,25 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                         }
                         else
                         {
-                            ret = ReadBlockFromFile(file_name, request.x,
-                                                    request.y, nBand, p,
-                                                    advise_read);
+                            if (psJob)
+                            {
+                                for (const auto &oError : psJob->aoErrors)
+                                {
+                                    CPLError(oError.type, oError.no, "%s",
+                                             oError.msg.c_str());
+                                }
+                                ret = psJob->eErr;
+                                if (ret == CE_None)
+                                    ret = StoreDecodedBlock(
+                                        request.x, request.y, nBand, p,
+                                        psJob->abyAllBands.data());
+                            }
+                            else
+                            {
+                                ret = ReadBlockFromFile(file_name, request.x,
+                                                        request.y, nBand, p,
+                                                        advise_read);
+                            }
                             if (ret == CE_None)
                             {
                                 if (cache != nullptr)
@@ -271,6 +382,8 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                                      "GDALWMS: EmptyBlock failed.");
                     }
                     VSIUnlink(file_name);
+                    if (psJob)
+                        psJob->osFileName.clear();
                 }
             }
             else
@@ -321,6 +434,14 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
         }
     }
 
+    // Files of jobs that have not been consumed above, either because of an
+    // earlier error or because they could not be submitted
+    for (const auto &job : asJobs)
+    {
+        if (!job.osFileName.empty())
+            VSIUnlink(job.osFileName);
+    }
+
     return ret;
 }
 
@@ -707,9 +828,13 @@ static const int *GetBandMapForExpand(int nSourceBands, int nWmsBands)
     return bandmap_selector[nWmsBands - 1][nSourceBands - 1];
 }
 
+// If pabyAllBands is set, the block of all bands is decoded into it, one
+// band after the other, instead of the block cache. This does not access the
+// block cache and may thus be called from a worker thread.
 CPLErr GDALWMSRasterBand::ReadBlockFromDataset(GDALDataset *ds, int x, int y,
                                                int to_buffer_band, void *buffer,
-                                               int advise_read)
+                                               int advise_read,
+                                               GByte *pabyAllBands)
 {
     CPLErr ret = CE_None;
     GByte *color_table = nullptr;
@@ -811,7 +936,13 @@ CPLErr GDALWMSRasterBand::ReadBlockFromDataset(GDALDataset *ds, int x, int y,
             {
                 void *p = nullptr;
                 GDALRasterBlock *b = nullptr;
-                if ((buffer != nullptr) && (ib == to_buffer_band))
+                if (pabyAllBands != nullptr)
+                {
+                    p = pabyAllBands +
+                        static_cast<size_t>(ib - 1) * nBlockXSize *
+                            nBlockYSize * GDALGetDataTypeSizeBytes(eDataType);
+                }
+                else if ((buffer != nullptr) && (ib == to_buffer_band))
                 {
                     p = buffer;
                 }
@@ -951,7 +1082,8 @@ CPLErr GDALWMSRasterBand::ReadBlockFromDataset(GDALDataset *ds, int x, int y,
 
 CPLErr GDALWMSRasterBand::ReadBlockFromFile(const CPLString &soFileName, int x,
                                             int y, int to_buffer_band,
-                                            void *buffer, int advise_read)
+                                            void *buffer, int advise_read,
+                                            GByte *pabyAllBands)
 {
     GDALDataset *ds = reinterpret_cast<GDALDataset *>(GDALOpenEx(
         soFileName, GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_VERBOSE_ERROR,
@@ -963,7 +1095,8 @@ CPLErr GDALWMSRasterBand::ReadBlockFromFile(const CPLString &soFileName, int x,
         return CE_Failure;
     }
 
-    return ReadBlockFromDataset(ds, x, y, to_buffer_band, buffer, advise_read);
+    return ReadBlockFromDataset(ds, x, y, to_buffer_band, buffer, advise_read,
+                                pabyAllBands);
 }
 
 CPLErr GDALWMSRasterBand::ReadBlockFromCache(const char *pszKey, int x, int y,
@@ -1045,6 +1178,59 @@ CPLErr GDALWMSRasterBand::EmptyBlock(int x, int y, int to_buffer_band,
     return ret;
 }
 
+// Stores a block decoded by ReadBlockFromDataset() into pabyAllBands
+CPLErr GDALWMSRasterBand::StoreDecodedBlock(int x, int y, int to_buffer_band,
+                                            void *buffer,
+                                            const GByte *pabyAllBands)
+{
+    CPLErr ret = CE_None;
+    const size_t nBandSize = static_cast<size_t>(nBlockXSize) * nBlockYSize *
+                             GDALGetDataTypeSizeBytes(eDataType);
+
+    for (int ib = 1; ib <= m_parent_dataset->nBands; ++ib)
+    {
+        if (ret == CE_None)
+        {
+            void *p = nullptr;
+            GDALRasterBlock *b = nullptr;
+            if ((buffer != nullptr) && (ib == to_buffer_band))
+            {
+                p = buffer;
+            }
+            else
+            {
+                GDALWMSRasterBand *band = static_cast<GDALWMSRasterBand *>(
+                    m_parent_dataset->GetRasterBand(ib));
+                if (m_overview >= 0)
+                    band = static_cast<GDALWMSRasterBand *>(
+                        band->GetOverview(m_overview));
+                if (!band->IsBlockInCache(x, y))
+                {
+                    b = band->GetLockedBlockRef(x, y, true);
+                    if (b != nullptr)
+                    {
+                        p = b->GetDataRef();
+                        if (p == nullptr)
+                        {
+                            CPLError(CE_Failure, CPLE_AppDefined,
+                                     "GDALWMS: GetDataRef returned NULL.");
+                            ret = CE_Failure;
+                        }
+                    }
+                }
+            }
+            if (p != nullptr)
+                memcpy(p, pabyAllBands + (ib - 1) * nBandSize, nBandSize);
+            if (b != nullptr)
+            {
+                b->DropLock();
+            }
+        }
+    }
+
+    return ret;
+}
+
 CPLErr GDALWMSRasterBand::ReportWMSException(const char *file_name)
 {
     CPLErr ret = CE_None;
@@ -580,11 +580,15 @@ class GDALWMSRasterBand final : public GDALPamRasterBand
                               int to_buffer_band, void *buffer,
                               int advise_read);
     CPLErr ReadBlockFromFile(const CPLString &soFileName, int x, int y,
-                             int to_buffer_band, void *buffer, int advise_read);
+                             int to_buffer_band, void *buffer, int advise_read,
+                             GByte *pabyAllBands = nullptr);
     CPLErr ReadBlockFromDataset(GDALDataset *ds, int x, int y,
                                 int to_buffer_band, void *buffer,
-                                int advise_read);
+                                int advise_read, GByte *pabyAllBands = nullptr);
     CPLErr EmptyBlock(int x, int y, int to_buffer_band, void *buffer);
+    CPLErr StoreDecodedBlock(int x, int y, int to_buffer_band, void *buffer,
+                             const GByte *pabyAllBands);
+    static void DecodeBlockJob(void *pData);
     static CPLErr ReportWMSException(const char *file_name);
 
   protected:
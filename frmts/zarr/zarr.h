@@ -535,6 +535,8 @@ class ZarrArray final : public GDALPamMDArray
     mutable bool m_bHasTriedCacheTilePresenceArray = false;
     mutable std::shared_ptr<GDALMDArray> m_poCacheTilePresenceArray{};
     mutable std::mutex m_oMutex{};
+    // Serializes IRead(), which uses the above working buffers
+    mutable std::mutex m_oReadMutex{};
     struct CachedTile
     {
         std::vector<GByte> abyDecoded{};
@@ -614,6 +616,12 @@ class ZarrArray final : public GDALPamMDArray
         return m_bUpdatable;
     }
 
+    bool IsReadThreadSafe() const override
+    {
+        // IRead() is serialized with m_oReadMutex
+        return true;
+    }
+
     const std::string &GetFilename() const override
     {
         return m_osFilename;
@@ -1713,6 +1713,8 @@ bool ZarrArray::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
                       const GDALExtendedDataType &bufferDataType,
                       void *pDstBuffer) const
 {
+    std::lock_guard<std::mutex> oReadLock(m_oReadMutex);
+
     if (!AllocateWorkingBuffers())
         return false;
 
@@ -949,6 +949,18 @@ GDALDatasetH CPL_DLL CPL_STDCALL GDALOpenShared(const char *, GDALAccess)
 #define GDAL_OF_BLOCK_ACCESS_MASK 0x300
 #endif
 
+/** Return a dataset that can be used concurrently by several threads for
+ * read access. Each thread transparently uses its own underlying dataset
+ * handle, opened on its first access.
+ *
+ * Can only be used with GDAL_OF_RASTER, and is incompatible with
+ * GDAL_OF_UPDATE and GDAL_OF_SHARED.
+ *
+ * Used by GDALOpenEx().
+ * @since GDAL 3.7
+ */
+#define GDAL_OF_THREAD_SAFE 0x800
+
 GDALDatasetH CPL_DLL CPL_STDCALL GDALOpenEx(
     const char *pszFilename, unsigned int nOpenFlags,
     const char *const *papszAllowedDrivers, const char *const *papszOpenOptions,
@@ -1403,6 +1415,11 @@ CPLErr CPL_DLL CPL_STDCALL GDALSetRasterStatistics(GDALRasterBandH hBand,
 GDALMDArrayH
     CPL_DLL GDALRasterBandAsMDArray(GDALRasterBandH) CPL_WARN_UNUSED_RESULT;
 
+CPLErr CPL_DLL GDALRasterInterpolateAtPoints(
+    GDALRasterBandH hBand, size_t nPointCount, const double *padfPixel,
+    const double *padfLine, GDALRIOResampleAlg eResampleAlg,
+    double *padfValues, int *pabSuccess);
+
 const char CPL_DLL *CPL_STDCALL GDALGetRasterUnitType(GDALRasterBandH);
 CPLErr CPL_DLL CPL_STDCALL GDALSetRasterUnitType(GDALRasterBandH hBand,
                                                  const char *pszNewValue);
@@ -2188,6 +2205,8 @@ GDALMDArrayH CPL_DLL GDALMDArrayGetResampled(GDALMDArrayH hArray,
                                              GDALRIOResampleAlg resampleAlg,
                                              OGRSpatialReferenceH hTargetSRS,
                                              CSLConstList papszOptions);
+GDALMDArrayH CPL_DLL GDALMDArrayGetReduced(GDALMDArrayH hArray, size_t iDim,
+                                           const char *pszOperation);
 GDALMDArrayH CPL_DLL *
 GDALMDArrayGetCoordinateVariables(GDALMDArrayH hArray,
                                   size_t *pnCount) CPL_WARN_UNUSED_RESULT;
@@ -1494,6 +1494,11 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
 
     std::shared_ptr<GDALMDArray> AsMDArray() const;
 
+    CPLErr InterpolateAtPoints(size_t nPointCount, const double *padfPixel,
+                               const double *padfLine,
+                               GDALRIOResampleAlg eResampleAlg,
+                               double *padfValues, int *pabSuccess);
+
 #ifndef DOXYGEN_XML
     void ReportError(CPLErr eErrClass, CPLErrorNum err_no, const char *fmt, ...)
         CPL_PRINT_FUNC_FORMAT(4, 5);
@@ -2490,6 +2495,14 @@ class CPL_DLL GDALAbstractMDArray
                                  FuncProcessPerChunkType pfnFunc,
                                  void *pUserData);
 
+    bool ProcessPerChunkMultiThreaded(const GUInt64 *arrayStartIdx,
+                                      const GUInt64 *count,
+                                      const size_t *chunkSize,
+                                      FuncProcessPerChunkType pfnFunc,
+                                      int nThreads, void *const *papUserData);
+
+    virtual bool IsReadThreadSafe() const;
+
     virtual bool
     Read(const GUInt64 *arrayStartIdx,    // array of size GetDimensionCount()
          const size_t *count,             // array of size GetDimensionCount()
@@ -2857,6 +2870,9 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
                  const OGRSpatialReference *poTargetSRS,
                  CSLConstList papszOptions) const;
 
+    std::shared_ptr<GDALMDArray>
+    GetReduced(size_t iDim, const std::string &osOperation) const;
+
     virtual GDALDataset *AsClassicDataset(size_t iXDim, size_t iYDim) const;
 
     virtual CPLErr GetStatistics(bool bApproxOK, bool bForce, double *pdfMin,
@@ -3589,6 +3605,11 @@ void GDALRasterIOExtraArgSetResampleAlg(GDALRasterIOExtraArg *psExtraArg,
 GDALDataset *GDALCreateOverviewDataset(GDALDataset *poDS, int nOvrLevel,
                                        bool bThisLevelOnly);
 
+GDALDataset *GDALCreateThreadSafeDataset(GDALDataset *poPrototypeDS,
+                                         const char *pszFilename,
+                                         unsigned nOpenFlags,
+                                         CSLConstList papszOpenOptions);
+
 // Should cover particular cases of #3573, #4183, #4506, #6578
 // Behavior is undefined if fVal1 or fVal2 are NaN (should be tested before
 // calling this function)
@@ -28,6 +28,9 @@
 
 #include "gdal_thread_pool.h"
 
+#include "cpl_conv.h"
+
+#include <algorithm>
 #include <mutex>
 
 static std::mutex gMutexThreadPool;
@@ -58,3 +61,30 @@ void GDALDestroyGlobalThreadPool()
     delete gpoCompressThreadPool;
     gpoCompressThreadPool = nullptr;
 }
+
+/************************************************************************/
+/*                         GDALGetNumThreads()                          */
+/************************************************************************/
+
+/** Return the number of worker threads to use.
+ *
+ * The value of the pszItem option of papszOptions is used if set, and
+ * otherwise the GDAL_NUM_THREADS configuration option, which defaults to 1.
+ * Values may be an integer or ALL_CPUS. The result is in [1, nMaxVal].
+ *
+ * @param papszOptions options in which to look for pszItem, or NULL.
+ * @param pszItem name of the option, for example "NUM_THREADS", or NULL.
+ * @param nMaxVal maximum number of threads to return.
+ */
+int GDALGetNumThreads(CSLConstList papszOptions, const char *pszItem,
+                      int nMaxVal)
+{
+    const char *pszNumThreads =
+        pszItem ? CSLFetchNameValue(papszOptions, pszItem) : nullptr;
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return std::max(1, std::min(nMaxVal, nThreads));
+}
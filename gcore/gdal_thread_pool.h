@@ -29,10 +29,14 @@
 #ifndef GDAL_THREAD_POOL_H
 #define GDAL_THREAD_POOL_H
 
+#include "cpl_string.h"
 #include "cpl_worker_thread_pool.h"
 
 CPLWorkerThreadPool CPL_DLL *GDALGetGlobalThreadPool(int nThreads);
 
+int CPL_DLL GDALGetNumThreads(CSLConstList papszOptions, const char *pszItem,
+                              int nMaxVal = 128);
+
 void GDALDestroyGlobalThreadPool();
 
 #endif  // GDAL_THREAD_POOL_H
@@ -3317,7 +3317,13 @@ GDALDatasetH CPL_STDCALL GDALOpen(const char *pszFilename, GDALAccess eAccess)
  * GDALOpenEx() it will be referenced and returned, if GDALOpenEx() is called
  * from the same thread.</li> <li>Verbose error: GDAL_OF_VERBOSE_ERROR. If set,
  * a failed attempt to open the file will lead to an error message to be
- * reported.</li>
+ * reported.</li> <li>Thread-safe mode: GDAL_OF_THREAD_SAFE (GDAL >= 3.7).
+ * If set, the returned dataset may be used concurrently by several threads
+ * for read access (RasterIO(), ReadBlock(), metadata getters, ...). Each
+ * thread transparently uses its own underlying dataset, opened on its first
+ * access and closed when the returned dataset is closed. Only compatible
+ * with GDAL_OF_RASTER and read-only access, and incompatible with
+ * GDAL_OF_SHARED.</li>
  * </ul>
  *
  * @param papszAllowedDrivers NULL to consider all candidate drivers, or a NULL
@@ -3355,6 +3361,35 @@ GDALDatasetH CPL_STDCALL GDALOpenEx(const char *pszFilename,
                                     const char *const *papszSiblingFiles)
 {
     VALIDATE_POINTER1(pszFilename, "GDALOpen", nullptr);
+
+    /* -------------------------------------------------------------------- */
+    /*      Thread-safe datasets wrap a prototype dataset opened normally.  */
+    /* -------------------------------------------------------------------- */
+    if (nOpenFlags & GDAL_OF_THREAD_SAFE)
+    {
+        if ((nOpenFlags & (GDAL_OF_UPDATE | GDAL_OF_SHARED)) != 0 ||
+            (nOpenFlags & GDAL_OF_KIND_MASK) != GDAL_OF_RASTER)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "GDAL_OF_THREAD_SAFE is only compatible with "
+                     "GDAL_OF_RASTER in read-only and non-shared mode");
+            return nullptr;
+        }
+        const unsigned nUnderlyingOpenFlags =
+            (nOpenFlags & ~GDAL_OF_THREAD_SAFE) | GDAL_OF_INTERNAL;
+        GDALDataset *poPrototypeDS = GDALDataset::FromHandle(
+            GDALOpenEx(pszFilename, nUnderlyingOpenFlags, papszAllowedDrivers,
+                       papszOpenOptions, papszSiblingFiles));
+        if (poPrototypeDS == nullptr)
+            return nullptr;
+        GDALDataset *poDS = GDALCreateThreadSafeDataset(
+            poPrototypeDS, pszFilename, nUnderlyingOpenFlags, papszOpenOptions);
+        poDS->nOpenFlags = nOpenFlags;
+        if (!(nOpenFlags & GDAL_OF_INTERNAL))
+            poDS->AddToDatasetOpenList();
+        return GDALDataset::ToHandle(poDS);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      In case of shared dataset, first scan the existing list to see  */
     /*      if it could already contain the requested dataset.              */
@@ -30,7 +30,9 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <mutex>
 #include <queue>
 #include <set>
 
@@ -39,6 +41,8 @@
 #include "cpl_error_internal.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
+#include "gdalsse_priv.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "cpl_safemaths.hpp"
 #include "ogrsf_frmts.h"
@@ -2622,6 +2626,34 @@ enum class Caller
 };
 }
 
+static bool CheckProcessPerChunkArgs(
+    const std::vector<std::shared_ptr<GDALDimension>> &dims,
+    const GUInt64 *arrayStartIdx, const GUInt64 *count, const size_t *chunkSize)
+{
+    size_t nTotalChunkSize = 1;
+    for (size_t i = 0; i < dims.size(); i++)
+    {
+        const auto nSizeThisDim(dims[i]->GetSize());
+        if (count[i] == 0 || count[i] > nSizeThisDim ||
+            arrayStartIdx[i] > nSizeThisDim - count[i])
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Inconsistent arrayStartIdx[] / count[] values "
+                     "regarding array size");
+            return false;
+        }
+        if (chunkSize[i] == 0 || chunkSize[i] > nSizeThisDim ||
+            chunkSize[i] > std::numeric_limits<size_t>::max() / nTotalChunkSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Inconsistent chunkSize[] values");
+            return false;
+        }
+        nTotalChunkSize *= chunkSize[i];
+    }
+    return true;
+}
+
 /** \brief Call a user-provided function to operate on an array chunk by chunk.
  *
  * This method is to be used when doing operations on an array, or a subset of
@@ -2663,27 +2695,8 @@ bool GDALAbstractMDArray::ProcessPerChunk(const GUInt64 *arrayStartIdx,
     }
 
     // Sanity check
-    size_t nTotalChunkSize = 1;
-    for (size_t i = 0; i < dims.size(); i++)
-    {
-        const auto nSizeThisDim(dims[i]->GetSize());
-        if (count[i] == 0 || count[i] > nSizeThisDim ||
-            arrayStartIdx[i] > nSizeThisDim - count[i])
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Inconsistent arrayStartIdx[] / count[] values "
-                     "regarding array size");
-            return false;
-        }
-        if (chunkSize[i] == 0 || chunkSize[i] > nSizeThisDim ||
-            chunkSize[i] > std::numeric_limits<size_t>::max() / nTotalChunkSize)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Inconsistent chunkSize[] values");
-            return false;
-        }
-        nTotalChunkSize *= chunkSize[i];
-    }
+    if (!CheckProcessPerChunkArgs(dims, arrayStartIdx, count, chunkSize))
+        return false;
 
     size_t dimIdx = 0;
     std::vector<GUInt64> chunkArrayStartIdx(dims.size());
@@ -2772,6 +2785,215 @@ end:
     return true;
 }
 
+/************************************************************************/
+/*                   ProcessPerChunkMultiThreaded()                     */
+/************************************************************************/
+
+/** \brief Call a user-provided function to operate on an array chunk by chunk,
+ * using several threads.
+ *
+ * This method is similar to ProcessPerChunk(), except that chunks are
+ * dispatched to nThreads worker threads of the global thread pool. The first
+ * chunk is processed in the calling thread before the others are dispatched,
+ * so that lazy initializations done by the array happen in a single thread.
+ * Chunks are then processed in no particular order, and the iCurChunk
+ * argument of pfnFunc is the index of the chunk (in the same order as
+ * ProcessPerChunk()) rather than a counter of processed chunks.
+ *
+ * pfnFunc may be called concurrently from several threads, with the same
+ * array, which must thus support concurrent reads (see IsReadThreadSafe()),
+ * and with a different pUserData value for each thread: papUserData[i] is
+ * used exclusively by one thread at a time, so that it may typically hold a
+ * per-thread accumulator. Errors emitted from the worker threads are emitted
+ * again from the calling thread once all chunks have been processed.
+ *
+ * @param arrayStartIdx See ProcessPerChunk().
+ * @param count         See ProcessPerChunk().
+ * @param chunkSize     See ProcessPerChunk().
+ * @param pfnFunc       See ProcessPerChunk().
+ * @param nThreads      Maximum number of threads to use. If <= 1,
+ *                      ProcessPerChunk() is called with papUserData[0].
+ * @param papUserData   Array of max(1, nThreads) values to pass as the
+ *                      pUserData argument of FuncProcessPerChunkType.
+ *
+ * @return true in case of success.
+ * @since GDAL 3.7
+ */
+bool GDALAbstractMDArray::ProcessPerChunkMultiThreaded(
+    const GUInt64 *arrayStartIdx, const GUInt64 *count,
+    const size_t *chunkSize, FuncProcessPerChunkType pfnFunc, int nThreads,
+    void *const *papUserData)
+{
+    const auto &dims = GetDimensions();
+    if (nThreads <= 1 || dims.empty())
+    {
+        return ProcessPerChunk(arrayStartIdx, count, chunkSize, pfnFunc,
+                               papUserData[0]);
+    }
+
+    // Sanity check
+    if (!CheckProcessPerChunkArgs(dims, arrayStartIdx, count, chunkSize))
+        return false;
+
+    struct Context
+    {
+        GDALAbstractMDArray *poArray = nullptr;
+        const GUInt64 *arrayStartIdx = nullptr;
+        const GUInt64 *count = nullptr;
+        const size_t *chunkSize = nullptr;
+        FuncProcessPerChunkType pfnFunc = nullptr;
+        std::vector<GUInt64> anStartBlock{};
+        std::vector<GUInt64> anBlockCount{};
+        GUInt64 nChunkCount = 1;
+        std::atomic<GUInt64> nNextChunk{0};
+        std::atomic<bool> bError{false};
+
+        // Process the chunk of (0-based) index iChunk
+        bool ProcessChunk(GUInt64 iChunk, std::vector<GUInt64> &anChunkStart,
+                          std::vector<size_t> &anChunkCount,
+                          void *pUserData) const
+        {
+            GUInt64 nRemainder = iChunk;
+            for (size_t i = anBlockCount.size(); i > 0;)
+            {
+                --i;
+                const GUInt64 nBlock =
+                    anStartBlock[i] + nRemainder % anBlockCount[i];
+                nRemainder /= anBlockCount[i];
+                const GUInt64 nStart =
+                    std::max(arrayStartIdx[i], nBlock * chunkSize[i]);
+                const GUInt64 nEnd = std::min(arrayStartIdx[i] + count[i],
+                                              (nBlock + 1) * chunkSize[i]);
+                anChunkStart[i] = nStart;
+                anChunkCount[i] = static_cast<size_t>(nEnd - nStart);
+            }
+            return pfnFunc(poArray, anChunkStart.data(), anChunkCount.data(),
+                           iChunk + 1, nChunkCount, pUserData);
+        }
+    };
+
+    Context sContext;
+    sContext.poArray = this;
+    sContext.arrayStartIdx = arrayStartIdx;
+    sContext.count = count;
+    sContext.chunkSize = chunkSize;
+    sContext.pfnFunc = pfnFunc;
+    for (size_t i = 0; i < dims.size(); i++)
+    {
+        const auto nStartBlock = arrayStartIdx[i] / chunkSize[i];
+        const auto nEndBlock = (arrayStartIdx[i] + count[i] - 1) / chunkSize[i];
+        sContext.anStartBlock.push_back(nStartBlock);
+        sContext.anBlockCount.push_back(nEndBlock - nStartBlock + 1);
+        sContext.nChunkCount *= nEndBlock - nStartBlock + 1;
+    }
+
+    std::vector<GUInt64> anChunkStart(dims.size());
+    std::vector<size_t> anChunkCount(dims.size());
+    if (!sContext.ProcessChunk(0, anChunkStart, anChunkCount, papUserData[0]))
+        return false;
+    sContext.nNextChunk = 1;
+    if (sContext.nChunkCount == 1)
+        return true;
+
+    nThreads = static_cast<int>(std::min(static_cast<GUInt64>(nThreads),
+                                         sContext.nChunkCount - 1));
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (poThreadPool == nullptr)
+    {
+        for (GUInt64 iChunk = 1; iChunk < sContext.nChunkCount; ++iChunk)
+        {
+            if (!sContext.ProcessChunk(iChunk, anChunkStart, anChunkCount,
+                                       papUserData[0]))
+                return false;
+        }
+        return true;
+    }
+
+    struct Job
+    {
+        Context *psContext = nullptr;
+        void *pUserData = nullptr;
+        // Errors raised in the worker thread, to be emitted by the caller
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    const auto JobFunc = [](void *pData)
+    {
+        Job *psJob = static_cast<Job *>(pData);
+        Context *psContext = psJob->psContext;
+        const size_t nDims = psContext->anBlockCount.size();
+        std::vector<GUInt64> l_anChunkStart(nDims);
+        std::vector<size_t> l_anChunkCount(nDims);
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        while (!psContext->bError)
+        {
+            const GUInt64 iChunk = psContext->nNextChunk++;
+            if (iChunk >= psContext->nChunkCount)
+                break;
+            if (!psContext->ProcessChunk(iChunk, l_anChunkStart,
+                                         l_anChunkCount, psJob->pUserData))
+            {
+                psContext->bError = true;
+            }
+        }
+        CPLUninstallErrorHandlerAccumulator();
+    };
+
+    std::vector<Job> asJobs(nThreads);
+    auto poQueue = poThreadPool->CreateJobQueue();
+    for (int i = 0; i < nThreads; ++i)
+    {
+        asJobs[i].psContext = &sContext;
+        asJobs[i].pUserData = papUserData[i];
+        if (!poQueue->SubmitJob(JobFunc, &asJobs[i]))
+        {
+            sContext.bError = true;
+            break;
+        }
+    }
+    poQueue->WaitCompletion();
+
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+
+    return !sContext.bError;
+}
+
+/************************************************************************/
+/*                   GetProcessPerChunkThreadCount()                    */
+/************************************************************************/
+
+// Returns the number of threads to use with ProcessPerChunkMultiThreaded()
+// for the specified array(s).
+static int GetProcessPerChunkThreadCount(const GDALAbstractMDArray *poArray,
+                                         const GDALAbstractMDArray *poArray2)
+{
+    if (!poArray->IsReadThreadSafe() ||
+        (poArray2 && !poArray2->IsReadThreadSafe()))
+        return 1;
+    return GDALGetNumThreads(nullptr, nullptr);
+}
+
+/************************************************************************/
+/*                          IsReadThreadSafe()                          */
+/************************************************************************/
+
+/** Return whether Read() may be called concurrently from several threads
+ * on this array.
+ *
+ * This is used to decide whether ProcessPerChunkMultiThreaded() can be used.
+ * The default implementation returns false.
+ *
+ * @since GDAL 3.7
+ */
+bool GDALAbstractMDArray::IsReadThreadSafe() const
+{
+    return false;
+}
+
 /************************************************************************/
 /*                          GDALAttribute()                             */
 /************************************************************************/
@@ -3475,6 +3697,10 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             GUInt64 nTotalCost = 0;
             GUInt64 nTotalBytesThisArray = 0;
             bool bStop = false;
+            // Only set when several threads are used, to serialize writing
+            // and progress reporting.
+            std::mutex *pMutex = nullptr;
+            GUInt64 *pnChunksDone = nullptr;
 
             static bool f(GDALAbstractMDArray *l_poSrcArray,
                           const GUInt64 *chunkArrayStartIdx,
@@ -3489,6 +3715,9 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
                 {
                     return false;
                 }
+                std::unique_lock<std::mutex> oLock;
+                if (data->pMutex)
+                    oLock = std::unique_lock<std::mutex>(*data->pMutex);
                 bool bRet =
                     poDstArray->Write(chunkArrayStartIdx, chunkCount, nullptr,
                                       nullptr, dt, &data->abyTmp[0]);
@@ -3513,6 +3742,8 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
                     return false;
                 }
 
+                if (data->pnChunksDone)
+                    iCurChunk = ++(*data->pnChunksDone);
                 double dfCurCost =
                     double(data->nCurCost) + double(iCurChunk) / nChunkCount *
                                                  data->nTotalBytesThisArray;
@@ -3527,23 +3758,40 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             }
         };
 
-        CopyFunc copyFunc;
-        copyFunc.poDstArray = this;
-        copyFunc.nCurCost = nCurCost;
-        copyFunc.nTotalCost = nTotalCost;
-        copyFunc.nTotalBytesThisArray = GetTotalElementsCount() * nDTSize;
-        copyFunc.pfnProgress = pfnProgress;
-        copyFunc.pProgressData = pProgressData;
+        // Reading of the source array can be done by several threads, if it
+        // supports it. Writing is serialized.
+        const int nThreads = GetProcessPerChunkThreadCount(poSrcArray, nullptr);
+        std::mutex oMutex;
+        GUInt64 nChunksDone = 0;
+        std::vector<CopyFunc> aCopyFuncs(nThreads);
+        std::vector<void *> apCopyFuncs;
+        const GUInt64 nTotalBytesThisArray = GetTotalElementsCount() * nDTSize;
+        for (auto &copyFunc : aCopyFuncs)
+        {
+            copyFunc.poDstArray = this;
+            copyFunc.nCurCost = nCurCost;
+            copyFunc.nTotalCost = nTotalCost;
+            copyFunc.nTotalBytesThisArray = nTotalBytesThisArray;
+            copyFunc.pfnProgress = pfnProgress;
+            copyFunc.pProgressData = pProgressData;
+            if (nThreads > 1)
+            {
+                copyFunc.pMutex = &oMutex;
+                copyFunc.pnChunksDone = &nChunksDone;
+            }
+            apCopyFuncs.push_back(&copyFunc);
+        }
         const char *pszSwathSize =
             CPLGetConfigOption("GDAL_SWATH_SIZE", nullptr);
         const size_t nMaxChunkSize =
-            pszSwathSize
-                ? static_cast<size_t>(
-                      std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
-                               CPLAtoGIntBig(pszSwathSize)))
-                : static_cast<size_t>(
-                      std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
-                               GDALGetCacheMax64() / 4));
+            (pszSwathSize
+                 ? static_cast<size_t>(std::min(
+                       GIntBig(std::numeric_limits<size_t>::max() / 2),
+                       CPLAtoGIntBig(pszSwathSize)))
+                 : static_cast<size_t>(std::min(
+                       GIntBig(std::numeric_limits<size_t>::max() / 2),
+                       GDALGetCacheMax64() / 4))) /
+            nThreads;
         const auto anChunkSizes(GetProcessingChunkSize(nMaxChunkSize));
         size_t nRealChunkSize = nDTSize;
         for (const auto &nChunkSize : anChunkSizes)
@@ -3552,26 +3800,32 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
         }
         try
         {
-            copyFunc.abyTmp.resize(nRealChunkSize);
+            for (auto &copyFunc : aCopyFuncs)
+                copyFunc.abyTmp.resize(nRealChunkSize);
         }
         catch (const std::exception &)
         {
             CPLError(CE_Failure, CPLE_OutOfMemory,
                      "Cannot allocate temporary buffer");
-            nCurCost += copyFunc.nTotalBytesThisArray;
+            nCurCost += nTotalBytesThisArray;
             return false;
         }
-        if (copyFunc.nTotalBytesThisArray != 0 &&
+        if (nTotalBytesThisArray != 0 &&
             !const_cast<GDALMDArray *>(poSrcArray)
-                 ->ProcessPerChunk(arrayStartIdx.data(), count.data(),
-                                   anChunkSizes.data(), CopyFunc::f,
-                                   &copyFunc) &&
-            (bStrict || copyFunc.bStop))
+                 ->ProcessPerChunkMultiThreaded(
+                     arrayStartIdx.data(), count.data(), anChunkSizes.data(),
+                     CopyFunc::f, nThreads, apCopyFuncs.data()))
         {
-            nCurCost += copyFunc.nTotalBytesThisArray;
-            return false;
+            bool bStop = false;
+            for (const auto &copyFunc : aCopyFuncs)
+                bStop |= copyFunc.bStop;
+            if (bStrict || bStop)
+            {
+                nCurCost += nTotalBytesThisArray;
+                return false;
+            }
         }
-        nCurCost += copyFunc.nTotalBytesThisArray;
+        nCurCost += nTotalBytesThisArray;
     }
 
     return true;
@@ -6001,6 +6255,11 @@ class GDALMDArrayMask final : public GDALPamMDArray
         return false;
     }
 
+    bool IsReadThreadSafe() const override
+    {
+        return m_poParent->IsReadThreadSafe();
+    }
+
     const std::string &GetFilename() const override
     {
         return m_poParent->GetFilename();
@@ -7542,6 +7801,419 @@ std::shared_ptr<GDALMDArray> GDALMDArray::GetResampled(
                                         poTargetSRS, papszOptions);
 }
 
+/************************************************************************/
+/*                         GDALMDArrayReduced                           */
+/************************************************************************/
+
+class GDALMDArrayReduced final : public GDALPamMDArray
+{
+  public:
+    enum class Operation
+    {
+        SUM,
+        MEAN,
+        MIN,
+        MAX,
+    };
+
+  private:
+    std::shared_ptr<GDALMDArray> m_poParent{};
+    size_t m_iDim;
+    Operation m_eOp;
+    std::vector<std::shared_ptr<GDALDimension>> m_apoDims{};
+    GDALExtendedDataType m_dt{GDALExtendedDataType::Create(GDT_Float64)};
+    bool m_bHasNoData = false;
+    double m_dfNoData = std::numeric_limits<double>::quiet_NaN();
+
+  protected:
+    GDALMDArrayReduced(const std::shared_ptr<GDALMDArray> &poParent,
+                       size_t iDim, Operation eOp, const std::string &osName)
+        : GDALAbstractMDArray(std::string(), osName),
+          GDALPamMDArray(std::string(), osName, ::GetPAM(poParent)),
+          m_poParent(poParent), m_iDim(iDim), m_eOp(eOp)
+    {
+        const auto &apoParentDims = m_poParent->GetDimensions();
+        for (size_t i = 0; i < apoParentDims.size(); ++i)
+        {
+            if (i != m_iDim)
+                m_apoDims.push_back(apoParentDims[i]);
+        }
+        const void *pRawNoData = m_poParent->GetRawNoDataValue();
+        if (pRawNoData)
+        {
+            m_bHasNoData = true;
+            GDALExtendedDataType::CopyValue(
+                pRawNoData, m_poParent->GetDataType(), &m_dfNoData, m_dt);
+        }
+    }
+
+    bool IRead(const GUInt64 *arrayStartIdx, const size_t *count,
+               const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
+               const GDALExtendedDataType &bufferDataType,
+               void *pDstBuffer) const override;
+
+  public:
+    static std::shared_ptr<GDALMDArrayReduced>
+    Create(const std::shared_ptr<GDALMDArray> &poParent, size_t iDim,
+           Operation eOp, const std::string &osName)
+    {
+        auto newAr(std::shared_ptr<GDALMDArrayReduced>(
+            new GDALMDArrayReduced(poParent, iDim, eOp, osName)));
+        newAr->SetSelf(newAr);
+        return newAr;
+    }
+
+    bool IsWritable() const override
+    {
+        return false;
+    }
+
+    bool IsReadThreadSafe() const override
+    {
+        return m_poParent->IsReadThreadSafe();
+    }
+
+    const std::string &GetFilename() const override
+    {
+        return m_poParent->GetFilename();
+    }
+
+    const std::vector<std::shared_ptr<GDALDimension>> &
+    GetDimensions() const override
+    {
+        return m_apoDims;
+    }
+
+    const GDALExtendedDataType &GetDataType() const override
+    {
+        return m_dt;
+    }
+
+    const std::string &GetUnit() const override
+    {
+        return m_poParent->GetUnit();
+    }
+
+    std::shared_ptr<OGRSpatialReference> GetSpatialRef() const override
+    {
+        auto poSrcSRS = m_poParent->GetSpatialRef();
+        if (!poSrcSRS)
+            return nullptr;
+        auto srcMapping = poSrcSRS->GetDataAxisToSRSAxisMapping();
+        std::vector<int> dstMapping;
+        for (int srcAxis : srcMapping)
+        {
+            if (srcAxis - 1 == static_cast<int>(m_iDim))
+                dstMapping.push_back(0);
+            else if (srcAxis - 1 > static_cast<int>(m_iDim))
+                dstMapping.push_back(srcAxis - 1);
+            else
+                dstMapping.push_back(srcAxis);
+        }
+        auto poClone(std::shared_ptr<OGRSpatialReference>(poSrcSRS->Clone()));
+        poClone->SetDataAxisToSRSAxisMapping(dstMapping);
+        return poClone;
+    }
+
+    const void *GetRawNoDataValue() const override
+    {
+        return m_bHasNoData ? &m_dfNoData : nullptr;
+    }
+
+    std::vector<GUInt64> GetBlockSize() const override
+    {
+        auto anBlockSize = m_poParent->GetBlockSize();
+        if (m_iDim < anBlockSize.size())
+            anBlockSize.erase(anBlockSize.begin() + m_iDim);
+        return anBlockSize;
+    }
+};
+
+/************************************************************************/
+/*                         AccumulateReduction()                        */
+/************************************************************************/
+
+// Accumulates nVals values into padfAcc[] / padfCount[], skipping values
+// equal to dfNoData or NaN. Processes 2 values at a time with SSE2.
+template <GDALMDArrayReduced::Operation eOp>
+static void AccumulateReduction(double *padfAcc, double *padfCount,
+                                const double *padfVals, size_t nVals,
+                                double dfNoData)
+{
+    const auto noData = XMMReg2Double::Load1ValHighAndLow(&dfNoData);
+    constexpr double dfOne = 1.0;
+    const auto one = XMMReg2Double::Load1ValHighAndLow(&dfOne);
+    const auto zero = XMMReg2Double::Zero();
+    size_t i = 0;
+    for (; i + 1 < nVals; i += 2)
+    {
+        const auto vals = XMMReg2Double::Load2Val(padfVals + i);
+        const auto valid =
+            XMMReg2Double::And(XMMReg2Double::NotEquals(vals, noData),
+                               XMMReg2Double::Equals(vals, vals));
+        auto acc = XMMReg2Double::Load2Val(padfAcc + i);
+        if (eOp == GDALMDArrayReduced::Operation::MIN)
+        {
+            acc = XMMReg2Double::Ternary(valid, XMMReg2Double::Min(acc, vals),
+                                         acc);
+        }
+        else if (eOp == GDALMDArrayReduced::Operation::MAX)
+        {
+            acc = XMMReg2Double::Ternary(
+                XMMReg2Double::And(valid, XMMReg2Double::Greater(vals, acc)),
+                vals, acc);
+        }
+        else
+        {
+            acc += XMMReg2Double::Ternary(valid, vals, zero);
+        }
+        acc.Store2Val(padfAcc + i);
+        auto counts = XMMReg2Double::Load2Val(padfCount + i);
+        counts += XMMReg2Double::Ternary(valid, one, zero);
+        counts.Store2Val(padfCount + i);
+    }
+    for (; i < nVals; ++i)
+    {
+        const double dfVal = padfVals[i];
+        if (dfVal == dfNoData || std::isnan(dfVal))
+            continue;
+        if (eOp == GDALMDArrayReduced::Operation::MIN)
+            padfAcc[i] = std::min(padfAcc[i], dfVal);
+        else if (eOp == GDALMDArrayReduced::Operation::MAX)
+            padfAcc[i] = std::max(padfAcc[i], dfVal);
+        else
+            padfAcc[i] += dfVal;
+        padfCount[i] += 1;
+    }
+}
+
+/************************************************************************/
+/*                             IRead()                                  */
+/************************************************************************/
+
+bool GDALMDArrayReduced::IRead(const GUInt64 *arrayStartIdx,
+                               const size_t *count, const GInt64 *arrayStep,
+                               const GPtrDiff_t *bufferStride,
+                               const GDALExtendedDataType &bufferDataType,
+                               void *pDstBuffer) const
+{
+    const size_t nDims = m_apoDims.size();
+    size_t nOutElts = 1;
+    for (size_t i = 0; i < nDims; ++i)
+        nOutElts *= count[i];
+
+    // Read the source array by slabs along the reduced dimension, aligned
+    // on its block size, so that only the output-sized accumulators and
+    // a bounded temporary buffer are kept in memory.
+    const GUInt64 nReducedDimSize =
+        m_poParent->GetDimensions()[m_iDim]->GetSize();
+    const auto anParentBlockSize = m_poParent->GetBlockSize();
+    const GUInt64 nBlockSize =
+        std::max<GUInt64>(1, anParentBlockSize.empty()
+                                 ? 0
+                                 : anParentBlockSize[m_iDim]);
+    const char *pszSwathSize = CPLGetConfigOption("GDAL_SWATH_SIZE", nullptr);
+    const GUInt64 nMaxSlabMem =
+        pszSwathSize ? static_cast<GUInt64>(
+                           std::max<GIntBig>(0, CPLAtoGIntBig(pszSwathSize)))
+                     : static_cast<GUInt64>(GDALGetCacheMax64() / 4);
+    GUInt64 nSlabSize =
+        std::max<GUInt64>(1, nMaxSlabMem / (nOutElts * sizeof(double)));
+    if (nSlabSize > nBlockSize)
+        nSlabSize = (nSlabSize / nBlockSize) * nBlockSize;
+    nSlabSize = std::min(nSlabSize, std::max<GUInt64>(1, nReducedDimSize));
+    if (nSlabSize > std::numeric_limits<size_t>::max() / 2 / nOutElts)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Too large slab");
+        return false;
+    }
+
+    std::vector<double> adfAcc;
+    std::vector<double> adfCount;
+    std::vector<double> adfSlab;
+    try
+    {
+        adfAcc.resize(
+            nOutElts,
+            m_eOp == Operation::MIN   ? std::numeric_limits<double>::infinity()
+            : m_eOp == Operation::MAX ? -std::numeric_limits<double>::infinity()
+                                      : 0.0);
+        adfCount.resize(nOutElts);
+        adfSlab.resize(static_cast<size_t>(nSlabSize) * nOutElts);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+
+    const size_t nParentDims = nDims + 1;
+    std::vector<GUInt64> anSrcStartIdx(nParentDims);
+    std::vector<size_t> anSrcCount(nParentDims);
+    std::vector<GInt64> anSrcStep(nParentDims);
+    std::vector<GPtrDiff_t> anSrcStride(nParentDims);
+    GPtrDiff_t nStride = 1;
+    for (size_t i = nParentDims; i > 0;)
+    {
+        --i;
+        if (i == m_iDim)
+            continue;
+        const size_t iOut = i < m_iDim ? i : i - 1;
+        anSrcStartIdx[i] = arrayStartIdx[iOut];
+        anSrcCount[i] = count[iOut];
+        anSrcStep[i] = arrayStep[iOut];
+        anSrcStride[i] = nStride;
+        nStride *= static_cast<GPtrDiff_t>(count[iOut]);
+    }
+    // The reduced dimension is the slowest varying one in the slab buffer
+    anSrcStep[m_iDim] = 1;
+    anSrcStride[m_iDim] = static_cast<GPtrDiff_t>(nOutElts);
+
+    for (GUInt64 nStart = 0; nStart < nReducedDimSize; nStart += nSlabSize)
+    {
+        const size_t nCount =
+            static_cast<size_t>(std::min(nSlabSize, nReducedDimSize - nStart));
+        anSrcStartIdx[m_iDim] = nStart;
+        anSrcCount[m_iDim] = nCount;
+        if (!m_poParent->Read(anSrcStartIdx.data(), anSrcCount.data(),
+                              anSrcStep.data(), anSrcStride.data(), m_dt,
+                              adfSlab.data()))
+        {
+            return false;
+        }
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            const double *padfVals = adfSlab.data() + i * nOutElts;
+            switch (m_eOp)
+            {
+                case Operation::SUM:
+                case Operation::MEAN:
+                    AccumulateReduction<Operation::SUM>(
+                        adfAcc.data(), adfCount.data(), padfVals, nOutElts,
+                        m_dfNoData);
+                    break;
+                case Operation::MIN:
+                    AccumulateReduction<Operation::MIN>(
+                        adfAcc.data(), adfCount.data(), padfVals, nOutElts,
+                        m_dfNoData);
+                    break;
+                case Operation::MAX:
+                    AccumulateReduction<Operation::MAX>(
+                        adfAcc.data(), adfCount.data(), padfVals, nOutElts,
+                        m_dfNoData);
+                    break;
+            }
+        }
+    }
+
+    // Finalize values and copy them to the (strided) output buffer
+    const size_t nBufferDTSize = bufferDataType.GetSize();
+    std::vector<size_t> anIdx(nDims);
+    GByte *pabyDst = static_cast<GByte *>(pDstBuffer);
+    for (size_t i = 0; i < nOutElts; ++i)
+    {
+        double dfVal = adfAcc[i];
+        if (adfCount[i] == 0)
+            dfVal = m_dfNoData;
+        else if (m_eOp == Operation::MEAN)
+            dfVal /= adfCount[i];
+        GDALExtendedDataType::CopyValue(&dfVal, m_dt, pabyDst, bufferDataType);
+
+        for (size_t iDim = nDims; iDim > 0;)
+        {
+            --iDim;
+            const GPtrDiff_t nOffset =
+                bufferStride[iDim] * static_cast<GPtrDiff_t>(nBufferDTSize);
+            pabyDst += nOffset;
+            if (++anIdx[iDim] < count[iDim])
+                break;
+            pabyDst -= nOffset * static_cast<GPtrDiff_t>(count[iDim]);
+            anIdx[iDim] = 0;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                           GetReduced()                               */
+/************************************************************************/
+
+/** Return an array that is the reduction of the current array along one of
+ * its dimensions.
+ *
+ * The returned array has one dimension less than the current one, and is of
+ * type Float64. Each of its values is the result of the operation applied to
+ * the values of the current array along the reduced dimension. Values equal
+ * to the nodata value, or NaN, are ignored. If all values are ignored, the
+ * nodata value (or NaN if there is none) is returned.
+ *
+ * The returned array is a lazy view: the source array is read on the fly by
+ * slabs along the reduced dimension, whose size is aligned on the block size
+ * of that dimension and bounded by the GDAL_SWATH_SIZE configuration option
+ * (or a quarter of the block cache size), so that memory use is mostly
+ * proportional to the size of the requested output region.
+ *
+ * If the array has a scale or offset, the reduction operates on unscaled
+ * values.
+ *
+ * This is the same as the C function GDALMDArrayGetReduced().
+ *
+ * @param iDim Index of the dimension to reduce, between 0 and
+ *             GetDimensionCount() - 1.
+ * @param osOperation One of "sum", "mean", "min" or "max".
+ * @return a new array, that holds a reference to the original one, and thus is
+ * a view of it (not a copy), or nullptr in case of error.
+ * @since 3.7
+ */
+std::shared_ptr<GDALMDArray>
+GDALMDArray::GetReduced(size_t iDim, const std::string &osOperation) const
+{
+    auto self = std::dynamic_pointer_cast<GDALMDArray>(m_pSelf.lock());
+    if (!self)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Driver implementation issue: m_pSelf not set !");
+        return nullptr;
+    }
+    if (GetDataType().GetClass() != GEDTC_NUMERIC ||
+        GDALDataTypeIsComplex(GetDataType().GetNumericDataType()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GetReduced() only supports non-complex numeric data type");
+        return nullptr;
+    }
+    if (iDim >= GetDimensionCount())
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "GetReduced(): invalid dimension index");
+        return nullptr;
+    }
+    GDALMDArrayReduced::Operation eOp;
+    if (EQUAL(osOperation.c_str(), "sum"))
+        eOp = GDALMDArrayReduced::Operation::SUM;
+    else if (EQUAL(osOperation.c_str(), "mean"))
+        eOp = GDALMDArrayReduced::Operation::MEAN;
+    else if (EQUAL(osOperation.c_str(), "min"))
+        eOp = GDALMDArrayReduced::Operation::MIN;
+    else if (EQUAL(osOperation.c_str(), "max"))
+        eOp = GDALMDArrayReduced::Operation::MAX;
+    else
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "GetReduced(): unsupported operation '%s'",
+                 osOperation.c_str());
+        return nullptr;
+    }
+    auto poUnscaled = GetUnscaled();
+    if (!poUnscaled)
+        return nullptr;
+    const std::string osName(CPLSPrintf(
+        "%s of %s along %s", CPLString(osOperation).tolower().c_str(),
+        GetFullName().c_str(), GetDimensions()[iDim]->GetName().c_str()));
+    return GDALMDArrayReduced::Create(poUnscaled, iDim, eOp, osName);
+}
+
 /************************************************************************/
 /*                         GDALDatasetFromArray()                       */
 /************************************************************************/
@@ -8167,10 +8839,20 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
                                     GDALProgressFunc pfnProgress,
                                     void *pProgressData)
 {
+    // Shared by all threads
+    struct StatsProgressType
+    {
+        std::mutex oMutex{};
+        GUInt64 nChunksDone = 0;
+        GDALProgressFunc pfnProgress = nullptr;
+        void *pProgressData = nullptr;
+    };
+
+    // One instance per thread
     struct StatsPerChunkType
     {
         const GDALMDArray *array = nullptr;
-        std::shared_ptr<GDALMDArray> poMask{};
+        const GDALMDArray *poMask = nullptr;
         double dfMin = std::numeric_limits<double>::max();
         double dfMax = -std::numeric_limits<double>::max();
         double dfMean = 0.0;
@@ -8179,18 +8861,17 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
         std::vector<GByte> abyData{};
         std::vector<double> adfData{};
         std::vector<GByte> abyMaskData{};
-        GDALProgressFunc pfnProgress = nullptr;
-        void *pProgressData = nullptr;
+        StatsProgressType *psProgress = nullptr;
     };
 
     const auto PerChunkFunc = [](GDALAbstractMDArray *,
                                  const GUInt64 *chunkArrayStartIdx,
-                                 const size_t *chunkCount, GUInt64 iCurChunk,
+                                 const size_t *chunkCount, GUInt64,
                                  GUInt64 nChunkCount, void *pUserData)
     {
         StatsPerChunkType *data = static_cast<StatsPerChunkType *>(pUserData);
         const GDALMDArray *array = data->array;
-        const GDALMDArray *poMask = data->poMask.get();
+        const GDALMDArray *poMask = data->poMask;
         const size_t nDims = array->GetDimensionCount();
         size_t nVals = 1;
         for (size_t i = 0; i < nDims; i++)
@@ -8243,11 +8924,17 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
                 data->dfM2 += dfDelta * (dfValue - data->dfMean);
             }
         }
-        if (data->pfnProgress &&
-            !data->pfnProgress(static_cast<double>(iCurChunk + 1) / nChunkCount,
-                               "", data->pProgressData))
+        StatsProgressType *psProgress = data->psProgress;
+        if (psProgress->pfnProgress)
         {
-            return false;
+            std::lock_guard<std::mutex> oLock(psProgress->oMutex);
+            ++psProgress->nChunksDone;
+            if (!psProgress->pfnProgress(
+                    static_cast<double>(psProgress->nChunksDone) / nChunkCount,
+                    "", psProgress->pProgressData))
+            {
+                return false;
+            }
         }
         return true;
     };
@@ -8270,29 +8957,61 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
     {
         count[i] = poDims[i]->GetSize();
     }
+    const auto poMask = GetMask(nullptr);
+    if (poMask == nullptr)
+    {
+        return false;
+    }
+    const int nThreads = GetProcessPerChunkThreadCount(this, poMask.get());
+
     const char *pszSwathSize = CPLGetConfigOption("GDAL_SWATH_SIZE", nullptr);
+    // Each thread uses its own buffers
     const size_t nMaxChunkSize =
-        pszSwathSize
-            ? static_cast<size_t>(
-                  std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
-                           CPLAtoGIntBig(pszSwathSize)))
-            : static_cast<size_t>(
-                  std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
-                           GDALGetCacheMax64() / 4));
-    StatsPerChunkType sData;
-    sData.array = this;
-    sData.poMask = GetMask(nullptr);
-    if (sData.poMask == nullptr)
+        (pszSwathSize
+             ? static_cast<size_t>(
+                   std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
+                            CPLAtoGIntBig(pszSwathSize)))
+             : static_cast<size_t>(
+                   std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
+                            GDALGetCacheMax64() / 4))) /
+        nThreads;
+    StatsProgressType sProgress;
+    sProgress.pfnProgress = pfnProgress;
+    sProgress.pProgressData = pProgressData;
+    std::vector<StatsPerChunkType> asData(nThreads);
+    std::vector<void *> apData;
+    for (auto &sThreadData : asData)
+    {
+        sThreadData.array = this;
+        sThreadData.poMask = poMask.get();
+        sThreadData.psProgress = &sProgress;
+        apData.push_back(&sThreadData);
+    }
+    if (!ProcessPerChunkMultiThreaded(
+            arrayStartIdx.data(), count.data(),
+            GetProcessingChunkSize(nMaxChunkSize).data(), PerChunkFunc,
+            nThreads, apData.data()))
     {
         return false;
     }
-    sData.pfnProgress = pfnProgress;
-    sData.pProgressData = pProgressData;
-    if (!ProcessPerChunk(arrayStartIdx.data(), count.data(),
-                         GetProcessingChunkSize(nMaxChunkSize).data(),
-                         PerChunkFunc, &sData))
+
+    // Merge the statistics of the different threads
+    StatsPerChunkType &sData = asData[0];
+    for (int i = 1; i < nThreads; ++i)
     {
-        return false;
+        const StatsPerChunkType &sOther = asData[i];
+        if (sOther.nValidCount == 0)
+            continue;
+        sData.dfMin = std::min(sData.dfMin, sOther.dfMin);
+        sData.dfMax = std::max(sData.dfMax, sOther.dfMax);
+        const double dfCountA = static_cast<double>(sData.nValidCount);
+        const double dfCountB = static_cast<double>(sOther.nValidCount);
+        const double dfCount = dfCountA + dfCountB;
+        const double dfDelta = sOther.dfMean - sData.dfMean;
+        sData.dfMean += dfDelta * dfCountB / dfCount;
+        sData.dfM2 +=
+            sOther.dfM2 + dfDelta * dfDelta * dfCountA * dfCountB / dfCount;
+        sData.nValidCount += sOther.nValidCount;
     }
 
     if (pdfMin)
@@ -10641,6 +11360,33 @@ GDALMDArrayH GDALMDArrayGetResampled(GDALMDArrayH hArray, size_t nNewDimCount,
     return new GDALMDArrayHS(poNewArray);
 }
 
+/************************************************************************/
+/*                      GDALMDArrayGetReduced()                         */
+/************************************************************************/
+
+/** Return an array that is the reduction of the current array along one of
+ * its dimensions.
+ *
+ * This is the same as the C++ method GDALMDArray::GetReduced().
+ *
+ * The returned object should be released with GDALMDArrayRelease().
+ *
+ * @param hArray Array.
+ * @param iDim Index of the dimension to reduce.
+ * @param pszOperation One of "sum", "mean", "min" or "max".
+ * @since 3.7
+ */
+GDALMDArrayH GDALMDArrayGetReduced(GDALMDArrayH hArray, size_t iDim,
+                                   const char *pszOperation)
+{
+    VALIDATE_POINTER1(hArray, __func__, nullptr);
+    VALIDATE_POINTER1(pszOperation, __func__, nullptr);
+    auto poNewArray = hArray->m_poImpl->GetReduced(iDim, pszOperation);
+    if (!poNewArray)
+        return nullptr;
+    return new GDALMDArrayHS(poNewArray);
+}
+
 /************************************************************************/
 /*                      GDALMDArraySetUnit()                            */
 /************************************************************************/
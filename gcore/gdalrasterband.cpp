@@ -43,6 +43,7 @@
 #include <memory>
 #include <new>
 #include <type_traits>
+#include <utility>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -8705,3 +8706,356 @@ std::shared_ptr<GDALMDArray> GDALRasterBand::AsMDArray() const
     return GDALMDArrayFromRasterBand::Create(
         poDS, const_cast<GDALRasterBand *>(this));
 }
+
+/************************************************************************/
+/*                     GetInterpolationPixelValue()                     */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+static inline double GetInterpolationPixelValue(const void *pData,
+                                                GDALDataType eDT,
+                                                size_t nOffset)
+{
+    switch (eDT)
+    {
+        case GDT_Byte:
+            return static_cast<const GByte *>(pData)[nOffset];
+        case GDT_Int8:
+            return static_cast<const GInt8 *>(pData)[nOffset];
+        case GDT_UInt16:
+            return static_cast<const GUInt16 *>(pData)[nOffset];
+        case GDT_Int16:
+            return static_cast<const GInt16 *>(pData)[nOffset];
+        case GDT_UInt32:
+            return static_cast<const GUInt32 *>(pData)[nOffset];
+        case GDT_Int32:
+            return static_cast<const GInt32 *>(pData)[nOffset];
+        case GDT_UInt64:
+            return static_cast<double>(
+                static_cast<const std::uint64_t *>(pData)[nOffset]);
+        case GDT_Int64:
+            return static_cast<double>(
+                static_cast<const std::int64_t *>(pData)[nOffset]);
+        case GDT_Float32:
+            return static_cast<const float *>(pData)[nOffset];
+        case GDT_Float64:
+            return static_cast<const double *>(pData)[nOffset];
+        default:
+            break;
+    }
+    // Complex types: real part
+    double dfVal = 0;
+    GDALCopyWords(static_cast<const GByte *>(pData) +
+                      nOffset * GDALGetDataTypeSizeBytes(eDT),
+                  eDT, 0, &dfVal, GDT_Float64, 0, 1);
+    return dfVal;
+}
+
+/************************************************************************/
+/*                       GDALCubicKernelWeight()                        */
+/************************************************************************/
+
+// Cubic convolution kernel with a = -0.5, as used by GRIORA_Cubic
+static inline double GDALCubicKernelWeight(double dfX)
+{
+    dfX = std::fabs(dfX);
+    if (dfX <= 1.0)
+        return (1.5 * dfX - 2.5) * dfX * dfX + 1.0;
+    if (dfX < 2.0)
+        return ((-0.5 * dfX + 2.5) * dfX - 4.0) * dfX + 2.0;
+    return 0.0;
+}
+//! @endcond
+
+/************************************************************************/
+/*                        InterpolateAtPoints()                         */
+/************************************************************************/
+
+/**
+ * \brief Interpolate the band values at a set of points.
+ *
+ * Point coordinates are expressed in pixel/line space of the band, with the
+ * pixel-is-area convention: the center of the top-left pixel is at
+ * (0.5, 0.5).
+ *
+ * Points are sorted by the block they fall in, so that each block is read
+ * only once from the block cache, whatever the order of the points. This is
+ * much faster than issuing one RasterIO() request per point when sampling
+ * many locations.
+ *
+ * With GRIORA_NearestNeighbour, the value of the pixel containing the point
+ * is returned. With GRIORA_Bilinear and GRIORA_Cubic, the 2x2 or 4x4 pixels
+ * around the point are combined, replicating edge pixels near the raster
+ * borders. Pixels equal to the nodata value (or NaN) are then ignored, and
+ * the weights of the valid pixels renormalized.
+ *
+ * For complex data types, the real part of the values is used.
+ *
+ * This method is the same as the C function GDALRasterInterpolateAtPoints().
+ *
+ * @param nPointCount Number of points.
+ * @param padfPixel Array of nPointCount pixel (column) coordinates.
+ * @param padfLine Array of nPointCount line (row) coordinates.
+ * @param eResampleAlg GRIORA_NearestNeighbour, GRIORA_Bilinear or
+ *                     GRIORA_Cubic.
+ * @param padfValues Array of nPointCount values, set to the interpolated
+ *                   values, or 0 for points where interpolation failed.
+ * @param pabSuccess Array of nPointCount values, set to TRUE for points
+ *                   inside the raster where the interpolation succeeded,
+ *                   FALSE otherwise. May be NULL.
+ *
+ * @return CE_None on success, CE_Failure if an unsupported algorithm is
+ * requested or if a block could not be read. In the latter case, the other
+ * points are still interpolated, and only the ones depending on that block
+ * are flagged as failed in pabSuccess.
+ *
+ * @since GDAL 3.7
+ */
+CPLErr GDALRasterBand::InterpolateAtPoints(size_t nPointCount,
+                                           const double *padfPixel,
+                                           const double *padfLine,
+                                           GDALRIOResampleAlg eResampleAlg,
+                                           double *padfValues, int *pabSuccess)
+{
+    for (size_t i = 0; i < nPointCount; ++i)
+    {
+        padfValues[i] = 0;
+        if (pabSuccess)
+            pabSuccess[i] = FALSE;
+    }
+
+    int nKernelRadius;
+    switch (eResampleAlg)
+    {
+        case GRIORA_NearestNeighbour:
+            nKernelRadius = 0;
+            break;
+        case GRIORA_Bilinear:
+            nKernelRadius = 1;
+            break;
+        case GRIORA_Cubic:
+            nKernelRadius = 2;
+            break;
+        default:
+            ReportError(CE_Failure, CPLE_NotSupported,
+                        "InterpolateAtPoints(): only nearest, bilinear and "
+                        "cubic resampling are supported");
+            return CE_Failure;
+    }
+
+    int bHasNoData = FALSE;
+    const double dfNoData = GetNoDataValue(&bHasNoData);
+    const auto IsValid = [bHasNoData, dfNoData](double dfVal)
+    {
+        return !std::isnan(dfVal) &&
+               !(bHasNoData && ARE_REAL_EQUAL(dfVal, dfNoData));
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Compute the anchor pixel of each point, that is the pixel       */
+    /*      containing it for nearest neighbour, or the top-left pixel of   */
+    /*      the central 2x2 pixels of the kernel otherwise, and sort the    */
+    /*      points by the block of that pixel.                              */
+    /* -------------------------------------------------------------------- */
+    struct PointRef
+    {
+        size_t nIdx;
+        int nBlockX;
+        int nBlockY;
+    };
+    std::vector<PointRef> asPoints;
+    try
+    {
+        asPoints.reserve(nPointCount);
+    }
+    catch (const std::bad_alloc &)
+    {
+        ReportError(CE_Failure, CPLE_OutOfMemory,
+                    "InterpolateAtPoints(): out of memory");
+        return CE_Failure;
+    }
+
+    const double dfShift = nKernelRadius == 0 ? 0.0 : 0.5;
+    for (size_t i = 0; i < nPointCount; ++i)
+    {
+        if (!(padfPixel[i] >= 0 && padfPixel[i] < nRasterXSize &&
+              padfLine[i] >= 0 && padfLine[i] < nRasterYSize))
+            continue;
+        const int nX = std::max(
+            0, static_cast<int>(std::floor(padfPixel[i] - dfShift)));
+        const int nY =
+            std::max(0, static_cast<int>(std::floor(padfLine[i] - dfShift)));
+        asPoints.push_back({i, nX / nBlockXSize, nY / nBlockYSize});
+    }
+    std::sort(asPoints.begin(), asPoints.end(),
+              [](const PointRef &a, const PointRef &b)
+              {
+                  return a.nBlockY < b.nBlockY ||
+                         (a.nBlockY == b.nBlockY && a.nBlockX < b.nBlockX);
+              });
+
+    /* -------------------------------------------------------------------- */
+    /*      Keep the blocks needed by the points of the current anchor      */
+    /*      block locked, so that kernels crossing block boundaries do not  */
+    /*      look them up again.                                             */
+    /* -------------------------------------------------------------------- */
+    std::vector<GDALRasterBlock *> apoLockedBlocks;
+    // Blocks that could not be read, not to retry them for each point
+    std::vector<std::pair<int, int>> aoFailedBlocks;
+    const auto ReleaseBlocks = [&apoLockedBlocks]()
+    {
+        for (auto poBlock : apoLockedBlocks)
+            poBlock->DropLock();
+        apoLockedBlocks.clear();
+    };
+    const auto GetBlockData =
+        [this, &apoLockedBlocks, &aoFailedBlocks](int nBlockX,
+                                                  int nBlockY) -> void *
+    {
+        for (auto poBlock : apoLockedBlocks)
+        {
+            if (poBlock->GetXOff() == nBlockX && poBlock->GetYOff() == nBlockY)
+                return poBlock->GetDataRef();
+        }
+        if (std::find(aoFailedBlocks.begin(), aoFailedBlocks.end(),
+                      std::make_pair(nBlockX, nBlockY)) != aoFailedBlocks.end())
+            return nullptr;
+        GDALRasterBlock *poBlock = GetLockedBlockRef(nBlockX, nBlockY);
+        if (poBlock == nullptr)
+        {
+            aoFailedBlocks.emplace_back(nBlockX, nBlockY);
+            return nullptr;
+        }
+        apoLockedBlocks.push_back(poBlock);
+        return poBlock->GetDataRef();
+    };
+
+    const int nKernelSize = std::max(1, 2 * nKernelRadius);
+    std::vector<double> adfWeightsX(nKernelSize), adfWeightsY(nKernelSize);
+    std::vector<int> anX(nKernelSize), anY(nKernelSize);
+
+    CPLErr eErr = CE_None;
+    int nCurBlockX = -1;
+    int nCurBlockY = -1;
+    for (const auto &sPoint : asPoints)
+    {
+        if (sPoint.nBlockX != nCurBlockX || sPoint.nBlockY != nCurBlockY)
+        {
+            ReleaseBlocks();
+            nCurBlockX = sPoint.nBlockX;
+            nCurBlockY = sPoint.nBlockY;
+        }
+
+        const size_t i = sPoint.nIdx;
+        if (nKernelRadius == 0)
+        {
+            anX[0] = static_cast<int>(padfPixel[i]);
+            anY[0] = static_cast<int>(padfLine[i]);
+            adfWeightsX[0] = 1.0;
+            adfWeightsY[0] = 1.0;
+        }
+        else
+        {
+            const double dfX = padfPixel[i] - 0.5;
+            const double dfY = padfLine[i] - 0.5;
+            const int nX0 = static_cast<int>(std::floor(dfX));
+            const int nY0 = static_cast<int>(std::floor(dfY));
+            const double dfFracX = dfX - nX0;
+            const double dfFracY = dfY - nY0;
+            for (int k = 0; k < nKernelSize; ++k)
+            {
+                // Kernel offsets are 0,1 for bilinear, -1,0,1,2 for cubic
+                const int nOff = k - nKernelRadius + 1;
+                anX[k] = std::min(std::max(nX0 + nOff, 0), nRasterXSize - 1);
+                anY[k] = std::min(std::max(nY0 + nOff, 0), nRasterYSize - 1);
+                if (nKernelRadius == 1)
+                {
+                    adfWeightsX[k] = nOff == 0 ? 1.0 - dfFracX : dfFracX;
+                    adfWeightsY[k] = nOff == 0 ? 1.0 - dfFracY : dfFracY;
+                }
+                else
+                {
+                    adfWeightsX[k] = GDALCubicKernelWeight(dfFracX - nOff);
+                    adfWeightsY[k] = GDALCubicKernelWeight(dfFracY - nOff);
+                }
+            }
+        }
+
+        double dfSum = 0;
+        double dfWeightSum = 0;
+        bool bValid = nKernelRadius == 0;
+        bool bReadError = false;
+        for (int iY = 0; iY < nKernelSize && !bReadError; ++iY)
+        {
+            const int nBlockY = anY[iY] / nBlockYSize;
+            const size_t nLineOffset =
+                static_cast<size_t>(anY[iY] - nBlockY * nBlockYSize) *
+                nBlockXSize;
+            for (int iX = 0; iX < nKernelSize; ++iX)
+            {
+                const int nBlockX = anX[iX] / nBlockXSize;
+                const void *pData = GetBlockData(nBlockX, nBlockY);
+                if (pData == nullptr)
+                {
+                    bReadError = true;
+                    break;
+                }
+                const double dfVal = GetInterpolationPixelValue(
+                    pData, eDataType,
+                    nLineOffset + (anX[iX] - nBlockX * nBlockXSize));
+                if (nKernelRadius == 0)
+                {
+                    dfSum = dfVal;
+                    dfWeightSum = 1.0;
+                }
+                else if (IsValid(dfVal))
+                {
+                    const double dfWeight = adfWeightsX[iX] * adfWeightsY[iY];
+                    dfSum += dfWeight * dfVal;
+                    dfWeightSum += dfWeight;
+                    bValid = true;
+                }
+            }
+        }
+        if (bReadError)
+        {
+            // Only the points depending on the unreadable block fail
+            eErr = CE_Failure;
+            continue;
+        }
+
+        if (bValid && std::fabs(dfWeightSum) > 1e-10)
+        {
+            padfValues[i] = dfSum / dfWeightSum;
+            if (pabSuccess)
+                pabSuccess[i] = TRUE;
+        }
+    }
+    ReleaseBlocks();
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                   GDALRasterInterpolateAtPoints()                    */
+/************************************************************************/
+
+/**
+ * \brief Interpolate the band values at a set of points.
+ *
+ * This is the same as the C++ method GDALRasterBand::InterpolateAtPoints().
+ *
+ * @since GDAL 3.7
+ */
+CPLErr GDALRasterInterpolateAtPoints(GDALRasterBandH hBand, size_t nPointCount,
+                                     const double *padfPixel,
+                                     const double *padfLine,
+                                     GDALRIOResampleAlg eResampleAlg,
+                                     double *padfValues, int *pabSuccess)
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterInterpolateAtPoints", CE_Failure);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    return poBand->InterpolateAtPoints(nPointCount, padfPixel, padfLine,
+                                       eResampleAlg, padfValues, pabSuccess);
+}
@@ -0,0 +1,520 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Dataset and raster band classes returned by GDALOpenEx() with
+ *           GDAL_OF_THREAD_SAFE, safe for concurrent read access.
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdal_proxy.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "gdal.h"
+#include "gdal_priv.h"
+
+/*! @cond Doxygen_Suppress */
+
+// The GDALDataset and GDALRasterBand objects of drivers are not safe for
+// concurrent use. The classes below expose the raster structure (dimensions,
+// bands, data types, block sizes, overviews, masks) of a prototype dataset,
+// and forward each request to a dataset opened by the calling thread on its
+// first access, and kept open until the thread-safe dataset is closed.
+// Blocks read by the per-thread datasets all go through the global block
+// cache, whose size limit is thus shared.
+
+class GDALThreadSafeRasterBand;
+
+/* ******************************************************************** */
+/*                        GDALThreadSafeDataset                         */
+/* ******************************************************************** */
+
+class GDALThreadSafeDataset final : public GDALProxyDataset
+{
+    friend class GDALThreadSafeRasterBand;
+
+    const std::string m_osFilename;
+    const unsigned m_nOpenFlags;
+    CPLStringList m_aosAllowedDrivers{};
+    CPLStringList m_aosOpenOptions{};
+
+    mutable std::mutex m_oMutex{};
+    mutable std::map<std::thread::id, std::unique_ptr<GDALDataset>>
+        m_oMapThreadToDataset{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadSafeDataset)
+
+  protected:
+    GDALDataset *RefUnderlyingDataset() const override;
+
+    CPLErr IBuildOverviews(const char *, int, const int *, int, const int *,
+                           GDALProgressFunc, void *,
+                           CSLConstList papszOptions) override;
+
+  public:
+    GDALThreadSafeDataset(GDALDataset *poPrototypeDS, const char *pszFilename,
+                          unsigned nOpenFlagsIn,
+                          CSLConstList papszOpenOptionsIn);
+
+    CPLErr FlushCache(bool bAtClosing) override;
+
+    CPLErr SetMetadata(char **papszMetadata, const char *pszDomain) override;
+    CPLErr SetMetadataItem(const char *pszName, const char *pszValue,
+                           const char *pszDomain) override;
+    CPLErr SetSpatialRef(const OGRSpatialReference *poSRS) override;
+    CPLErr SetGeoTransform(double *) override;
+    CPLErr SetGCPs(int nGCPCount, const GDAL_GCP *pasGCPList,
+                   const OGRSpatialReference *poGCP_SRS) override;
+    CPLErr CreateMaskBand(int nFlags) override;
+};
+
+/* ******************************************************************** */
+/*                       GDALThreadSafeRasterBand                       */
+/* ******************************************************************** */
+
+class GDALThreadSafeRasterBand final : public GDALProxyRasterBand
+{
+    GDALThreadSafeDataset *const m_poTSDS;
+    const int m_nBandNumber;
+    const int m_iOverview;  // -1 for a full resolution band
+    const bool m_bIsMask;
+    const int m_iMaskOverview;  // -1 unless an overview of a mask band
+    std::vector<std::unique_ptr<GDALThreadSafeRasterBand>> m_apoOverviews{};
+    std::unique_ptr<GDALThreadSafeRasterBand> m_poMaskBand{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadSafeRasterBand)
+
+    static CPLErr ReadOnlyError();
+
+  protected:
+    GDALRasterBand *
+    RefUnderlyingRasterBand(bool bForceOpen = true) const override;
+
+    CPLErr IWriteBlock(int, int, void *) override;
+
+  public:
+    GDALThreadSafeRasterBand(GDALThreadSafeDataset *poTSDS,
+                             GDALRasterBand *poPrototypeBand, int nBandNumber,
+                             int iOverview, bool bIsMask,
+                             int iMaskOverview = -1);
+
+    CPLErr FlushCache(bool bAtClosing) override;
+
+    int GetOverviewCount() override;
+    GDALRasterBand *GetOverview(int) override;
+    GDALRasterBand *GetRasterSampleOverview(GUIntBig) override;
+    GDALRasterBand *GetMaskBand() override;
+
+    CPLErr SetMetadata(char **papszMetadata, const char *pszDomain) override;
+    CPLErr SetMetadataItem(const char *pszName, const char *pszValue,
+                           const char *pszDomain) override;
+    CPLErr Fill(double dfRealValue, double dfImaginaryValue = 0) override;
+    CPLErr SetCategoryNames(char **) override;
+    CPLErr SetNoDataValue(double) override;
+    CPLErr DeleteNoDataValue() override;
+    CPLErr SetColorTable(GDALColorTable *) override;
+    CPLErr SetColorInterpretation(GDALColorInterp) override;
+    CPLErr SetOffset(double) override;
+    CPLErr SetScale(double) override;
+    CPLErr SetUnitType(const char *) override;
+    CPLErr SetStatistics(double dfMin, double dfMax, double dfMean,
+                         double dfStdDev) override;
+    CPLErr SetDefaultHistogram(double dfMin, double dfMax, int nBuckets,
+                               GUIntBig *panHistogram) override;
+    CPLErr SetDefaultRAT(const GDALRasterAttributeTable *) override;
+    CPLErr CreateMaskBand(int nFlags) override;
+    CPLErr BuildOverviews(const char *, int, const int *, GDALProgressFunc,
+                          void *, CSLConstList papszOptions) override;
+};
+
+/************************************************************************/
+/*                        GDALThreadSafeDataset()                       */
+/************************************************************************/
+
+GDALThreadSafeDataset::GDALThreadSafeDataset(GDALDataset *poPrototypeDS,
+                                             const char *pszFilename,
+                                             unsigned nOpenFlagsIn,
+                                             CSLConstList papszOpenOptionsIn)
+    : m_osFilename(pszFilename), m_nOpenFlags(nOpenFlagsIn),
+      m_aosOpenOptions(CSLDuplicate(papszOpenOptionsIn))
+{
+    SetDescription(pszFilename);
+    eAccess = GA_ReadOnly;
+    nRasterXSize = poPrototypeDS->GetRasterXSize();
+    nRasterYSize = poPrototypeDS->GetRasterYSize();
+    poDriver = poPrototypeDS->GetDriver();
+    if (poDriver)
+    {
+        // Per-thread opens do not need to probe other drivers
+        m_aosAllowedDrivers.AddString(poDriver->GetDescription());
+    }
+
+    for (int i = 1; i <= poPrototypeDS->GetRasterCount(); ++i)
+    {
+        SetBand(i, new GDALThreadSafeRasterBand(
+                       this, poPrototypeDS->GetRasterBand(i), i, -1, false));
+    }
+
+    // The prototype dataset becomes the one of the opening thread.
+    m_oMapThreadToDataset[std::this_thread::get_id()].reset(poPrototypeDS);
+}
+
+/************************************************************************/
+/*                       RefUnderlyingDataset()                         */
+/************************************************************************/
+
+GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
+{
+    const auto nThreadId = std::this_thread::get_id();
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const auto oIter = m_oMapThreadToDataset.find(nThreadId);
+        if (oIter != m_oMapThreadToDataset.end())
+            return oIter->second.get();
+    }
+
+    // Do not hold the mutex while opening, so that threads accessing the
+    // dataset for the first time do not wait for each other.
+    std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+        m_osFilename.c_str(), m_nOpenFlags, m_aosAllowedDrivers.List(),
+        m_aosOpenOptions.List()));
+    if (!poDS)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot open %s in thread-safe dataset",
+                 m_osFilename.c_str());
+        return nullptr;
+    }
+    if (poDS->GetRasterXSize() != nRasterXSize ||
+        poDS->GetRasterYSize() != nRasterYSize ||
+        poDS->GetRasterCount() != nBands)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s has been modified since it has been opened as a "
+                 "thread-safe dataset",
+                 m_osFilename.c_str());
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    auto &poSlot = m_oMapThreadToDataset[nThreadId];
+    poSlot = std::move(poDS);
+    return poSlot.get();
+}
+
+/************************************************************************/
+/*                            FlushCache()                              */
+/************************************************************************/
+
+CPLErr GDALThreadSafeDataset::FlushCache(bool bAtClosing)
+{
+    // Do not forward to the per-thread datasets, that may be in use by
+    // other threads.
+    return GDALDataset::FlushCache(bAtClosing);
+}
+
+/************************************************************************/
+/*                        Read-only restrictions                        */
+/************************************************************************/
+
+static CPLErr GDALThreadSafeReadOnlyError()
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Thread-safe datasets are read-only");
+    return CE_Failure;
+}
+
+CPLErr GDALThreadSafeDataset::IBuildOverviews(const char *, int, const int *,
+                                              int, const int *,
+                                              GDALProgressFunc, void *,
+                                              CSLConstList)
+{
+    return GDALThreadSafeReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::SetMetadata(char **, const char *)
+{
+    return GDALThreadSafeReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::SetMetadataItem(const char *, const char *,
+                                              const char *)
+{
+    return GDALThreadSafeReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::SetSpatialRef(const OGRSpatialReference *)
+{
+    return GDALThreadSafeReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::SetGeoTransform(double *)
+{
+    return GDALThreadSafeReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::SetGCPs(int, const GDAL_GCP *,
+                                      const OGRSpatialReference *)
+{
+    return GDALThreadSafeReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::CreateMaskBand(int)
+{
+    return GDALThreadSafeReadOnlyError();
+}
+
+/************************************************************************/
+/*                      GDALThreadSafeRasterBand()                      */
+/************************************************************************/
+
+GDALThreadSafeRasterBand::GDALThreadSafeRasterBand(
+    GDALThreadSafeDataset *poTSDS, GDALRasterBand *poPrototypeBand,
+    int nBandNumber, int iOverview, bool bIsMask, int iMaskOverview)
+    : m_poTSDS(poTSDS), m_nBandNumber(nBandNumber), m_iOverview(iOverview),
+      m_bIsMask(bIsMask), m_iMaskOverview(iMaskOverview)
+{
+    // Only full resolution bands are attached to the dataset, as in drivers
+    // overview and mask bands generally belong to another dataset.
+    if (iOverview < 0 && !bIsMask)
+    {
+        poDS = poTSDS;
+        nBand = nBandNumber;
+    }
+    eAccess = GA_ReadOnly;
+    nRasterXSize = poPrototypeBand->GetXSize();
+    nRasterYSize = poPrototypeBand->GetYSize();
+    eDataType = poPrototypeBand->GetRasterDataType();
+    poPrototypeBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+
+    // Overviews of the full resolution mask bands are exposed too, so that
+    // callers never get a band of the prototype or per-thread datasets.
+    if (iOverview < 0 && iMaskOverview < 0)
+    {
+        const int nOverviews = poPrototypeBand->GetOverviewCount();
+        for (int i = 0; i < nOverviews; ++i)
+        {
+            auto poOvrBand = poPrototypeBand->GetOverview(i);
+            if (poOvrBand == nullptr)
+                break;
+            m_apoOverviews.emplace_back(
+                bIsMask ? cpl::make_unique<GDALThreadSafeRasterBand>(
+                              poTSDS, poOvrBand, nBandNumber, -1, true, i)
+                        : cpl::make_unique<GDALThreadSafeRasterBand>(
+                              poTSDS, poOvrBand, nBandNumber, i, false));
+        }
+    }
+
+    if (!bIsMask)
+    {
+        auto poMaskBand = poPrototypeBand->GetMaskBand();
+        if (poMaskBand)
+        {
+            m_poMaskBand = cpl::make_unique<GDALThreadSafeRasterBand>(
+                poTSDS, poMaskBand, nBandNumber, iOverview, true);
+        }
+    }
+}
+
+/************************************************************************/
+/*                      RefUnderlyingRasterBand()                       */
+/************************************************************************/
+
+GDALRasterBand *
+GDALThreadSafeRasterBand::RefUnderlyingRasterBand(bool /*bForceOpen*/) const
+{
+    auto poUnderlyingDS = m_poTSDS->RefUnderlyingDataset();
+    if (poUnderlyingDS == nullptr)
+        return nullptr;
+    auto poBand = poUnderlyingDS->GetRasterBand(m_nBandNumber);
+    if (poBand && m_iOverview >= 0)
+        poBand = poBand->GetOverview(m_iOverview);
+    if (poBand && m_bIsMask)
+        poBand = poBand->GetMaskBand();
+    if (poBand && m_iMaskOverview >= 0)
+        poBand = poBand->GetOverview(m_iMaskOverview);
+    return poBand;
+}
+
+/************************************************************************/
+/*                            FlushCache()                              */
+/************************************************************************/
+
+CPLErr GDALThreadSafeRasterBand::FlushCache(bool bAtClosing)
+{
+    return GDALRasterBand::FlushCache(bAtClosing);
+}
+
+/************************************************************************/
+/*                      Overviews and mask band                         */
+/************************************************************************/
+
+int GDALThreadSafeRasterBand::GetOverviewCount()
+{
+    return static_cast<int>(m_apoOverviews.size());
+}
+
+GDALRasterBand *GDALThreadSafeRasterBand::GetOverview(int i)
+{
+    if (i < 0 || i >= static_cast<int>(m_apoOverviews.size()))
+        return nullptr;
+    return m_apoOverviews[i].get();
+}
+
+GDALRasterBand *GDALThreadSafeRasterBand::GetRasterSampleOverview(GUIntBig n)
+{
+    // The base implementation relies on GetOverview(), and will thus
+    // return one of our bands.
+    return GDALRasterBand::GetRasterSampleOverview(n);
+}
+
+GDALRasterBand *GDALThreadSafeRasterBand::GetMaskBand()
+{
+    if (m_poMaskBand)
+        return m_poMaskBand.get();
+    return GDALProxyRasterBand::GetMaskBand();
+}
+
+/************************************************************************/
+/*                        Read-only restrictions                        */
+/************************************************************************/
+
+CPLErr GDALThreadSafeRasterBand::ReadOnlyError()
+{
+    return GDALThreadSafeReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::IWriteBlock(int, int, void *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetMetadata(char **, const char *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetMetadataItem(const char *, const char *,
+                                                 const char *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::Fill(double, double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetCategoryNames(char **)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetNoDataValue(double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::DeleteNoDataValue()
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetColorTable(GDALColorTable *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetColorInterpretation(GDALColorInterp)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetOffset(double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetScale(double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetUnitType(const char *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetStatistics(double, double, double, double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetDefaultHistogram(double, double, int,
+                                                     GUIntBig *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetDefaultRAT(const GDALRasterAttributeTable *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::CreateMaskBand(int)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::BuildOverviews(const char *, int, const int *,
+                                                GDALProgressFunc, void *,
+                                                CSLConstList)
+{
+    return ReadOnlyError();
+}
+
+/************************************************************************/
+/*                    GDALCreateThreadSafeDataset()                     */
+/************************************************************************/
+
+// Takes ownership of poPrototypeDS, which must have been opened in read-only
+// mode by the calling thread with nOpenFlags and papszOpenOptions.
+GDALDataset *GDALCreateThreadSafeDataset(GDALDataset *poPrototypeDS,
+                                         const char *pszFilename,
+                                         unsigned nOpenFlags,
+                                         CSLConstList papszOpenOptions)
+{
+    return new GDALThreadSafeDataset(poPrototypeDS, pszFilename, nOpenFlags,
+                                     papszOpenOptions);
+}
+
+/*! @endcond */
@@ -5003,6 +5003,21 @@ CPLErr GDALRegenerateOverviewsMultiBand(
     const int nChunkMaxSize =
         atoi(CPLGetConfigOption("GDAL_OVR_CHUNK_MAX_SIZE", "10485760"));
 
+    // Maximum amount of memory used to keep the content of an overview level
+    // in RAM, so that the next level can be computed from it without reading
+    // it back from the overview bands.
+    const char *pszCascadingMaxMem =
+        CPLGetConfigOption("GDAL_OVR_CASCADING_MAX_MEM", nullptr);
+    const GIntBig nCascadingMaxMem =
+        pszCascadingMaxMem ? CPLAtoGIntBig(pszCascadingMaxMem)
+                           : CPLGetUsablePhysicalRAM() / 4;
+    const int nDataTypeSize = GDALGetDataTypeSizeBytes(eDataType);
+
+    // Content of the previous overview level, when kept in RAM, and of the
+    // one being computed. Indexed by band.
+    std::vector<std::vector<GByte>> aabyCascadingSrc;
+    std::vector<std::vector<GByte>> aabyCascadingDst;
+
     // Second pass to do the real job.
     double dfCurPixelCount = 0;
     CPLErr eErr = CE_None;
@@ -5030,6 +5045,67 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             nSrcHeight = papapoOverviewBands[0][iOverview - 1]->GetYSize();
             iSrcOverview = iOverview - 1;
         }
+        else
+        {
+            aabyCascadingSrc.clear();
+        }
+
+        // Decide whether to keep the content of this level in RAM, to
+        // compute the next level from it. This is not done when the next
+        // level must be computed with the mask of this level, or when the
+        // overview bands may not store exactly the values written to them
+        // (lossy compression, NBITS). The GTiff DISCARD_LSB creation option
+        // is not checked: it only applies to the full resolution image, and
+        // overview levels store the written values exactly.
+        aabyCascadingDst.clear();
+        if (iOverview + 1 < nOverviews && !bUseNoDataMask &&
+            nDstWidth > papapoOverviewBands[0][iOverview + 1]->GetXSize() &&
+            static_cast<GIntBig>(nDstWidth) * nDstHeight * nBands *
+                        nDataTypeSize +
+                    static_cast<GIntBig>(nSrcWidth) * nSrcHeight * nBands *
+                        nDataTypeSize *
+                        (aabyCascadingSrc.empty() ? 0 : 1) <=
+                nCascadingMaxMem &&
+            static_cast<GUIntBig>(nDstWidth) * nDstHeight * nDataTypeSize <=
+                std::numeric_limits<size_t>::max())
+        {
+            bool bCanCascadeInMemory = true;
+            for (int iBand = 0; iBand < nBands && bCanCascadeInMemory; ++iBand)
+            {
+                GDALRasterBand *poOvrBand =
+                    papapoOverviewBands[iBand][iOverview];
+                GDALDataset *poOvrDS = poOvrBand->GetDataset();
+                const char *pszCompression =
+                    poOvrDS ? poOvrDS->GetMetadataItem("COMPRESSION",
+                                                       "IMAGE_STRUCTURE")
+                            : nullptr;
+                if (poOvrBand->GetMetadataItem("NBITS", "IMAGE_STRUCTURE") ||
+                    (pszCompression &&
+                     (STARTS_WITH_CI(pszCompression, "JPEG") ||
+                      STARTS_WITH_CI(pszCompression, "WEBP") ||
+                      STARTS_WITH_CI(pszCompression, "JXL") ||
+                      STARTS_WITH_CI(pszCompression, "LERC"))))
+                {
+                    bCanCascadeInMemory = false;
+                }
+            }
+            if (bCanCascadeInMemory)
+            {
+                try
+                {
+                    aabyCascadingDst.resize(nBands);
+                    for (auto &abyBuffer : aabyCascadingDst)
+                    {
+                        abyBuffer.resize(static_cast<size_t>(nDstWidth) *
+                                         nDstHeight * nDataTypeSize);
+                    }
+                }
+                catch (const std::exception &)
+                {
+                    aabyCascadingDst.clear();
+                }
+            }
+        }
 
         const double dfXRatioDstToSrc =
             static_cast<double>(nSrcWidth) / nDstWidth;
@@ -5103,6 +5179,11 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             GDALDataType eSrcDataType = GDT_Unknown;
             bool bPropagateNoData = false;
 
+            // Where to copy the result, when the overview level is kept in
+            // RAM (lines of nDstWidth pixels of type eSrcDataType)
+            GByte *pabyCascadingDst = nullptr;
+            int nDstWidth = 0;
+
             // Output values of resampling function
             CPLErr eErr = CE_Failure;
             void *pDstBuffer = nullptr;
@@ -5131,6 +5212,28 @@ CPLErr GDALRegenerateOverviewsMultiBand(
 
             poJob->oDstBufferHolder.reset(new PointerHolder(poJob->pDstBuffer));
 
+            if (poJob->eErr == CE_None && poJob->pabyCascadingDst)
+            {
+                const int nXCount = poJob->nDstXOff2 - poJob->nDstXOff;
+                const int nSrcDTSize =
+                    GDALGetDataTypeSizeBytes(poJob->eDstBufferDataType);
+                const int nDstDTSize =
+                    GDALGetDataTypeSizeBytes(poJob->eSrcDataType);
+                for (int iY = poJob->nDstYOff; iY < poJob->nDstYOff2; ++iY)
+                {
+                    GDALCopyWords(
+                        static_cast<const GByte *>(poJob->pDstBuffer) +
+                            static_cast<size_t>(iY - poJob->nDstYOff) *
+                                nXCount * nSrcDTSize,
+                        poJob->eDstBufferDataType, nSrcDTSize,
+                        poJob->pabyCascadingDst +
+                            (static_cast<size_t>(iY) * poJob->nDstWidth +
+                             poJob->nDstXOff) *
+                                nDstDTSize,
+                        poJob->eSrcDataType, nDstDTSize, nXCount);
+                }
+            }
+
             {
                 std::lock_guard<std::mutex> guard(poJob->mutex);
                 poJob->bFinished = true;
@@ -5311,7 +5414,31 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                 }
 
                 // Read the source buffers for all the bands.
-                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
+                for (int iBand = 0; iBand < nBands && eErr == CE_None &&
+                                    !aabyCascadingSrc.empty();
+                     ++iBand)
+                {
+                    // Previous overview level kept in RAM.
+                    const int nWrkDTSize =
+                        GDALGetDataTypeSizeBytes(eWrkDataType);
+                    for (int iY = 0; iY < nChunkYSizeQueried; ++iY)
+                    {
+                        GDALCopyWords(
+                            aabyCascadingSrc[iBand].data() +
+                                (static_cast<size_t>(nChunkYOffQueried + iY) *
+                                     nSrcWidth +
+                                 nChunkXOffQueried) *
+                                    nDataTypeSize,
+                            eDataType, nDataTypeSize,
+                            static_cast<GByte *>(apaChunk[iBand]) +
+                                static_cast<size_t>(iY) * nChunkXSizeQueried *
+                                    nWrkDTSize,
+                            eWrkDataType, nWrkDTSize, nChunkXSizeQueried);
+                    }
+                }
+                for (int iBand = 0; iBand < nBands && eErr == CE_None &&
+                                    aabyCascadingSrc.empty();
+                     ++iBand)
                 {
                     GDALRasterBand *poSrcBand = nullptr;
                     if (iSrcOverview == -1)
@@ -5361,6 +5488,12 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                     poJob->fNoDataValue = pafNoDataValue[iBand];
                     poJob->eSrcDataType = eDataType;
                     poJob->bPropagateNoData = bPropagateNoData;
+                    if (!aabyCascadingDst.empty())
+                    {
+                        poJob->pabyCascadingDst =
+                            aabyCascadingDst[iBand].data();
+                        poJob->nDstWidth = nDstWidth;
+                    }
 
                     if (poJobQueue)
                     {
@@ -5406,6 +5539,8 @@ CPLErr GDALRegenerateOverviewsMultiBand(
 
             CPLFree(apabyChunkNoDataMask[iBand]);
         }
+
+        std::swap(aabyCascadingSrc, aabyCascadingDst);
     }
 
     CPLFree(pabHasNoData);
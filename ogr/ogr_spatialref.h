@@ -710,6 +710,11 @@ class CPL_DLL OGRSpatialReference
 
     /*! @cond Doxygen_Suppress */
     void UpdateCoordinateSystemFromGeogCRS();
+
+    bool GetCachedCTTextRepresentation(const std::string &osContext,
+                                       std::string &osText) const;
+    void SetCachedCTTextRepresentation(const std::string &osContext,
+                                       const std::string &osText) const;
     /*! @endcond */
 
     static OGRSpatialReference *GetWGS84SRS();
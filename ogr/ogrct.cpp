@@ -37,6 +37,7 @@
 #include <limits>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -85,11 +86,13 @@ static void CPLGettimeofday(struct CPLTimeVal *tp, void * /* timezonep*/)
 
 #endif  // DEBUG_PERF
 
-// Cache of OGRProjCT objects
+// Cache of OGRProjCT objects. Several ready-to-use instances may be kept for
+// the same key, so that threads that concurrently create the same
+// transformation do not have to go through OGRProjCT::Initialize()
 static std::mutex g_oCTCacheMutex;
 class OGRProjCT;
 typedef std::string CTCacheKey;
-typedef std::unique_ptr<OGRProjCT> CTCacheValue;
+typedef std::vector<std::unique_ptr<OGRProjCT>> CTCacheValue;
 static lru11::Cache<CTCacheKey, CTCacheValue> *g_poCTCache = nullptr;
 
 /************************************************************************/
@@ -204,6 +207,18 @@ static char *GetWktOrProjString(const OGRSpatialReference *poSRS)
 
 static char *GetTextRepresentation(const OGRSpatialReference *poSRS)
 {
+    // Computing the text representation involves a database lookup and a WKT
+    // export, so it is cached on the SRS object, together with the value of
+    // the configuration options that affect it.
+    const char *pszPreferOfficialSRSDef =
+        CPLGetConfigOption("OGR_CT_PREFER_OFFICIAL_SRS_DEF", "YES");
+    std::string osContext(pszPreferOfficialSRSDef);
+    osContext += ',';
+    osContext += CPLGetConfigOption("OSR_CT_USE_DEFAULT_EPSG_TOWGS84", "NO");
+    std::string osCachedText;
+    if (poSRS->GetCachedCTTextRepresentation(osContext, osCachedText))
+        return CPLStrdup(osCachedText.c_str());
+
     const auto CanUseAuthorityDef = [](const OGRSpatialReference *poSRS1,
                                        OGRSpatialReference *poSRSFromAuth,
                                        const char *pszAuth)
@@ -242,9 +257,7 @@ static char *GetTextRepresentation(const OGRSpatialReference *poSRS)
     // https://github.com/OSGeo/PROJ/issues/2955)
     const char *pszAuth = poSRS->GetAuthorityName(nullptr);
     const char *pszCode = poSRS->GetAuthorityCode(nullptr);
-    if (pszAuth && pszCode &&
-        CPLTestBool(
-            CPLGetConfigOption("OGR_CT_PREFER_OFFICIAL_SRS_DEF", "YES")))
+    if (pszAuth && pszCode && CPLTestBool(pszPreferOfficialSRSDef))
     {
         CPLString osAuthCode(pszAuth);
         osAuthCode += ':';
@@ -267,6 +280,10 @@ static char *GetTextRepresentation(const OGRSpatialReference *poSRS)
     {
         pszText = GetWktOrProjString(poSRS);
     }
+    if (pszText && pszText[0])
+    {
+        poSRS->SetCachedCTTextRepresentation(osContext, pszText);
+    }
     return pszText;
 }
 
@@ -678,6 +695,12 @@ class OGRProjCT : public OGRCoordinateTransformation
 
     bool bWebMercatorToWGS84LongLat = false;
 
+    // Set when m_pj is a chain of axis swaps, unit conversions, affine
+    // transforms and translations, collapsed into m_adfAffine.
+    bool m_bAffineOnly = false;
+    // 3x4 row-major matrix: X' = [0] X + [1] Y + [2] Z + [3], etc.
+    double m_adfAffine[12] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0};
+
     int nErrorCount = 0;
 
     double dfThreshold = 0.0;
@@ -730,6 +753,7 @@ class OGRProjCT : public OGRCoordinateTransformation
 
     void ComputeThreshold();
     void DetectWebMercatorToWGS84();
+    void DetectAffineOperation();
 
     OGRProjCT(const OGRProjCT &other);
     OGRProjCT &operator=(const OGRProjCT &) = delete;
@@ -1191,6 +1215,7 @@ OGRProjCT::OGRProjCT(const OGRProjCT &other)
       dfTargetCoordinateEpoch(other.dfTargetCoordinateEpoch),
       m_osTargetSRS(other.m_osTargetSRS),
       bWebMercatorToWGS84LongLat(other.bWebMercatorToWGS84LongLat),
+      m_bAffineOnly(other.m_bAffineOnly),
       nErrorCount(other.nErrorCount), dfThreshold(other.dfThreshold),
       m_pj(other.m_pj), m_bReversePj(other.m_bReversePj),
       m_bEmitErrors(other.m_bEmitErrors), bNoTransform(other.bNoTransform),
@@ -1199,6 +1224,7 @@ OGRProjCT::OGRProjCT(const OGRProjCT &other)
       m_iCurTransformation(other.m_iCurTransformation),
       m_options(other.m_options)
 {
+    memcpy(m_adfAffine, other.m_adfAffine, sizeof(m_adfAffine));
 }
 
 /************************************************************************/
@@ -1356,6 +1382,362 @@ void OGRProjCT::DetectWebMercatorToWGS84()
     }
 }
 
+/************************************************************************/
+/*                         GetUnitConvertFactor()                       */
+/************************************************************************/
+
+// Returns the factor to convert a unit of the +proj=unitconvert operation
+// to meter (or radian when *pbAngular is set), or 0 if unknown.
+static double GetUnitConvertFactor(const char *pszUnit, bool *pbAngular)
+{
+    struct UnitDef
+    {
+        const char *pszName;
+        double dfFactor;
+        bool bAngular;
+    };
+
+    static const UnitDef asUnits[] = {
+        {"km", 1000.0, false},
+        {"m", 1.0, false},
+        {"dm", 0.1, false},
+        {"cm", 0.01, false},
+        {"mm", 0.001, false},
+        {"kmi", 1852.0, false},
+        {"in", 0.0254, false},
+        {"ft", 0.3048, false},
+        {"yd", 0.9144, false},
+        {"mi", 1609.344, false},
+        {"fath", 1.8288, false},
+        {"ch", 20.1168, false},
+        {"link", 0.201168, false},
+        {"us-in", 1.0 / 39.37, false},
+        {"us-ft", 0.304800609601219, false},
+        {"us-yd", 0.914401828803658, false},
+        {"us-ch", 20.11684023368047, false},
+        {"us-mi", 1609.347218694437, false},
+        {"ind-yd", 0.91439523, false},
+        {"ind-ft", 0.30479841, false},
+        {"ind-ch", 20.11669506, false},
+        {"rad", 1.0, true},
+        {"deg", M_PI / 180.0, true},
+        {"grad", M_PI / 200.0, true},
+    };
+
+    for (const auto &sUnit : asUnits)
+    {
+        if (strcmp(pszUnit, sUnit.pszName) == 0)
+        {
+            *pbAngular = sUnit.bAngular;
+            return sUnit.dfFactor;
+        }
+    }
+
+    // Conversion factor to meter given as a number
+    if (CPLGetValueType(pszUnit) != CPL_VALUE_STRING)
+    {
+        *pbAngular = false;
+        const double dfFactor = CPLAtof(pszUnit);
+        return dfFactor > 0 ? dfFactor : 0.0;
+    }
+
+    return 0.0;
+}
+
+/************************************************************************/
+/*                          InvertAffineMatrix()                        */
+/************************************************************************/
+
+static bool InvertAffineMatrix(const double adfIn[12], double adfOut[12])
+{
+    const double a = adfIn[0], b = adfIn[1], c = adfIn[2];
+    const double d = adfIn[4], e = adfIn[5], f = adfIn[6];
+    const double g = adfIn[8], h = adfIn[9], i = adfIn[10];
+
+    const double dfDet =
+        a * (e * i - f * h) - b * (d * i - f * g) + c * (d * h - e * g);
+    if (dfDet == 0 || !std::isfinite(dfDet))
+        return false;
+    const double dfInvDet = 1.0 / dfDet;
+
+    adfOut[0] = (e * i - f * h) * dfInvDet;
+    adfOut[1] = (c * h - b * i) * dfInvDet;
+    adfOut[2] = (b * f - c * e) * dfInvDet;
+    adfOut[4] = (f * g - d * i) * dfInvDet;
+    adfOut[5] = (a * i - c * g) * dfInvDet;
+    adfOut[6] = (c * d - a * f) * dfInvDet;
+    adfOut[8] = (d * h - e * g) * dfInvDet;
+    adfOut[9] = (b * g - a * h) * dfInvDet;
+    adfOut[10] = (a * e - b * d) * dfInvDet;
+
+    for (int iRow = 0; iRow < 3; ++iRow)
+    {
+        adfOut[4 * iRow + 3] = -(adfOut[4 * iRow + 0] * adfIn[3] +
+                                 adfOut[4 * iRow + 1] * adfIn[7] +
+                                 adfOut[4 * iRow + 2] * adfIn[11]);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        GetAffineFromPROJStep()                       */
+/************************************************************************/
+
+// Computes the 3x4 matrix of a single step of a PROJ pipeline, provided
+// it is an affine operation.
+static bool GetAffineFromPROJStep(const CPLStringList &aosStep,
+                                  double adfMat[12])
+{
+    const char *pszProj = aosStep.FetchNameValue("proj");
+    if (pszProj == nullptr)
+        return false;
+
+    // Parameters that do not influence the steps we handle
+    const auto IsIgnoredParam = [](const char *pszKey)
+    {
+        return EQUAL(pszKey, "proj") || EQUAL(pszKey, "inv") ||
+               EQUAL(pszKey, "ellps") || EQUAL(pszKey, "a") ||
+               EQUAL(pszKey, "b") || EQUAL(pszKey, "rf") ||
+               EQUAL(pszKey, "R") || EQUAL(pszKey, "no_defs");
+    };
+
+    double adfStep[12] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0};
+    if (EQUAL(pszProj, "noop"))
+    {
+        // identity
+    }
+    else if (EQUAL(pszProj, "axisswap"))
+    {
+        const char *pszOrder = aosStep.FetchNameValue("order");
+        if (pszOrder == nullptr)
+            return false;
+        const CPLStringList aosOrder(CSLTokenizeString2(pszOrder, ",", 0));
+        if (aosOrder.size() < 2 || aosOrder.size() > 3)
+            return false;
+        adfStep[0] = adfStep[5] = adfStep[10] = 0;
+        bool abUsed[3] = {false, false, false};
+        for (int iRow = 0; iRow < aosOrder.size(); ++iRow)
+        {
+            const int nAxis = atoi(aosOrder[iRow]);
+            const int nAbsAxis = std::abs(nAxis);
+            if (nAbsAxis < 1 || nAbsAxis > 3 || abUsed[nAbsAxis - 1])
+                return false;
+            abUsed[nAbsAxis - 1] = true;
+            adfStep[4 * iRow + nAbsAxis - 1] = nAxis > 0 ? 1.0 : -1.0;
+        }
+        if (aosOrder.size() == 2)
+            adfStep[10] = 1;
+        for (const char *pszItem : aosStep)
+        {
+            const CPLStringList aosKV(CSLTokenizeString2(pszItem, "=", 0));
+            if (aosKV.size() >= 1 && !IsIgnoredParam(aosKV[0]) &&
+                !EQUAL(aosKV[0], "order"))
+                return false;
+        }
+    }
+    else if (EQUAL(pszProj, "unitconvert"))
+    {
+        const char *pszTIn = aosStep.FetchNameValue("t_in");
+        const char *pszTOut = aosStep.FetchNameValue("t_out");
+        if ((pszTIn || pszTOut) &&
+            (pszTIn == nullptr || pszTOut == nullptr ||
+             strcmp(pszTIn, pszTOut) != 0))
+        {
+            return false;
+        }
+
+        const auto GetFactor = [&aosStep](const char *pszInKey,
+                                          const char *pszOutKey,
+                                          bool bAllowAngular, double &dfFactor)
+        {
+            const char *pszIn = aosStep.FetchNameValue(pszInKey);
+            const char *pszOut = aosStep.FetchNameValue(pszOutKey);
+            dfFactor = 1.0;
+            if (pszIn == nullptr && pszOut == nullptr)
+                return true;
+            if (pszIn == nullptr || pszOut == nullptr)
+                return false;
+            bool bInAngular = false;
+            bool bOutAngular = false;
+            const double dfIn = GetUnitConvertFactor(pszIn, &bInAngular);
+            const double dfOut = GetUnitConvertFactor(pszOut, &bOutAngular);
+            if (dfIn == 0 || dfOut == 0 || bInAngular != bOutAngular ||
+                (bInAngular && !bAllowAngular))
+                return false;
+            dfFactor = dfIn / dfOut;
+            return true;
+        };
+
+        double dfXYFactor = 1.0;
+        double dfZFactor = 1.0;
+        if (!GetFactor("xy_in", "xy_out", true, dfXYFactor) ||
+            !GetFactor("z_in", "z_out", false, dfZFactor))
+        {
+            return false;
+        }
+        adfStep[0] = dfXYFactor;
+        adfStep[5] = dfXYFactor;
+        adfStep[10] = dfZFactor;
+
+        for (const char *pszItem : aosStep)
+        {
+            const CPLStringList aosKV(CSLTokenizeString2(pszItem, "=", 0));
+            if (aosKV.size() >= 1 && !IsIgnoredParam(aosKV[0]) &&
+                !EQUAL(aosKV[0], "xy_in") && !EQUAL(aosKV[0], "xy_out") &&
+                !EQUAL(aosKV[0], "z_in") && !EQUAL(aosKV[0], "z_out") &&
+                !EQUAL(aosKV[0], "t_in") && !EQUAL(aosKV[0], "t_out"))
+                return false;
+        }
+    }
+    else if (EQUAL(pszProj, "affine") || EQUAL(pszProj, "helmert"))
+    {
+        // Only translations are affine for helmert, as rotations are
+        // subject to the position_vector/coordinate_frame convention and
+        // may be time-dependent.
+        const bool bHelmert = EQUAL(pszProj, "helmert");
+        static const char *const apszAffineParams[] = {
+            "xoff", "s11", "s12", "s13", "yoff", "s21",
+            "s22",  "s23", "zoff", "s31", "s32", "s33"};
+        static const char *const apszHelmertParams[] = {
+            "x", nullptr, nullptr, nullptr, "y", nullptr,
+            nullptr, nullptr, "z", nullptr, nullptr, nullptr};
+        const char *const *papszParams =
+            bHelmert ? apszHelmertParams : apszAffineParams;
+
+        for (const char *pszItem : aosStep)
+        {
+            const CPLStringList aosKV(CSLTokenizeString2(pszItem, "=", 0));
+            if (aosKV.size() < 1 || IsIgnoredParam(aosKV[0]))
+                continue;
+            if (bHelmert && EQUAL(aosKV[0], "convention"))
+                continue;
+            int iParam = 0;
+            for (; iParam < 12; ++iParam)
+            {
+                if (papszParams[iParam] &&
+                    EQUAL(aosKV[0], papszParams[iParam]))
+                    break;
+            }
+            if (iParam == 12 || aosKV.size() != 2)
+                return false;
+            // Parameters are listed by row, offset first
+            const int iRow = iParam / 4;
+            const int iCol = iParam % 4;
+            adfStep[4 * iRow + (iCol == 0 ? 3 : iCol - 1)] = CPLAtof(aosKV[1]);
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    if (aosStep.FetchBool("inv", false))
+    {
+        double adfInv[12];
+        if (!InvertAffineMatrix(adfStep, adfInv))
+            return false;
+        memcpy(adfStep, adfInv, sizeof(adfStep));
+    }
+
+    // adfMat = adfStep x adfMat
+    double adfRes[12];
+    for (int iRow = 0; iRow < 3; ++iRow)
+    {
+        for (int iCol = 0; iCol < 4; ++iCol)
+        {
+            adfRes[4 * iRow + iCol] =
+                adfStep[4 * iRow + 0] * adfMat[0 + iCol] +
+                adfStep[4 * iRow + 1] * adfMat[4 + iCol] +
+                adfStep[4 * iRow + 2] * adfMat[8 + iCol] +
+                (iCol == 3 ? adfStep[4 * iRow + 3] : 0.0);
+        }
+    }
+    memcpy(adfMat, adfRes, sizeof(adfRes));
+    return true;
+}
+
+/************************************************************************/
+/*                        DetectAffineOperation()                       */
+/************************************************************************/
+
+// Detect operations such as axis swapping, unit conversions or pure
+// translations, that can be done without going through proj_trans().
+void OGRProjCT::DetectAffineOperation()
+{
+    m_bAffineOnly = false;
+    if (!m_pj || bWebMercatorToWGS84LongLat || bNoTransform ||
+        !CPLTestBool(CPLGetConfigOption("OGR_CT_AFFINE_OPTIMIZATION", "YES")))
+    {
+        return;
+    }
+
+    // For a PJ object made of several candidate operations, the definition
+    // is not available before proj_trans() has been called, and is then
+    // not a PROJ string.
+    const auto info = proj_pj_info(m_pj);
+    if (info.definition == nullptr || info.definition[0] == '\0')
+        return;
+
+    const CPLStringList aosTokens(CSLTokenizeString2(info.definition, " ", 0));
+    std::vector<CPLStringList> aosSteps;
+    bool bPipeline = false;
+    for (int i = 0; i < aosTokens.size(); ++i)
+    {
+        const char *pszToken = aosTokens[i];
+        if (pszToken[0] == '+')
+            ++pszToken;
+        if (i == 0 && EQUAL(pszToken, "proj=pipeline"))
+        {
+            bPipeline = true;
+        }
+        else if (bPipeline && EQUAL(pszToken, "step"))
+        {
+            aosSteps.emplace_back();
+        }
+        else if (bPipeline && aosSteps.empty())
+        {
+            // Global pipeline parameters are not handled
+            return;
+        }
+        else
+        {
+            if (aosSteps.empty())
+                aosSteps.emplace_back();
+            if (strchr(pszToken, '=') == nullptr)
+                aosSteps.back().AddNameValue(pszToken, "YES");
+            else
+                aosSteps.back().AddString(pszToken);
+        }
+    }
+    if (aosSteps.empty())
+        return;
+
+    double adfMat[12] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0};
+    for (const auto &aosStep : aosSteps)
+    {
+        if (!GetAffineFromPROJStep(aosStep, adfMat))
+            return;
+    }
+
+    if (m_bReversePj)
+    {
+        if (!InvertAffineMatrix(adfMat, m_adfAffine))
+            return;
+    }
+    else
+    {
+        memcpy(m_adfAffine, adfMat, sizeof(adfMat));
+    }
+    for (double dfVal : m_adfAffine)
+    {
+        if (!std::isfinite(dfVal))
+            return;
+    }
+
+    m_bAffineOnly = true;
+    CPLDebug("OGRCT", "Using affine transformation optimization");
+}
+
 /************************************************************************/
 /*                             Initialize()                             */
 /************************************************************************/
@@ -1632,6 +2014,8 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
             CPL_TO_BOOL(poSRSSource->IsSame(poSRSTarget, apszOptionsIsSame));
     }
 
+    DetectAffineOperation();
+
     return TRUE;
 }
 
@@ -2349,6 +2733,56 @@ int OGRProjCT::TransformWithErrorCodes(int nCount, double *x, double *y,
         bTransformDone = true;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Optimized transform for operations that are only made of axis   */
+    /*      swapping, unit conversion, affine transforms or translations.   */
+    /* -------------------------------------------------------------------- */
+    else if (m_bAffineOnly)
+    {
+        const double *M = m_adfAffine;
+
+        // Keep this loop free of branches so that it can be vectorized.
+        if (z)
+        {
+            for (int i = 0; i < nCount; i++)
+            {
+                const double xIn = x[i];
+                const double yIn = y[i];
+                const double zIn = z[i];
+                x[i] = M[0] * xIn + M[1] * yIn + M[2] * zIn + M[3];
+                y[i] = M[4] * xIn + M[5] * yIn + M[6] * zIn + M[7];
+                z[i] = M[8] * xIn + M[9] * yIn + M[10] * zIn + M[11];
+            }
+        }
+        else
+        {
+            for (int i = 0; i < nCount; i++)
+            {
+                const double xIn = x[i];
+                const double yIn = y[i];
+                x[i] = M[0] * xIn + M[1] * yIn + M[3];
+                y[i] = M[4] * xIn + M[5] * yIn + M[7];
+            }
+        }
+
+        // Any non-finite input (including HUGE_VAL) results in a non-finite
+        // output.
+        for (int i = 0; i < nCount; i++)
+        {
+            int err = 0;
+            if (!std::isfinite(x[i]) || !std::isfinite(y[i]))
+            {
+                x[i] = HUGE_VAL;
+                y[i] = HUGE_VAL;
+                err = PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
+            }
+            if (panErrorCodes)
+                panErrorCodes[i] = err;
+        }
+
+        bTransformDone = true;
+    }
+
     // Determine the default coordinate epoch, if not provided in the point to
     // transform.
     // For time-dependent transformations, PROJ can currently only do
@@ -3388,6 +3822,9 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
     poNewCT->m_options = newOptions;
 
     poNewCT->DetectWebMercatorToWGS84();
+    poNewCT->m_bAffineOnly =
+        m_bAffineOnly &&
+        InvertAffineMatrix(m_adfAffine, poNewCT->m_adfAffine);
 
     return poNewCT;
 }
@@ -3454,13 +3891,24 @@ void OGRProjCT::InsertIntoCache(OGRProjCT *poCT)
                                   poCT->poSRSTarget,
                                   poCT->m_osTargetSRS.c_str(), poCT->m_options);
 
+    // Do not keep more instances than threads that could use them at the
+    // same time.
+    const size_t nMaxInstancesPerKey =
+        static_cast<size_t>(std::max(1, CPLGetNumCPUs()));
+
     std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
-    if (g_poCTCache->contains(key))
+    CTCacheValue *cachedValue = g_poCTCache->getPtr(key);
+    if (cachedValue)
     {
-        delete poCT;
+        if (cachedValue->size() >= nMaxInstancesPerKey)
+            delete poCT;
+        else
+            cachedValue->emplace_back(poCT);
         return;
     }
-    g_poCTCache->insert(key, std::unique_ptr<OGRProjCT>(poCT));
+    CTCacheValue newValue;
+    newValue.emplace_back(poCT);
+    g_poCTCache->insert(key, std::move(newValue));
 }
 
 /************************************************************************/
@@ -3480,13 +3928,15 @@ OGRProjCT *OGRProjCT::FindFromCache(
 
     const auto key =
         MakeCacheKey(poSource, pszSrcSRS, poTarget, pszTargetSRS, options);
-    // Get value from cache and remove it
+    // Get an instance from cache and remove it
     std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
     CTCacheValue *cachedValue = g_poCTCache->getPtr(key);
     if (cachedValue)
     {
-        auto poCT = cachedValue->release();
-        g_poCTCache->remove(key);
+        auto poCT = cachedValue->back().release();
+        cachedValue->pop_back();
+        if (cachedValue->empty())
+            g_poCTCache->remove(key);
         return poCT;
     }
     return nullptr;
@@ -159,7 +159,7 @@ class OGRFeatherWriterLayer final : public OGRArrowWriterLayer
         return m_poFileWriter != nullptr;
     }
     virtual void CreateWriter() override;
-    virtual void CloseFileWriter() override;
+    virtual bool CloseFileWriter() override;
 
     virtual void CreateSchema() override;
     virtual void PerformStepsBeforeFinalFlushGroup() override;
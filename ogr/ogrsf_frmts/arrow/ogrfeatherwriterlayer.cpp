@@ -201,7 +201,7 @@ bool OGRFeatherWriterLayer::SetOptions(const std::string &osFilename,
 /*                         CloseFileWriter()                            */
 /************************************************************************/
 
-void OGRFeatherWriterLayer::CloseFileWriter()
+bool OGRFeatherWriterLayer::CloseFileWriter()
 {
     auto status = m_poFileWriter->Close();
     if (!status.ok())
@@ -209,7 +209,9 @@ void OGRFeatherWriterLayer::CloseFileWriter()
         CPLError(CE_Failure, CPLE_AppDefined,
                  "FileWriter::Close() failed with %s",
                  status.message().c_str());
+        return false;
     }
+    return true;
 }
 
 /************************************************************************/
@@ -177,6 +177,11 @@ class OGRArrowLayer CPL_NON_FINAL
     }
 
     virtual bool GetFastExtent(int iGeomField, OGREnvelope *psExtent) const;
+
+    const std::vector<Constraint> &GetAttributeFilterConstraints() const
+    {
+        return m_asAttributeFilterConstraints;
+    }
     static OGRErr GetExtentFromMetadata(const CPLJSONObject &oJSONDef,
                                         OGREnvelope *psExtent);
 
@@ -276,6 +281,9 @@ class OGRArrowWriterLayer CPL_NON_FINAL : public OGRLayer
         m_oMapFieldDomainToStringArray{};
 
     bool m_bWriteFieldArrowExtensionName = false;
+    // Whether to write a {geom_name}_bbox struct column with the float32
+    // xmin, ymin, xmax, ymax of each geometry
+    bool m_bWriteBBoxStruct = false;
     OGRArrowGeomEncoding m_eGeomEncoding = OGRArrowGeomEncoding::WKB;
     std::vector<OGRArrowGeomEncoding> m_aeGeomEncoding{};
 
@@ -298,6 +306,10 @@ class OGRArrowWriterLayer CPL_NON_FINAL : public OGRLayer
     GetPreciseArrowGeomEncoding(OGRwkbGeometryType eGType);
     static const char *
     GetGeomEncodingAsString(OGRArrowGeomEncoding eGeomEncoding);
+    static std::string GetBBoxStructName(const char *pszGeomFieldName)
+    {
+        return std::string(pszGeomFieldName) + "_bbox";
+    }
 
     virtual bool IsSupportedGeometryType(OGRwkbGeometryType eGType) const = 0;
 
@@ -305,7 +317,7 @@ class OGRArrowWriterLayer CPL_NON_FINAL : public OGRLayer
 
     virtual bool IsFileWriterCreated() const = 0;
     virtual void CreateWriter() = 0;
-    virtual void CloseFileWriter() = 0;
+    virtual bool CloseFileWriter() = 0;
 
     void CreateSchemaCommon();
     void FinalizeSchema();
@@ -316,7 +328,7 @@ class OGRArrowWriterLayer CPL_NON_FINAL : public OGRLayer
 
     void CreateArrayBuilders();
     virtual bool FlushGroup() = 0;
-    void FinalizeWriting();
+    bool FinalizeWriting();
     bool WriteArrays(std::function<bool(const std::shared_ptr<arrow::Field> &,
                                         const std::shared_ptr<arrow::Array> &)>
                          postProcessArray);
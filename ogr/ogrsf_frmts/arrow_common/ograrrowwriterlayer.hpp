@@ -32,6 +32,7 @@
 #include "cpl_time.h"
 
 #include <cinttypes>
+#include <cmath>
 #include <limits>
 
 static constexpr int TZFLAG_UNINITIALIZED = -1;
@@ -88,8 +89,10 @@ inline OGRArrowWriterLayer::~OGRArrowWriterLayer()
 /*                         FinalizeWriting()                            */
 /************************************************************************/
 
-inline void OGRArrowWriterLayer::FinalizeWriting()
+inline bool OGRArrowWriterLayer::FinalizeWriting()
 {
+    bool bRet = true;
+
     if (!IsFileWriterCreated())
     {
         CreateWriter();
@@ -98,11 +101,14 @@ inline void OGRArrowWriterLayer::FinalizeWriting()
     {
         PerformStepsBeforeFinalFlushGroup();
 
-        if (!m_apoBuilders.empty())
-            FlushGroup();
+        if (!m_apoBuilders.empty() && !FlushGroup())
+            bRet = false;
 
-        CloseFileWriter();
+        if (!CloseFileWriter())
+            bRet = false;
     }
+
+    return bRet;
 }
 
 /************************************************************************/
@@ -318,6 +324,24 @@ inline void OGRArrowWriterLayer::CreateSchemaCommon()
         fields.emplace_back(field);
     }
 
+    if (m_bWriteBBoxStruct)
+    {
+        for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+        {
+            const auto poGeomFieldDefn = m_poFeatureDefn->GetGeomFieldDefn(i);
+            auto bbox_field_xmin = arrow::field("xmin", arrow::float32(), true);
+            auto bbox_field_ymin = arrow::field("ymin", arrow::float32(), true);
+            auto bbox_field_xmax = arrow::field("xmax", arrow::float32(), true);
+            auto bbox_field_ymax = arrow::field("ymax", arrow::float32(), true);
+            auto bbox_field = arrow::field(
+                GetBBoxStructName(poGeomFieldDefn->GetNameRef()),
+                arrow::struct_({bbox_field_xmin, bbox_field_ymin,
+                                bbox_field_xmax, bbox_field_ymax}),
+                true);
+            fields.emplace_back(bbox_field);
+        }
+    }
+
     m_aoEnvelopes.resize(m_poFeatureDefn->GetGeomFieldCount());
     m_oSetWrittenGeometryTypes.resize(m_poFeatureDefn->GetGeomFieldCount());
 
@@ -814,6 +838,21 @@ inline void OGRArrowWriterLayer::CreateArrayBuilders()
         }
         m_apoBuilders.emplace_back(builder);
     }
+
+    if (m_bWriteBBoxStruct)
+    {
+        for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount();
+             ++i, ++nArrowIdx)
+        {
+            std::vector<std::shared_ptr<arrow::ArrayBuilder>> apoChildren;
+            for (int j = 0; j < 4; ++j)
+                apoChildren.emplace_back(
+                    std::make_shared<arrow::FloatBuilder>(m_poMemoryPool));
+            m_apoBuilders.emplace_back(std::make_shared<arrow::StructBuilder>(
+                m_poSchema->fields()[nArrowIdx]->type(), m_poMemoryPool,
+                std::move(apoChildren)));
+        }
+    }
 }
 
 /************************************************************************/
@@ -1511,6 +1550,45 @@ inline OGRErr OGRArrowWriterLayer::ICreateFeature(OGRFeature *poFeature)
         }
     }
 
+    // Write bounding box of geometries, rounded outwards to float32
+    if (m_bWriteBBoxStruct)
+    {
+        for (int i = 0; i < nGeomFieldCount; ++i, ++nArrowIdx)
+        {
+            auto poStructBuilder = static_cast<arrow::StructBuilder *>(
+                m_apoBuilders[nArrowIdx].get());
+            const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
+            if (poGeom == nullptr || poGeom->IsEmpty())
+            {
+                OGR_ARROW_RETURN_OGRERR_NOT_OK(poStructBuilder->Append(false));
+                for (int j = 0; j < 4; ++j)
+                    OGR_ARROW_RETURN_OGRERR_NOT_OK(
+                        poStructBuilder->field_builder(j)->AppendNull());
+                continue;
+            }
+
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            const double adfVal[] = {sEnvelope.MinX, sEnvelope.MinY,
+                                     sEnvelope.MaxX, sEnvelope.MaxY};
+            OGR_ARROW_RETURN_OGRERR_NOT_OK(poStructBuilder->Append());
+            for (int j = 0; j < 4; ++j)
+            {
+                float fVal = static_cast<float>(adfVal[j]);
+                if (j < 2 && static_cast<double>(fVal) > adfVal[j])
+                    fVal = std::nextafter(
+                        fVal, -std::numeric_limits<float>::infinity());
+                else if (j >= 2 && static_cast<double>(fVal) < adfVal[j])
+                    fVal = std::nextafter(
+                        fVal, std::numeric_limits<float>::infinity());
+                OGR_ARROW_RETURN_OGRERR_NOT_OK(
+                    static_cast<arrow::FloatBuilder *>(
+                        poStructBuilder->field_builder(j))
+                        ->Append(fVal));
+            }
+        }
+    }
+
     m_nFeatureCount++;
 
     // Flush the current row group if reaching the limit of rows per group.
@@ -32,8 +32,13 @@
 #define OGR_CSV_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "cpl_error_internal.h"
 
+#include <atomic>
+#include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 #if defined(_MSC_VER) && _MSC_VER <= 1600  // MSVC <= 2010
 #define GDAL_OVERRIDE
@@ -92,6 +97,24 @@ class OGRCSVLayer final : public OGRLayer
     bool bHasFieldNames;
 
     OGRFeature *GetNextUnfilteredFeature();
+    OGRFeature *BuildFeatureFromTokens(char **papszTokens, int nRecord);
+
+    // Multi-threaded reading
+    struct ParseChunkJob;
+    int m_nNumThreads = 1;
+    bool m_bMTEOF = false;
+    std::string m_osMTBuffer{};  // bytes read but not yet parsed
+    std::vector<std::unique_ptr<OGRFeature>> m_apoMTFeatures{};
+    size_t m_iMTFeature = 0;
+    // Errors of the worker threads, with the index in m_apoMTFeatures of
+    // the feature being read when they were raised
+    std::vector<std::pair<size_t, CPLErrorHandlerAccumulatorStruct>>
+        m_aoMTErrors{};
+    size_t m_iMTError = 0;
+    void EmitMTErrors(size_t nUpToFeature);
+    bool ReadNextBatchMultiThreaded();
+    OGRFeature *GetNextUnfilteredFeatureMultiThreaded();
+    static void ParseChunkJobFunc(void *pData);
 
     bool bNew;
     bool bInWriteMode;
@@ -131,7 +154,7 @@ class OGRCSVLayer final : public OGRLayer
 
     char **AutodetectFieldTypes(char **papszOpenOptions, int nFieldCount);
 
-    bool bWarningBadTypeOrWidth;
+    std::atomic<bool> bWarningBadTypeOrWidth;
     bool bKeepSourceColumns;
     bool bKeepGeomColumns;
 
@@ -426,6 +426,13 @@ void RegisterOGRCSV()
         "  <Option name='MAX_LINE_SIZE' type='int' description='Maximum number "
         "of bytes for a line (-1=unlimited)' default='" STRINGIFY(
             OGR_CSV_DEFAULT_MAX_LINE_SIZE) "'/>"
+                                           "  <Option name='NUM_THREADS' "
+                                           "type='string' "
+                                           "description='Number of threads "
+                                           "used to parse features "
+                                           "(integer or ALL_CPUS). Defaults "
+                                           "to the GDAL_NUM_THREADS "
+                                           "configuration option, or 1'/>"
                                            "</OpenOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
@@ -41,6 +41,7 @@
 #endif
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -49,6 +50,8 @@
 #include "cpl_error.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -155,6 +158,7 @@ void OGRCSVLayer::BuildFeatureDefn(const char *pszNfdcGeomField,
     bMergeDelimiter = CPLFetchBool(papszOpenOptions, "MERGE_SEPARATOR", false);
     bEmptyStringNull =
         CPLFetchBool(papszOpenOptions, "EMPTY_STRING_AS_NULL", false);
+    m_nNumThreads = GDALGetNumThreads(papszOpenOptions, "NUM_THREADS");
 
     // If this is not a new file, read ahead to establish if it is
     // already in CRLF (DOS) mode, or just a normal unix CR mode.
@@ -1280,6 +1284,13 @@ void OGRCSVLayer::ResetReading()
     bNeedRewindBeforeRead = false;
 
     nNextFID = 1;
+
+    m_bMTEOF = false;
+    m_osMTBuffer.clear();
+    m_apoMTFeatures.clear();
+    m_iMTFeature = 0;
+    m_aoMTErrors.clear();
+    m_iMTError = 0;
 }
 
 /************************************************************************/
@@ -1315,7 +1326,9 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 {
     if (nFID < 1 || fpCSV == nullptr)
         return nullptr;
-    if (nFID < nNextFID || bNeedRewindBeforeRead)
+    // In multi-threaded reading, the file position is ahead of nNextFID
+    if (nFID < nNextFID || bNeedRewindBeforeRead || m_bMTEOF ||
+        !m_osMTBuffer.empty() || m_iMTFeature < m_apoMTFeatures.size())
         ResetReading();
     while (nNextFID < nFID)
     {
@@ -1343,6 +1356,27 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if (papszTokens == nullptr)
         return nullptr;
 
+    OGRFeature *poFeature = BuildFeatureFromTokens(papszTokens, nNextFID);
+
+    // Translate the record id.
+    poFeature->SetFID(nNextFID++);
+
+    m_nFeaturesRead++;
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                       BuildFeatureFromTokens()                       */
+/*                                                                      */
+/*      Takes ownership of papszTokens. nRecord is only used in         */
+/*      warning messages. Must be safe to call from several threads     */
+/*      at the same time.                                               */
+/************************************************************************/
+
+OGRFeature *OGRCSVLayer::BuildFeatureFromTokens(char **papszTokens,
+                                                int nRecord)
+{
     // Create the OGR feature.
     OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
 
@@ -1432,7 +1466,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                         CE_Warning, CPLE_AppDefined,
                         "Invalid value type found in record %d for field %s. "
                         "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
+                        nRecord, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1461,7 +1495,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                  "Invalid value type found in record %d for "
                                  "field %s. "
                                  "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
+                                 nRecord, poFieldDefn->GetNameRef());
                     }
                     else if (!bWarningBadTypeOrWidth &&
                              poFieldDefn->GetWidth() > 0 &&
@@ -1473,7 +1507,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                  "Value with a width greater than field width "
                                  "found in record %d for field %s. "
                                  "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
+                                 nRecord, poFieldDefn->GetNameRef());
                     }
                     else if (!bWarningBadTypeOrWidth &&
                              eType == CPL_VALUE_REAL &&
@@ -1492,7 +1526,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                      "field precision found in record %d for "
                                      "field %s. "
                                      "This warning will no longer be emitted",
-                                     nNextFID, poFieldDefn->GetNameRef());
+                                     nRecord, poFieldDefn->GetNameRef());
                         }
                     }
                 }
@@ -1505,7 +1539,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                             CE_Warning, CPLE_AppDefined,
                             "Invalid value type found in record %d for field "
                             "%s. This warning will no longer be emitted.",
-                            nNextFID, poFieldDefn->GetNameRef());
+                            nRecord, poFieldDefn->GetNameRef());
                     }
                 }
             }
@@ -1523,7 +1557,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                         CE_Warning, CPLE_AppDefined,
                         "Invalid value type found in record %d for field %s. "
                         "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
+                        nRecord, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1545,7 +1579,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                              "Value with a width greater than field width "
                              "found in record %d for field %s. "
                              "This warning will no longer be emitted",
-                             nNextFID, poFieldDefn->GetNameRef());
+                             nRecord, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1672,11 +1706,274 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
     CSLDestroy(papszTokens);
 
-    // Translate the record id.
-    poFeature->SetFID(nNextFID++);
+    return poFeature;
+}
 
-    m_nFeaturesRead++;
+/************************************************************************/
+/*                            ParseChunkJob                             */
+/************************************************************************/
+
+struct OGRCSVLayer::ParseChunkJob
+{
+    OGRCSVLayer *poLayer = nullptr;
+    const char *pszData = nullptr;
+    size_t nSize = 0;
+    int nFirstRecord = 0;
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    std::vector<size_t> anErrorFeatureIdx{};  // one per item of aoErrors
+    bool bError = false;
+};
+
+/************************************************************************/
+/*                         ParseChunkJobFunc()                          */
+/************************************************************************/
+
+void OGRCSVLayer::ParseChunkJobFunc(void *pData)
+{
+    auto psJob = static_cast<ParseChunkJob *>(pData);
+    auto poLayer = psJob->poLayer;
+    CSVBufferReader oReader(psJob->pszData, psJob->nSize);
+    int nRecord = psJob->nFirstRecord;
+    // Errors are collected to be emitted by the thread reading the features
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    while (true)
+    {
+        psJob->anErrorFeatureIdx.resize(psJob->aoErrors.size(),
+                                        psJob->apoFeatures.size());
+        char **papszTokens = oReader.ReadParseLine(
+            poLayer->m_nMaxLineSize, poLayer->szDelimiter,
+            poLayer->bHonourStrings,
+            false,  // bKeepLeadingAndClosingQuotes
+            poLayer->bMergeDelimiter,
+            true  // bSkipBOM
+        );
+        if (papszTokens == nullptr)
+            break;
+        if (papszTokens[0] == nullptr)
+        {
+            CSLDestroy(papszTokens);
+            continue;
+        }
+        psJob->apoFeatures.emplace_back(
+            poLayer->BuildFeatureFromTokens(papszTokens, nRecord));
+        ++nRecord;
+    }
+    CPLUninstallErrorHandlerAccumulator();
+    psJob->anErrorFeatureIdx.resize(psJob->aoErrors.size(),
+                                    psJob->apoFeatures.size());
+    psJob->bError = std::any_of(
+        psJob->aoErrors.begin(), psJob->aoErrors.end(),
+        [](const CPLErrorHandlerAccumulatorStruct &oError)
+        { return oError.type == CE_Failure || oError.type == CE_Fatal; });
+}
+
+/************************************************************************/
+/*                     ReadNextBatchMultiThreaded()                     */
+/*                                                                      */
+/*      Read a large chunk of the file, split it at record boundaries   */
+/*      into as many parts as threads, and turn each part into          */
+/*      features in a worker thread.                                    */
+/************************************************************************/
+
+bool OGRCSVLayer::ReadNextBatchMultiThreaded()
+{
+    if (m_bMTEOF)
+        return false;
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(m_nNumThreads);
+    if (poPool == nullptr)
+        return false;
+
+    constexpr size_t CHUNK_SIZE_PER_THREAD = 1024 * 1024;
+    const size_t nChunkSize =
+        CHUNK_SIZE_PER_THREAD * static_cast<size_t>(m_nNumThreads);
+
+    std::vector<ParseChunkJob> asJobs;
+    size_t nConsumed = 0;
+    int nRecord = nNextFID;
+    while (true)
+    {
+        const size_t nOldSize = m_osMTBuffer.size();
+        try
+        {
+            m_osMTBuffer.resize(nOldSize + nChunkSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate buffer for CSV reading");
+            m_bMTEOF = true;
+            return false;
+        }
+        const size_t nRead =
+            VSIFReadL(&m_osMTBuffer[nOldSize], 1, nChunkSize, fpCSV);
+        m_osMTBuffer.resize(nOldSize + nRead);
+        const bool bEOF = nRead < nChunkSize;
+        if (m_osMTBuffer.empty())
+        {
+            m_bMTEOF = true;
+            return false;
+        }
+
+        // Locate the record boundaries, that is end-of-line characters
+        // that are preceded by an even number of double quotes since the
+        // start of the buffer (which is itself at a record boundary), and
+        // split the buffer into parts of roughly the same size.
+        const char *const pszStart = m_osMTBuffer.c_str();
+        const char *const pszEnd = pszStart + m_osMTBuffer.size();
+        const size_t nTargetSize = std::max<size_t>(
+            1, m_osMTBuffer.size() / static_cast<size_t>(m_nNumThreads));
+        asJobs.clear();
+        ParseChunkJob sCurJob;
+        sCurJob.pszData = pszStart;
+        sCurJob.nFirstRecord = nRecord;
+        int nCurJobRecords = 0;
+        const char *pszRecordStart = pszStart;
+        bool bInString = false;
+        const char *pszIter = pszStart;
+        while (pszIter < pszEnd)
+        {
+            // strpbrk() stops at the nul character terminating the buffer,
+            // but also on nul characters in the data, that must be skipped.
+            const char *pszSpecial =
+                strpbrk(pszIter, bInString ? "\"" : "\"\r\n");
+            if (pszSpecial == nullptr)
+            {
+                pszIter += strlen(pszIter) + 1;
+                continue;
+            }
+            pszIter = pszSpecial + 1;
+            if (*pszSpecial == '"')
+            {
+                bInString = !bInString;
+                continue;
+            }
+
+            // Count records as GetNextLineTokens() does, skipping empty
+            // lines (possibly made only of a UTF-8 BOM).
+            const size_t nRecordSize =
+                static_cast<size_t>(pszSpecial - pszRecordStart);
+            if (nRecordSize > 0 &&
+                !(nRecordSize == 3 &&
+                  memcmp(pszRecordStart, "\xEF\xBB\xBF", 3) == 0))
+            {
+                nCurJobRecords++;
+            }
+            pszRecordStart = pszIter;
+
+            if (static_cast<size_t>(pszIter - sCurJob.pszData) >=
+                    nTargetSize &&
+                static_cast<int>(asJobs.size()) < m_nNumThreads - 1)
+            {
+                sCurJob.nSize = static_cast<size_t>(pszIter - sCurJob.pszData);
+                asJobs.emplace_back(std::move(sCurJob));
+                sCurJob = ParseChunkJob();
+                sCurJob.pszData = pszIter;
+                nRecord += nCurJobRecords;
+                sCurJob.nFirstRecord = nRecord;
+                nCurJobRecords = 0;
+            }
+        }
+
+        // At end of file, the last record does not need to be terminated.
+        if (bEOF)
+            pszRecordStart = pszEnd;
+        sCurJob.nSize = static_cast<size_t>(pszRecordStart - sCurJob.pszData);
+        if (sCurJob.nSize > 0)
+            asJobs.emplace_back(std::move(sCurJob));
+        nConsumed = static_cast<size_t>(pszRecordStart - pszStart);
+        if (nConsumed > 0 || bEOF)
+        {
+            m_bMTEOF = bEOF;
+            break;
+        }
+        // No complete record in the buffer: read more, unless the pending
+        // record is already larger than allowed, which happens in
+        // particular with an unbalanced double quote.
+        if (m_nMaxLineSize > 0 &&
+            m_osMTBuffer.size() >= static_cast<size_t>(m_nMaxLineSize))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Maximum number of characters allowed reached.");
+            m_osMTBuffer.clear();
+            m_bMTEOF = true;
+            return false;
+        }
+        nRecord = nNextFID;
+    }
+
+    auto poQueue = poPool->CreateJobQueue();
+    for (auto &sJob : asJobs)
+    {
+        sJob.poLayer = this;
+        poQueue->SubmitJob(ParseChunkJobFunc, &sJob);
+    }
+    poQueue->WaitCompletion();
+
+    m_apoMTFeatures.clear();
+    m_iMTFeature = 0;
+    m_aoMTErrors.clear();
+    m_iMTError = 0;
+    for (auto &sJob : asJobs)
+    {
+        for (size_t i = 0; i < sJob.aoErrors.size(); ++i)
+        {
+            m_aoMTErrors.emplace_back(m_apoMTFeatures.size() +
+                                          sJob.anErrorFeatureIdx[i],
+                                      std::move(sJob.aoErrors[i]));
+        }
+        for (auto &poFeature : sJob.apoFeatures)
+            m_apoMTFeatures.emplace_back(std::move(poFeature));
+        if (sJob.bError)
+        {
+            m_bMTEOF = true;
+            break;
+        }
+    }
+    m_osMTBuffer.erase(0, nConsumed);
+
+    return true;
+}
+
+/************************************************************************/
+/*                            EmitMTErrors()                            */
+/************************************************************************/
+
+// Emit the errors raised by the worker threads up to the reading of the
+// feature of index nUpToFeature of the current batch, in the calling thread.
+void OGRCSVLayer::EmitMTErrors(size_t nUpToFeature)
+{
+    for (; m_iMTError < m_aoMTErrors.size() &&
+           m_aoMTErrors[m_iMTError].first <= nUpToFeature;
+         ++m_iMTError)
+    {
+        const auto &oError = m_aoMTErrors[m_iMTError].second;
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+}
 
+/************************************************************************/
+/*                GetNextUnfilteredFeatureMultiThreaded()               */
+/************************************************************************/
+
+OGRFeature *OGRCSVLayer::GetNextUnfilteredFeatureMultiThreaded()
+{
+    if (fpCSV == nullptr)
+        return nullptr;
+
+    while (m_iMTFeature == m_apoMTFeatures.size())
+    {
+        // Errors raised after the last feature of the batch
+        EmitMTErrors(m_apoMTFeatures.size());
+        if (!ReadNextBatchMultiThreaded())
+            return nullptr;
+    }
+
+    EmitMTErrors(m_iMTFeature);
+    OGRFeature *poFeature = m_apoMTFeatures[m_iMTFeature++].release();
+    poFeature->SetFID(nNextFID++);
+    m_nFeaturesRead++;
     return poFeature;
 }
 
@@ -1692,9 +1989,13 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
 
     // Read features till we find one that satisfies our current
     // spatial criteria.
+    const bool bMultiThreaded =
+        m_nNumThreads > 1 && bHonourStrings && !bInWriteMode;
     while (true)
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
+        OGRFeature *poFeature = bMultiThreaded
+                                    ? GetNextUnfilteredFeatureMultiThreaded()
+                                    : GetNextUnfilteredFeature();
         if (poFeature == nullptr)
             return nullptr;
 
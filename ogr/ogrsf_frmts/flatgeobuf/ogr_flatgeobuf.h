@@ -102,6 +102,19 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     bool m_ignoreSpatialFilter = false;
     bool m_ignoreAttributeFilter = false;
 
+    // coalesced reads of spatial index search hits
+    struct CoalescedRange
+    {
+        uint64_t offset = 0;   // file offset of the range
+        size_t itemsEnd = 0;   // index after the last found item in the range
+        std::vector<GByte> data;
+    };
+    bool m_bCoalescedReads = true;
+    std::vector<CoalescedRange> m_coalescedRanges;
+    size_t m_iCoalescedRange = 0;
+    size_t m_coalescedItemsBegin = 0;  // first found item index covered
+    size_t m_coalescedItemsEnd = 0;    // index after last found item covered
+
     // creation
     bool m_create = false;
     std::deque<FeatureItem> m_featureItems;  // feature item description used to
@@ -126,6 +139,8 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     void ensurePadfBuffers(size_t count);
     OGRErr ensureFeatureBuf(uint32_t featureSize);
     OGRErr parseFeature(OGRFeature *poFeature);
+    bool fillCoalescedRanges();
+    bool readCoalescedFeature(uint32_t &featureSize);
     const std::vector<flatbuffers::Offset<FlatGeobuf::Column>>
     writeColumns(flatbuffers::FlatBufferBuilder &fbb);
     void readColumns();
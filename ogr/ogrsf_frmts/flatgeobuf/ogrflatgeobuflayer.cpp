@@ -987,6 +987,171 @@ OGRErr OGRFlatGeobufLayer::ensureFeatureBuf(uint32_t featureSize)
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                       fillCoalescedRanges()                          */
+/************************************************************************/
+
+// Fetch the features of the spatial index search hits starting at
+// m_featuresPos by merging neighbouring hits into a few byte ranges that are
+// read with a single ReadMultiRange() call. This avoids a seek and two tiny
+// reads per feature, which translate into one HTTP request per feature on
+// network file systems.
+bool OGRFlatGeobufLayer::fillCoalescedRanges()
+{
+    m_coalescedRanges.clear();
+    m_iCoalescedRange = 0;
+    m_coalescedItemsBegin = m_featuresPos;
+    m_coalescedItemsEnd = m_featuresPos;
+
+    if (!CPLTestBool(
+            CPLGetConfigOption("OGR_FLATGEOBUF_COALESCE_READS", "YES")))
+        return false;
+
+    if (m_nFileSize == 0)
+    {
+        VSIStatBufL sStatBuf;
+        if (VSIStatL(m_osFilename.c_str(), &sStatBuf) != 0)
+            return false;
+        m_nFileSize = sStatBuf.st_size;
+    }
+
+    // Maximum distance between the start of two consecutive hits for them
+    // to be read in the same range.
+    const uint64_t nMaxDistance = static_cast<uint64_t>(std::max<GIntBig>(
+        0, CPLAtoGIntBig(CPLGetConfigOption(
+               "OGR_FLATGEOBUF_COALESCE_MAX_DISTANCE", "65536"))));
+    constexpr size_t MAX_RANGES = 100;
+    constexpr uint64_t MAX_RANGE_SIZE = 4 * 1024 * 1024;
+    constexpr uint64_t MAX_TOTAL_SIZE = 16 * 1024 * 1024;
+    constexpr uint64_t MIN_LAST_FEATURE_SIZE = 4096;
+
+    const size_t nItems = m_foundItems.size();
+    uint64_t nTotalSize = 0;
+    size_t i = m_featuresPos;
+    while (i < nItems && m_coalescedRanges.size() < MAX_RANGES &&
+           nTotalSize < MAX_TOTAL_SIZE)
+    {
+        size_t j = i;
+        while (j + 1 < nItems &&
+               m_foundItems[j + 1].offset > m_foundItems[j].offset &&
+               m_foundItems[j + 1].offset - m_foundItems[j].offset <=
+                   nMaxDistance &&
+               m_foundItems[j + 1].offset - m_foundItems[i].offset <=
+                   MAX_RANGE_SIZE)
+        {
+            ++j;
+        }
+
+        // The size of the last feature of the range is not known: guess it
+        // from the average distance between hits. If the guess is too short,
+        // that feature will be read the usual way.
+        uint64_t nLastFeatureSize = MIN_LAST_FEATURE_SIZE;
+        if (j > i)
+        {
+            nLastFeatureSize = std::max(
+                nLastFeatureSize,
+                (m_foundItems[j].offset - m_foundItems[i].offset) / (j - i));
+        }
+        const uint64_t nStart = m_offsetFeatures + m_foundItems[i].offset;
+        const uint64_t nEnd =
+            std::min(m_offsetFeatures + m_foundItems[j].offset +
+                         nLastFeatureSize,
+                     static_cast<uint64_t>(m_nFileSize));
+        if (nEnd <= nStart)
+            break;
+
+        CoalescedRange range;
+        range.offset = nStart;
+        range.itemsEnd = j + 1;
+        try
+        {
+            range.data.resize(static_cast<size_t>(nEnd - nStart));
+        }
+        catch (const std::bad_alloc &)
+        {
+            break;
+        }
+        nTotalSize += nEnd - nStart;
+        m_coalescedRanges.emplace_back(std::move(range));
+        i = j + 1;
+    }
+    if (m_coalescedRanges.empty())
+        return false;
+
+    const int nRanges = static_cast<int>(m_coalescedRanges.size());
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    for (auto &range : m_coalescedRanges)
+    {
+        apData.push_back(range.data.data());
+        anOffsets.push_back(range.offset);
+        anSizes.push_back(range.data.size());
+    }
+    CPLDebugOnly("FlatGeobuf",
+                 "Reading %lu features in %d ranges totalling " CPL_FRMT_GUIB
+                 " bytes",
+                 static_cast<long unsigned int>(i - m_featuresPos), nRanges,
+                 static_cast<GUIntBig>(nTotalSize));
+    if (VSIFReadMultiRangeL(nRanges, apData.data(), anOffsets.data(),
+                            anSizes.data(), m_poFp) != 0)
+    {
+        m_coalescedRanges.clear();
+        return false;
+    }
+    m_coalescedItemsEnd = i;
+    return true;
+}
+
+/************************************************************************/
+/*                       readCoalescedFeature()                         */
+/************************************************************************/
+
+// Copy the feature at m_offset, which must be the one of spatial index search
+// hit m_featuresPos, from the coalesced ranges into m_featureBuf. Returns
+// false if the feature is not (fully) available in them, in which case the
+// caller must read it from the file.
+bool OGRFlatGeobufLayer::readCoalescedFeature(uint32_t &featureSize)
+{
+    if (!m_bCoalescedReads)
+        return false;
+
+    if (m_featuresPos < m_coalescedItemsBegin ||
+        m_featuresPos >= m_coalescedItemsEnd)
+    {
+        if (!fillCoalescedRanges())
+        {
+            m_bCoalescedReads = false;
+            return false;
+        }
+    }
+
+    while (m_iCoalescedRange < m_coalescedRanges.size() &&
+           m_featuresPos >= m_coalescedRanges[m_iCoalescedRange].itemsEnd)
+    {
+        ++m_iCoalescedRange;
+    }
+    if (m_iCoalescedRange == m_coalescedRanges.size())
+        return false;
+
+    const auto &range = m_coalescedRanges[m_iCoalescedRange];
+    if (m_offset < range.offset)
+        return false;
+    const uint64_t nPos = m_offset - range.offset;
+    if (nPos + sizeof(featureSize) > range.data.size())
+        return false;
+    memcpy(&featureSize, range.data.data() + nPos, sizeof(featureSize));
+    CPL_LSBPTR32(&featureSize);
+    if (featureSize > range.data.size() - nPos - sizeof(featureSize))
+        return false;
+    if (ensureFeatureBuf(featureSize) != OGRERR_NONE)
+        return false;
+    memcpy(m_featureBuf, range.data.data() + nPos + sizeof(featureSize),
+           featureSize);
+    m_offset += featureSize + sizeof(featureSize);
+    return true;
+}
+
 OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
 {
     GIntBig fid;
@@ -1010,48 +1175,52 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     if (m_featuresPos == 0)
         seek = true;
 
-    if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
-    {
-        if (VSIFEofL(m_poFp))
-            return OGRERR_NONE;
-        return CPLErrorIO("seeking to feature location");
-    }
-    uint32_t featureSize;
-    if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
-    {
-        if (VSIFEofL(m_poFp))
-            return OGRERR_NONE;
-        return CPLErrorIO("reading feature size");
-    }
-    CPL_LSBPTR32(&featureSize);
-
-    // Sanity check to avoid allocated huge amount of memory on corrupted
-    // feature
-    if (featureSize > 100 * 1024 * 1024)
+    uint32_t featureSize = 0;
+    if (!(m_queriedSpatialIndex && !m_ignoreSpatialFilter &&
+          readCoalescedFeature(featureSize)))
     {
-        if (featureSize > feature_max_buffer_size)
-            return CPLErrorInvalidSize("feature");
-
-        if (m_nFileSize == 0)
+        if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
         {
-            VSIStatBufL sStatBuf;
-            if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
-            {
-                m_nFileSize = sStatBuf.st_size;
-            }
+            if (VSIFEofL(m_poFp))
+                return OGRERR_NONE;
+            return CPLErrorIO("seeking to feature location");
         }
-        if (m_offset + featureSize > m_nFileSize)
+        if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
         {
+            if (VSIFEofL(m_poFp))
+                return OGRERR_NONE;
             return CPLErrorIO("reading feature size");
         }
-    }
+        CPL_LSBPTR32(&featureSize);
 
-    const auto err = ensureFeatureBuf(featureSize);
-    if (err != OGRERR_NONE)
-        return err;
-    if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        return CPLErrorIO("reading feature");
-    m_offset += featureSize + sizeof(featureSize);
+        // Sanity check to avoid allocated huge amount of memory on corrupted
+        // feature
+        if (featureSize > 100 * 1024 * 1024)
+        {
+            if (featureSize > feature_max_buffer_size)
+                return CPLErrorInvalidSize("feature");
+
+            if (m_nFileSize == 0)
+            {
+                VSIStatBufL sStatBuf;
+                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                {
+                    m_nFileSize = sStatBuf.st_size;
+                }
+            }
+            if (m_offset + featureSize > m_nFileSize)
+            {
+                return CPLErrorIO("reading feature size");
+            }
+        }
+
+        const auto err = ensureFeatureBuf(featureSize);
+        if (err != OGRERR_NONE)
+            return err;
+        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
+            return CPLErrorIO("reading feature");
+        m_offset += featureSize + sizeof(featureSize);
+    }
 
     if (m_bVerifyBuffers)
     {
@@ -1446,55 +1615,59 @@ int OGRFlatGeobufLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         if (m_featuresPos == 0)
             seek = true;
 
-        if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+        uint32_t featureSize = 0;
+        if (!(m_queriedSpatialIndex && !m_ignoreSpatialFilter &&
+              readCoalescedFeature(featureSize)))
         {
-            break;
-        }
-        uint32_t featureSize;
-        if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
-        {
-            if (VSIFEofL(m_poFp))
+            if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+            {
                 break;
-            CPLErrorIO("reading feature size");
-            goto error;
-        }
-        CPL_LSBPTR32(&featureSize);
-
-        // Sanity check to avoid allocated huge amount of memory on corrupted
-        // feature
-        if (featureSize > 100 * 1024 * 1024)
-        {
-            if (featureSize > feature_max_buffer_size)
+            }
+            if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
             {
-                CPLErrorInvalidSize("feature");
+                if (VSIFEofL(m_poFp))
+                    break;
+                CPLErrorIO("reading feature size");
                 goto error;
             }
+            CPL_LSBPTR32(&featureSize);
 
-            if (m_nFileSize == 0)
+            // Sanity check to avoid allocated huge amount of memory on
+            // corrupted feature
+            if (featureSize > 100 * 1024 * 1024)
             {
-                VSIStatBufL sStatBuf;
-                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                if (featureSize > feature_max_buffer_size)
                 {
-                    m_nFileSize = sStatBuf.st_size;
+                    CPLErrorInvalidSize("feature");
+                    goto error;
+                }
+
+                if (m_nFileSize == 0)
+                {
+                    VSIStatBufL sStatBuf;
+                    if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                    {
+                        m_nFileSize = sStatBuf.st_size;
+                    }
+                }
+                if (m_offset + featureSize > m_nFileSize)
+                {
+                    CPLErrorIO("reading feature size");
+                    goto error;
                 }
             }
-            if (m_offset + featureSize > m_nFileSize)
+
+            const auto err = ensureFeatureBuf(featureSize);
+            if (err != OGRERR_NONE)
+                goto error;
+            if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
             {
-                CPLErrorIO("reading feature size");
+                CPLErrorIO("reading feature");
                 goto error;
             }
+            m_offset += featureSize + sizeof(featureSize);
         }
 
-        const auto err = ensureFeatureBuf(featureSize);
-        if (err != OGRERR_NONE)
-            goto error;
-        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        {
-            CPLErrorIO("reading feature");
-            goto error;
-        }
-        m_offset += featureSize + sizeof(featureSize);
-
         if (m_bVerifyBuffers)
         {
             Verifier v(m_featureBuf, featureSize);
@@ -2267,6 +2440,11 @@ void OGRFlatGeobufLayer::ResetReading()
     m_queriedSpatialIndex = false;
     m_ignoreSpatialFilter = false;
     m_ignoreAttributeFilter = false;
+    m_bCoalescedReads = true;
+    m_coalescedRanges.clear();
+    m_iCoalescedRange = 0;
+    m_coalescedItemsBegin = 0;
+    m_coalescedItemsEnd = 0;
     return;
 }
 
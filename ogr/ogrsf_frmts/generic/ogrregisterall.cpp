@@ -239,6 +239,9 @@ void OGRRegisterAllInternal()
 #ifdef MVT_ENABLED
     RegisterOGRMVT();
 #endif
+#ifdef PMTILES_ENABLED
+    RegisterOGRPMTiles();
+#endif
 #ifdef NGW_ENABLED
     RegisterOGRNGW();
 #endif  // NGW_ENABLED
@@ -30,6 +30,9 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_vsi_error.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_geojson.h"
 #include "ogrgeojsonreader.h"
@@ -104,7 +107,26 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     OGRGeometryFactory::TransformWithOptionsCache m_oTransformCache;
     OGRGeoJSONWriteOptions m_oWriteOptions;
 
+    // Multi-threaded reading
+    int m_nNumThreads = 1;
+    struct ParseJob;
+    struct Batch;
+    std::unique_ptr<Batch> m_poCurBatch{};
+    std::unique_ptr<Batch> m_poPendingBatch{};
+    std::string m_osMTLeftover{};
+    bool m_bMTEOF = false;
+    size_t m_iMTJob = 0;
+    size_t m_iMTItem = 0;
+
     json_object *GetNextObject(bool bLooseIdentification);
+    OGRFeature *BuildFeature(json_object *poObject,
+                             const char *pszSerializedObj);
+
+    bool SubmitNextBatch(bool bBuildFeatures);
+    bool GetNextBatchMultiThreaded(bool bBuildFeatures);
+    json_object *GetNextObjectMultiThreaded();
+    OGRFeature *GetNextFeatureMultiThreaded();
+    static void ParseJobFunc(void *pData);
 
   public:
     OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS, const char *pszName);
@@ -118,6 +140,11 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
 
     bool Init(bool bLooseIdentification, bool bEstablishLayerDefn);
 
+    void SetNumThreads(int nNumThreads)
+    {
+        m_nNumThreads = nNumThreads;
+    }
+
     const char *GetName() override
     {
         return GetDescription();
@@ -135,6 +162,63 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     OGRErr CreateField(OGRFieldDefn *, int) override;
 };
 
+/************************************************************************/
+/*                               ParseJob                               */
+/************************************************************************/
+
+struct OGRGeoJSONSeqLayer::ParseJob
+{
+    OGRGeoJSONSeqLayer *poLayer = nullptr;
+    char *pszData = nullptr;
+    size_t nSize = 0;
+    char chSep = '\n';
+    bool bBuildFeatures = false;
+    std::vector<json_object *> apoObjects{};
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+
+    // Errors raised while parsing, and for each of them, the index of the
+    // item (object or feature) that was being built when it was raised.
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    std::vector<size_t> anErrorItemIdx{};
+    size_t iNextError = 0;
+
+    ParseJob() = default;
+    ParseJob(const ParseJob &) = delete;
+    ParseJob &operator=(const ParseJob &) = delete;
+
+    ~ParseJob()
+    {
+        for (auto poObject : apoObjects)
+            json_object_put(poObject);
+    }
+
+    // Emit, in the calling thread, the errors raised up to the building of
+    // the item of index nUpToItem.
+    void EmitErrors(size_t nUpToItem)
+    {
+        for (; iNextError < aoErrors.size() &&
+               anErrorItemIdx[iNextError] <= nUpToItem;
+             ++iNextError)
+        {
+            const auto &oError = aoErrors[iNextError];
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+    }
+};
+
+/************************************************************************/
+/*                                Batch                                 */
+/************************************************************************/
+
+struct OGRGeoJSONSeqLayer::Batch
+{
+    std::string osData{};
+    std::vector<std::unique_ptr<ParseJob>> apoJobs{};
+    // Must be declared last, so that its destructor, which waits for the
+    // completion of the jobs, is called before the data is freed.
+    std::unique_ptr<CPLJobQueue> poQueue{};
+};
+
 /************************************************************************/
 /*                       OGRGeoJSONSeqDataSource()                      */
 /************************************************************************/
@@ -291,6 +375,8 @@ OGRGeoJSONSeqLayer::OGRGeoJSONSeqLayer(
 
 OGRGeoJSONSeqLayer::~OGRGeoJSONSeqLayer()
 {
+    m_poPendingBatch.reset();
+    m_poCurBatch.reset();
     m_poFeatureDefn->Release();
 }
 
@@ -334,9 +420,15 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
     gdal::DirectedAcyclicGraph<int, std::string> dag;
     bool bOK = false;
 
+    // When scanning the whole file, JSON parsing can be done by worker
+    // threads, while the layer definition is built in order.
+    const bool bMultiThreaded =
+        m_nNumThreads > 1 && bEstablishLayerDefn && !bLooseIdentification;
     while (true)
     {
-        auto poObject = GetNextObject(bLooseIdentification);
+        auto poObject = bMultiThreaded
+                            ? GetNextObjectMultiThreaded()
+                            : GetNextObject(bLooseIdentification);
         if (!poObject)
             break;
         const auto eObjectType = OGRGeoJSONGetType(poObject);
@@ -401,6 +493,13 @@ void OGRGeoJSONSeqLayer::ResetReading()
     m_nPosInBuffer = nBufferSizeValidated;
     m_nBufferValidSize = nBufferSizeValidated;
     m_nNextFID = 0;
+
+    m_poPendingBatch.reset();
+    m_poCurBatch.reset();
+    m_osMTLeftover.clear();
+    m_bMTEOF = false;
+    m_iMTJob = 0;
+    m_iMTItem = 0;
 }
 
 /************************************************************************/
@@ -503,6 +602,277 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
     }
 }
 
+/************************************************************************/
+/*                            BuildFeature()                            */
+/*                                                                      */
+/*      Returns nullptr for objects that are not features or            */
+/*      geometries. May be called from several threads at the same      */
+/*      time.                                                           */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONSeqLayer::BuildFeature(json_object *poObject,
+                                             const char *pszSerializedObj)
+{
+    const auto type = OGRGeoJSONGetType(poObject);
+    if (type == GeoJSONObject::eFeature)
+    {
+        return m_oReader.ReadFeature(this, poObject, pszSerializedObj);
+    }
+    else if (type == GeoJSONObject::eFeatureCollection ||
+             type == GeoJSONObject::eUnknown)
+    {
+        return nullptr;
+    }
+
+    OGRGeometry *poGeom = m_oReader.ReadGeometry(poObject, GetSpatialRef());
+    if (!poGeom)
+        return nullptr;
+    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    poFeature->SetGeometryDirectly(poGeom);
+    return poFeature;
+}
+
+/************************************************************************/
+/*                            ParseJobFunc()                            */
+/************************************************************************/
+
+void OGRGeoJSONSeqLayer::ParseJobFunc(void *pData)
+{
+    auto psJob = static_cast<ParseJob *>(pData);
+    char *pszIter = psJob->pszData;
+    char *const pszEnd = pszIter + psJob->nSize;
+    const auto RecordErrorItemIdx = [psJob]()
+    {
+        psJob->anErrorItemIdx.resize(psJob->aoErrors.size(),
+                                     psJob->bBuildFeatures
+                                         ? psJob->apoFeatures.size()
+                                         : psJob->apoObjects.size());
+    };
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    while (pszIter < pszEnd)
+    {
+        char *pszSep = static_cast<char *>(memchr(
+            pszIter, psJob->chSep, static_cast<size_t>(pszEnd - pszIter)));
+        char *pszRecordEnd = pszSep ? pszSep : pszEnd;
+        char *pszNext = pszSep ? pszSep + 1 : pszEnd;
+        while (pszRecordEnd > pszIter &&
+               (pszRecordEnd[-1] == '\r' || pszRecordEnd[-1] == '\n'))
+        {
+            --pszRecordEnd;
+        }
+        if (pszRecordEnd > pszIter)
+        {
+            // The last record of the batch is already nul-terminated.
+            if (pszRecordEnd < pszEnd)
+                *pszRecordEnd = '\0';
+            json_object *poObject = nullptr;
+            CPL_IGNORE_RET_VAL(OGRJSonParse(pszIter, &poObject));
+            if (json_object_get_type(poObject) != json_type_object)
+            {
+                json_object_put(poObject);
+            }
+            else if (psJob->bBuildFeatures)
+            {
+                OGRFeature *poFeature =
+                    psJob->poLayer->BuildFeature(poObject, pszIter);
+                json_object_put(poObject);
+                if (poFeature)
+                    psJob->apoFeatures.emplace_back(poFeature);
+            }
+            else
+            {
+                psJob->apoObjects.push_back(poObject);
+            }
+            RecordErrorItemIdx();
+        }
+        pszIter = pszNext;
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*                          SubmitNextBatch()                           */
+/*                                                                      */
+/*      Read the next block of the file, split it at record             */
+/*      separators into one part per thread, and submit the parsing of  */
+/*      those parts to the global thread pool.                          */
+/************************************************************************/
+
+bool OGRGeoJSONSeqLayer::SubmitNextBatch(bool bBuildFeatures)
+{
+    if (m_bMTEOF)
+        return false;
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(m_nNumThreads);
+    if (poPool == nullptr)
+        return false;
+
+    constexpr size_t CHUNK_SIZE_PER_THREAD = 1024 * 1024;
+    const size_t nChunkSize =
+        CHUNK_SIZE_PER_THREAD * static_cast<size_t>(m_nNumThreads);
+
+    auto poBatch = cpl::make_unique<Batch>();
+    std::string &osData = poBatch->osData;
+    std::swap(osData, m_osMTLeftover);
+    size_t nLastSep = 0;
+    while (true)
+    {
+        const bool bStartOfFile = VSIFTellL(m_poDS->m_fp) == 0;
+        const size_t nOldSize = osData.size();
+        try
+        {
+            osData.resize(nOldSize + nChunkSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate buffer for GeoJSONSeq reading");
+            m_bMTEOF = true;
+            return false;
+        }
+        const size_t nRead =
+            VSIFReadL(&osData[nOldSize], 1, nChunkSize, m_poDS->m_fp);
+        osData.resize(nOldSize + nRead);
+        if (bStartOfFile && nRead > 0)
+            m_poDS->m_bIsRSSeparated = (osData[0] == RS);
+        if (nRead < nChunkSize)
+        {
+            m_bMTEOF = true;
+            nLastSep = osData.size();
+            break;
+        }
+        nLastSep = osData.rfind(m_poDS->m_bIsRSSeparated ? RS : '\n');
+        if (nLastSep != std::string::npos)
+        {
+            nLastSep++;
+            break;
+        }
+        if (m_nMaxObjectSize > 0 && osData.size() > m_nMaxObjectSize)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Too large feature. You may define the "
+                     "OGR_GEOJSON_MAX_OBJ_SIZE configuration option to "
+                     "a value in megabytes (larger than %u) to allow "
+                     "for larger features, or 0 to remove any size limit.",
+                     static_cast<unsigned>(osData.size() / 1024 / 1024));
+            m_bMTEOF = true;
+            return false;
+        }
+    }
+    m_osMTLeftover.assign(osData, nLastSep, std::string::npos);
+    osData.resize(nLastSep);
+    if (osData.empty())
+        return false;
+
+    const char chSep = m_poDS->m_bIsRSSeparated ? RS : '\n';
+    const size_t nTargetSize =
+        std::max<size_t>(1, osData.size() / static_cast<size_t>(m_nNumThreads));
+    size_t nPos = 0;
+    while (nPos < osData.size())
+    {
+        size_t nEnd = nPos + nTargetSize;
+        if (nEnd >= osData.size())
+        {
+            nEnd = osData.size();
+        }
+        else
+        {
+            nEnd = osData.find(chSep, nEnd);
+            nEnd = nEnd == std::string::npos ? osData.size() : nEnd + 1;
+        }
+        auto poJob = cpl::make_unique<ParseJob>();
+        poJob->poLayer = this;
+        poJob->pszData = &osData[nPos];
+        poJob->nSize = nEnd - nPos;
+        poJob->chSep = chSep;
+        poJob->bBuildFeatures = bBuildFeatures;
+        poBatch->apoJobs.emplace_back(std::move(poJob));
+        nPos = nEnd;
+    }
+
+    poBatch->poQueue = poPool->CreateJobQueue();
+    for (auto &poJob : poBatch->apoJobs)
+        poBatch->poQueue->SubmitJob(ParseJobFunc, poJob.get());
+    m_poPendingBatch = std::move(poBatch);
+    return true;
+}
+
+/************************************************************************/
+/*                     GetNextBatchMultiThreaded()                      */
+/************************************************************************/
+
+bool OGRGeoJSONSeqLayer::GetNextBatchMultiThreaded(bool bBuildFeatures)
+{
+    m_poCurBatch.reset();
+    if (!m_poPendingBatch && !SubmitNextBatch(bBuildFeatures))
+        return false;
+    m_poPendingBatch->poQueue->WaitCompletion();
+    m_poCurBatch = std::move(m_poPendingBatch);
+    m_iMTJob = 0;
+    m_iMTItem = 0;
+
+    // Start parsing the next batch while the current one is consumed.
+    SubmitNextBatch(bBuildFeatures);
+    return true;
+}
+
+/************************************************************************/
+/*                     GetNextObjectMultiThreaded()                     */
+/************************************************************************/
+
+json_object *OGRGeoJSONSeqLayer::GetNextObjectMultiThreaded()
+{
+    while (true)
+    {
+        if (m_poCurBatch)
+        {
+            while (m_iMTJob < m_poCurBatch->apoJobs.size())
+            {
+                auto &oJob = *(m_poCurBatch->apoJobs[m_iMTJob]);
+                auto &apoObjects = oJob.apoObjects;
+                oJob.EmitErrors(m_iMTItem);
+                if (m_iMTItem < apoObjects.size())
+                {
+                    json_object *poObject = apoObjects[m_iMTItem];
+                    apoObjects[m_iMTItem] = nullptr;
+                    ++m_iMTItem;
+                    return poObject;
+                }
+                ++m_iMTJob;
+                m_iMTItem = 0;
+            }
+        }
+        if (!GetNextBatchMultiThreaded(/* bBuildFeatures = */ false))
+            return nullptr;
+    }
+}
+
+/************************************************************************/
+/*                     GetNextFeatureMultiThreaded()                    */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONSeqLayer::GetNextFeatureMultiThreaded()
+{
+    while (true)
+    {
+        if (m_poCurBatch)
+        {
+            while (m_iMTJob < m_poCurBatch->apoJobs.size())
+            {
+                auto &oJob = *(m_poCurBatch->apoJobs[m_iMTJob]);
+                auto &apoFeatures = oJob.apoFeatures;
+                oJob.EmitErrors(m_iMTItem);
+                if (m_iMTItem < apoFeatures.size())
+                    return apoFeatures[m_iMTItem++].release();
+                ++m_iMTJob;
+                m_iMTItem = 0;
+            }
+        }
+        if (!GetNextBatchMultiThreaded(/* bBuildFeatures = */ true))
+            return nullptr;
+    }
+}
+
 /************************************************************************/
 /*                           GetNextFeature()                           */
 /************************************************************************/
@@ -523,34 +893,22 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     GetLayerDefn();  // force scan if not already done
     while (true)
     {
-        auto poObject = GetNextObject(false);
-        if (!poObject)
-            return nullptr;
         OGRFeature *poFeature;
-        auto type = OGRGeoJSONGetType(poObject);
-        if (type == GeoJSONObject::eFeature)
-        {
-            poFeature = m_oReader.ReadFeature(this, poObject,
-                                              m_osFeatureBuffer.c_str());
-            json_object_put(poObject);
-        }
-        else if (type == GeoJSONObject::eFeatureCollection ||
-                 type == GeoJSONObject::eUnknown)
+        if (m_nNumThreads > 1)
         {
-            json_object_put(poObject);
-            continue;
+            poFeature = GetNextFeatureMultiThreaded();
+            if (!poFeature)
+                return nullptr;
         }
         else
         {
-            OGRGeometry *poGeom =
-                m_oReader.ReadGeometry(poObject, GetSpatialRef());
+            auto poObject = GetNextObject(false);
+            if (!poObject)
+                return nullptr;
+            poFeature = BuildFeature(poObject, m_osFeatureBuffer.c_str());
             json_object_put(poObject);
-            if (!poGeom)
-            {
+            if (!poFeature)
                 continue;
-            }
-            poFeature = new OGRFeature(m_poFeatureDefn);
-            poFeature->SetGeometryDirectly(poGeom);
         }
 
         if (poFeature->GetFID() == OGRNullFID)
@@ -786,6 +1144,11 @@ bool OGRGeoJSONSeqDataSource::Open(GDALOpenInfo *poOpenInfo,
     }
     SetDescription(poOpenInfo->pszFilename);
     auto poLayer = new OGRGeoJSONSeqLayer(this, osLayerName.c_str());
+    if (poOpenInfo->eAccess != GA_Update)
+    {
+        poLayer->SetNumThreads(
+            GDALGetNumThreads(poOpenInfo->papszOpenOptions, "NUM_THREADS"));
+    }
     const bool bLooseIdentification =
         nSrcType == eGeoJSONSourceService &&
         !STARTS_WITH_CI(poOpenInfo->pszFilename, "GeoJSONSeq:");
@@ -956,6 +1319,14 @@ void RegisterOGRGeoJSONSeq()
         "  </Option>"
         "</LayerCreationOptionList>");
 
+    poDriver->SetMetadataItem(
+        GDAL_DMD_OPENOPTIONLIST,
+        "<OpenOptionList>"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "threads used to parse records (integer or ALL_CPUS). Defaults to the "
+        "GDAL_NUM_THREADS configuration option, or 1'/>"
+        "</OpenOptionList>");
+
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONFIELDDATATYPES,
                               "Integer Integer64 Real String IntegerList "
@@ -32,8 +32,10 @@
 #define OGRMEM_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "cpl_quad_tree.h"
 
 #include <map>
+#include <vector>
 
 /************************************************************************/
 /*                             OGRMemLayer                              */
@@ -68,12 +70,28 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
 
     bool m_bUpdated;
 
+    // Spatial index of the FIDs of features, on the geometry field
+    // m_iSpatialIndexGeomField. Built at the first read with a spatial
+    // filter, and kept up to date afterwards. It is dropped, and rebuilt at
+    // the next such read, when a feature falls outside of its root bounds.
+    CPLQuadTree *m_hSpatialIndex = nullptr;
+    CPLRectObj m_sSpatialIndexBounds{0, 0, 0, 0};
+    int m_iSpatialIndexGeomField = -1;
+    bool m_bSpatialIndexSearchDone = false;
+    std::vector<GIntBig> m_anSpatialIndexHits{};
+    size_t m_iNextSpatialIndexHit = 0;
+
     // Only use it in the lifetime of a function where the list of features
     // doesn't change.
     IOGRMemLayerFeatureIterator *GetIterator();
 
     const OGRFeature *GetFeatureRef(GIntBig nFeatureId);
 
+    bool BuildSpatialIndex();
+    void SpatialIndexInsert(const OGRFeature *poFeature);
+    void SpatialIndexRemove(const OGRFeature *poFeature);
+    void DropSpatialIndex();
+
   public:
     OGRMemLayer(const char *pszName, OGRSpatialReference *poSRS,
                 OGRwkbGeometryType eGeomType);
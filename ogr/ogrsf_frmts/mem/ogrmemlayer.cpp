@@ -30,9 +30,12 @@
 #include "cpl_port.h"
 #include "ogr_mem.h"
 
+#include <climits>
 #include <cstddef>
 #include <cstring>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <map>
 #include <new>
 #include <utility>
@@ -119,6 +122,9 @@ OGRMemLayer::~OGRMemLayer()
         }
     }
 
+    if (m_hSpatialIndex)
+        CPLQuadTreeDestroy(m_hSpatialIndex);
+
     if (m_poFeatureDefn)
         m_poFeatureDefn->Release();
 }
@@ -132,6 +138,9 @@ void OGRMemLayer::ResetReading()
 {
     m_iNextReadFID = 0;
     m_oMapFeaturesIter = m_oMapFeatures.begin();
+    m_bSpatialIndexSearchDone = false;
+    m_anSpatialIndexHits.clear();
+    m_iNextSpatialIndexHit = 0;
 }
 
 /************************************************************************/
@@ -141,6 +150,51 @@ void OGRMemLayer::ResetReading()
 OGRFeature *OGRMemLayer::GetNextFeature()
 
 {
+    if (m_poFilterGeom != nullptr && !m_bSpatialIndexSearchDone &&
+        CPLTestBool(CPLGetConfigOption("OGR_MEM_SPATIAL_INDEX", "YES")) &&
+        (m_iSpatialIndexGeomField == m_iGeomFieldFilter ||
+         BuildSpatialIndex()))
+    {
+        CPLRectObj sAOI;
+        sAOI.minx = m_sFilterEnvelope.MinX;
+        sAOI.miny = m_sFilterEnvelope.MinY;
+        sAOI.maxx = m_sFilterEnvelope.MaxX;
+        sAOI.maxy = m_sFilterEnvelope.MaxY;
+        int nCount = 0;
+        void **pahHits = CPLQuadTreeSearch(m_hSpatialIndex, &sAOI, &nCount);
+        m_anSpatialIndexHits.resize(nCount);
+        for (int i = 0; i < nCount; ++i)
+        {
+            m_anSpatialIndexHits[i] =
+                static_cast<GIntBig>(reinterpret_cast<size_t>(pahHits[i]));
+        }
+        CPLFree(pahHits);
+        // Return features in the same order as a sequential scan would.
+        std::sort(m_anSpatialIndexHits.begin(), m_anSpatialIndexHits.end());
+        m_iNextSpatialIndexHit = 0;
+        m_bSpatialIndexSearchDone = true;
+    }
+
+    if (m_bSpatialIndexSearchDone)
+    {
+        while (m_iNextSpatialIndexHit < m_anSpatialIndexHits.size())
+        {
+            // The feature may have been deleted since the search.
+            OGRFeature *poFeature = const_cast<OGRFeature *>(GetFeatureRef(
+                m_anSpatialIndexHits[m_iNextSpatialIndexHit++]));
+            if (poFeature != nullptr &&
+                FilterGeometry(
+                    poFeature->GetGeomFieldRef(m_iGeomFieldFilter)) &&
+                (m_poAttrQuery == nullptr ||
+                 m_poAttrQuery->Evaluate(poFeature)))
+            {
+                m_nFeaturesRead++;
+                return poFeature->Clone();
+            }
+        }
+        return nullptr;
+    }
+
     while (true)
     {
         OGRFeature *poFeature = nullptr;
@@ -368,6 +422,7 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
 
         if (m_papoFeatures[nFID] != nullptr)
         {
+            SpatialIndexRemove(m_papoFeatures[nFID]);
             delete m_papoFeatures[nFID];
             m_papoFeatures[nFID] = nullptr;
         }
@@ -383,6 +438,7 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
         FeatureIterator oIter = m_oMapFeatures.find(nFID);
         if (oIter != m_oMapFeatures.end())
         {
+            SpatialIndexRemove(oIter->second);
             delete oIter->second;
             oIter->second = poFeatureCloned;
         }
@@ -413,6 +469,8 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
         }
     }
 
+    SpatialIndexInsert(poFeatureCloned);
+
     m_bUpdated = true;
 
     return OGRERR_NONE;
@@ -496,6 +554,7 @@ OGRErr OGRMemLayer::DeleteFeature(GIntBig nFID)
         {
             return OGRERR_FAILURE;
         }
+        SpatialIndexRemove(m_papoFeatures[nFID]);
         delete m_papoFeatures[nFID];
         m_papoFeatures[nFID] = nullptr;
     }
@@ -506,6 +565,7 @@ OGRErr OGRMemLayer::DeleteFeature(GIntBig nFID)
         {
             return OGRERR_FAILURE;
         }
+        SpatialIndexRemove(oIter->second);
         delete oIter->second;
         m_oMapFeatures.erase(oIter);
     }
@@ -1038,3 +1098,155 @@ IOGRMemLayerFeatureIterator *OGRMemLayer::GetIterator()
 
     return new OGRMemLayerIteratorMap(m_oMapFeatures);
 }
+
+/************************************************************************/
+/*                       GetFeatureIndexBounds()                        */
+/************************************************************************/
+
+static bool GetFeatureIndexBounds(const OGRFeature *poFeature, int iGeomField,
+                                  CPLRectObj &sBounds)
+{
+    const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeomField);
+    if (poGeom == nullptr || poGeom->IsEmpty())
+        return false;
+    OGREnvelope sEnvelope;
+    poGeom->getEnvelope(&sEnvelope);
+    if (std::isnan(sEnvelope.MinX) || std::isnan(sEnvelope.MinY) ||
+        std::isnan(sEnvelope.MaxX) || std::isnan(sEnvelope.MaxY))
+        return false;
+    sBounds.minx = sEnvelope.MinX;
+    sBounds.miny = sEnvelope.MinY;
+    sBounds.maxx = sEnvelope.MaxX;
+    sBounds.maxy = sEnvelope.MaxY;
+    return true;
+}
+
+/************************************************************************/
+/*                         BuildSpatialIndex()                          */
+/************************************************************************/
+
+bool OGRMemLayer::BuildSpatialIndex()
+{
+    DropSpatialIndex();
+
+    // FIDs are stored as the quadtree items.
+    if (static_cast<GUIntBig>(std::max(m_iNextCreateFID, m_nMaxFeatureCount)) >
+            std::numeric_limits<size_t>::max() ||
+        (!m_oMapFeatures.empty() &&
+         static_cast<GUIntBig>(m_oMapFeatures.rbegin()->first) >
+             std::numeric_limits<size_t>::max()))
+    {
+        return false;
+    }
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = 0;
+    sGlobalBounds.miny = 0;
+    sGlobalBounds.maxx = 0;
+    sGlobalBounds.maxy = 0;
+    bool bFirst = true;
+    IOGRMemLayerFeatureIterator *poIter = GetIterator();
+    OGRFeature *poFeature = nullptr;
+    while ((poFeature = poIter->Next()) != nullptr)
+    {
+        CPLRectObj sBounds;
+        if (!GetFeatureIndexBounds(poFeature, m_iGeomFieldFilter, sBounds))
+            continue;
+        if (bFirst)
+        {
+            sGlobalBounds = sBounds;
+            bFirst = false;
+        }
+        else
+        {
+            sGlobalBounds.minx = std::min(sGlobalBounds.minx, sBounds.minx);
+            sGlobalBounds.miny = std::min(sGlobalBounds.miny, sBounds.miny);
+            sGlobalBounds.maxx = std::max(sGlobalBounds.maxx, sBounds.maxx);
+            sGlobalBounds.maxy = std::max(sGlobalBounds.maxy, sBounds.maxy);
+        }
+    }
+    delete poIter;
+
+    m_sSpatialIndexBounds = sGlobalBounds;
+    m_hSpatialIndex = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    CPLQuadTreeSetMaxDepth(
+        m_hSpatialIndex,
+        CPLQuadTreeGetAdvisedMaxDepth(static_cast<int>(
+            std::min<GIntBig>(m_nFeatureCount, INT_MAX))));
+    m_iSpatialIndexGeomField = m_iGeomFieldFilter;
+
+    poIter = GetIterator();
+    while ((poFeature = poIter->Next()) != nullptr)
+    {
+        SpatialIndexInsert(poFeature);
+    }
+    delete poIter;
+
+    return true;
+}
+
+/************************************************************************/
+/*                         SpatialIndexInsert()                         */
+/************************************************************************/
+
+void OGRMemLayer::SpatialIndexInsert(const OGRFeature *poFeature)
+{
+    if (m_hSpatialIndex == nullptr)
+        return;
+    const GIntBig nFID = poFeature->GetFID();
+    if (static_cast<GUIntBig>(nFID) > std::numeric_limits<size_t>::max())
+    {
+        // Cannot be stored: drop the index.
+        DropSpatialIndex();
+        return;
+    }
+    CPLRectObj sBounds;
+    if (GetFeatureIndexBounds(poFeature, m_iSpatialIndexGeomField, sBounds))
+    {
+        // Searches never visit items outside of the root node bounds, which
+        // cannot be enlarged: drop the index.
+        if (sBounds.minx < m_sSpatialIndexBounds.minx ||
+            sBounds.miny < m_sSpatialIndexBounds.miny ||
+            sBounds.maxx > m_sSpatialIndexBounds.maxx ||
+            sBounds.maxy > m_sSpatialIndexBounds.maxy)
+        {
+            DropSpatialIndex();
+            return;
+        }
+        CPLQuadTreeInsertWithBounds(
+            m_hSpatialIndex,
+            reinterpret_cast<void *>(static_cast<size_t>(nFID)), &sBounds);
+    }
+}
+
+/************************************************************************/
+/*                          DropSpatialIndex()                          */
+/************************************************************************/
+
+void OGRMemLayer::DropSpatialIndex()
+{
+    if (m_hSpatialIndex)
+    {
+        CPLQuadTreeDestroy(m_hSpatialIndex);
+        m_hSpatialIndex = nullptr;
+    }
+    m_iSpatialIndexGeomField = -1;
+}
+
+/************************************************************************/
+/*                         SpatialIndexRemove()                         */
+/************************************************************************/
+
+void OGRMemLayer::SpatialIndexRemove(const OGRFeature *poFeature)
+{
+    if (m_hSpatialIndex == nullptr)
+        return;
+    CPLRectObj sBounds;
+    if (GetFeatureIndexBounds(poFeature, m_iSpatialIndexGeomField, sBounds))
+    {
+        CPLQuadTreeRemove(
+            m_hSpatialIndex,
+            reinterpret_cast<void *>(static_cast<size_t>(poFeature->GetFID())),
+            &sBounds);
+    }
+}
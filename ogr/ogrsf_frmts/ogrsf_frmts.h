@@ -643,6 +643,7 @@ void CPL_DLL RegisterOGRHANA();
 void CPL_DLL RegisterOGRParquet();
 void CPL_DLL RegisterOGRArrow();
 void CPL_DLL RegisterOGRGTFS();
+void CPL_DLL RegisterOGRPMTiles();
 // @endcond
 
 CPL_C_END
@@ -33,6 +33,8 @@
 
 #include <functional>
 #include <map>
+#include <set>
+#include <utility>
 
 #include "../arrow_common/ogr_arrow.h"
 #include "ogr_include_parquet.h"
@@ -54,8 +56,13 @@ class OGRParquetLayerBase CPL_NON_FINAL : public OGRArrowLayer
     OGRParquetDataset *m_poDS = nullptr;
     std::shared_ptr<arrow::RecordBatchReader> m_poRecordBatchReader{};
 
+    // Columns referenced by the GeoParquet 1.1 "covering" of geometry
+    // columns, that are not exposed as OGR fields.
+    std::set<std::string> m_oSetCoveringBBoxColumns{};
+
     void LoadGeoMetadata(
         const std::shared_ptr<const arrow::KeyValueMetadata> &kv_metadata);
+    bool IsCoveringBBoxColumn(const std::shared_ptr<arrow::Field> &field) const;
     bool DealWithGeometryColumn(
         int iFieldIdx, const std::shared_ptr<arrow::Field> &field,
         std::function<OGRwkbGeometryType(void)> computeGeometryTypeFun);
@@ -89,8 +96,23 @@ class OGRParquetLayer final : public OGRParquetLayerBase
 #endif
     CPLStringList m_aosFeatherMetadata{};
 
+    // Row groups that may contain features matching the attribute and/or
+    // spatial filter, with the index of their first feature. Only used when
+    // m_bUseRowGroupSelection is set.
+    bool m_bUseRowGroupSelection = false;
+    std::vector<std::pair<int, int64_t>> m_anSelectedRowGroups{};
+    int m_iSelectedRowGroup = -1;  // index in m_anSelectedRowGroups
+
     void EstablishFeatureDefn();
     bool CreateRecordBatchReader(int iStartingRowGroup);
+    bool CreateRecordBatchReader(const std::vector<int> &anRowGroups);
+    bool ReadNextSelectedRowGroup(std::shared_ptr<arrow::RecordBatch> &poBatch);
+    void ComputeSelectedRowGroups();
+    bool CanSkipRowGroupDueToAttributeFilter(int iRowGroup) const;
+    bool CanSkipRowGroupDueToSpatialFilter(
+        int iRowGroup, const int anBBoxParquetColumns[4]) const;
+    int GetCoveringBBoxParquetColumn(int iGeomField,
+                                     const char *pszComponent) const;
     bool ReadNextBatch() override;
     OGRwkbGeometryType ComputeGeometryColumnType(int iGeomCol,
                                                  int iParquetCol) const;
@@ -116,6 +138,20 @@ class OGRParquetLayer final : public OGRParquetLayerBase
     void ResetReading() override;
     OGRFeature *GetFeature(GIntBig nFID) override;
     GIntBig GetFeatureCount(int bForce) override;
+    OGRErr GetExtent(OGREnvelope *psExtent, int bForce = TRUE) override
+    {
+        return GetExtent(0, psExtent, bForce);
+    }
+    OGRErr GetExtent(int iGeomField, OGREnvelope *psExtent,
+                     int bForce = TRUE) override;
+    OGRErr SetAttributeFilter(const char *pszFilter) override;
+
+    void SetSpatialFilter(OGRGeometry *poGeom) override
+    {
+        SetSpatialFilter(0, poGeom);
+    }
+    void SetSpatialFilter(int iGeomField, OGRGeometry *poGeom) override;
+
     int TestCapability(const char *pszCap) override;
     OGRErr SetIgnoredFields(const char **papszFields) override;
     const char *GetMetadataItem(const char *pszName,
@@ -221,12 +257,33 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
     bool m_bEdgesSpherical = false;
     parquet::WriterProperties::Builder m_oWriterPropertiesBuilder{};
 
+    // SORT_BY_BBOX=YES: features are first written in a temporary file, and
+    // are then written to the Parquet file in the order of the Hilbert code
+    // of the center of their bounding box.
+    struct SortItem
+    {
+        vsi_l_offset nOffset = 0;
+        uint32_t nSize = 0;
+        uint32_t nHilbertCode = 0;
+        double dfX = 0;
+        double dfY = 0;
+    };
+
+    bool m_bSortByBBox = false;
+    std::string m_osTmpFilename{};
+    VSILFILE *m_fpTmp = nullptr;
+    vsi_l_offset m_nTmpFileSize = 0;
+    std::vector<SortItem> m_asSortItems{};
+    std::vector<GByte> m_abyFeatureBuffer{};
+
+    bool WriteSortedFeatures();
+
     virtual bool IsFileWriterCreated() const override
     {
         return m_poFileWriter != nullptr;
     }
     virtual void CreateWriter() override;
-    virtual void CloseFileWriter() override;
+    virtual bool CloseFileWriter() override;
 
     virtual void CreateSchema() override;
     virtual void PerformStepsBeforeFinalFlushGroup() override;
@@ -249,6 +306,9 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
 
     std::string GetGeoMetadata() const;
 
+  protected:
+    OGRErr ICreateFeature(OGRFeature *poFeature) override;
+
   public:
     OGRParquetWriterLayer(
         arrow::MemoryPool *poMemoryPool,
@@ -257,7 +317,9 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
 
     ~OGRParquetWriterLayer() override;
 
-    bool SetOptions(CSLConstList papszOptions,
+    bool Close();
+
+    bool SetOptions(const std::string &osFilename, CSLConstList papszOptions,
                     OGRSpatialReference *poSpatialRef,
                     OGRwkbGeometryType eGType);
 
@@ -274,11 +336,17 @@ class OGRParquetWriterDataset final : public GDALPamDataset
     std::unique_ptr<arrow::MemoryPool> m_poMemoryPool{};
     std::unique_ptr<OGRParquetWriterLayer> m_poLayer{};
     std::shared_ptr<arrow::io::OutputStream> m_poOutputStream{};
+    std::string m_osFilename{};
 
   public:
-    explicit OGRParquetWriterDataset(
+    OGRParquetWriterDataset(
+        const std::string &osFilename,
         const std::shared_ptr<arrow::io::OutputStream> &poOutputStream);
 
+    ~OGRParquetWriterDataset() override;
+
+    CPLErr Close() override;
+
     arrow::MemoryPool *GetMemoryPool() const
     {
         return m_poMemoryPool.get();
@@ -71,6 +71,9 @@ void OGRParquetDatasetLayer::EstablishFeatureDefn(
     {
         const auto &field = fields[i];
 
+        if (IsCoveringBBoxColumn(field))
+            continue;
+
         if (!m_osFIDColumn.empty() && field->name() == m_osFIDColumn)
         {
             m_iFIDArrowColumn = i;
@@ -618,7 +618,7 @@ static GDALDataset *OGRParquetDriverCreate(const char *pszName, int nXSize,
                                     arrow::io::FileOutputStream::Open(pszName));
         }
 
-        return new OGRParquetWriterDataset(out_file);
+        return new OGRParquetWriterDataset(pszName, out_file);
     }
     catch (const std::exception &e)
     {
@@ -763,6 +763,36 @@ void OGRParquetDriver::InitMetadata()
         CPLCreateXMLElementAndValue(psOption, "Value", "SPHERICAL");
     }
 
+    {
+        auto psOption = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psOption, "name", "WRITE_COVERING_BBOX");
+        CPLAddXMLAttributeAndValue(psOption, "type", "boolean");
+        CPLAddXMLAttributeAndValue(psOption, "description",
+                                   "Whether to write xmin/ymin/xmax/ymax "
+                                   "columns with the bounding box of "
+                                   "geometries");
+        CPLAddXMLAttributeAndValue(psOption, "default", "NO");
+    }
+
+    {
+        auto psOption = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psOption, "name", "SORT_BY_BBOX");
+        CPLAddXMLAttributeAndValue(psOption, "type", "boolean");
+        CPLAddXMLAttributeAndValue(psOption, "description",
+                                   "Whether to sort features along a Hilbert "
+                                   "curve before writing them");
+        CPLAddXMLAttributeAndValue(psOption, "default", "NO");
+    }
+
+    {
+        auto psOption = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psOption, "name", "TEMPORARY_DIR");
+        CPLAddXMLAttributeAndValue(psOption, "type", "string");
+        CPLAddXMLAttributeAndValue(psOption, "description",
+                                   "Directory where the temporary file used "
+                                   "by SORT_BY_BBOX is created");
+    }
+
     {
         auto psOption = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
         CPLAddXMLAttributeAndValue(psOption, "name", "CREATOR");
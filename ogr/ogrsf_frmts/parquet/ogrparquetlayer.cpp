@@ -98,6 +98,19 @@ void OGRParquetLayerBase::LoadGeoMetadata(
                     for (const auto &oColumn : oColumns.GetChildren())
                     {
                         m_oMapGeometryColumns[oColumn.GetName()] = oColumn;
+
+                        for (const char *pszComponent :
+                             {"xmin", "ymin", "xmax", "ymax"})
+                        {
+                            const auto oPath = oColumn.GetArray(
+                                std::string("covering/bbox/")
+                                    .append(pszComponent));
+                            if (oPath.IsValid() && oPath.Size() == 2)
+                            {
+                                m_oSetCoveringBBoxColumns.insert(
+                                    oPath[0].ToString());
+                            }
+                        }
                     }
                 }
             }
@@ -110,6 +123,32 @@ void OGRParquetLayerBase::LoadGeoMetadata(
     }
 }
 
+/************************************************************************/
+/*                        IsCoveringBBoxColumn()                        */
+/************************************************************************/
+
+// Returns whether the field is a struct of floating-point xmin/ymin/xmax/ymax
+// referenced by the "covering" of a geometry column.
+bool OGRParquetLayerBase::IsCoveringBBoxColumn(
+    const std::shared_ptr<arrow::Field> &field) const
+{
+    if (field->type()->id() != arrow::Type::STRUCT ||
+        m_oSetCoveringBBoxColumns.find(field->name()) ==
+            m_oSetCoveringBBoxColumns.end())
+    {
+        return false;
+    }
+    for (const auto &child : field->type()->fields())
+    {
+        if (child->type()->id() != arrow::Type::FLOAT &&
+            child->type()->id() != arrow::Type::DOUBLE)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                      DealWithGeometryColumn()                        */
 /************************************************************************/
@@ -417,6 +456,13 @@ void OGRParquetLayer::EstablishFeatureDefn()
         if (!bParquetColValid)
             m_bHasMissingMappingToParquet = true;
 
+        if (IsCoveringBBoxColumn(field))
+        {
+            if (bParquetColValid)
+                iParquetCol += field->type()->num_fields();
+            continue;
+        }
+
         if (!m_osFIDColumn.empty() && field->name() == m_osFIDColumn)
         {
             m_iFIDArrowColumn = i;
@@ -864,6 +910,11 @@ OGRFeature *OGRParquetLayer::GetFeature(GIntBig nFID)
 
 void OGRParquetLayer::ResetReading()
 {
+    // When reading a selection of row groups, the reader may not be
+    // positioned on the first selected row group, so recreate it.
+    if (m_bUseRowGroupSelection)
+        m_iRecordBatch = -1;
+    m_iSelectedRowGroup = -1;
     if (m_iRecordBatch != 0)
     {
         m_poRecordBatchReader.reset();
@@ -882,6 +933,12 @@ bool OGRParquetLayer::CreateRecordBatchReader(int iStartingRowGroup)
     anRowGroups.reserve(nNumGroups - iStartingRowGroup);
     for (int i = iStartingRowGroup; i < nNumGroups; ++i)
         anRowGroups.push_back(i);
+    return CreateRecordBatchReader(anRowGroups);
+}
+
+bool OGRParquetLayer::CreateRecordBatchReader(
+    const std::vector<int> &anRowGroups)
+{
     arrow::Status status;
     if (m_bIgnoredFields)
     {
@@ -902,6 +959,38 @@ bool OGRParquetLayer::CreateRecordBatchReader(int iStartingRowGroup)
     return true;
 }
 
+/************************************************************************/
+/*                      ReadNextSelectedRowGroup()                      */
+/************************************************************************/
+
+bool OGRParquetLayer::ReadNextSelectedRowGroup(
+    std::shared_ptr<arrow::RecordBatch> &poBatch)
+{
+    const int nSelectedRowGroups =
+        static_cast<int>(m_anSelectedRowGroups.size());
+    while (m_iSelectedRowGroup + 1 < nSelectedRowGroups)
+    {
+        ++m_iSelectedRowGroup;
+        const auto &oRowGroup = m_anSelectedRowGroups[m_iSelectedRowGroup];
+        if (!CreateRecordBatchReader(std::vector<int>{oRowGroup.first}))
+            return false;
+        // Features of skipped row groups must still be accounted for in
+        // the FID numbering.
+        m_nFeatureIdx = oRowGroup.second;
+
+        auto status = m_poRecordBatchReader->ReadNext(&poBatch);
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "ReadNext() failed: %s",
+                     status.message().c_str());
+            return false;
+        }
+        if (poBatch != nullptr)
+            return true;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                           ReadNextBatch()                            */
 /************************************************************************/
@@ -918,9 +1007,10 @@ bool OGRParquetLayer::ReadNextBatch()
     }
 
     CPLAssert((m_iRecordBatch == -1 && m_poRecordBatchReader == nullptr) ||
-              (m_iRecordBatch >= 0 && m_poRecordBatchReader != nullptr));
+              (m_iRecordBatch >= 0 && m_poRecordBatchReader != nullptr) ||
+              m_bUseRowGroupSelection);
 
-    if (m_poRecordBatchReader == nullptr)
+    if (m_poRecordBatchReader == nullptr && !m_bUseRowGroupSelection)
     {
         if (!CreateRecordBatchReader(0))
             return false;
@@ -929,16 +1019,24 @@ bool OGRParquetLayer::ReadNextBatch()
     ++m_iRecordBatch;
 
     std::shared_ptr<arrow::RecordBatch> poNextBatch;
-    auto status = m_poRecordBatchReader->ReadNext(&poNextBatch);
-    if (!status.ok())
+    if (m_poRecordBatchReader)
+    {
+        auto status = m_poRecordBatchReader->ReadNext(&poNextBatch);
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "ReadNext() failed: %s",
+                     status.message().c_str());
+            poNextBatch.reset();
+        }
+    }
+    if (poNextBatch == nullptr && m_bUseRowGroupSelection)
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "ReadNext() failed: %s",
-                 status.message().c_str());
-        poNextBatch.reset();
+        if (!ReadNextSelectedRowGroup(poNextBatch))
+            poNextBatch.reset();
     }
     if (poNextBatch == nullptr)
     {
-        if (m_iRecordBatch == 1)
+        if (m_iRecordBatch == 1 && !m_bUseRowGroupSelection)
         {
             m_iRecordBatch = 0;
             m_bSingleBatch = true;
@@ -1003,6 +1101,374 @@ bool OGRParquetLayer::ReadNextBatch()
     return true;
 }
 
+/************************************************************************/
+/*                  CanSkipRowGroupFromStatistics()                     */
+/************************************************************************/
+
+// Returns true if no value in [minVal, maxVal] can satisfy
+// "value nOperation refVal"
+template <class T>
+static bool CanSkipRowGroupFromStatistics(int nOperation, const T &minVal,
+                                          const T &maxVal, const T &refVal)
+{
+    switch (nOperation)
+    {
+        case SWQ_EQ:
+            return refVal < minVal || refVal > maxVal;
+        case SWQ_LT:
+            return minVal >= refVal;
+        case SWQ_LE:
+            return minVal > refVal;
+        case SWQ_GT:
+            return maxVal <= refVal;
+        case SWQ_GE:
+            return maxVal < refVal;
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                GetNumericStatistics()                                */
+/************************************************************************/
+
+template <class T>
+static bool GetNumericStatistics(const parquet::Statistics *poStats,
+                                 T &minVal, T &maxVal)
+{
+    switch (poStats->physical_type())
+    {
+        case parquet::Type::INT32:
+        {
+            auto castStats =
+                dynamic_cast<const parquet::Int32Statistics *>(poStats);
+            if (!castStats)
+                return false;
+            minVal = static_cast<T>(castStats->min());
+            maxVal = static_cast<T>(castStats->max());
+            return true;
+        }
+        case parquet::Type::INT64:
+        {
+            auto castStats =
+                dynamic_cast<const parquet::Int64Statistics *>(poStats);
+            if (!castStats)
+                return false;
+            minVal = static_cast<T>(castStats->min());
+            maxVal = static_cast<T>(castStats->max());
+            return true;
+        }
+        case parquet::Type::FLOAT:
+        {
+            auto castStats =
+                dynamic_cast<const parquet::FloatStatistics *>(poStats);
+            if (!castStats)
+                return false;
+            minVal = static_cast<T>(castStats->min());
+            maxVal = static_cast<T>(castStats->max());
+            return true;
+        }
+        case parquet::Type::DOUBLE:
+        {
+            auto castStats =
+                dynamic_cast<const parquet::DoubleStatistics *>(poStats);
+            if (!castStats)
+                return false;
+            minVal = static_cast<T>(castStats->min());
+            maxVal = static_cast<T>(castStats->max());
+            return true;
+        }
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                CanSkipRowGroupDueToAttributeFilter()                 */
+/************************************************************************/
+
+bool OGRParquetLayer::CanSkipRowGroupDueToAttributeFilter(int iRowGroup) const
+{
+    const auto metadata = m_poArrowReader->parquet_reader()->metadata();
+    const auto poRowGroup = metadata->RowGroup(iRowGroup);
+    for (const auto &constraint : GetAttributeFilterConstraints())
+    {
+        const int iCol = m_anMapFieldIndexToParquetColumn[constraint.iField];
+        if (iCol < 0)
+            continue;
+        const auto columnChunk = poRowGroup->ColumnChunk(iCol);
+        const auto colStats = columnChunk->statistics();
+        if (!columnChunk->is_stats_set() || !colStats)
+            continue;
+
+        if (constraint.nOperation == SWQ_ISNULL)
+        {
+            if (colStats->HasNullCount() && colStats->null_count() == 0)
+                return true;
+            continue;
+        }
+        if (constraint.nOperation == SWQ_ISNOTNULL)
+        {
+            if (colStats->HasNullCount() && colStats->num_values() == 0)
+                return true;
+            continue;
+        }
+        if (!colStats->HasMinMax())
+            continue;
+
+        const auto descr = metadata->schema()->Column(iCol);
+        const auto &logicalType = descr->logical_type();
+        if (colStats->physical_type() == parquet::Type::BYTE_ARRAY)
+        {
+            if (constraint.eType != OGRArrowLayer::Constraint::Type::String ||
+                descr->sort_order() != parquet::SortOrder::UNSIGNED)
+            {
+                continue;
+            }
+            auto castStats = dynamic_cast<const parquet::ByteArrayStatistics *>(
+                colStats.get());
+            if (!castStats)
+                continue;
+            const auto minRaw = castStats->min();
+            const auto maxRaw = castStats->max();
+            const std::string osMin(reinterpret_cast<const char *>(minRaw.ptr),
+                                    minRaw.len);
+            const std::string osMax(reinterpret_cast<const char *>(maxRaw.ptr),
+                                    maxRaw.len);
+            if (CanSkipRowGroupFromStatistics(constraint.nOperation, osMin,
+                                              osMax, constraint.osValue))
+            {
+                return true;
+            }
+            continue;
+        }
+
+        // Decimal columns store unscaled values, and unsigned columns have
+        // statistics computed with an unsigned sort order.
+        if ((logicalType && logicalType->is_decimal()) ||
+            descr->sort_order() != parquet::SortOrder::SIGNED)
+        {
+            continue;
+        }
+
+        if (constraint.eType == OGRArrowLayer::Constraint::Type::Integer ||
+            constraint.eType == OGRArrowLayer::Constraint::Type::Integer64)
+        {
+            if (colStats->physical_type() != parquet::Type::INT32 &&
+                colStats->physical_type() != parquet::Type::INT64)
+            {
+                continue;
+            }
+            int64_t nMin = 0;
+            int64_t nMax = 0;
+            const int64_t nVal =
+                constraint.eType == OGRArrowLayer::Constraint::Type::Integer
+                    ? constraint.sValue.Integer
+                    : constraint.sValue.Integer64;
+            if (GetNumericStatistics(colStats.get(), nMin, nMax) &&
+                CanSkipRowGroupFromStatistics(constraint.nOperation, nMin,
+                                              nMax, nVal))
+            {
+                return true;
+            }
+        }
+        else if (constraint.eType == OGRArrowLayer::Constraint::Type::Real)
+        {
+            double dfMin = 0;
+            double dfMax = 0;
+            if (GetNumericStatistics(colStats.get(), dfMin, dfMax) &&
+                CanSkipRowGroupFromStatistics(constraint.nOperation, dfMin,
+                                              dfMax, constraint.sValue.Real))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                   GetCoveringBBoxParquetColumn()                     */
+/************************************************************************/
+
+// Returns the index of the Parquet column pointed by the GeoParquet 1.1
+// "covering.bbox.{pszComponent}" item of the geometry column, or -1.
+int OGRParquetLayer::GetCoveringBBoxParquetColumn(
+    int iGeomField, const char *pszComponent) const
+{
+    const auto oIter = m_oMapGeometryColumns.find(
+        m_poFeatureDefn->GetGeomFieldDefn(iGeomField)->GetNameRef());
+    if (oIter == m_oMapGeometryColumns.end())
+        return -1;
+    const auto oPath = oIter->second.GetArray(
+        std::string("covering/bbox/").append(pszComponent));
+    if (!oPath.IsValid() || oPath.Size() == 0)
+        return -1;
+    std::string osPath;
+    for (const auto &oPart : oPath)
+    {
+        if (!osPath.empty())
+            osPath += '.';
+        osPath += oPart.ToString();
+    }
+
+    const auto schema = m_poArrowReader->parquet_reader()->metadata()->schema();
+    for (int i = 0; i < schema->num_columns(); ++i)
+    {
+        if (schema->Column(i)->path()->ToDotString() == osPath)
+            return i;
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                 CanSkipRowGroupDueToSpatialFilter()                  */
+/************************************************************************/
+
+bool OGRParquetLayer::CanSkipRowGroupDueToSpatialFilter(
+    int iRowGroup, const int anBBoxParquetColumns[4]) const
+{
+    const auto metadata = m_poArrowReader->parquet_reader()->metadata();
+    const auto poRowGroup = metadata->RowGroup(iRowGroup);
+    double adfMin[4] = {0, 0, 0, 0};
+    double adfMax[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 4; ++i)
+    {
+        const auto columnChunk =
+            poRowGroup->ColumnChunk(anBBoxParquetColumns[i]);
+        const auto colStats = columnChunk->statistics();
+        if (!columnChunk->is_stats_set() || !colStats ||
+            !colStats->HasMinMax() ||
+            !GetNumericStatistics(colStats.get(), adfMin[i], adfMax[i]))
+        {
+            return false;
+        }
+    }
+    // anBBoxParquetColumns[] is xmin, ymin, xmax, ymax
+    return adfMin[0] > m_sFilterEnvelope.MaxX ||
+           adfMin[1] > m_sFilterEnvelope.MaxY ||
+           adfMax[2] < m_sFilterEnvelope.MinX ||
+           adfMax[3] < m_sFilterEnvelope.MinY;
+}
+
+/************************************************************************/
+/*                      ComputeSelectedRowGroups()                      */
+/************************************************************************/
+
+// Uses row group statistics to determine which row groups may contain
+// features matching the attribute and spatial filters.
+void OGRParquetLayer::ComputeSelectedRowGroups()
+{
+    const bool bWasUsingRowGroupSelection = m_bUseRowGroupSelection;
+    m_bUseRowGroupSelection = false;
+    m_anSelectedRowGroups.clear();
+
+    if (!m_bSingleBatch &&
+        (!GetAttributeFilterConstraints().empty() ||
+         m_poFilterGeom != nullptr) &&
+        CPLTestBool(
+            CPLGetConfigOption("OGR_PARQUET_USE_ROW_GROUP_STATISTICS", "YES")))
+    {
+        int anBBoxParquetColumns[4] = {-1, -1, -1, -1};
+        bool bUseSpatialFilter = false;
+        if (m_poFilterGeom != nullptr)
+        {
+            const char *const apszComponents[] = {"xmin", "ymin", "xmax",
+                                                  "ymax"};
+            bUseSpatialFilter = true;
+            for (int i = 0; i < 4; ++i)
+            {
+                anBBoxParquetColumns[i] = GetCoveringBBoxParquetColumn(
+                    m_iGeomFieldFilter, apszComponents[i]);
+                if (anBBoxParquetColumns[i] < 0)
+                    bUseSpatialFilter = false;
+            }
+        }
+
+        if (bUseSpatialFilter || !GetAttributeFilterConstraints().empty())
+        {
+            const auto metadata =
+                m_poArrowReader->parquet_reader()->metadata();
+            const int nNumGroups = metadata->num_row_groups();
+            int64_t nFeatureIdx = 0;
+            for (int iGroup = 0; iGroup < nNumGroups; ++iGroup)
+            {
+                if (!CanSkipRowGroupDueToAttributeFilter(iGroup) &&
+                    !(bUseSpatialFilter &&
+                      CanSkipRowGroupDueToSpatialFilter(
+                          iGroup, anBBoxParquetColumns)))
+                {
+                    m_anSelectedRowGroups.emplace_back(iGroup, nFeatureIdx);
+                }
+                nFeatureIdx += metadata->RowGroup(iGroup)->num_rows();
+            }
+            if (static_cast<int>(m_anSelectedRowGroups.size()) < nNumGroups)
+            {
+                CPLDebug("PARQUET", "%d row group(s) selected out of %d",
+                         static_cast<int>(m_anSelectedRowGroups.size()),
+                         nNumGroups);
+                m_bUseRowGroupSelection = true;
+            }
+            else
+            {
+                m_anSelectedRowGroups.clear();
+            }
+        }
+    }
+
+    if (m_bUseRowGroupSelection || bWasUsingRowGroupSelection)
+    {
+        // Full invalidation
+        m_iRecordBatch = -1;
+        ResetReading();
+    }
+}
+
+/************************************************************************/
+/*                        SetAttributeFilter()                          */
+/************************************************************************/
+
+OGRErr OGRParquetLayer::SetAttributeFilter(const char *pszFilter)
+{
+    const OGRErr eErr = OGRParquetLayerBase::SetAttributeFilter(pszFilter);
+    ComputeSelectedRowGroups();
+    return eErr;
+}
+
+/************************************************************************/
+/*                         SetSpatialFilter()                           */
+/************************************************************************/
+
+void OGRParquetLayer::SetSpatialFilter(int iGeomField, OGRGeometry *poGeom)
+{
+    OGRParquetLayerBase::SetSpatialFilter(iGeomField, poGeom);
+    ComputeSelectedRowGroups();
+}
+
+/************************************************************************/
+/*                            GetExtent()                               */
+/************************************************************************/
+
+OGRErr OGRParquetLayer::GetExtent(int iGeomField, OGREnvelope *psExtent,
+                                  int bForce)
+{
+    if (!m_bUseRowGroupSelection)
+        return OGRParquetLayerBase::GetExtent(iGeomField, psExtent, bForce);
+
+    // The extent must be computed on all row groups, regardless of filters
+    m_bUseRowGroupSelection = false;
+    m_iRecordBatch = -1;
+    ResetReading();
+    const OGRErr eErr =
+        OGRParquetLayerBase::GetExtent(iGeomField, psExtent, bForce);
+    m_bUseRowGroupSelection = true;
+    m_iRecordBatch = -1;
+    ResetReading();
+    return eErr;
+}
+
 /************************************************************************/
 /*                        SetIgnoredFields()                            */
 /************************************************************************/
@@ -1190,6 +1656,14 @@ const char *OGRParquetLayer::GetMetadataItem(const char *pszName,
         {
             return CPLSPrintf("%d", m_poArrowReader->num_row_groups());
         }
+        if (EQUAL(pszName, "NUM_SELECTED_ROW_GROUPS"))
+        {
+            return CPLSPrintf("%d",
+                              m_bUseRowGroupSelection
+                                  ? static_cast<int>(
+                                        m_anSelectedRowGroups.size())
+                                  : m_poArrowReader->num_row_groups());
+        }
         if (EQUAL(pszName, "CREATOR"))
         {
             return CPLSPrintf("%s", m_poArrowReader->parquet_reader()
@@ -1360,6 +1834,10 @@ OGRErr OGRParquetLayer::SetNextByIndex(GIntBig nIndex)
             }
             m_nIdxInBatch = nIndex - nAccRows;
             m_nFeatureIdx = nIndex;
+            // The reader goes up to the last row group, so do not switch
+            // to the next selected row group afterwards.
+            m_iSelectedRowGroup =
+                static_cast<int>(m_anSelectedRowGroups.size());
             SetBatch(poBatch);
             return OGRERR_NONE;
         }
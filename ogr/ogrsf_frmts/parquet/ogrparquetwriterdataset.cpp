@@ -35,12 +35,42 @@
 /************************************************************************/
 
 OGRParquetWriterDataset::OGRParquetWriterDataset(
+    const std::string &osFilename,
     const std::shared_ptr<arrow::io::OutputStream> &poOutputStream)
     : m_poMemoryPool(arrow::MemoryPool::CreateDefault()),
-      m_poOutputStream(poOutputStream)
+      m_poOutputStream(poOutputStream), m_osFilename(osFilename)
 {
 }
 
+/************************************************************************/
+/*                      ~OGRParquetWriterDataset()                      */
+/************************************************************************/
+
+OGRParquetWriterDataset::~OGRParquetWriterDataset()
+{
+    OGRParquetWriterDataset::Close();
+}
+
+/************************************************************************/
+/*                                Close()                               */
+/************************************************************************/
+
+CPLErr OGRParquetWriterDataset::Close()
+{
+    CPLErr eErr = CE_None;
+    if (nOpenFlags != OPEN_FLAGS_CLOSED)
+    {
+        // Errors while writing sorted features or the file footer are
+        // reported through the return value of GDALClose()
+        if (m_poLayer && !m_poLayer->Close())
+            eErr = CE_Failure;
+
+        if (GDALPamDataset::Close() != CE_None)
+            eErr = CE_Failure;
+    }
+    return eErr;
+}
+
 /************************************************************************/
 /*                           GetLayerCount()                            */
 /************************************************************************/
@@ -88,7 +118,8 @@ OGRLayer *OGRParquetWriterDataset::ICreateLayer(
     }
     m_poLayer = cpl::make_unique<OGRParquetWriterLayer>(
         m_poMemoryPool.get(), m_poOutputStream, pszName);
-    if (!m_poLayer->SetOptions(papszOptions, poSpatialRef, eGType))
+    if (!m_poLayer->SetOptions(m_osFilename, papszOptions, poSpatialRef,
+                               eGType))
     {
         m_poLayer.reset();
         return nullptr;
@@ -33,6 +33,11 @@
 
 #include "../arrow_common/ograrrowwriterlayer.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
 /************************************************************************/
 /*                      OGRParquetWriterLayer()                         */
 /************************************************************************/
@@ -51,8 +56,34 @@ OGRParquetWriterLayer::OGRParquetWriterLayer(
 
 OGRParquetWriterLayer::~OGRParquetWriterLayer()
 {
+    Close();
+}
+
+/************************************************************************/
+/*                                Close()                               */
+/************************************************************************/
+
+/** Write the pending features (sorted ones with SORT_BY_BBOX=YES) and the
+ * file footer. Returns false if any of these steps failed.
+ */
+bool OGRParquetWriterLayer::Close()
+{
+    bool bRet = true;
     if (m_bInitializationOK)
-        FinalizeWriting();
+    {
+        m_bInitializationOK = false;
+        if (m_bSortByBBox && !WriteSortedFeatures())
+            bRet = false;
+        if (!FinalizeWriting())
+            bRet = false;
+    }
+    if (m_fpTmp)
+    {
+        VSIFCloseL(m_fpTmp);
+        m_fpTmp = nullptr;
+        VSIUnlink(m_osTmpFilename.c_str());
+    }
+    return bRet;
 }
 
 /************************************************************************/
@@ -86,7 +117,8 @@ bool OGRParquetWriterLayer::IsSupportedGeometryType(
 /*                           SetOptions()                               */
 /************************************************************************/
 
-bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
+bool OGRParquetWriterLayer::SetOptions(const std::string &osFilename,
+                                       CSLConstList papszOptions,
                                        OGRSpatialReference *poSpatialRef,
                                        OGRwkbGeometryType eGType)
 {
@@ -212,6 +244,51 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
     m_bEdgesSpherical = EQUAL(
         CSLFetchNameValueDef(papszOptions, "EDGES", "PLANAR"), "SPHERICAL");
 
+    m_bWriteBBoxStruct = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "WRITE_COVERING_BBOX", "NO"));
+
+    m_bSortByBBox = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "SORT_BY_BBOX", "NO"));
+    if (m_bSortByBBox && eGType == wkbNone)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "SORT_BY_BBOX=YES is not supported on a layer without "
+                 "geometry");
+        return false;
+    }
+    if (m_bSortByBBox)
+    {
+        const std::string osDirname(CPLGetPath(osFilename.c_str()));
+        const std::string osBasename(CPLGetBasename(osFilename.c_str()));
+        const char *pszTempDir =
+            CSLFetchNameValue(papszOptions, "TEMPORARY_DIR");
+        VSIStatBufL sStat;
+        if (pszTempDir && (VSIStatL(pszTempDir, &sStat) != 0 ||
+                           !VSI_ISDIR(sStat.st_mode)))
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "TEMPORARY_DIR=%s is not an existing directory",
+                     pszTempDir);
+            return false;
+        }
+        m_osTmpFilename =
+            pszTempDir ? CPLFormFilename(pszTempDir, osBasename.c_str(),
+                                         nullptr)
+            : (STARTS_WITH(osFilename.c_str(), "/vsi") &&
+               !STARTS_WITH(osFilename.c_str(), "/vsimem/"))
+                ? CPLGenerateTempFilename(osBasename.c_str())
+                : CPLFormFilename(osDirname.c_str(), osBasename.c_str(),
+                                  nullptr);
+        m_osTmpFilename += "_sort_by_bbox.tmp";
+        m_fpTmp = VSIFOpenL(m_osTmpFilename.c_str(), "w+b");
+        if (m_fpTmp == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     m_osTmpFilename.c_str());
+            return false;
+        }
+    }
+
     m_bInitializationOK = true;
     return true;
 }
@@ -220,7 +297,7 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
 /*                         CloseFileWriter()                            */
 /************************************************************************/
 
-void OGRParquetWriterLayer::CloseFileWriter()
+bool OGRParquetWriterLayer::CloseFileWriter()
 {
     auto status = m_poFileWriter->Close();
     if (!status.ok())
@@ -228,7 +305,9 @@ void OGRParquetWriterLayer::CloseFileWriter()
         CPLError(CE_Failure, CPLE_AppDefined,
                  "FileWriter::Close() failed with %s",
                  status.message().c_str());
+        return false;
     }
+    return true;
 }
 
 /************************************************************************/
@@ -355,7 +434,8 @@ std::string OGRParquetWriterLayer::GetGeoMetadata() const
         CPLTestBool(CPLGetConfigOption("OGR_PARQUET_WRITE_GEO", "YES")))
     {
         CPLJSONObject oRoot;
-        oRoot.Add("version", "1.0.0-beta.1");
+        // "covering" was introduced in GeoParquet 1.1
+        oRoot.Add("version", m_bWriteBBoxStruct ? "1.1.0" : "1.0.0-beta.1");
         oRoot.Add("primary_column",
                   m_poFeatureDefn->GetGeomFieldDefn(0)->GetNameRef());
         CPLJSONObject oColumns;
@@ -438,6 +518,25 @@ std::string OGRParquetWriterLayer::GetGeoMetadata() const
                 oColumn.Add("edges", "spherical");
             }
 
+            if (m_bWriteBBoxStruct)
+            {
+                // GeoParquet 1.1 bounding box covering columns
+                const std::string osBBoxName =
+                    GetBBoxStructName(poGeomFieldDefn->GetNameRef());
+                CPLJSONObject oCovering;
+                oColumn.Add("covering", oCovering);
+                CPLJSONObject oBBox;
+                oCovering.Add("bbox", oBBox);
+                for (const char *pszComponent :
+                     {"xmin", "ymin", "xmax", "ymax"})
+                {
+                    CPLJSONArray oPath;
+                    oPath.Add(osBBoxName);
+                    oPath.Add(pszComponent);
+                    oBBox.Add(pszComponent, oPath);
+                }
+            }
+
             if (m_aoEnvelopes[i].IsInit() &&
                 CPLTestBool(
                     CPLGetConfigOption("OGR_PARQUET_WRITE_BBOX", "YES")))
@@ -680,6 +779,493 @@ bool OGRParquetWriterLayer::FlushGroup()
     return ret;
 }
 
+/************************************************************************/
+/*                          AppendToBuffer()                            */
+/************************************************************************/
+
+template <class T>
+static void AppendToBuffer(std::vector<GByte> &abyBuffer, const T &val)
+{
+    const size_t nOldSize = abyBuffer.size();
+    abyBuffer.resize(nOldSize + sizeof(T));
+    memcpy(abyBuffer.data() + nOldSize, &val, sizeof(T));
+}
+
+static void AppendToBuffer(std::vector<GByte> &abyBuffer, const void *pData,
+                           size_t nSize)
+{
+    const size_t nOldSize = abyBuffer.size();
+    abyBuffer.resize(nOldSize + nSize);
+    if (nSize)
+        memcpy(abyBuffer.data() + nOldSize, pData, nSize);
+}
+
+/************************************************************************/
+/*                         SerializeFeature()                           */
+/************************************************************************/
+
+// Serializes a feature in the (native endianness) format of the temporary
+// file used by SORT_BY_BBOX=YES.
+static bool SerializeFeature(const OGRFeature *poFeature,
+                             std::vector<GByte> &abyBuffer)
+{
+    abyBuffer.clear();
+    AppendToBuffer(abyBuffer, static_cast<int64_t>(poFeature->GetFID()));
+
+    const auto poFeatureDefn = poFeature->GetDefnRef();
+    const int nFieldCount = poFeatureDefn->GetFieldCount();
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        if (!poFeature->IsFieldSetUnsafe(i))
+        {
+            AppendToBuffer(abyBuffer, static_cast<GByte>(0));
+            continue;
+        }
+        if (poFeature->IsFieldNull(i))
+        {
+            AppendToBuffer(abyBuffer, static_cast<GByte>(1));
+            continue;
+        }
+        AppendToBuffer(abyBuffer, static_cast<GByte>(2));
+
+        const OGRField *psField = poFeature->GetRawFieldRef(i);
+        switch (poFeatureDefn->GetFieldDefn(i)->GetType())
+        {
+            case OFTInteger:
+                AppendToBuffer(abyBuffer, psField->Integer);
+                break;
+            case OFTInteger64:
+                AppendToBuffer(abyBuffer, psField->Integer64);
+                break;
+            case OFTReal:
+                AppendToBuffer(abyBuffer, psField->Real);
+                break;
+            case OFTString:
+            case OFTWideString:
+            {
+                const auto nLen =
+                    static_cast<uint32_t>(strlen(psField->String));
+                AppendToBuffer(abyBuffer, nLen);
+                AppendToBuffer(abyBuffer, psField->String, nLen);
+                break;
+            }
+            case OFTBinary:
+                AppendToBuffer(abyBuffer,
+                               static_cast<uint32_t>(psField->Binary.nCount));
+                AppendToBuffer(abyBuffer, psField->Binary.paData,
+                               psField->Binary.nCount);
+                break;
+            case OFTIntegerList:
+                AppendToBuffer(
+                    abyBuffer,
+                    static_cast<uint32_t>(psField->IntegerList.nCount));
+                AppendToBuffer(abyBuffer, psField->IntegerList.paList,
+                               psField->IntegerList.nCount * sizeof(int));
+                break;
+            case OFTInteger64List:
+                AppendToBuffer(
+                    abyBuffer,
+                    static_cast<uint32_t>(psField->Integer64List.nCount));
+                AppendToBuffer(abyBuffer, psField->Integer64List.paList,
+                               psField->Integer64List.nCount * sizeof(GIntBig));
+                break;
+            case OFTRealList:
+                AppendToBuffer(abyBuffer,
+                               static_cast<uint32_t>(psField->RealList.nCount));
+                AppendToBuffer(abyBuffer, psField->RealList.paList,
+                               psField->RealList.nCount * sizeof(double));
+                break;
+            case OFTStringList:
+            case OFTWideStringList:
+                AppendToBuffer(
+                    abyBuffer,
+                    static_cast<uint32_t>(psField->StringList.nCount));
+                for (int j = 0; j < psField->StringList.nCount; ++j)
+                {
+                    const auto nLen = static_cast<uint32_t>(
+                        strlen(psField->StringList.paList[j]));
+                    AppendToBuffer(abyBuffer, nLen);
+                    AppendToBuffer(abyBuffer, psField->StringList.paList[j],
+                                   nLen);
+                }
+                break;
+            case OFTDate:
+            case OFTTime:
+            case OFTDateTime:
+                AppendToBuffer(abyBuffer, psField->Date);
+                break;
+        }
+    }
+
+    const int nGeomFieldCount = poFeatureDefn->GetGeomFieldCount();
+    for (int i = 0; i < nGeomFieldCount; ++i)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
+        if (poGeom == nullptr)
+        {
+            AppendToBuffer(abyBuffer, static_cast<uint32_t>(0));
+            continue;
+        }
+        const size_t nWKBSize = poGeom->WkbSize();
+        if (nWKBSize > std::numeric_limits<uint32_t>::max())
+        {
+            CPLError(CE_Failure, CPLE_NotSupported, "Too large geometry");
+            return false;
+        }
+        AppendToBuffer(abyBuffer, static_cast<uint32_t>(nWKBSize));
+        const size_t nOldSize = abyBuffer.size();
+        abyBuffer.resize(nOldSize + nWKBSize);
+        poGeom->exportToWkb(wkbNDR, abyBuffer.data() + nOldSize,
+                            wkbVariantIso);
+    }
+
+    if (abyBuffer.size() > std::numeric_limits<uint32_t>::max())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too large feature");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        DeserializeFeature()                          */
+/************************************************************************/
+
+static bool DeserializeFeature(const GByte *pabyData, size_t nSize,
+                               OGRFeature *poFeature)
+{
+    const GByte *const pabyEnd = pabyData + nSize;
+    const auto Read = [&pabyData, pabyEnd](void *pDst, size_t nBytes)
+    {
+        if (static_cast<size_t>(pabyEnd - pabyData) < nBytes)
+            return false;
+        if (nBytes)
+            memcpy(pDst, pabyData, nBytes);
+        pabyData += nBytes;
+        return true;
+    };
+
+    int64_t nFID = 0;
+    if (!Read(&nFID, sizeof(nFID)))
+        return false;
+    poFeature->SetFID(nFID);
+
+    const auto poFeatureDefn = poFeature->GetDefnRef();
+    const int nFieldCount = poFeatureDefn->GetFieldCount();
+    std::string osTmp;
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        GByte nState = 0;
+        if (!Read(&nState, 1))
+            return false;
+        if (nState == 0)
+            continue;
+        if (nState == 1)
+        {
+            poFeature->SetFieldNull(i);
+            continue;
+        }
+
+        OGRField sField;
+        uint32_t nCount = 0;
+        switch (poFeatureDefn->GetFieldDefn(i)->GetType())
+        {
+            case OFTInteger:
+            {
+                int nVal = 0;
+                if (!Read(&nVal, sizeof(nVal)))
+                    return false;
+                poFeature->SetField(i, nVal);
+                break;
+            }
+            case OFTInteger64:
+            {
+                GIntBig nVal = 0;
+                if (!Read(&nVal, sizeof(nVal)))
+                    return false;
+                poFeature->SetField(i, nVal);
+                break;
+            }
+            case OFTReal:
+            {
+                double dfVal = 0;
+                if (!Read(&dfVal, sizeof(dfVal)))
+                    return false;
+                poFeature->SetField(i, dfVal);
+                break;
+            }
+            case OFTString:
+            case OFTWideString:
+            {
+                if (!Read(&nCount, sizeof(nCount)))
+                    return false;
+                osTmp.resize(nCount);
+                if (!Read(&osTmp[0], nCount))
+                    return false;
+                poFeature->SetField(i, osTmp.c_str());
+                break;
+            }
+            case OFTBinary:
+            {
+                if (!Read(&nCount, sizeof(nCount)) ||
+                    static_cast<size_t>(pabyEnd - pabyData) < nCount)
+                    return false;
+                poFeature->SetField(i, static_cast<int>(nCount), pabyData);
+                pabyData += nCount;
+                break;
+            }
+            case OFTIntegerList:
+            {
+                if (!Read(&nCount, sizeof(nCount)))
+                    return false;
+                std::vector<int> anValues(nCount);
+                if (!Read(anValues.data(), nCount * sizeof(int)))
+                    return false;
+                poFeature->SetField(i, static_cast<int>(nCount),
+                                    anValues.data());
+                break;
+            }
+            case OFTInteger64List:
+            {
+                if (!Read(&nCount, sizeof(nCount)))
+                    return false;
+                std::vector<GIntBig> anValues(nCount);
+                if (!Read(anValues.data(), nCount * sizeof(GIntBig)))
+                    return false;
+                poFeature->SetField(i, static_cast<int>(nCount),
+                                    anValues.data());
+                break;
+            }
+            case OFTRealList:
+            {
+                if (!Read(&nCount, sizeof(nCount)))
+                    return false;
+                std::vector<double> adfValues(nCount);
+                if (!Read(adfValues.data(), nCount * sizeof(double)))
+                    return false;
+                poFeature->SetField(i, static_cast<int>(nCount),
+                                    adfValues.data());
+                break;
+            }
+            case OFTStringList:
+            case OFTWideStringList:
+            {
+                if (!Read(&nCount, sizeof(nCount)))
+                    return false;
+                CPLStringList aosList;
+                for (uint32_t j = 0; j < nCount; ++j)
+                {
+                    uint32_t nLen = 0;
+                    if (!Read(&nLen, sizeof(nLen)))
+                        return false;
+                    osTmp.resize(nLen);
+                    if (!Read(&osTmp[0], nLen))
+                        return false;
+                    aosList.AddString(osTmp.c_str());
+                }
+                poFeature->SetField(i, aosList.List());
+                break;
+            }
+            case OFTDate:
+            case OFTTime:
+            case OFTDateTime:
+            {
+                if (!Read(&sField.Date, sizeof(sField.Date)))
+                    return false;
+                poFeature->SetField(i, &sField);
+                break;
+            }
+        }
+    }
+
+    const int nGeomFieldCount = poFeatureDefn->GetGeomFieldCount();
+    for (int i = 0; i < nGeomFieldCount; ++i)
+    {
+        uint32_t nWKBSize = 0;
+        if (!Read(&nWKBSize, sizeof(nWKBSize)))
+            return false;
+        if (nWKBSize == 0)
+            continue;
+        if (static_cast<size_t>(pabyEnd - pabyData) < nWKBSize)
+            return false;
+        OGRGeometry *poGeom = nullptr;
+        if (OGRGeometryFactory::createFromWkb(pabyData, nullptr, &poGeom,
+                                              nWKBSize, wkbVariantIso) !=
+            OGRERR_NONE)
+        {
+            return false;
+        }
+        poFeature->SetGeomFieldDirectly(i, poGeom);
+        pabyData += nWKBSize;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          ICreateFeature()                            */
+/************************************************************************/
+
+OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
+{
+    if (!m_bSortByBBox)
+        return OGRArrowWriterLayer::ICreateFeature(poFeature);
+
+    // Prevent fields from being added after the first feature, as in the
+    // non-sorted case.
+    if (m_poSchema == nullptr)
+        CreateSchema();
+
+    if (!m_osFIDColumn.empty() && poFeature->GetFID() == OGRNullFID)
+        poFeature->SetFID(m_nFeatureCount);
+
+    if (!SerializeFeature(poFeature, m_abyFeatureBuffer))
+        return OGRERR_FAILURE;
+    if (VSIFWriteL(m_abyFeatureBuffer.data(), 1, m_abyFeatureBuffer.size(),
+                   m_fpTmp) != m_abyFeatureBuffer.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write in temporary file %s",
+                 m_osTmpFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+
+    SortItem sItem;
+    sItem.nOffset = m_nTmpFileSize;
+    sItem.nSize = static_cast<uint32_t>(m_abyFeatureBuffer.size());
+    sItem.dfX = std::numeric_limits<double>::quiet_NaN();
+    sItem.dfY = std::numeric_limits<double>::quiet_NaN();
+    const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
+    if (poGeom && !poGeom->IsEmpty())
+    {
+        OGREnvelope sEnvelope;
+        poGeom->getEnvelope(&sEnvelope);
+        sItem.dfX = sEnvelope.MinX + (sEnvelope.MaxX - sEnvelope.MinX) / 2;
+        sItem.dfY = sEnvelope.MinY + (sEnvelope.MaxY - sEnvelope.MinY) / 2;
+    }
+    m_asSortItems.push_back(sItem);
+    m_nTmpFileSize += sItem.nSize;
+    m_nFeatureCount++;
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           HilbertCode()                              */
+/************************************************************************/
+
+// Returns the distance along a Hilbert curve of order 16 of (x,y), with
+// x and y in [0, 65535]
+static uint32_t HilbertCode(uint32_t x, uint32_t y)
+{
+    constexpr uint32_t N = 1U << 16;
+    uint32_t d = 0;
+    for (uint32_t s = N / 2; s > 0; s /= 2)
+    {
+        const uint32_t rx = (x & s) != 0 ? 1 : 0;
+        const uint32_t ry = (y & s) != 0 ? 1 : 0;
+        d += s * s * ((3 * rx) ^ ry);
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = N - 1 - x;
+                y = N - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+/************************************************************************/
+/*                        WriteSortedFeatures()                         */
+/************************************************************************/
+
+bool OGRParquetWriterLayer::WriteSortedFeatures()
+{
+    if (m_fpTmp == nullptr)
+        return false;
+
+    OGREnvelope sExtent;
+    for (const auto &sItem : m_asSortItems)
+    {
+        if (!std::isnan(sItem.dfX))
+        {
+            sExtent.Merge(sItem.dfX, sItem.dfY);
+        }
+    }
+
+    constexpr double HILBERT_MAX = 65535;
+    const double dfWidth = sExtent.MaxX - sExtent.MinX;
+    const double dfHeight = sExtent.MaxY - sExtent.MinY;
+    for (auto &sItem : m_asSortItems)
+    {
+        if (std::isnan(sItem.dfX))
+        {
+            // Features without geometry are written last
+            sItem.nHilbertCode = std::numeric_limits<uint32_t>::max();
+        }
+        else
+        {
+            const auto x = static_cast<uint32_t>(
+                dfWidth > 0
+                    ? (sItem.dfX - sExtent.MinX) / dfWidth * HILBERT_MAX
+                    : 0);
+            const auto y = static_cast<uint32_t>(
+                dfHeight > 0
+                    ? (sItem.dfY - sExtent.MinY) / dfHeight * HILBERT_MAX
+                    : 0);
+            sItem.nHilbertCode = HilbertCode(x, y);
+        }
+    }
+    std::stable_sort(m_asSortItems.begin(), m_asSortItems.end(),
+                     [](const SortItem &a, const SortItem &b)
+                     { return a.nHilbertCode < b.nHilbertCode; });
+
+    // Features are now actually written by the base implementation, which
+    // counts them again.
+    m_nFeatureCount = 0;
+    m_bSortByBBox = false;
+
+    bool bRet = true;
+    for (const auto &sItem : m_asSortItems)
+    {
+        m_abyFeatureBuffer.resize(sItem.nSize);
+        if (VSIFSeekL(m_fpTmp, sItem.nOffset, SEEK_SET) != 0 ||
+            VSIFReadL(m_abyFeatureBuffer.data(), 1, sItem.nSize, m_fpTmp) !=
+                sItem.nSize)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read from temporary file %s",
+                     m_osTmpFilename.c_str());
+            bRet = false;
+            break;
+        }
+        OGRFeature oFeature(m_poFeatureDefn);
+        if (!DeserializeFeature(m_abyFeatureBuffer.data(), sItem.nSize,
+                                &oFeature))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot decode feature from temporary file %s",
+                     m_osTmpFilename.c_str());
+            bRet = false;
+            break;
+        }
+        if (OGRArrowWriterLayer::ICreateFeature(&oFeature) != OGRERR_NONE)
+        {
+            bRet = false;
+            break;
+        }
+    }
+
+    m_asSortItems.clear();
+    m_asSortItems.shrink_to_fit();
+    VSIFCloseL(m_fpTmp);
+    m_fpTmp = nullptr;
+    VSIUnlink(m_osTmpFilename.c_str());
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                     FixupGeometryBeforeWriting()                     */
 /************************************************************************/
@@ -0,0 +1,387 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  PMTiles driver declarations
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef OGR_PMTILES_H_INCLUDED
+#define OGR_PMTILES_H_INCLUDED
+
+#include "cpl_json.h"
+#include "cpl_mem_cache.h"
+#include "gdal_pam.h"
+#include "ogrsf_frmts.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Specification:
+// https://github.com/protomaps/PMTiles/blob/main/spec/v3/spec.md
+
+constexpr int PMTILES_HEADER_LENGTH = 127;
+
+// The header and the root directory must fit in the first 16 KB of the file,
+// so that readers can fetch both with a single range request.
+constexpr int PMTILES_HEADER_AND_ROOT_MAX_LENGTH = 16384;
+
+// Directories may only be nested on that many levels
+constexpr int PMTILES_MAX_DIRECTORY_DEPTH = 4;
+
+// Maximum zoom level supported, so that tile coordinates fit on an int
+constexpr int PMTILES_MAX_ZOOM = 30;
+
+#define PMTILES_SPHERICAL_RADIUS 6378137.0
+#define PMTILES_MAX_GM (PMTILES_SPHERICAL_RADIUS * M_PI)  // 20037508.342789244
+
+/** Values of the internal_compression and tile_compression header fields */
+enum class PMTilesCompression : uint8_t
+{
+    UNKNOWN = 0,
+    NONE = 1,
+    GZIP = 2,
+    BROTLI = 3,
+    ZSTD = 4,
+};
+
+/** Values of the tile_type header field */
+enum class PMTilesTileType : uint8_t
+{
+    UNKNOWN = 0,
+    MVT = 1,
+    PNG = 2,
+    JPEG = 3,
+    WEBP = 4,
+    AVIF = 5,
+};
+
+/************************************************************************/
+/*                           OGRPMTilesHeader                           */
+/************************************************************************/
+
+struct OGRPMTilesHeader
+{
+    uint64_t nRootDirOffset = 0;
+    uint64_t nRootDirLength = 0;
+    uint64_t nMetadataOffset = 0;
+    uint64_t nMetadataLength = 0;
+    uint64_t nLeafDirsOffset = 0;
+    uint64_t nLeafDirsLength = 0;
+    uint64_t nTileDataOffset = 0;
+    uint64_t nTileDataLength = 0;
+    uint64_t nAddressedTilesCount = 0;
+    uint64_t nTileEntriesCount = 0;
+    uint64_t nTileContentsCount = 0;
+    bool bClustered = false;
+    PMTilesCompression eInternalCompression = PMTilesCompression::UNKNOWN;
+    PMTilesCompression eTileCompression = PMTilesCompression::UNKNOWN;
+    PMTilesTileType eTileType = PMTilesTileType::UNKNOWN;
+    int nMinZoom = 0;
+    int nMaxZoom = 0;
+    // Bounds and center in degrees
+    double dfMinLon = -180;
+    double dfMinLat = -85.0511287798066;
+    double dfMaxLon = 180;
+    double dfMaxLat = 85.0511287798066;
+    int nCenterZoom = 0;
+    double dfCenterLon = 0;
+    double dfCenterLat = 0;
+};
+
+/************************************************************************/
+/*                            OGRPMTilesEntry                           */
+/************************************************************************/
+
+/** Directory entry. A run length of 0 designates a leaf directory, whose
+ * offset is relative to the start of the leaf directories section. Otherwise
+ * the entry points to tile data, relative to the start of the tile data
+ * section, shared by nRunLength consecutive tile ids. */
+struct OGRPMTilesEntry
+{
+    uint64_t nTileId = 0;
+    uint64_t nOffset = 0;
+    uint32_t nLength = 0;
+    uint32_t nRunLength = 0;
+};
+
+typedef std::shared_ptr<const std::vector<OGRPMTilesEntry>>
+    OGRPMTilesDirectoryPtr;
+
+/* ogrpmtilesformat.cpp */
+uint64_t OGRPMTilesZXYToTileId(int nZ, uint32_t nX, uint32_t nY);
+bool OGRPMTilesTileIdToZXY(uint64_t nTileId, int &nZ, uint32_t &nX,
+                           uint32_t &nY);
+bool OGRPMTilesDeserializeHeader(const GByte *pabyData, size_t nSize,
+                                 OGRPMTilesHeader &sHeader);
+void OGRPMTilesSerializeHeader(const OGRPMTilesHeader &sHeader,
+                               GByte *pabyData);
+bool OGRPMTilesDeserializeDirectory(const std::string &osData,
+                                    std::vector<OGRPMTilesEntry> &aoEntries);
+std::string
+OGRPMTilesSerializeDirectory(const std::vector<OGRPMTilesEntry> &aoEntries);
+const OGRPMTilesEntry *
+OGRPMTilesFindEntry(const std::vector<OGRPMTilesEntry> &aoEntries,
+                    uint64_t nTileId);
+bool OGRPMTilesDecompress(PMTilesCompression eCompression,
+                          const std::string &osIn, std::string &osOut);
+bool OGRPMTilesCompress(PMTilesCompression eCompression,
+                        const std::string &osIn, std::string &osOut);
+
+/* ogrpmtilesfrommbtiles.cpp */
+bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
+                                  const char *pszSrcName,
+                                  GDALProgressFunc pfnProgress,
+                                  void *pProgressData);
+
+class OGRPMTilesDataset;
+
+/************************************************************************/
+/*                        OGRPMTilesTileIterator                        */
+/************************************************************************/
+
+/** Iterates over the tiles of a zoom level that intersect a window of tile
+ * coordinates. Large windows are browsed by walking the directories in tile
+ * id (Hilbert curve) order, whereas small windows are browsed by looking up
+ * each of their tiles individually. */
+class OGRPMTilesTileIterator
+{
+    OGRPMTilesDataset *m_poDS = nullptr;
+    int m_nZoomLevel = 0;
+    int m_nMinX = 0;
+    int m_nMinY = 0;
+    int m_nMaxX = 0;
+    int m_nMaxY = 0;
+
+    // Lookup mode
+    bool m_bLookupMode = false;
+    int m_nCurX = 0;
+    int m_nCurY = 0;
+
+    // Directory walk mode
+    uint64_t m_nMinTileId = 0;
+    uint64_t m_nMaxTileId = 0;  // exclusive
+    struct DirectoryCursor
+    {
+        OGRPMTilesDirectoryPtr poEntries{};
+        size_t nIdx = 0;
+    };
+    std::vector<DirectoryCursor> m_aoStack{};
+    OGRPMTilesEntry m_sCurEntry{};
+    uint64_t m_nNextTileIdInRun = 0;
+    bool m_bInRun = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesTileIterator)
+
+  public:
+    OGRPMTilesTileIterator(OGRPMTilesDataset *poDS, int nZoomLevel, int nMinX,
+                           int nMinY, int nMaxX, int nMaxY);
+
+    bool GetNextTile(int &nX, int &nY, OGRPMTilesEntry &sEntry);
+};
+
+/************************************************************************/
+/*                           OGRPMTilesDataset                          */
+/************************************************************************/
+
+class OGRPMTilesDataset final : public GDALPamDataset
+{
+    friend class OGRPMTilesRasterBand;
+    friend class OGRPMTilesVectorLayer;
+    friend class OGRPMTilesTileIterator;
+
+    VSILFILE *m_fp = nullptr;
+    OGRPMTilesHeader m_sHeader{};
+    OGRPMTilesDirectoryPtr m_poRootDirectory{};
+    lru11::Cache<uint64_t, OGRPMTilesDirectoryPtr> m_oLeafDirectoryCache{
+        128};
+    std::string m_osMetadata{};
+    std::string m_osMetadataMemFilename{};
+    CPLStringList m_aosMetadata{};
+    OGRSpatialReference m_oSRS{};
+    int m_nZoomLevel = 0;
+    int m_nMinZoomLevel = 0;
+
+    // Vector
+    std::vector<std::unique_ptr<OGRLayer>> m_apoLayers{};
+    std::string m_osClip{};
+
+    // Raster
+    OGRPMTilesDataset *m_poMainDS = nullptr;
+    std::vector<std::unique_ptr<OGRPMTilesDataset>> m_apoOverviewDS{};
+    int m_nTileSize = 256;
+    int m_nMinTileX = 0;
+    int m_nMinTileY = 0;
+
+    bool ReadDirectory(uint64_t nOffset, uint64_t nLength,
+                       std::vector<OGRPMTilesEntry> &aoEntries);
+    OGRPMTilesDirectoryPtr GetLeafDirectory(const OGRPMTilesEntry &sEntry);
+    bool FindTile(uint64_t nTileId, OGRPMTilesEntry &sEntry, bool &bFound);
+    bool ReadTileData(const OGRPMTilesEntry &sEntry, std::string &osData);
+
+    bool InitRaster();
+    void InitVector(GDALOpenInfo *poOpenInfo);
+    bool ReadRasterTile(int nBlockXOff, int nBlockYOff,
+                        std::vector<GByte> &abyTile);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesDataset)
+
+  public:
+    OGRPMTilesDataset();
+    ~OGRPMTilesDataset() override;
+
+    static int Identify(GDALOpenInfo *poOpenInfo);
+    static GDALDataset *Open(GDALOpenInfo *poOpenInfo);
+
+    int GetLayerCount() override
+    {
+        return static_cast<int>(m_apoLayers.size());
+    }
+    OGRLayer *GetLayer(int iLayer) override;
+
+    CPLErr GetGeoTransform(double *padfGeoTransform) override;
+    const OGRSpatialReference *GetSpatialRef() const override;
+
+    char **GetMetadata(const char *pszDomain = "") override;
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain = "") override;
+
+    bool ReadTile(int nZ, int nX, int nY, std::string &osData, bool &bFound);
+};
+
+/************************************************************************/
+/*                         OGRPMTilesRasterBand                         */
+/************************************************************************/
+
+class OGRPMTilesRasterBand final : public GDALPamRasterBand
+{
+  public:
+    OGRPMTilesRasterBand(OGRPMTilesDataset *poDS, int nBand);
+
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage) override;
+    GDALColorInterp GetColorInterpretation() override;
+    int GetOverviewCount() override;
+    GDALRasterBand *GetOverview(int nIdx) override;
+};
+
+/************************************************************************/
+/*                         OGRPMTilesVectorLayer                        */
+/************************************************************************/
+
+class OGRPMTilesVectorLayer final : public OGRLayer
+{
+    OGRPMTilesDataset *m_poDS = nullptr;
+    OGRFeatureDefn *m_poFeatureDefn = nullptr;
+    std::unique_ptr<OGRPMTilesTileIterator> m_poTileIterator{};
+    bool m_bEOF = false;
+    std::string m_osTmpFilename{};
+    std::unique_ptr<GDALDataset> m_poTileDS{};
+    OGRLayer *m_poTileLayer = nullptr;
+    GIntBig m_nFeatureCount = -1;
+    int m_nX = 0;
+    int m_nY = 0;
+    OGREnvelope m_sExtent{};
+    int m_nFilterMinX = 0;
+    int m_nFilterMinY = 0;
+    int m_nFilterMaxX = 0;
+    int m_nFilterMaxY = 0;
+    int m_nZoomLevel = 0;
+    bool m_bZoomLevelAuto = false;
+    bool m_bJsonField = false;
+
+    OGRFeature *GetNextRawFeature();
+    OGRFeature *GetNextSrcFeature();
+    OGRFeature *CreateFeatureFrom(OGRFeature *poSrcFeature);
+    std::unique_ptr<GDALDataset> OpenTile(int nX, int nY,
+                                          const OGRPMTilesEntry &sEntry,
+                                          std::string &osTmpFilename);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesVectorLayer)
+
+  public:
+    OGRPMTilesVectorLayer(OGRPMTilesDataset *poDS, const char *pszLayerName,
+                          const CPLJSONObject &oFields, bool bJsonField,
+                          const OGREnvelope &sExtent,
+                          OGRwkbGeometryType eGeomType,
+                          bool bZoomLevelFromSpatialFilter);
+    ~OGRPMTilesVectorLayer() override;
+
+    void ResetReading() override;
+    OGRFeature *GetNextFeature() override;
+    OGRFeatureDefn *GetLayerDefn() override
+    {
+        return m_poFeatureDefn;
+    }
+    GIntBig GetFeatureCount(int bForce) override;
+    int TestCapability(const char *) override;
+
+    OGRErr GetExtent(OGREnvelope *psExtent, int bForce) override;
+    OGRErr GetExtent(int iGeomField, OGREnvelope *psExtent,
+                     int bForce) override
+    {
+        return OGRLayer::GetExtent(iGeomField, psExtent, bForce);
+    }
+
+    void SetSpatialFilter(OGRGeometry *) override;
+    void SetSpatialFilter(int iGeomField, OGRGeometry *poGeom) override
+    {
+        OGRLayer::SetSpatialFilter(iGeomField, poGeom);
+    }
+    OGRFeature *GetFeature(GIntBig nFID) override;
+};
+
+/************************************************************************/
+/*                        OGRPMTilesWriterDataset                       */
+/************************************************************************/
+
+/** Vector writer: features are tiled by the MVT writer into a temporary
+ * MBTiles file, which is converted into a PMTiles archive when the dataset
+ * is closed. */
+class OGRPMTilesWriterDataset final : public GDALDataset
+{
+    std::unique_ptr<GDALDataset> m_poMBTilesWriterDS{};
+    std::string m_osTmpFilename{};
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesWriterDataset)
+
+  protected:
+    OGRLayer *ICreateLayer(const char *pszLayerName,
+                           OGRSpatialReference *poSRS,
+                           OGRwkbGeometryType eGType,
+                           char **papszOptions) override;
+
+  public:
+    OGRPMTilesWriterDataset() = default;
+    ~OGRPMTilesWriterDataset() override;
+
+    bool Create(const char *pszFilename, CSLConstList papszOptions);
+    CPLErr Close() override;
+
+    int GetLayerCount() override;
+    OGRLayer *GetLayer(int iLayer) override;
+    int TestCapability(const char *pszCap) override;
+};
+
+#endif  // OGR_PMTILES_H_INCLUDED
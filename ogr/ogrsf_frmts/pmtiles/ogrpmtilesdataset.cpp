@@ -0,0 +1,1022 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Implementation of the PMTiles reader
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ogr_pmtiles.h"
+
+#include "mvtutils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// Sanity limits on the size of the sections read in memory
+constexpr uint64_t MAX_DIRECTORY_SIZE = 100 * 1024 * 1024;
+constexpr uint64_t MAX_METADATA_SIZE = 100 * 1024 * 1024;
+constexpr uint32_t MAX_TILE_SIZE = 100 * 1024 * 1024;
+
+/************************************************************************/
+/*                     LongLatToSphericalMercator()                     */
+/************************************************************************/
+
+static void LongLatToSphericalMercator(double &dfX, double &dfY)
+{
+    constexpr double MAX_LAT = 85.0511287798066;
+    const double dfLat = std::max(-MAX_LAT, std::min(MAX_LAT, dfY));
+    dfX = PMTILES_SPHERICAL_RADIUS * dfX / 180 * M_PI;
+    dfY = PMTILES_SPHERICAL_RADIUS *
+          log(tan(M_PI / 4 + 0.5 * dfLat / 180 * M_PI));
+}
+
+/************************************************************************/
+/*                         OGRPMTilesDataset()                          */
+/************************************************************************/
+
+OGRPMTilesDataset::OGRPMTilesDataset()
+{
+    m_oSRS.importFromEPSG(3857);
+    m_oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+}
+
+/************************************************************************/
+/*                        ~OGRPMTilesDataset()                          */
+/************************************************************************/
+
+OGRPMTilesDataset::~OGRPMTilesDataset()
+{
+    if (m_poMainDS == nullptr)
+        FlushCache(true);
+    m_apoLayers.clear();
+    m_apoOverviewDS.clear();
+    if (!m_osMetadataMemFilename.empty())
+        VSIUnlink(m_osMetadataMemFilename.c_str());
+    if (m_fp)
+        VSIFCloseL(m_fp);
+}
+
+/************************************************************************/
+/*                              Identify()                              */
+/************************************************************************/
+
+int OGRPMTilesDataset::Identify(GDALOpenInfo *poOpenInfo)
+{
+    return poOpenInfo->fpL != nullptr &&
+           poOpenInfo->nHeaderBytes >= PMTILES_HEADER_LENGTH &&
+           memcmp(poOpenInfo->pabyHeader, "PMTiles", 7) == 0;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+GDALDataset *OGRPMTilesDataset::Open(GDALOpenInfo *poOpenInfo)
+{
+    if (!Identify(poOpenInfo))
+        return nullptr;
+    if (poOpenInfo->eAccess == GA_Update)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Update of existing PMTiles files is not supported");
+        return nullptr;
+    }
+
+    auto poDS = cpl::make_unique<OGRPMTilesDataset>();
+    poDS->m_fp = poOpenInfo->fpL;
+    poOpenInfo->fpL = nullptr;
+
+    // The header and the root directory are fetched with a single read,
+    // that is a single range request on network file systems.
+    std::string osBuffer;
+    osBuffer.resize(PMTILES_HEADER_AND_ROOT_MAX_LENGTH);
+    VSIFSeekL(poDS->m_fp, 0, SEEK_SET);
+    const size_t nRead =
+        VSIFReadL(&osBuffer[0], 1, osBuffer.size(), poDS->m_fp);
+    osBuffer.resize(nRead);
+    auto &sHeader = poDS->m_sHeader;
+    if (!OGRPMTilesDeserializeHeader(
+            reinterpret_cast<const GByte *>(osBuffer.data()), nRead, sHeader))
+    {
+        return nullptr;
+    }
+
+    auto poRootDirectory = std::make_shared<std::vector<OGRPMTilesEntry>>();
+    if (sHeader.nRootDirOffset <= nRead &&
+        sHeader.nRootDirLength <= nRead - sHeader.nRootDirOffset)
+    {
+        std::string osDir;
+        if (!OGRPMTilesDecompress(
+                sHeader.eInternalCompression,
+                osBuffer.substr(static_cast<size_t>(sHeader.nRootDirOffset),
+                                static_cast<size_t>(sHeader.nRootDirLength)),
+                osDir) ||
+            !OGRPMTilesDeserializeDirectory(osDir, *poRootDirectory))
+        {
+            return nullptr;
+        }
+    }
+    else if (!poDS->ReadDirectory(sHeader.nRootDirOffset,
+                                  sHeader.nRootDirLength, *poRootDirectory))
+    {
+        return nullptr;
+    }
+    poDS->m_poRootDirectory = poRootDirectory;
+
+    // Read the JSON metadata
+    if (sHeader.nMetadataLength > MAX_METADATA_SIZE)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Too large metadata section");
+        return nullptr;
+    }
+    if (sHeader.nMetadataLength > 0)
+    {
+        std::string osMetadata;
+        osMetadata.resize(static_cast<size_t>(sHeader.nMetadataLength));
+        if (VSIFSeekL(poDS->m_fp, sHeader.nMetadataOffset, SEEK_SET) != 0 ||
+            VSIFReadL(&osMetadata[0], osMetadata.size(), 1, poDS->m_fp) !=
+                1 ||
+            !OGRPMTilesDecompress(sHeader.eInternalCompression, osMetadata,
+                                  poDS->m_osMetadata))
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read metadata");
+            return nullptr;
+        }
+    }
+
+    CPLJSONDocument oMetadataDoc;
+    if (!poDS->m_osMetadata.empty() &&
+        oMetadataDoc.LoadMemory(poDS->m_osMetadata))
+    {
+        for (const auto &oChild : oMetadataDoc.GetRoot().GetChildren())
+        {
+            switch (oChild.GetType())
+            {
+                case CPLJSONObject::Type::String:
+                case CPLJSONObject::Type::Integer:
+                case CPLJSONObject::Type::Long:
+                case CPLJSONObject::Type::Double:
+                case CPLJSONObject::Type::Boolean:
+                    poDS->m_aosMetadata.SetNameValue(
+                        oChild.GetName().c_str(), oChild.ToString().c_str());
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    poDS->m_aosMetadata.SetNameValue("ZOOM_LEVEL",
+                                     CPLSPrintf("%d", sHeader.nMaxZoom));
+
+    poDS->m_nMinZoomLevel = sHeader.nMinZoom;
+    poDS->m_nZoomLevel = sHeader.nMaxZoom;
+    const char *pszZoomLevel =
+        CSLFetchNameValue(poOpenInfo->papszOpenOptions, "ZOOM_LEVEL");
+    if (pszZoomLevel)
+    {
+        poDS->m_nZoomLevel = atoi(pszZoomLevel);
+        if (poDS->m_nZoomLevel < sHeader.nMinZoom ||
+            poDS->m_nZoomLevel > sHeader.nMaxZoom)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid zoom level. Should be in [%d,%d] range",
+                     sHeader.nMinZoom, sHeader.nMaxZoom);
+            return nullptr;
+        }
+        poDS->m_aosMetadata.SetNameValue("ZOOM_LEVEL", pszZoomLevel);
+    }
+
+    switch (sHeader.eTileType)
+    {
+        case PMTilesTileType::MVT:
+            if ((poOpenInfo->nOpenFlags & GDAL_OF_VECTOR) == 0)
+                return nullptr;
+            poDS->InitVector(poOpenInfo);
+            break;
+
+        case PMTilesTileType::PNG:
+        case PMTilesTileType::JPEG:
+        case PMTilesTileType::WEBP:
+            if ((poOpenInfo->nOpenFlags & GDAL_OF_RASTER) == 0)
+                return nullptr;
+            if (!poDS->InitRaster())
+                return nullptr;
+            break;
+
+        default:
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "PMTiles: unsupported tile type %d",
+                     static_cast<int>(sHeader.eTileType));
+            return nullptr;
+    }
+
+    poDS->SetDescription(poOpenInfo->pszFilename);
+    if (poDS->nBands > 0)
+    {
+        poDS->TryLoadXML();
+    }
+    return poDS.release();
+}
+
+/************************************************************************/
+/*                           ReadDirectory()                            */
+/************************************************************************/
+
+bool OGRPMTilesDataset::ReadDirectory(uint64_t nOffset, uint64_t nLength,
+                                      std::vector<OGRPMTilesEntry> &aoEntries)
+{
+    if (nLength > MAX_DIRECTORY_SIZE)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Too large PMTiles directory");
+        return false;
+    }
+    std::string osCompressed;
+    osCompressed.resize(static_cast<size_t>(nLength));
+    if (VSIFSeekL(m_fp, nOffset, SEEK_SET) != 0 ||
+        (nLength > 0 &&
+         VSIFReadL(&osCompressed[0], osCompressed.size(), 1, m_fp) != 1))
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot read PMTiles directory at offset " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(nOffset));
+        return false;
+    }
+    std::string osDir;
+    return OGRPMTilesDecompress(m_sHeader.eInternalCompression, osCompressed,
+                                osDir) &&
+           OGRPMTilesDeserializeDirectory(osDir, aoEntries);
+}
+
+/************************************************************************/
+/*                          GetLeafDirectory()                          */
+/************************************************************************/
+
+OGRPMTilesDirectoryPtr
+OGRPMTilesDataset::GetLeafDirectory(const OGRPMTilesEntry &sEntry)
+{
+    OGRPMTilesDirectoryPtr poDir;
+    if (m_oLeafDirectoryCache.tryGet(sEntry.nOffset, poDir))
+        return poDir;
+
+    if (sEntry.nOffset > m_sHeader.nLeafDirsLength ||
+        sEntry.nLength > m_sHeader.nLeafDirsLength - sEntry.nOffset)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid leaf directory entry: offset=" CPL_FRMT_GUIB
+                 ", length=%u",
+                 static_cast<GUIntBig>(sEntry.nOffset), sEntry.nLength);
+        return nullptr;
+    }
+
+    auto poEntries = std::make_shared<std::vector<OGRPMTilesEntry>>();
+    if (!ReadDirectory(m_sHeader.nLeafDirsOffset + sEntry.nOffset,
+                       sEntry.nLength, *poEntries))
+    {
+        return nullptr;
+    }
+    poDir = poEntries;
+    m_oLeafDirectoryCache.insert(sEntry.nOffset, poDir);
+    return poDir;
+}
+
+/************************************************************************/
+/*                              FindTile()                              */
+/************************************************************************/
+
+/** Looks up the entry of a tile, descending through leaf directories.
+ * bFound is set to false if the tile does not exist, which is not an error.
+ * Returns false if a directory cannot be read. */
+bool OGRPMTilesDataset::FindTile(uint64_t nTileId, OGRPMTilesEntry &sEntry,
+                                 bool &bFound)
+{
+    bFound = false;
+    OGRPMTilesDirectoryPtr poDir = m_poRootDirectory;
+    for (int iDepth = 0; iDepth < PMTILES_MAX_DIRECTORY_DEPTH; ++iDepth)
+    {
+        const OGRPMTilesEntry *psEntry = OGRPMTilesFindEntry(*poDir, nTileId);
+        if (psEntry == nullptr)
+            return true;
+        if (psEntry->nRunLength > 0)
+        {
+            sEntry = *psEntry;
+            bFound = true;
+            return true;
+        }
+        poDir = GetLeafDirectory(*psEntry);
+        if (!poDir)
+            return false;
+    }
+    CPLError(CE_Failure, CPLE_AppDefined,
+             "Too deeply nested PMTiles directories");
+    return false;
+}
+
+/************************************************************************/
+/*                            ReadTileData()                            */
+/************************************************************************/
+
+bool OGRPMTilesDataset::ReadTileData(const OGRPMTilesEntry &sEntry,
+                                     std::string &osData)
+{
+    if (sEntry.nOffset > m_sHeader.nTileDataLength ||
+        sEntry.nLength > m_sHeader.nTileDataLength - sEntry.nOffset ||
+        sEntry.nLength > MAX_TILE_SIZE)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid tile entry: offset=" CPL_FRMT_GUIB ", length=%u",
+                 static_cast<GUIntBig>(sEntry.nOffset), sEntry.nLength);
+        return false;
+    }
+    std::string osCompressed;
+    osCompressed.resize(sEntry.nLength);
+    if (VSIFSeekL(m_fp, m_sHeader.nTileDataOffset + sEntry.nOffset,
+                  SEEK_SET) != 0 ||
+        (sEntry.nLength > 0 &&
+         VSIFReadL(&osCompressed[0], osCompressed.size(), 1, m_fp) != 1))
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot read tile at offset " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(sEntry.nOffset));
+        return false;
+    }
+    return OGRPMTilesDecompress(m_sHeader.eTileCompression, osCompressed,
+                                osData);
+}
+
+/************************************************************************/
+/*                              ReadTile()                              */
+/************************************************************************/
+
+/** Reads the uncompressed content of a tile. bFound is set to false if the
+ * tile does not exist, which is not an error. */
+bool OGRPMTilesDataset::ReadTile(int nZ, int nX, int nY, std::string &osData,
+                                 bool &bFound)
+{
+    osData.clear();
+    bFound = false;
+    if (nZ < 0 || nZ > PMTILES_MAX_ZOOM || nX < 0 || nY < 0 ||
+        nX >= (1 << nZ) || nY >= (1 << nZ))
+    {
+        return true;
+    }
+    OGRPMTilesEntry sEntry;
+    if (!FindTile(OGRPMTilesZXYToTileId(nZ, nX, nY), sEntry, bFound))
+        return false;
+    if (!bFound)
+        return true;
+    return ReadTileData(sEntry, osData);
+}
+
+/************************************************************************/
+/*                             InitVector()                             */
+/************************************************************************/
+
+void OGRPMTilesDataset::InitVector(GDALOpenInfo *poOpenInfo)
+{
+    m_osClip = CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "CLIP", "");
+
+    // The MVT driver takes the layer schemas from a metadata.json file,
+    // whose vector_layers member has the same layout as in PMTiles metadata.
+    m_osMetadataMemFilename = CPLSPrintf("/vsimem/pmtiles/%p_metadata.json",
+                                         static_cast<void *>(this));
+    VSILFILE *fp = VSIFOpenL(m_osMetadataMemFilename.c_str(), "wb");
+    if (fp)
+    {
+        VSIFWriteL(m_osMetadata.data(), 1, m_osMetadata.size(), fp);
+        VSIFCloseL(fp);
+    }
+
+    CPLJSONDocument oJsonDoc;
+    if (!m_osMetadata.empty())
+        CPL_IGNORE_RET_VAL(oJsonDoc.LoadMemory(m_osMetadata));
+    const CPLJSONArray oVectorLayers =
+        oJsonDoc.GetRoot().GetArray("vector_layers");
+    const CPLJSONArray oTileStatLayers =
+        oJsonDoc.GetRoot().GetArray("tilestats/layers");
+
+    OGREnvelope sExtent;
+    sExtent.MinX = m_sHeader.dfMinLon;
+    sExtent.MinY = m_sHeader.dfMinLat;
+    sExtent.MaxX = m_sHeader.dfMaxLon;
+    sExtent.MaxY = m_sHeader.dfMaxLat;
+    LongLatToSphericalMercator(sExtent.MinX, sExtent.MinY);
+    LongLatToSphericalMercator(sExtent.MaxX, sExtent.MaxY);
+
+    const bool bZoomLevelFromSpatialFilter = CPLFetchBool(
+        poOpenInfo->papszOpenOptions, "ZOOM_LEVEL_AUTO", false);
+    const bool bJsonField =
+        CPLFetchBool(poOpenInfo->papszOpenOptions, "JSON_FIELD", false);
+
+    for (int i = 0; i < oVectorLayers.Size(); i++)
+    {
+        CPLJSONObject oId = oVectorLayers[i].GetObj("id");
+        if (oId.IsValid() && oId.GetType() == CPLJSONObject::Type::String)
+        {
+            OGRwkbGeometryType eGeomType = wkbUnknown;
+            if (oTileStatLayers.IsValid())
+            {
+                eGeomType = OGRMVTFindGeomTypeFromTileStat(
+                    oTileStatLayers, oId.ToString().c_str());
+            }
+
+            CPLJSONObject oFields = oVectorLayers[i].GetObj("fields");
+            m_apoLayers.push_back(cpl::make_unique<OGRPMTilesVectorLayer>(
+                this, oId.ToString().c_str(), oFields, bJsonField, sExtent,
+                eGeomType, bZoomLevelFromSpatialFilter));
+        }
+    }
+}
+
+/************************************************************************/
+/*                              GetLayer()                              */
+/************************************************************************/
+
+OGRLayer *OGRPMTilesDataset::GetLayer(int iLayer)
+{
+    if (iLayer < 0 || iLayer >= GetLayerCount())
+        return nullptr;
+    return m_apoLayers[iLayer].get();
+}
+
+/************************************************************************/
+/*                           OpenRasterTile()                           */
+/************************************************************************/
+
+static std::unique_ptr<GDALDataset>
+OpenRasterTile(const std::string &osData, const std::string &osTmpFilename)
+{
+    VSIFCloseL(VSIFileFromMemBuffer(
+        osTmpFilename.c_str(),
+        reinterpret_cast<GByte *>(const_cast<char *>(osData.data())),
+        osData.size(), false));
+    const char *const apszAllowedDrivers[] = {"PNG", "JPEG", "WEBP", nullptr};
+    return std::unique_ptr<GDALDataset>(GDALDataset::Open(
+        osTmpFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_INTERNAL,
+        apszAllowedDrivers, nullptr, nullptr));
+}
+
+/************************************************************************/
+/*                             InitRaster()                             */
+/************************************************************************/
+
+bool OGRPMTilesDataset::InitRaster()
+{
+    // Tiles are exposed as RGB for JPEG, and RGBA otherwise
+    const int nBandCount =
+        m_sHeader.eTileType == PMTilesTileType::JPEG ? 3 : 4;
+
+    // Get the tile size from the first tile of the full resolution level
+    {
+        const int nMaxTile = (1 << m_nZoomLevel) - 1;
+        OGRPMTilesTileIterator oIter(this, m_nZoomLevel, 0, 0, nMaxTile,
+                                     nMaxTile);
+        int nX = 0;
+        int nY = 0;
+        OGRPMTilesEntry sEntry;
+        std::string osData;
+        if (oIter.GetNextTile(nX, nY, sEntry) && ReadTileData(sEntry, osData))
+        {
+            const std::string osTmpFilename(CPLSPrintf(
+                "/vsimem/pmtiles/%p_tilesize", static_cast<void *>(this)));
+            auto poTileDS = OpenRasterTile(osData, osTmpFilename);
+            if (poTileDS)
+            {
+                m_nTileSize = poTileDS->GetRasterXSize();
+                if (poTileDS->GetRasterYSize() != m_nTileSize ||
+                    m_nTileSize < 64 || m_nTileSize > 4096)
+                {
+                    CPLError(CE_Failure, CPLE_NotSupported,
+                             "Unsupported tile dimensions: %dx%d",
+                             poTileDS->GetRasterXSize(),
+                             poTileDS->GetRasterYSize());
+                    m_nTileSize = 0;
+                }
+            }
+            poTileDS.reset();
+            VSIUnlink(osTmpFilename.c_str());
+            if (m_nTileSize == 0)
+                return false;
+        }
+    }
+
+    double dfMinX = m_sHeader.dfMinLon;
+    double dfMinY = m_sHeader.dfMinLat;
+    double dfMaxX = m_sHeader.dfMaxLon;
+    double dfMaxY = m_sHeader.dfMaxLat;
+    LongLatToSphericalMercator(dfMinX, dfMinY);
+    LongLatToSphericalMercator(dfMaxX, dfMaxY);
+
+    // All zoom levels share the same extent, aligned on the tiles of the
+    // lowest zoom level exposed as an overview: the lowest one where the
+    // bounds still cover at least one tile.
+    int nOvrMinZoom = m_nZoomLevel;
+    while (nOvrMinZoom > m_sHeader.nMinZoom)
+    {
+        const double dfTileDim = 2 * PMTILES_MAX_GM / (1 << (nOvrMinZoom - 1));
+        if (std::max(dfMaxX - dfMinX, dfMaxY - dfMinY) < dfTileDim)
+            break;
+        --nOvrMinZoom;
+    }
+    const double dfTileDim = 2 * PMTILES_MAX_GM / (1 << nOvrMinZoom);
+    const int nMaxTile = (1 << nOvrMinZoom) - 1;
+    const auto Clamp = [](double dfVal, int nMin, int nMax)
+    {
+        return static_cast<int>(std::max<double>(
+            nMin, std::min<double>(nMax, std::floor(dfVal))));
+    };
+    const int nMinTileX = Clamp((dfMinX + PMTILES_MAX_GM) / dfTileDim, 0,
+                                nMaxTile);
+    const int nMaxTileX =
+        Clamp(std::ceil((dfMaxX + PMTILES_MAX_GM) / dfTileDim) - 1, nMinTileX,
+              nMaxTile);
+    const int nMinTileY = Clamp((PMTILES_MAX_GM - dfMaxY) / dfTileDim, 0,
+                                nMaxTile);
+    const int nMaxTileY =
+        Clamp(std::ceil((PMTILES_MAX_GM - dfMinY) / dfTileDim) - 1, nMinTileY,
+              nMaxTile);
+
+    for (int nZ = m_nZoomLevel; nZ >= nOvrMinZoom; --nZ)
+    {
+        const int nShift = nZ - nOvrMinZoom;
+        const uint64_t nXSize =
+            (static_cast<uint64_t>(nMaxTileX - nMinTileX + 1) << nShift) *
+            m_nTileSize;
+        const uint64_t nYSize =
+            (static_cast<uint64_t>(nMaxTileY - nMinTileY + 1) << nShift) *
+            m_nTileSize;
+        if (nXSize > static_cast<uint64_t>(std::numeric_limits<int>::max()) ||
+            nYSize > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+        {
+            if (nZ < m_nZoomLevel)
+                continue;
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Raster too large at zoom level %d. Use the ZOOM_LEVEL "
+                     "open option to select a lower zoom level",
+                     nZ);
+            return false;
+        }
+
+        OGRPMTilesDataset *poLevelDS = this;
+        if (nZ < m_nZoomLevel)
+        {
+            m_apoOverviewDS.push_back(cpl::make_unique<OGRPMTilesDataset>());
+            poLevelDS = m_apoOverviewDS.back().get();
+            poLevelDS->m_poMainDS = this;
+            poLevelDS->eAccess = eAccess;
+        }
+        poLevelDS->m_nZoomLevel = nZ;
+        poLevelDS->m_nTileSize = m_nTileSize;
+        poLevelDS->m_nMinTileX = nMinTileX << nShift;
+        poLevelDS->m_nMinTileY = nMinTileY << nShift;
+        poLevelDS->nRasterXSize = static_cast<int>(nXSize);
+        poLevelDS->nRasterYSize = static_cast<int>(nYSize);
+        for (int i = 1; i <= nBandCount; ++i)
+            poLevelDS->SetBand(i, new OGRPMTilesRasterBand(poLevelDS, i));
+        poLevelDS->SetMetadataItem("INTERLEAVE", "PIXEL", "IMAGE_STRUCTURE");
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                           ReadRasterTile()                           */
+/************************************************************************/
+
+/** Decodes the tile corresponding to a block as band-sequential Byte
+ * values. abyTile is left empty if the tile does not exist. */
+bool OGRPMTilesDataset::ReadRasterTile(int nBlockXOff, int nBlockYOff,
+                                       std::vector<GByte> &abyTile)
+{
+    abyTile.clear();
+    OGRPMTilesDataset *poMainDS = m_poMainDS ? m_poMainDS : this;
+    std::string osData;
+    bool bFound = false;
+    if (!poMainDS->ReadTile(m_nZoomLevel, m_nMinTileX + nBlockXOff,
+                            m_nMinTileY + nBlockYOff, osData, bFound))
+    {
+        return false;
+    }
+    if (!bFound)
+        return true;
+
+    const std::string osTmpFilename(
+        CPLSPrintf("/vsimem/pmtiles/%p_%d_%d", static_cast<void *>(this),
+                   nBlockXOff, nBlockYOff));
+    auto poTileDS = OpenRasterTile(osData, osTmpFilename);
+    bool bRet = false;
+    if (poTileDS == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot decode tile %d/%d/%d",
+                 m_nZoomLevel, m_nMinTileX + nBlockXOff,
+                 m_nMinTileY + nBlockYOff);
+    }
+    else if (poTileDS->GetRasterXSize() != m_nTileSize ||
+             poTileDS->GetRasterYSize() != m_nTileSize ||
+             poTileDS->GetRasterCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Tile %d/%d/%d has unexpected dimensions", m_nZoomLevel,
+                 m_nMinTileX + nBlockXOff, m_nMinTileY + nBlockYOff);
+    }
+    else
+    {
+        const int nTileBands = poTileDS->GetRasterCount();
+        const size_t nPixels = static_cast<size_t>(m_nTileSize) * m_nTileSize;
+        abyTile.resize(nBands * nPixels);
+        const GDALColorTable *poCT =
+            nTileBands == 1 ? poTileDS->GetRasterBand(1)->GetColorTable()
+                            : nullptr;
+        if (poCT)
+        {
+            std::vector<GByte> abyIndices(nPixels);
+            bRet = poTileDS->GetRasterBand(1)->RasterIO(
+                       GF_Read, 0, 0, m_nTileSize, m_nTileSize,
+                       abyIndices.data(), m_nTileSize, m_nTileSize, GDT_Byte,
+                       0, 0, nullptr) == CE_None;
+            GByte abyLUT[256][4] = {};
+            const int nEntries = std::min(256, poCT->GetColorEntryCount());
+            for (int i = 0; i < nEntries; ++i)
+            {
+                const GDALColorEntry *psEntry = poCT->GetColorEntry(i);
+                abyLUT[i][0] = static_cast<GByte>(psEntry->c1);
+                abyLUT[i][1] = static_cast<GByte>(psEntry->c2);
+                abyLUT[i][2] = static_cast<GByte>(psEntry->c3);
+                abyLUT[i][3] = static_cast<GByte>(psEntry->c4);
+            }
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                GByte *pabyDst = abyTile.data() + iBand * nPixels;
+                for (size_t i = 0; i < nPixels; ++i)
+                    pabyDst[i] = abyLUT[abyIndices[i]][iBand];
+            }
+        }
+        else
+        {
+            // Gray, gray+alpha, RGB or RGBA tiles
+            int anBandMap[4] = {1, 2, 3, 4};
+            int nCount = std::min(nTileBands, 4);
+            if (nTileBands <= 2)
+            {
+                anBandMap[1] = 1;
+                anBandMap[2] = 1;
+                anBandMap[3] = 2;
+                nCount = nTileBands == 1 ? 3 : 4;
+            }
+            nCount = std::min(nCount, nBands);
+            bRet = poTileDS->RasterIO(GF_Read, 0, 0, m_nTileSize, m_nTileSize,
+                                      abyTile.data(), m_nTileSize, m_nTileSize,
+                                      GDT_Byte, nCount, anBandMap, 1,
+                                      m_nTileSize, nPixels, nullptr) == CE_None;
+            // Opaque alpha band if the tile has none
+            if (nCount < nBands)
+            {
+                memset(abyTile.data() + nCount * nPixels, 255,
+                       (nBands - nCount) * nPixels);
+            }
+        }
+    }
+    poTileDS.reset();
+    VSIUnlink(osTmpFilename.c_str());
+    if (!bRet)
+        abyTile.clear();
+    return bRet;
+}
+
+/************************************************************************/
+/*                          GetGeoTransform()                           */
+/************************************************************************/
+
+CPLErr OGRPMTilesDataset::GetGeoTransform(double *padfGeoTransform)
+{
+    if (nBands == 0)
+        return GDALPamDataset::GetGeoTransform(padfGeoTransform);
+    const double dfTileDim = 2 * PMTILES_MAX_GM / (1 << m_nZoomLevel);
+    const double dfRes = dfTileDim / m_nTileSize;
+    padfGeoTransform[0] = -PMTILES_MAX_GM + m_nMinTileX * dfTileDim;
+    padfGeoTransform[1] = dfRes;
+    padfGeoTransform[2] = 0;
+    padfGeoTransform[3] = PMTILES_MAX_GM - m_nMinTileY * dfTileDim;
+    padfGeoTransform[4] = 0;
+    padfGeoTransform[5] = -dfRes;
+    return CE_None;
+}
+
+/************************************************************************/
+/*                           GetSpatialRef()                            */
+/************************************************************************/
+
+const OGRSpatialReference *OGRPMTilesDataset::GetSpatialRef() const
+{
+    return nBands > 0 ? &m_oSRS : nullptr;
+}
+
+/************************************************************************/
+/*                            GetMetadata()                             */
+/************************************************************************/
+
+char **OGRPMTilesDataset::GetMetadata(const char *pszDomain)
+{
+    if (pszDomain == nullptr || pszDomain[0] == '\0')
+        return m_aosMetadata.List();
+    return GDALPamDataset::GetMetadata(pszDomain);
+}
+
+/************************************************************************/
+/*                          GetMetadataItem()                           */
+/************************************************************************/
+
+const char *OGRPMTilesDataset::GetMetadataItem(const char *pszName,
+                                               const char *pszDomain)
+{
+    if (pszDomain == nullptr || pszDomain[0] == '\0')
+        return m_aosMetadata.FetchNameValue(pszName);
+    return GDALPamDataset::GetMetadataItem(pszName, pszDomain);
+}
+
+/************************************************************************/
+/*                        OGRPMTilesRasterBand()                        */
+/************************************************************************/
+
+OGRPMTilesRasterBand::OGRPMTilesRasterBand(OGRPMTilesDataset *poDSIn,
+                                           int nBandIn)
+{
+    poDS = poDSIn;
+    nBand = nBandIn;
+    eDataType = GDT_Byte;
+    nBlockXSize = poDSIn->m_nTileSize;
+    nBlockYSize = poDSIn->m_nTileSize;
+}
+
+/************************************************************************/
+/*                             IReadBlock()                             */
+/************************************************************************/
+
+CPLErr OGRPMTilesRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
+                                        void *pImage)
+{
+    auto poGDS = cpl::down_cast<OGRPMTilesDataset *>(poDS);
+    std::vector<GByte> abyTile;
+    if (!poGDS->ReadRasterTile(nBlockXOff, nBlockYOff, abyTile))
+        return CE_Failure;
+
+    // A tile holds all bands: fill the blocks of the other bands as well.
+    const size_t nPixels = static_cast<size_t>(nBlockXSize) * nBlockYSize;
+    for (int iBand = 1; iBand <= poGDS->GetRasterCount(); ++iBand)
+    {
+        GDALRasterBlock *poBlock = nullptr;
+        GByte *pabyDst = nullptr;
+        if (iBand == nBand)
+        {
+            pabyDst = static_cast<GByte *>(pImage);
+        }
+        else
+        {
+            auto poOtherBand = poGDS->GetRasterBand(iBand);
+            poBlock = poOtherBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            poBlock =
+                poOtherBand->GetLockedBlockRef(nBlockXOff, nBlockYOff, TRUE);
+            if (poBlock == nullptr)
+                continue;
+            pabyDst = static_cast<GByte *>(poBlock->GetDataRef());
+        }
+        if (abyTile.empty())
+            memset(pabyDst, 0, nPixels);
+        else
+            memcpy(pabyDst, abyTile.data() + (iBand - 1) * nPixels, nPixels);
+        if (poBlock)
+            poBlock->DropLock();
+    }
+    return CE_None;
+}
+
+/************************************************************************/
+/*                       GetColorInterpretation()                       */
+/************************************************************************/
+
+GDALColorInterp OGRPMTilesRasterBand::GetColorInterpretation()
+{
+    return static_cast<GDALColorInterp>(GCI_RedBand + nBand - 1);
+}
+
+/************************************************************************/
+/*                          GetOverviewCount()                          */
+/************************************************************************/
+
+int OGRPMTilesRasterBand::GetOverviewCount()
+{
+    auto poGDS = cpl::down_cast<OGRPMTilesDataset *>(poDS);
+    return static_cast<int>(poGDS->m_apoOverviewDS.size());
+}
+
+/************************************************************************/
+/*                            GetOverview()                             */
+/************************************************************************/
+
+GDALRasterBand *OGRPMTilesRasterBand::GetOverview(int nIdx)
+{
+    auto poGDS = cpl::down_cast<OGRPMTilesDataset *>(poDS);
+    if (nIdx < 0 || nIdx >= GetOverviewCount())
+        return nullptr;
+    return poGDS->m_apoOverviewDS[nIdx]->GetRasterBand(nBand);
+}
+
+/************************************************************************/
+/*                           GetStartIndex()                            */
+/************************************************************************/
+
+// Index of the last entry whose tile id is <= nTileId (or 0)
+static size_t GetStartIndex(const std::vector<OGRPMTilesEntry> &aoEntries,
+                            uint64_t nTileId)
+{
+    auto oIter = std::upper_bound(aoEntries.begin(), aoEntries.end(), nTileId,
+                                  [](uint64_t nVal, const OGRPMTilesEntry &e)
+                                  { return nVal < e.nTileId; });
+    if (oIter == aoEntries.begin())
+        return 0;
+    return static_cast<size_t>(oIter - aoEntries.begin()) - 1;
+}
+
+/************************************************************************/
+/*                       OGRPMTilesTileIterator()                       */
+/************************************************************************/
+
+OGRPMTilesTileIterator::OGRPMTilesTileIterator(OGRPMTilesDataset *poDS,
+                                               int nZoomLevel, int nMinX,
+                                               int nMinY, int nMaxX, int nMaxY)
+    : m_poDS(poDS), m_nZoomLevel(nZoomLevel), m_nMinX(nMinX), m_nMinY(nMinY),
+      m_nMaxX(nMaxX), m_nMaxY(nMaxY), m_nCurX(nMinX), m_nCurY(nMinY)
+{
+    if (nMinX > nMaxX || nMinY > nMaxY)
+    {
+        // Empty window
+        m_bLookupMode = true;
+        m_nCurY = nMaxY + 1;
+        return;
+    }
+
+    // Looking up a tile costs a binary search in each directory level,
+    // whereas walking the directories visits all the tiles of the zoom level
+    // (in Hilbert order, so leaf directories are only fetched once). Only
+    // walk when the window is large.
+    constexpr uint64_t MAX_TILES_LOOKUP = 1000;
+    m_bLookupMode = static_cast<uint64_t>(nMaxX - nMinX + 1) *
+                        static_cast<uint64_t>(nMaxY - nMinY + 1) <=
+                    MAX_TILES_LOOKUP;
+    if (!m_bLookupMode)
+    {
+        m_nMinTileId = OGRPMTilesZXYToTileId(nZoomLevel, 0, 0);
+        m_nMaxTileId =
+            m_nMinTileId + (static_cast<uint64_t>(1) << (2 * nZoomLevel));
+        DirectoryCursor oCursor;
+        oCursor.poEntries = poDS->m_poRootDirectory;
+        oCursor.nIdx = GetStartIndex(*oCursor.poEntries, m_nMinTileId);
+        m_aoStack.push_back(oCursor);
+    }
+}
+
+/************************************************************************/
+/*                            GetNextTile()                             */
+/************************************************************************/
+
+/** Returns the coordinates and the entry of the next existing tile, or false
+ * when iteration is finished. The returned entry has a run length of 1. */
+bool OGRPMTilesTileIterator::GetNextTile(int &nX, int &nY,
+                                         OGRPMTilesEntry &sEntry)
+{
+    if (m_bLookupMode)
+    {
+        while (m_nCurY <= m_nMaxY)
+        {
+            const int nCurX = m_nCurX;
+            const int nCurY = m_nCurY;
+            if (++m_nCurX > m_nMaxX)
+            {
+                m_nCurX = m_nMinX;
+                ++m_nCurY;
+            }
+            bool bFound = false;
+            if (!m_poDS->FindTile(
+                    OGRPMTilesZXYToTileId(m_nZoomLevel, nCurX, nCurY), sEntry,
+                    bFound))
+            {
+                m_nCurY = m_nMaxY + 1;
+                return false;
+            }
+            if (bFound)
+            {
+                nX = nCurX;
+                nY = nCurY;
+                sEntry.nRunLength = 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    while (true)
+    {
+        if (m_bInRun)
+        {
+            if (m_nNextTileIdInRun >= m_nMaxTileId)
+            {
+                m_bInRun = false;
+                m_aoStack.clear();
+                return false;
+            }
+            if (m_nNextTileIdInRun - m_sCurEntry.nTileId >=
+                m_sCurEntry.nRunLength)
+            {
+                m_bInRun = false;
+                continue;
+            }
+            const uint64_t nTileId = m_nNextTileIdInRun++;
+            int nZ = 0;
+            uint32_t nTileX = 0;
+            uint32_t nTileY = 0;
+            if (OGRPMTilesTileIdToZXY(nTileId, nZ, nTileX, nTileY) &&
+                nZ == m_nZoomLevel && static_cast<int>(nTileX) >= m_nMinX &&
+                static_cast<int>(nTileX) <= m_nMaxX &&
+                static_cast<int>(nTileY) >= m_nMinY &&
+                static_cast<int>(nTileY) <= m_nMaxY)
+            {
+                nX = static_cast<int>(nTileX);
+                nY = static_cast<int>(nTileY);
+                sEntry = m_sCurEntry;
+                sEntry.nTileId = nTileId;
+                sEntry.nRunLength = 1;
+                return true;
+            }
+            continue;
+        }
+
+        if (m_aoStack.empty())
+            return false;
+        auto &oCursor = m_aoStack.back();
+        if (oCursor.nIdx >= oCursor.poEntries->size())
+        {
+            m_aoStack.pop_back();
+            continue;
+        }
+        const OGRPMTilesEntry sCur = (*oCursor.poEntries)[oCursor.nIdx++];
+        if (sCur.nTileId >= m_nMaxTileId)
+        {
+            m_aoStack.clear();
+            return false;
+        }
+        if (sCur.nRunLength == 0)
+        {
+            if (m_aoStack.size() >=
+                static_cast<size_t>(PMTILES_MAX_DIRECTORY_DEPTH))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Too deeply nested PMTiles directories");
+                m_aoStack.clear();
+                return false;
+            }
+            DirectoryCursor oLeafCursor;
+            oLeafCursor.poEntries = m_poDS->GetLeafDirectory(sCur);
+            if (!oLeafCursor.poEntries)
+            {
+                m_aoStack.clear();
+                return false;
+            }
+            oLeafCursor.nIdx =
+                GetStartIndex(*oLeafCursor.poEntries, m_nMinTileId);
+            m_aoStack.push_back(oLeafCursor);
+        }
+        else if (sCur.nTileId + sCur.nRunLength > m_nMinTileId)
+        {
+            m_sCurEntry = sCur;
+            m_nNextTileIdInRun = std::max(sCur.nTileId, m_nMinTileId);
+            m_bInRun = true;
+        }
+    }
+}
@@ -0,0 +1,254 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  PMTiles driver registration
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#if defined(HAVE_SQLITE) && defined(HAVE_GEOS)
+// Needed by mvtutils.h
+#define HAVE_MVT_WRITE_SUPPORT
+#endif
+
+#include "ogr_pmtiles.h"
+
+#include "mvtutils.h"
+
+#include <vector>
+
+#ifdef HAVE_MVT_WRITE_SUPPORT
+
+/************************************************************************/
+/*                      OGRPMTilesDriverCreate()                        */
+/************************************************************************/
+
+static GDALDataset *OGRPMTilesDriverCreate(const char *pszFilename, int nXSize,
+                                           int nYSize, int nBandsIn,
+                                           GDALDataType eDT,
+                                           char **papszOptions)
+{
+    if (nXSize == 0 && nYSize == 0 && nBandsIn == 0 && eDT == GDT_Unknown)
+    {
+        auto poDS = cpl::make_unique<OGRPMTilesWriterDataset>();
+        if (!poDS->Create(pszFilename, papszOptions))
+            return nullptr;
+        return poDS.release();
+    }
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Raster PMTiles can only be created with CreateCopy()");
+    return nullptr;
+}
+
+#endif  // HAVE_MVT_WRITE_SUPPORT
+
+/************************************************************************/
+/*                     OGRPMTilesDriverCreateCopy()                     */
+/************************************************************************/
+
+/** Raster tiles are generated by the MBTiles driver, with all overview
+ * levels, into a temporary file (in CPL_TMPDIR) which is then converted. */
+static GDALDataset *
+OGRPMTilesDriverCreateCopy(const char *pszFilename, GDALDataset *poSrcDS,
+                           int bStrict, char **papszOptions,
+                           GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    GDALDriver *poMBTilesDriver =
+        GetGDALDriverManager()->GetDriverByName("MBTiles");
+    if (poMBTilesDriver == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "MBTiles driver needed to create raster PMTiles");
+        return nullptr;
+    }
+
+    const std::string osTmpFilename =
+        std::string(CPLGenerateTempFilename(nullptr)) + ".mbtiles";
+
+    void *pScaledProgress =
+        GDALCreateScaledProgress(0, 0.5, pfnProgress, pProgressData);
+    std::unique_ptr<GDALDataset> poMBTilesDS(poMBTilesDriver->CreateCopy(
+        osTmpFilename.c_str(), poSrcDS, bStrict, papszOptions,
+        GDALScaledProgress, pScaledProgress));
+    GDALDestroyScaledProgress(pScaledProgress);
+    if (!poMBTilesDS)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return nullptr;
+    }
+
+    bool bOK = true;
+    GDALRasterBand *poBand = poMBTilesDS->GetRasterBand(1);
+    const int nOvrCount = poBand->GetOverviewCount();
+    if (nOvrCount > 0)
+    {
+        std::vector<int> anOvrFactors;
+        for (int i = 0; i < nOvrCount; ++i)
+        {
+            GDALRasterBand *poOvrBand = poBand->GetOverview(i);
+            if (poOvrBand)
+            {
+                anOvrFactors.push_back(static_cast<int>(
+                    0.5 + static_cast<double>(poBand->GetXSize()) /
+                              poOvrBand->GetXSize()));
+            }
+        }
+        pScaledProgress =
+            GDALCreateScaledProgress(0.5, 0.75, pfnProgress, pProgressData);
+        bOK = poMBTilesDS->BuildOverviews(
+                  CSLFetchNameValueDef(papszOptions, "RESAMPLING", "BILINEAR"),
+                  static_cast<int>(anOvrFactors.size()), anOvrFactors.data(),
+                  0, nullptr, GDALScaledProgress, pScaledProgress,
+                  nullptr) == CE_None;
+        GDALDestroyScaledProgress(pScaledProgress);
+    }
+    if (poMBTilesDS->Close() != CE_None)
+        bOK = false;
+    poMBTilesDS.reset();
+
+    if (bOK)
+    {
+        pScaledProgress =
+            GDALCreateScaledProgress(0.75, 1.0, pfnProgress, pProgressData);
+        bOK = OGRPMTilesConvertFromMBTiles(pszFilename, osTmpFilename.c_str(),
+                                           GDALScaledProgress,
+                                           pScaledProgress);
+        GDALDestroyScaledProgress(pScaledProgress);
+    }
+    VSIUnlink(osTmpFilename.c_str());
+    if (!bOK)
+        return nullptr;
+
+    return GDALDataset::Open(pszFilename, GDAL_OF_RASTER);
+}
+
+/************************************************************************/
+/*                         RegisterOGRPMTiles()                         */
+/************************************************************************/
+
+void RegisterOGRPMTiles()
+
+{
+    if (GDALGetDriverByName("PMTiles") != nullptr)
+        return;
+
+    GDALDriver *poDriver = new GDALDriver();
+
+    poDriver->SetDescription("PMTiles");
+    poDriver->SetMetadataItem(GDAL_DCAP_RASTER, "YES");
+    poDriver->SetMetadataItem(GDAL_DCAP_VECTOR, "YES");
+    poDriver->SetMetadataItem(GDAL_DMD_LONGNAME, "ProtoMap Tiles");
+    poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC,
+                              "drivers/vector/pmtiles.html");
+    poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "pmtiles");
+    poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
+    poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES, "Byte");
+
+    poDriver->SetMetadataItem(
+        GDAL_DMD_OPENOPTIONLIST,
+        "<OpenOptionList>"
+        "  <Option name='ZOOM_LEVEL' scope='raster,vector' type='integer' "
+        "description='Zoom level of full resolution. If not specified, "
+        "maximum zoom level of the archive'/>"
+        "  <Option name='CLIP' scope='vector' type='boolean' "
+        "description='Whether to clip geometries to tile extent' "
+        "default='YES'/>"
+        "  <Option name='ZOOM_LEVEL_AUTO' scope='vector' type='boolean' "
+        "description='Whether to auto-select the zoom level for vector layers "
+        "according to spatial filter extent. Only for display purpose' "
+        "default='NO'/>"
+        "  <Option name='JSON_FIELD' scope='vector' type='boolean' "
+        "description='For vector layers, "
+        "whether to put all attributes as a serialized JSon dictionary'/>"
+        "</OpenOptionList>");
+
+    poDriver->SetMetadataItem(
+        GDAL_DMD_CREATIONOPTIONLIST,
+        "<CreationOptionList>"
+        "  <Option name='NAME' scope='raster,vector' type='string' "
+        "description='Tileset name'/>"
+        "  <Option name='DESCRIPTION' scope='raster,vector' type='string' "
+        "description='A description of the layer'/>"
+        "  <Option name='TYPE' scope='raster,vector' type='string-select' "
+        "description='Layer type' default='overlay'>"
+        "    <Value>overlay</Value>"
+        "    <Value>baselayer</Value>"
+        "  </Option>"
+        "  <Option name='BLOCKSIZE' scope='raster' type='int' "
+        "description='Block size in pixels' default='256' min='64' "
+        "max='8192'/>"
+        "  <Option name='TILE_FORMAT' scope='raster' type='string-select' "
+        "description='Format to use to create tiles' default='PNG'>"
+        "    <Value>PNG</Value>"
+        "    <Value>PNG8</Value>"
+        "    <Value>JPEG</Value>"
+        "  </Option>"
+        "  <Option name='QUALITY' scope='raster' type='int' min='1' max='100' "
+        "description='Quality for JPEG tiles' default='75'/>"
+        "  <Option name='ZLEVEL' scope='raster' type='int' min='1' max='9' "
+        "description='DEFLATE compression level for PNG tiles' default='6'/>"
+        "  <Option name='ZOOM_LEVEL_STRATEGY' scope='raster' "
+        "type='string-select' description='Strategy to determine zoom level.' "
+        "default='AUTO'>"
+        "    <Value>AUTO</Value>"
+        "    <Value>LOWER</Value>"
+        "    <Value>UPPER</Value>"
+        "  </Option>"
+        "  <Option name='RESAMPLING' scope='raster' type='string-select' "
+        "description='Resampling algorithm.' default='BILINEAR'>"
+        "    <Value>NEAREST</Value>"
+        "    <Value>BILINEAR</Value>"
+        "    <Value>CUBIC</Value>"
+        "    <Value>CUBICSPLINE</Value>"
+        "    <Value>LANCZOS</Value>"
+        "    <Value>MODE</Value>"
+        "    <Value>AVERAGE</Value>"
+        "  </Option>"
+        "  <Option name='BOUNDS' scope='raster,vector' type='string' "
+        "description='Override default value for bounds metadata item'/>"
+        "  <Option name='CENTER' scope='raster,vector' type='string' "
+        "description='Override default value for center metadata item'/>"
+#ifdef HAVE_MVT_WRITE_SUPPORT
+        MVT_MBTILES_COMMON_DSCO
+#endif
+        "</CreationOptionList>");
+
+#ifdef HAVE_MVT_WRITE_SUPPORT
+    poDriver->SetMetadataItem(GDAL_DCAP_CREATE_LAYER, "YES");
+    poDriver->SetMetadataItem(GDAL_DCAP_CREATE_FIELD, "YES");
+    poDriver->SetMetadataItem(GDAL_DMD_CREATIONFIELDDATATYPES,
+                              "Integer Integer64 Real String");
+    poDriver->SetMetadataItem(GDAL_DMD_CREATIONFIELDDATASUBTYPES,
+                              "Boolean Float32");
+
+    poDriver->SetMetadataItem(GDAL_DS_LAYER_CREATIONOPTIONLIST, MVT_LCO);
+
+    poDriver->pfnCreate = OGRPMTilesDriverCreate;
+#endif
+
+    poDriver->pfnIdentify = OGRPMTilesDataset::Identify;
+    poDriver->pfnOpen = OGRPMTilesDataset::Open;
+    poDriver->pfnCreateCopy = OGRPMTilesDriverCreateCopy;
+
+    GetGDALDriverManager()->RegisterDriver(poDriver);
+}
@@ -0,0 +1,519 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  PMTiles header, directory and tile id encoding and decoding
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ogr_pmtiles.h"
+
+#include "cpl_compressor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+/************************************************************************/
+/*                             HilbertRotate()                          */
+/************************************************************************/
+
+static void HilbertRotate(uint64_t n, uint64_t &x, uint64_t &y, uint64_t rx,
+                          uint64_t ry)
+{
+    if (ry == 0)
+    {
+        if (rx == 1)
+        {
+            x = n - 1 - x;
+            y = n - 1 - y;
+        }
+        std::swap(x, y);
+    }
+}
+
+/************************************************************************/
+/*                        OGRPMTilesZXYToTileId()                       */
+/************************************************************************/
+
+/** Returns the tile id of a tile: tiles of lower zoom levels come first, and
+ * tiles of a same zoom level are ordered along a Hilbert curve. */
+uint64_t OGRPMTilesZXYToTileId(int nZ, uint32_t nX, uint32_t nY)
+{
+    CPLAssert(nZ >= 0 && nZ <= PMTILES_MAX_ZOOM);
+    // Number of tiles of all zoom levels lower than nZ
+    const uint64_t nAcc = ((static_cast<uint64_t>(1) << (2 * nZ)) - 1) / 3;
+    const uint64_t n = static_cast<uint64_t>(1) << nZ;
+    uint64_t x = nX;
+    uint64_t y = nY;
+    uint64_t d = 0;
+    for (uint64_t s = n / 2; s > 0; s /= 2)
+    {
+        const uint64_t rx = (x & s) > 0 ? 1 : 0;
+        const uint64_t ry = (y & s) > 0 ? 1 : 0;
+        d += s * s * ((3 * rx) ^ ry);
+        HilbertRotate(n, x, y, rx, ry);
+    }
+    return nAcc + d;
+}
+
+/************************************************************************/
+/*                        OGRPMTilesTileIdToZXY()                       */
+/************************************************************************/
+
+bool OGRPMTilesTileIdToZXY(uint64_t nTileId, int &nZ, uint32_t &nX,
+                           uint32_t &nY)
+{
+    uint64_t nAcc = 0;
+    for (int z = 0; z <= PMTILES_MAX_ZOOM; ++z)
+    {
+        const uint64_t nTilesAtZ = static_cast<uint64_t>(1) << (2 * z);
+        if (nTileId - nAcc < nTilesAtZ)
+        {
+            uint64_t t = nTileId - nAcc;
+            uint64_t x = 0;
+            uint64_t y = 0;
+            const uint64_t n = static_cast<uint64_t>(1) << z;
+            for (uint64_t s = 1; s < n; s *= 2)
+            {
+                const uint64_t rx = 1 & (t / 2);
+                const uint64_t ry = 1 & (t ^ rx);
+                HilbertRotate(s, x, y, rx, ry);
+                x += s * rx;
+                y += s * ry;
+                t /= 4;
+            }
+            nZ = z;
+            nX = static_cast<uint32_t>(x);
+            nY = static_cast<uint32_t>(y);
+            return true;
+        }
+        nAcc += nTilesAtZ;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                       Little-endian helpers                          */
+/************************************************************************/
+
+static uint64_t ReadUInt64LE(const GByte *pabyData)
+{
+    uint64_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_LSBPTR64(&nVal);
+    return nVal;
+}
+
+static double ReadE7LE(const GByte *pabyData)
+{
+    int32_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_LSBPTR32(&nVal);
+    return nVal / 1e7;
+}
+
+static void WriteUInt64LE(GByte *pabyData, uint64_t nVal)
+{
+    CPL_LSBPTR64(&nVal);
+    memcpy(pabyData, &nVal, sizeof(nVal));
+}
+
+static void WriteE7LE(GByte *pabyData, double dfVal)
+{
+    int32_t nVal = static_cast<int32_t>(std::round(dfVal * 1e7));
+    CPL_LSBPTR32(&nVal);
+    memcpy(pabyData, &nVal, sizeof(nVal));
+}
+
+/************************************************************************/
+/*                     OGRPMTilesDeserializeHeader()                    */
+/************************************************************************/
+
+bool OGRPMTilesDeserializeHeader(const GByte *pabyData, size_t nSize,
+                                 OGRPMTilesHeader &sHeader)
+{
+    if (nSize < static_cast<size_t>(PMTILES_HEADER_LENGTH) ||
+        memcmp(pabyData, "PMTiles", 7) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Not a PMTiles file");
+        return false;
+    }
+    if (pabyData[7] != 3)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "PMTiles version %d not supported. Only version 3 is",
+                 pabyData[7]);
+        return false;
+    }
+
+    sHeader.nRootDirOffset = ReadUInt64LE(pabyData + 8);
+    sHeader.nRootDirLength = ReadUInt64LE(pabyData + 16);
+    sHeader.nMetadataOffset = ReadUInt64LE(pabyData + 24);
+    sHeader.nMetadataLength = ReadUInt64LE(pabyData + 32);
+    sHeader.nLeafDirsOffset = ReadUInt64LE(pabyData + 40);
+    sHeader.nLeafDirsLength = ReadUInt64LE(pabyData + 48);
+    sHeader.nTileDataOffset = ReadUInt64LE(pabyData + 56);
+    sHeader.nTileDataLength = ReadUInt64LE(pabyData + 64);
+    sHeader.nAddressedTilesCount = ReadUInt64LE(pabyData + 72);
+    sHeader.nTileEntriesCount = ReadUInt64LE(pabyData + 80);
+    sHeader.nTileContentsCount = ReadUInt64LE(pabyData + 88);
+    sHeader.bClustered = pabyData[96] == 1;
+    sHeader.eInternalCompression =
+        static_cast<PMTilesCompression>(pabyData[97]);
+    sHeader.eTileCompression = static_cast<PMTilesCompression>(pabyData[98]);
+    sHeader.eTileType = static_cast<PMTilesTileType>(pabyData[99]);
+    sHeader.nMinZoom = pabyData[100];
+    sHeader.nMaxZoom = pabyData[101];
+    sHeader.dfMinLon = ReadE7LE(pabyData + 102);
+    sHeader.dfMinLat = ReadE7LE(pabyData + 106);
+    sHeader.dfMaxLon = ReadE7LE(pabyData + 110);
+    sHeader.dfMaxLat = ReadE7LE(pabyData + 114);
+    sHeader.nCenterZoom = pabyData[118];
+    sHeader.dfCenterLon = ReadE7LE(pabyData + 119);
+    sHeader.dfCenterLat = ReadE7LE(pabyData + 123);
+
+    if (sHeader.nMinZoom > sHeader.nMaxZoom ||
+        sHeader.nMaxZoom > PMTILES_MAX_ZOOM)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid minimum/maximum zoom levels: %d, %d",
+                 sHeader.nMinZoom, sHeader.nMaxZoom);
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      OGRPMTilesSerializeHeader()                     */
+/************************************************************************/
+
+void OGRPMTilesSerializeHeader(const OGRPMTilesHeader &sHeader,
+                               GByte *pabyData)
+{
+    memcpy(pabyData, "PMTiles", 7);
+    pabyData[7] = 3;
+    WriteUInt64LE(pabyData + 8, sHeader.nRootDirOffset);
+    WriteUInt64LE(pabyData + 16, sHeader.nRootDirLength);
+    WriteUInt64LE(pabyData + 24, sHeader.nMetadataOffset);
+    WriteUInt64LE(pabyData + 32, sHeader.nMetadataLength);
+    WriteUInt64LE(pabyData + 40, sHeader.nLeafDirsOffset);
+    WriteUInt64LE(pabyData + 48, sHeader.nLeafDirsLength);
+    WriteUInt64LE(pabyData + 56, sHeader.nTileDataOffset);
+    WriteUInt64LE(pabyData + 64, sHeader.nTileDataLength);
+    WriteUInt64LE(pabyData + 72, sHeader.nAddressedTilesCount);
+    WriteUInt64LE(pabyData + 80, sHeader.nTileEntriesCount);
+    WriteUInt64LE(pabyData + 88, sHeader.nTileContentsCount);
+    pabyData[96] = sHeader.bClustered ? 1 : 0;
+    pabyData[97] = static_cast<GByte>(sHeader.eInternalCompression);
+    pabyData[98] = static_cast<GByte>(sHeader.eTileCompression);
+    pabyData[99] = static_cast<GByte>(sHeader.eTileType);
+    pabyData[100] = static_cast<GByte>(sHeader.nMinZoom);
+    pabyData[101] = static_cast<GByte>(sHeader.nMaxZoom);
+    WriteE7LE(pabyData + 102, sHeader.dfMinLon);
+    WriteE7LE(pabyData + 106, sHeader.dfMinLat);
+    WriteE7LE(pabyData + 110, sHeader.dfMaxLon);
+    WriteE7LE(pabyData + 114, sHeader.dfMaxLat);
+    pabyData[118] = static_cast<GByte>(sHeader.nCenterZoom);
+    WriteE7LE(pabyData + 119, sHeader.dfCenterLon);
+    WriteE7LE(pabyData + 123, sHeader.dfCenterLat);
+}
+
+/************************************************************************/
+/*                              ReadVarInt()                            */
+/************************************************************************/
+
+static bool ReadVarInt(const GByte *&pabyData, const GByte *pabyEnd,
+                       uint64_t &nVal)
+{
+    nVal = 0;
+    for (int nShift = 0; nShift < 64; nShift += 7)
+    {
+        if (pabyData >= pabyEnd)
+            return false;
+        const GByte byVal = *pabyData;
+        ++pabyData;
+        nVal |= static_cast<uint64_t>(byVal & 0x7F) << nShift;
+        if ((byVal & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                              WriteVarInt()                           */
+/************************************************************************/
+
+static void WriteVarInt(std::string &osData, uint64_t nVal)
+{
+    while (nVal >= 0x80)
+    {
+        osData += static_cast<char>(static_cast<GByte>(nVal & 0x7F) | 0x80);
+        nVal >>= 7;
+    }
+    osData += static_cast<char>(static_cast<GByte>(nVal));
+}
+
+/************************************************************************/
+/*                   OGRPMTilesDeserializeDirectory()                   */
+/************************************************************************/
+
+/** Decodes an uncompressed directory: number of entries, followed by the
+ * delta-encoded tile ids, the run lengths, the lengths and the offsets of
+ * all entries. An offset of 0 means that the tile data immediately follows
+ * the one of the previous entry, otherwise it is the offset plus one. */
+bool OGRPMTilesDeserializeDirectory(const std::string &osData,
+                                    std::vector<OGRPMTilesEntry> &aoEntries)
+{
+    const GByte *pabyData = reinterpret_cast<const GByte *>(osData.data());
+    const GByte *const pabyEnd = pabyData + osData.size();
+
+    uint64_t nEntries = 0;
+    // Each entry takes at least 4 bytes
+    if (!ReadVarInt(pabyData, pabyEnd, nEntries) ||
+        nEntries > osData.size() / 4)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "PMTiles: invalid number of directory entries");
+        return false;
+    }
+    aoEntries.clear();
+    aoEntries.resize(static_cast<size_t>(nEntries));
+
+    const auto Error = []()
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "PMTiles: corrupted directory");
+        return false;
+    };
+
+    uint64_t nLastTileId = 0;
+    for (auto &sEntry : aoEntries)
+    {
+        uint64_t nDelta = 0;
+        if (!ReadVarInt(pabyData, pabyEnd, nDelta) ||
+            nDelta > std::numeric_limits<uint64_t>::max() - nLastTileId)
+            return Error();
+        nLastTileId += nDelta;
+        sEntry.nTileId = nLastTileId;
+    }
+    for (auto &sEntry : aoEntries)
+    {
+        uint64_t nVal = 0;
+        if (!ReadVarInt(pabyData, pabyEnd, nVal) ||
+            nVal > std::numeric_limits<uint32_t>::max())
+            return Error();
+        sEntry.nRunLength = static_cast<uint32_t>(nVal);
+    }
+    for (auto &sEntry : aoEntries)
+    {
+        uint64_t nVal = 0;
+        if (!ReadVarInt(pabyData, pabyEnd, nVal) ||
+            nVal > std::numeric_limits<uint32_t>::max())
+            return Error();
+        sEntry.nLength = static_cast<uint32_t>(nVal);
+    }
+    for (size_t i = 0; i < aoEntries.size(); ++i)
+    {
+        uint64_t nVal = 0;
+        if (!ReadVarInt(pabyData, pabyEnd, nVal))
+            return Error();
+        if (nVal == 0)
+        {
+            if (i == 0)
+                return Error();
+            aoEntries[i].nOffset =
+                aoEntries[i - 1].nOffset + aoEntries[i - 1].nLength;
+        }
+        else
+        {
+            aoEntries[i].nOffset = nVal - 1;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    OGRPMTilesSerializeDirectory()                    */
+/************************************************************************/
+
+std::string
+OGRPMTilesSerializeDirectory(const std::vector<OGRPMTilesEntry> &aoEntries)
+{
+    std::string osData;
+    WriteVarInt(osData, aoEntries.size());
+    uint64_t nLastTileId = 0;
+    for (const auto &sEntry : aoEntries)
+    {
+        WriteVarInt(osData, sEntry.nTileId - nLastTileId);
+        nLastTileId = sEntry.nTileId;
+    }
+    for (const auto &sEntry : aoEntries)
+        WriteVarInt(osData, sEntry.nRunLength);
+    for (const auto &sEntry : aoEntries)
+        WriteVarInt(osData, sEntry.nLength);
+    for (size_t i = 0; i < aoEntries.size(); ++i)
+    {
+        if (i > 0 && aoEntries[i].nOffset ==
+                         aoEntries[i - 1].nOffset + aoEntries[i - 1].nLength)
+        {
+            WriteVarInt(osData, 0);
+        }
+        else
+        {
+            WriteVarInt(osData, aoEntries[i].nOffset + 1);
+        }
+    }
+    return osData;
+}
+
+/************************************************************************/
+/*                         OGRPMTilesFindEntry()                        */
+/************************************************************************/
+
+/** Returns the entry of a directory holding a tile id: either a tile entry
+ * whose run covers it, or the leaf directory entry where to look for it. */
+const OGRPMTilesEntry *
+OGRPMTilesFindEntry(const std::vector<OGRPMTilesEntry> &aoEntries,
+                    uint64_t nTileId)
+{
+    // Last entry whose tile id is <= nTileId
+    auto oIter = std::upper_bound(aoEntries.begin(), aoEntries.end(), nTileId,
+                                  [](uint64_t nVal, const OGRPMTilesEntry &e)
+                                  { return nVal < e.nTileId; });
+    if (oIter == aoEntries.begin())
+        return nullptr;
+    --oIter;
+    if (oIter->nRunLength == 0 ||
+        nTileId - oIter->nTileId < oIter->nRunLength)
+    {
+        return &(*oIter);
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                         GetCompressorName()                          */
+/************************************************************************/
+
+static const char *GetCompressorName(PMTilesCompression eCompression)
+{
+    switch (eCompression)
+    {
+        case PMTilesCompression::GZIP:
+            return "gzip";
+        case PMTilesCompression::ZSTD:
+            return "zstd";
+        case PMTilesCompression::BROTLI:
+            return "brotli";
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                         OGRPMTilesDecompress()                       */
+/************************************************************************/
+
+bool OGRPMTilesDecompress(PMTilesCompression eCompression,
+                          const std::string &osIn, std::string &osOut)
+{
+    const char *pszName = GetCompressorName(eCompression);
+    if (pszName == nullptr)
+    {
+        osOut = osIn;
+        return true;
+    }
+    if (eCompression == PMTilesCompression::GZIP)
+    {
+        // Unlike the gzip decompressor, CPLZLibInflate() grows its output
+        // buffer as needed, whatever the compression ratio.
+        size_t nOutSize = 0;
+        void *pOut =
+            CPLZLibInflate(osIn.data(), osIn.size(), nullptr, 0, &nOutSize);
+        if (pOut == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "PMTiles: %s decompression failed", pszName);
+            return false;
+        }
+        osOut.assign(static_cast<const char *>(pOut), nOutSize);
+        VSIFree(pOut);
+        return true;
+    }
+    const CPLCompressor *psDecompressor = CPLGetDecompressor(pszName);
+    if (psDecompressor == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "PMTiles: %s decompression not available", pszName);
+        return false;
+    }
+    void *pOut = nullptr;
+    size_t nOutSize = 0;
+    if (!psDecompressor->pfnFunc(osIn.data(), osIn.size(), &pOut, &nOutSize,
+                                 nullptr, psDecompressor->user_data))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "PMTiles: %s decompression failed", pszName);
+        return false;
+    }
+    osOut.assign(static_cast<const char *>(pOut), nOutSize);
+    VSIFree(pOut);
+    return true;
+}
+
+/************************************************************************/
+/*                          OGRPMTilesCompress()                        */
+/************************************************************************/
+
+bool OGRPMTilesCompress(PMTilesCompression eCompression,
+                        const std::string &osIn, std::string &osOut)
+{
+    const char *pszName = GetCompressorName(eCompression);
+    if (pszName == nullptr)
+    {
+        osOut = osIn;
+        return true;
+    }
+    const CPLCompressor *psCompressor = CPLGetCompressor(pszName);
+    if (psCompressor == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "PMTiles: %s compression not available", pszName);
+        return false;
+    }
+    void *pOut = nullptr;
+    size_t nOutSize = 0;
+    if (!psCompressor->pfnFunc(osIn.data(), osIn.size(), &pOut, &nOutSize,
+                               nullptr, psCompressor->user_data))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "PMTiles: %s compression failed", pszName);
+        return false;
+    }
+    osOut.assign(static_cast<const char *>(pOut), nOutSize);
+    VSIFree(pOut);
+    return true;
+}
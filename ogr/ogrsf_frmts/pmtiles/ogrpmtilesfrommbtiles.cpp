@@ -0,0 +1,515 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Conversion of a MBTiles file into a PMTiles archive
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ogr_pmtiles.h"
+
+#include "cpl_sha256.h"
+
+#include <sqlite3.h>
+#include "../sqlite/ogrsqlitevfs.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+namespace
+{
+
+/************************************************************************/
+/*                            MBTilesReader                             */
+/************************************************************************/
+
+/** Minimal read access to the metadata and tiles tables of a MBTiles file */
+class MBTilesReader
+{
+    sqlite3_vfs *m_pMyVFS = nullptr;
+    sqlite3 *m_hDB = nullptr;
+    sqlite3_stmt *m_hTileStmt = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(MBTilesReader)
+
+  public:
+    MBTilesReader() = default;
+
+    ~MBTilesReader()
+    {
+        if (m_hTileStmt)
+            sqlite3_finalize(m_hTileStmt);
+        if (m_hDB)
+            sqlite3_close(m_hDB);
+        if (m_pMyVFS)
+        {
+            sqlite3_vfs_unregister(m_pMyVFS);
+            CPLFree(m_pMyVFS->pAppData);
+            CPLFree(m_pMyVFS);
+        }
+    }
+
+    bool Open(const char *pszFilename)
+    {
+        m_pMyVFS = OGRSQLiteCreateVFS(nullptr, nullptr);
+        sqlite3_vfs_register(m_pMyVFS, 0);
+        if (sqlite3_open_v2(pszFilename, &m_hDB, SQLITE_OPEN_READONLY,
+                            m_pMyVFS->zName) != SQLITE_OK ||
+            sqlite3_prepare_v2(m_hDB,
+                               "SELECT tile_data FROM tiles WHERE "
+                               "zoom_level = ? AND tile_column = ? AND "
+                               "tile_row = ?",
+                               -1, &m_hTileStmt, nullptr) != SQLITE_OK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot open %s: %s",
+                     pszFilename, m_hDB ? sqlite3_errmsg(m_hDB) : "");
+            return false;
+        }
+        return true;
+    }
+
+    std::vector<std::pair<std::string, std::string>> GetMetadata()
+    {
+        std::vector<std::pair<std::string, std::string>> aoItems;
+        sqlite3_stmt *hStmt = nullptr;
+        if (sqlite3_prepare_v2(m_hDB, "SELECT name, value FROM metadata", -1,
+                               &hStmt, nullptr) == SQLITE_OK)
+        {
+            while (sqlite3_step(hStmt) == SQLITE_ROW)
+            {
+                const char *pszName = reinterpret_cast<const char *>(
+                    sqlite3_column_text(hStmt, 0));
+                const char *pszValue = reinterpret_cast<const char *>(
+                    sqlite3_column_text(hStmt, 1));
+                if (pszName && pszValue)
+                    aoItems.emplace_back(pszName, pszValue);
+            }
+            sqlite3_finalize(hStmt);
+        }
+        return aoItems;
+    }
+
+    /** Calls pfnFunc(z, x, tile_row) for each tile */
+    template <class F> bool ForEachTileCoordinate(F pfnFunc)
+    {
+        sqlite3_stmt *hStmt = nullptr;
+        if (sqlite3_prepare_v2(
+                m_hDB,
+                "SELECT zoom_level, tile_column, tile_row FROM tiles", -1,
+                &hStmt, nullptr) != SQLITE_OK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     sqlite3_errmsg(m_hDB));
+            return false;
+        }
+        bool bRet = true;
+        while (bRet && sqlite3_step(hStmt) == SQLITE_ROW)
+        {
+            bRet = pfnFunc(sqlite3_column_int(hStmt, 0),
+                           sqlite3_column_int(hStmt, 1),
+                           sqlite3_column_int(hStmt, 2));
+        }
+        sqlite3_finalize(hStmt);
+        return bRet;
+    }
+
+    bool ReadTile(int nZ, int nX, int nRow, std::string &osData)
+    {
+        sqlite3_reset(m_hTileStmt);
+        sqlite3_bind_int(m_hTileStmt, 1, nZ);
+        sqlite3_bind_int(m_hTileStmt, 2, nX);
+        sqlite3_bind_int(m_hTileStmt, 3, nRow);
+        if (sqlite3_step(m_hTileStmt) != SQLITE_ROW)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot read tile %d/%d/%d", nZ, nX, nRow);
+            return false;
+        }
+        const int nBytes = sqlite3_column_bytes(m_hTileStmt, 0);
+        const void *pData = sqlite3_column_blob(m_hTileStmt, 0);
+        osData.assign(static_cast<const char *>(pData),
+                      pData ? static_cast<size_t>(nBytes) : 0);
+        return true;
+    }
+};
+
+/************************************************************************/
+/*                              TileRecord                              */
+/************************************************************************/
+
+struct TileRecord
+{
+    uint64_t nTileId;
+    int nZ;
+    int nX;
+    int nRow;  // TMS convention, as in MBTiles
+    // Whether the content of the tile is not a duplicate of an earlier one
+    bool bNewContent;
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                          BuildDirectories()                          */
+/************************************************************************/
+
+/** Builds the root directory, and if it does not fit in the first 16 KB of
+ * the file, leaf directories of increasing size. */
+static bool BuildDirectories(const std::vector<OGRPMTilesEntry> &aoEntries,
+                             std::string &osRootDir, std::string &osLeafDirs)
+{
+    constexpr PMTilesCompression eCompression = PMTilesCompression::GZIP;
+    constexpr size_t ROOT_MAX_LENGTH =
+        PMTILES_HEADER_AND_ROOT_MAX_LENGTH - PMTILES_HEADER_LENGTH;
+
+    osLeafDirs.clear();
+    if (!OGRPMTilesCompress(eCompression,
+                            OGRPMTilesSerializeDirectory(aoEntries),
+                            osRootDir))
+    {
+        return false;
+    }
+    if (osRootDir.size() <= ROOT_MAX_LENGTH)
+        return true;
+
+    for (size_t nLeafSize = 4096;; nLeafSize *= 2)
+    {
+        osLeafDirs.clear();
+        std::vector<OGRPMTilesEntry> aoRootEntries;
+        for (size_t i = 0; i < aoEntries.size(); i += nLeafSize)
+        {
+            const size_t nEnd = std::min(aoEntries.size(), i + nLeafSize);
+            const std::vector<OGRPMTilesEntry> aoLeafEntries(
+                aoEntries.begin() + i, aoEntries.begin() + nEnd);
+            std::string osLeaf;
+            if (!OGRPMTilesCompress(eCompression,
+                                    OGRPMTilesSerializeDirectory(aoLeafEntries),
+                                    osLeaf))
+            {
+                return false;
+            }
+            OGRPMTilesEntry sRootEntry;
+            sRootEntry.nTileId = aoLeafEntries[0].nTileId;
+            sRootEntry.nOffset = osLeafDirs.size();
+            sRootEntry.nLength = static_cast<uint32_t>(osLeaf.size());
+            sRootEntry.nRunLength = 0;
+            aoRootEntries.push_back(sRootEntry);
+            osLeafDirs += osLeaf;
+        }
+        if (!OGRPMTilesCompress(eCompression,
+                                OGRPMTilesSerializeDirectory(aoRootEntries),
+                                osRootDir))
+        {
+            return false;
+        }
+        if (osRootDir.size() <= ROOT_MAX_LENGTH)
+            return true;
+    }
+}
+
+/************************************************************************/
+/*                    OGRPMTilesConvertFromMBTiles()                    */
+/************************************************************************/
+
+/** Writes the content of a MBTiles file as a PMTiles archive.
+ *
+ * The archive is written sequentially, in the order recommended by the
+ * specification: header, root directory, metadata, leaf directories and
+ * tile data sorted by tile id, so that it can be directly streamed to an
+ * object storage. Tiles with identical content are stored only once, and
+ * consecutive tile ids sharing the same content are run-length encoded.
+ * Tiles are read twice from the source: a first pass computes the layout
+ * of the tile data and the directories, a second pass writes the tile data.
+ */
+bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
+                                  const char *pszSrcName,
+                                  GDALProgressFunc pfnProgress,
+                                  void *pProgressData)
+{
+    MBTilesReader oReader;
+    if (!oReader.Open(pszSrcName))
+        return false;
+
+    OGRPMTilesHeader sHeader;
+    sHeader.bClustered = true;
+    sHeader.eInternalCompression = PMTilesCompression::GZIP;
+    sHeader.eTileCompression = PMTilesCompression::NONE;
+
+    // Translate MBTiles metadata
+    CPLJSONDocument oMetadataDoc;
+    CPLJSONObject oMetadata = oMetadataDoc.GetRoot();
+    bool bCenterSet = false;
+    for (const auto &oItem : oReader.GetMetadata())
+    {
+        const std::string &osName = oItem.first;
+        const std::string &osValue = oItem.second;
+        if (osName == "format")
+        {
+            if (osValue == "pbf")
+                sHeader.eTileType = PMTilesTileType::MVT;
+            else if (osValue == "png")
+                sHeader.eTileType = PMTilesTileType::PNG;
+            else if (osValue == "jpg" || osValue == "jpeg")
+                sHeader.eTileType = PMTilesTileType::JPEG;
+            else if (osValue == "webp")
+                sHeader.eTileType = PMTilesTileType::WEBP;
+        }
+        else if (osName == "minzoom" || osName == "maxzoom")
+        {
+            // Established from the tiles actually present
+        }
+        else if (osName == "bounds")
+        {
+            const CPLStringList aosTokens(
+                CSLTokenizeString2(osValue.c_str(), ",", 0));
+            if (aosTokens.size() == 4)
+            {
+                sHeader.dfMinLon = CPLAtof(aosTokens[0]);
+                sHeader.dfMinLat = CPLAtof(aosTokens[1]);
+                sHeader.dfMaxLon = CPLAtof(aosTokens[2]);
+                sHeader.dfMaxLat = CPLAtof(aosTokens[3]);
+            }
+        }
+        else if (osName == "center")
+        {
+            const CPLStringList aosTokens(
+                CSLTokenizeString2(osValue.c_str(), ",", 0));
+            if (aosTokens.size() >= 2)
+            {
+                sHeader.dfCenterLon = CPLAtof(aosTokens[0]);
+                sHeader.dfCenterLat = CPLAtof(aosTokens[1]);
+                if (aosTokens.size() >= 3)
+                    sHeader.nCenterZoom = atoi(aosTokens[2]);
+                bCenterSet = true;
+            }
+        }
+        else if (osName == "json")
+        {
+            // vector_layers and tilestats are stored at the root of the
+            // PMTiles metadata
+            CPLJSONDocument oJsonDoc;
+            if (oJsonDoc.LoadMemory(osValue))
+            {
+                for (const auto &oChild : oJsonDoc.GetRoot().GetChildren())
+                    oMetadata.Add(oChild.GetName(), oChild);
+            }
+        }
+        else if (osName != "scheme")
+        {
+            oMetadata.Add(osName, osValue);
+        }
+    }
+    if (sHeader.eTileType == PMTilesTileType::UNKNOWN)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Missing or unsupported 'format' metadata item in %s",
+                 pszSrcName);
+        return false;
+    }
+
+    // Collect the tile coordinates, and sort them along the tile id order
+    std::vector<TileRecord> asTiles;
+    if (!oReader.ForEachTileCoordinate(
+            [&asTiles](int nZ, int nX, int nRow)
+            {
+                if (nZ < 0 || nZ > PMTILES_MAX_ZOOM || nX < 0 || nRow < 0 ||
+                    nX >= (1 << nZ) || nRow >= (1 << nZ))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Invalid tile coordinates: %d/%d/%d", nZ, nX,
+                             nRow);
+                    return false;
+                }
+                TileRecord sRecord;
+                sRecord.nZ = nZ;
+                sRecord.nX = nX;
+                sRecord.nRow = nRow;
+                sRecord.nTileId =
+                    OGRPMTilesZXYToTileId(nZ, nX, (1 << nZ) - 1 - nRow);
+                sRecord.bNewContent = false;
+                asTiles.push_back(sRecord);
+                return true;
+            }))
+    {
+        return false;
+    }
+    std::sort(asTiles.begin(), asTiles.end(),
+              [](const TileRecord &a, const TileRecord &b)
+              { return a.nTileId < b.nTileId; });
+
+    // Tile ids are increasing with the zoom level
+    if (!asTiles.empty())
+    {
+        sHeader.nMinZoom = asTiles.front().nZ;
+        sHeader.nMaxZoom = asTiles.back().nZ;
+    }
+    if (!bCenterSet)
+    {
+        sHeader.dfCenterLon = (sHeader.dfMinLon + sHeader.dfMaxLon) / 2;
+        sHeader.dfCenterLat = (sHeader.dfMinLat + sHeader.dfMaxLat) / 2;
+        sHeader.nCenterZoom = sHeader.nMinZoom;
+    }
+
+    // First pass: compute the layout of the tile data, with deduplication
+    // of identical tiles and run-length encoding of directory entries.
+    std::vector<OGRPMTilesEntry> aoEntries;
+    std::unordered_map<std::string, std::pair<uint64_t, uint32_t>>
+        oMapHashToContent;
+    uint64_t nTileDataLength = 0;
+    std::string osData;
+    const double dfTileCount = std::max<double>(1, asTiles.size());
+    for (size_t i = 0; i < asTiles.size(); ++i)
+    {
+        auto &sRecord = asTiles[i];
+        if (!oReader.ReadTile(sRecord.nZ, sRecord.nX, sRecord.nRow, osData))
+            return false;
+        if (i == 0 && sHeader.eTileType == PMTilesTileType::MVT &&
+            osData.size() >= 2 && static_cast<GByte>(osData[0]) == 0x1F &&
+            static_cast<GByte>(osData[1]) == 0x8B)
+        {
+            sHeader.eTileCompression = PMTilesCompression::GZIP;
+        }
+        if (osData.size() > std::numeric_limits<uint32_t>::max())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Too large tile");
+            return false;
+        }
+
+        GByte abyHash[CPL_SHA256_HASH_SIZE];
+        CPL_SHA256(osData.data(), osData.size(), abyHash);
+        const std::string osHash(reinterpret_cast<const char *>(abyHash),
+                                 sizeof(abyHash));
+        uint64_t nOffset;
+        const uint32_t nLength = static_cast<uint32_t>(osData.size());
+        auto oIter = oMapHashToContent.find(osHash);
+        if (oIter != oMapHashToContent.end())
+        {
+            nOffset = oIter->second.first;
+        }
+        else
+        {
+            nOffset = nTileDataLength;
+            nTileDataLength += nLength;
+            oMapHashToContent[osHash] = std::make_pair(nOffset, nLength);
+            sRecord.bNewContent = true;
+        }
+
+        ++sHeader.nAddressedTilesCount;
+        if (!aoEntries.empty() &&
+            aoEntries.back().nTileId + aoEntries.back().nRunLength ==
+                sRecord.nTileId &&
+            aoEntries.back().nOffset == nOffset &&
+            aoEntries.back().nLength == nLength &&
+            aoEntries.back().nRunLength < std::numeric_limits<uint32_t>::max())
+        {
+            aoEntries.back().nRunLength++;
+        }
+        else
+        {
+            OGRPMTilesEntry sEntry;
+            sEntry.nTileId = sRecord.nTileId;
+            sEntry.nOffset = nOffset;
+            sEntry.nLength = nLength;
+            sEntry.nRunLength = 1;
+            aoEntries.push_back(sEntry);
+        }
+
+        if (pfnProgress &&
+            !pfnProgress(0.5 * (i + 1) / dfTileCount, "", pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "Interrupted by user");
+            return false;
+        }
+    }
+    sHeader.nTileEntriesCount = aoEntries.size();
+    sHeader.nTileContentsCount = oMapHashToContent.size();
+    oMapHashToContent.clear();
+
+    std::string osRootDir;
+    std::string osLeafDirs;
+    std::string osMetadata;
+    if (!BuildDirectories(aoEntries, osRootDir, osLeafDirs) ||
+        !OGRPMTilesCompress(sHeader.eInternalCompression,
+                            oMetadata.Format(CPLJSONObject::PrettyFormat::Plain),
+                            osMetadata))
+    {
+        return false;
+    }
+    aoEntries.clear();
+
+    sHeader.nRootDirOffset = PMTILES_HEADER_LENGTH;
+    sHeader.nRootDirLength = osRootDir.size();
+    sHeader.nMetadataOffset = sHeader.nRootDirOffset + sHeader.nRootDirLength;
+    sHeader.nMetadataLength = osMetadata.size();
+    sHeader.nLeafDirsOffset = sHeader.nMetadataOffset + sHeader.nMetadataLength;
+    sHeader.nLeafDirsLength = osLeafDirs.size();
+    sHeader.nTileDataOffset = sHeader.nLeafDirsOffset + sHeader.nLeafDirsLength;
+    sHeader.nTileDataLength = nTileDataLength;
+
+    VSILFILE *fp = VSIFOpenL(pszDestName, "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s", pszDestName);
+        return false;
+    }
+
+    GByte abyHeader[PMTILES_HEADER_LENGTH];
+    OGRPMTilesSerializeHeader(sHeader, abyHeader);
+    bool bRet = VSIFWriteL(abyHeader, sizeof(abyHeader), 1, fp) == 1 &&
+                VSIFWriteL(osRootDir.data(), 1, osRootDir.size(), fp) ==
+                    osRootDir.size() &&
+                VSIFWriteL(osMetadata.data(), 1, osMetadata.size(), fp) ==
+                    osMetadata.size() &&
+                VSIFWriteL(osLeafDirs.data(), 1, osLeafDirs.size(), fp) ==
+                    osLeafDirs.size();
+
+    // Second pass: write the tile data
+    for (size_t i = 0; bRet && i < asTiles.size(); ++i)
+    {
+        const auto &sRecord = asTiles[i];
+        if (sRecord.bNewContent)
+        {
+            bRet = oReader.ReadTile(sRecord.nZ, sRecord.nX, sRecord.nRow,
+                                    osData) &&
+                   VSIFWriteL(osData.data(), 1, osData.size(), fp) ==
+                       osData.size();
+        }
+        if (bRet && pfnProgress &&
+            !pfnProgress(0.5 + 0.5 * (i + 1) / dfTileCount, "",
+                         pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "Interrupted by user");
+            bRet = false;
+        }
+    }
+
+    if (VSIFCloseL(fp) != 0)
+        bRet = false;
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Error while writing %s",
+                 pszDestName);
+    }
+    return bRet;
+}
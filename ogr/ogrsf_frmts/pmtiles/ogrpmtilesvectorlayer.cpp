@@ -0,0 +1,426 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Implementation of PMTiles vector layers
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ogr_pmtiles.h"
+
+#include "mvtutils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+/************************************************************************/
+/*                       OGRPMTilesVectorLayer()                        */
+/************************************************************************/
+
+OGRPMTilesVectorLayer::OGRPMTilesVectorLayer(
+    OGRPMTilesDataset *poDS, const char *pszLayerName,
+    const CPLJSONObject &oFields, bool bJsonField, const OGREnvelope &sExtent,
+    OGRwkbGeometryType eGeomType, bool bZoomLevelFromSpatialFilter)
+    : m_poDS(poDS), m_poFeatureDefn(new OGRFeatureDefn(pszLayerName)),
+      m_sExtent(sExtent), m_bJsonField(bJsonField)
+{
+    SetDescription(pszLayerName);
+    m_poFeatureDefn->SetGeomType(eGeomType);
+    OGRSpatialReference *poSRS = m_poDS->m_oSRS.Clone();
+    m_poFeatureDefn->GetGeomFieldDefn(0)->SetSpatialRef(poSRS);
+    poSRS->Release();
+    m_poFeatureDefn->Reference();
+
+    if (m_bJsonField)
+    {
+        OGRFieldDefn oFieldDefnId("mvt_id", OFTInteger64);
+        m_poFeatureDefn->AddFieldDefn(&oFieldDefnId);
+    }
+    else
+    {
+        OGRMVTInitFields(m_poFeatureDefn, oFields);
+    }
+
+    m_nZoomLevel = m_poDS->m_nZoomLevel;
+    m_bZoomLevelAuto = bZoomLevelFromSpatialFilter;
+    OGRPMTilesVectorLayer::SetSpatialFilter(nullptr);
+
+    // If the metadata contains an empty fields object, this may be a sign
+    // that it doesn't know the schema. In that case check if a tile has
+    // attributes, and in that case create a json field.
+    if (!m_bJsonField && oFields.IsValid() && oFields.GetChildren().empty())
+    {
+        m_bJsonField = true;
+        OGRFeature *poSrcFeature = GetNextSrcFeature();
+        m_bJsonField = false;
+
+        if (poSrcFeature)
+        {
+            // There is at least the mvt_id field
+            if (poSrcFeature->GetFieldCount() > 1)
+            {
+                m_bJsonField = true;
+            }
+            delete poSrcFeature;
+        }
+        OGRPMTilesVectorLayer::ResetReading();
+    }
+
+    if (m_bJsonField)
+    {
+        OGRFieldDefn oFieldDefn("json", OFTString);
+        m_poFeatureDefn->AddFieldDefn(&oFieldDefn);
+    }
+}
+
+/************************************************************************/
+/*                       ~OGRPMTilesVectorLayer()                       */
+/************************************************************************/
+
+OGRPMTilesVectorLayer::~OGRPMTilesVectorLayer()
+{
+    m_poTileDS.reset();
+    if (!m_osTmpFilename.empty())
+        VSIUnlink(m_osTmpFilename.c_str());
+    m_poFeatureDefn->Release();
+}
+
+/************************************************************************/
+/*                           TestCapability()                           */
+/************************************************************************/
+
+int OGRPMTilesVectorLayer::TestCapability(const char *pszCap)
+{
+    if (EQUAL(pszCap, OLCStringsAsUTF8) ||
+        EQUAL(pszCap, OLCFastSpatialFilter) || EQUAL(pszCap, OLCFastGetExtent))
+    {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/************************************************************************/
+/*                             GetExtent()                              */
+/************************************************************************/
+
+OGRErr OGRPMTilesVectorLayer::GetExtent(OGREnvelope *psExtent, int)
+{
+    *psExtent = m_sExtent;
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            ResetReading()                            */
+/************************************************************************/
+
+void OGRPMTilesVectorLayer::ResetReading()
+{
+    m_poTileDS.reset();
+    m_poTileLayer = nullptr;
+    if (!m_osTmpFilename.empty())
+    {
+        VSIUnlink(m_osTmpFilename.c_str());
+        m_osTmpFilename.clear();
+    }
+    m_bEOF = false;
+    m_poTileIterator = cpl::make_unique<OGRPMTilesTileIterator>(
+        m_poDS, m_nZoomLevel, m_nFilterMinX, m_nFilterMinY, m_nFilterMaxX,
+        m_nFilterMaxY);
+}
+
+/************************************************************************/
+/*                          SetSpatialFilter()                          */
+/************************************************************************/
+
+void OGRPMTilesVectorLayer::SetSpatialFilter(OGRGeometry *poGeomIn)
+{
+    OGRLayer::SetSpatialFilter(poGeomIn);
+
+    // Without spatial filter, restrict to the bounds of the tileset
+    OGREnvelope sEnvelope = m_sExtent;
+    if (m_poFilterGeom != nullptr)
+    {
+        sEnvelope.MinX = std::max(sEnvelope.MinX, m_sFilterEnvelope.MinX);
+        sEnvelope.MinY = std::max(sEnvelope.MinY, m_sFilterEnvelope.MinY);
+        sEnvelope.MaxX = std::min(sEnvelope.MaxX, m_sFilterEnvelope.MaxX);
+        sEnvelope.MaxY = std::min(sEnvelope.MaxY, m_sFilterEnvelope.MaxY);
+    }
+
+    if (m_bZoomLevelAuto)
+    {
+        m_nZoomLevel = m_poDS->m_nZoomLevel;
+        const double dfExtent =
+            std::min(m_sFilterEnvelope.MaxX - m_sFilterEnvelope.MinX,
+                     m_sFilterEnvelope.MaxY - m_sFilterEnvelope.MinY);
+        if (m_poFilterGeom != nullptr && dfExtent > 0)
+        {
+            m_nZoomLevel = std::max(
+                m_poDS->m_nMinZoomLevel,
+                std::min(static_cast<int>(
+                             0.5 + log(2 * PMTILES_MAX_GM / dfExtent) /
+                                       log(2.0)),
+                         m_poDS->m_nZoomLevel));
+            CPLDebug("PMTiles", "Zoom level = %d", m_nZoomLevel);
+        }
+    }
+
+    if (sEnvelope.MinX > sEnvelope.MaxX || sEnvelope.MinY > sEnvelope.MaxY)
+    {
+        // Empty window
+        m_nFilterMinX = 1;
+        m_nFilterMinY = 1;
+        m_nFilterMaxX = 0;
+        m_nFilterMaxY = 0;
+    }
+    else
+    {
+        const int nMaxTile = (1 << m_nZoomLevel) - 1;
+        const double dfTileDim = 2 * PMTILES_MAX_GM / (1 << m_nZoomLevel);
+        const auto Clamp = [nMaxTile](double dfVal)
+        {
+            return static_cast<int>(
+                std::max(0.0, std::min<double>(nMaxTile, std::floor(dfVal))));
+        };
+        m_nFilterMinX = Clamp((sEnvelope.MinX + PMTILES_MAX_GM) / dfTileDim);
+        m_nFilterMaxX = Clamp((sEnvelope.MaxX + PMTILES_MAX_GM) / dfTileDim);
+        // Y tile coordinates are top-based
+        m_nFilterMinY = Clamp((PMTILES_MAX_GM - sEnvelope.MaxY) / dfTileDim);
+        m_nFilterMaxY = Clamp((PMTILES_MAX_GM - sEnvelope.MinY) / dfTileDim);
+    }
+
+    ResetReading();
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRPMTilesVectorLayer::GetNextFeature()
+{
+    while (true)
+    {
+        OGRFeature *poFeature = GetNextRawFeature();
+        if (poFeature == nullptr)
+            return nullptr;
+
+        if ((m_poFilterGeom == nullptr ||
+             FilterGeometry(poFeature->GetGeometryRef())) &&
+            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
+        {
+            return poFeature;
+        }
+
+        delete poFeature;
+    }
+}
+
+/************************************************************************/
+/*                              OpenTile()                              */
+/************************************************************************/
+
+/** Opens a tile with the MVT driver. osTmpFilename is set to the in-memory
+ * file holding the tile content, to unlink once the dataset is closed. */
+std::unique_ptr<GDALDataset>
+OGRPMTilesVectorLayer::OpenTile(int nX, int nY, const OGRPMTilesEntry &sEntry,
+                                std::string &osTmpFilename)
+{
+    std::string osData;
+    if (!m_poDS->ReadTileData(sEntry, osData))
+        return nullptr;
+
+    osTmpFilename = CPLSPrintf("/vsimem/pmtiles/mvt_%p_%d_%d_%d.pbf",
+                               static_cast<void *>(this), m_nZoomLevel, nX, nY);
+    GByte *pabyDataDup = static_cast<GByte *>(VSI_MALLOC_VERBOSE(
+        std::max(static_cast<size_t>(1), osData.size())));
+    if (pabyDataDup == nullptr)
+        return nullptr;
+    memcpy(pabyDataDup, osData.data(), osData.size());
+    VSIFCloseL(VSIFileFromMemBuffer(osTmpFilename.c_str(), pabyDataDup,
+                                    osData.size(), true));
+
+    const char *const apszAllowedDrivers[] = {"MVT", nullptr};
+    CPLStringList aosOpenOptions;
+    aosOpenOptions.SetNameValue("X", CPLSPrintf("%d", nX));
+    aosOpenOptions.SetNameValue("Y", CPLSPrintf("%d", nY));
+    aosOpenOptions.SetNameValue("Z", CPLSPrintf("%d", m_nZoomLevel));
+    aosOpenOptions.SetNameValue(
+        "METADATA_FILE",
+        m_bJsonField ? "" : m_poDS->m_osMetadataMemFilename.c_str());
+    if (!m_poDS->m_osClip.empty())
+        aosOpenOptions.SetNameValue("CLIP", m_poDS->m_osClip.c_str());
+    return std::unique_ptr<GDALDataset>(GDALDataset::Open(
+        ("MVT:" + osTmpFilename).c_str(), GDAL_OF_VECTOR | GDAL_OF_INTERNAL,
+        apszAllowedDrivers, aosOpenOptions.List(), nullptr));
+}
+
+/************************************************************************/
+/*                          GetFeatureCount()                           */
+/************************************************************************/
+
+GIntBig OGRPMTilesVectorLayer::GetFeatureCount(int bForce)
+{
+    if (m_poFilterGeom == nullptr && m_poAttrQuery == nullptr)
+    {
+        if (m_nFeatureCount < 0)
+        {
+            m_nFeatureCount = 0;
+            OGRPMTilesTileIterator oIter(m_poDS, m_nZoomLevel, m_nFilterMinX,
+                                         m_nFilterMinY, m_nFilterMaxX,
+                                         m_nFilterMaxY);
+            int nX = 0;
+            int nY = 0;
+            OGRPMTilesEntry sEntry;
+            while (oIter.GetNextTile(nX, nY, sEntry))
+            {
+                std::string osTmpFilename;
+                auto poTileDS = OpenTile(nX, nY, sEntry, osTmpFilename);
+                if (poTileDS)
+                {
+                    OGRLayer *poLayer = poTileDS->GetLayerByName(GetName());
+                    if (poLayer)
+                        m_nFeatureCount += poLayer->GetFeatureCount(true);
+                }
+                poTileDS.reset();
+                if (!osTmpFilename.empty())
+                    VSIUnlink(osTmpFilename.c_str());
+            }
+        }
+        return m_nFeatureCount;
+    }
+    return OGRLayer::GetFeatureCount(bForce);
+}
+
+/************************************************************************/
+/*                         GetNextSrcFeature()                          */
+/************************************************************************/
+
+OGRFeature *OGRPMTilesVectorLayer::GetNextSrcFeature()
+{
+    if (m_bEOF)
+        return nullptr;
+    if (!m_poTileIterator)
+        ResetReading();
+
+    while (true)
+    {
+        if (m_poTileLayer)
+        {
+            OGRFeature *poFeature = m_poTileLayer->GetNextFeature();
+            if (poFeature)
+                return poFeature;
+            m_poTileLayer = nullptr;
+        }
+
+        m_poTileDS.reset();
+        if (!m_osTmpFilename.empty())
+        {
+            VSIUnlink(m_osTmpFilename.c_str());
+            m_osTmpFilename.clear();
+        }
+
+        OGRPMTilesEntry sEntry;
+        if (!m_poTileIterator->GetNextTile(m_nX, m_nY, sEntry))
+        {
+            m_bEOF = true;
+            return nullptr;
+        }
+        CPLDebug("PMTiles", "X=%d, Y=%d", m_nX, m_nY);
+
+        m_poTileDS = OpenTile(m_nX, m_nY, sEntry, m_osTmpFilename);
+        if (m_poTileDS)
+            m_poTileLayer = m_poTileDS->GetLayerByName(GetName());
+    }
+}
+
+/************************************************************************/
+/*                         CreateFeatureFrom()                          */
+/************************************************************************/
+
+OGRFeature *OGRPMTilesVectorLayer::CreateFeatureFrom(OGRFeature *poSrcFeature)
+{
+    return OGRMVTCreateFeatureFrom(poSrcFeature, m_poFeatureDefn, m_bJsonField,
+                                   GetSpatialRef());
+}
+
+/************************************************************************/
+/*                         GetNextRawFeature()                          */
+/************************************************************************/
+
+OGRFeature *OGRPMTilesVectorLayer::GetNextRawFeature()
+{
+    OGRFeature *poSrcFeat = GetNextSrcFeature();
+    if (poSrcFeat == nullptr)
+        return nullptr;
+
+    const GIntBig nFIDBase =
+        (static_cast<GIntBig>(m_nY) << m_nZoomLevel) | m_nX;
+    OGRFeature *poFeature = CreateFeatureFrom(poSrcFeat);
+    poFeature->SetFID((poSrcFeat->GetFID() << (2 * m_nZoomLevel)) | nFIDBase);
+    delete poSrcFeat;
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                             GetFeature()                             */
+/************************************************************************/
+
+OGRFeature *OGRPMTilesVectorLayer::GetFeature(GIntBig nFID)
+{
+    const int nZ = m_nZoomLevel;
+    const int nX = static_cast<int>(nFID & ((1 << nZ) - 1));
+    const int nY = static_cast<int>((nFID >> nZ) & ((1 << nZ) - 1));
+    const GIntBig nTileFID = nFID >> (2 * nZ);
+
+    OGRPMTilesEntry sEntry;
+    bool bFound = false;
+    if (!m_poDS->FindTile(OGRPMTilesZXYToTileId(nZ, nX, nY), sEntry, bFound) ||
+        !bFound)
+    {
+        return nullptr;
+    }
+
+    std::string osTmpFilename;
+    auto poTileDS = OpenTile(nX, nY, sEntry, osTmpFilename);
+    OGRFeature *poFeature = nullptr;
+    if (poTileDS)
+    {
+        OGRLayer *poLayer = poTileDS->GetLayerByName(GetName());
+        if (poLayer)
+        {
+            OGRFeature *poUnderlyingFeature = poLayer->GetFeature(nTileFID);
+            if (poUnderlyingFeature)
+            {
+                poFeature = CreateFeatureFrom(poUnderlyingFeature);
+                poFeature->SetFID(nFID);
+            }
+            delete poUnderlyingFeature;
+        }
+    }
+    poTileDS.reset();
+    if (!osTmpFilename.empty())
+        VSIUnlink(osTmpFilename.c_str());
+
+    return poFeature;
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  PMTiles vector writer
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#if defined(HAVE_SQLITE) && defined(HAVE_GEOS)
+// Needed by mvtutils.h
+#define HAVE_MVT_WRITE_SUPPORT
+#endif
+
+#include "ogr_pmtiles.h"
+
+#include "mvtutils.h"
+
+#ifdef HAVE_MVT_WRITE_SUPPORT
+
+/************************************************************************/
+/*                      ~OGRPMTilesWriterDataset()                      */
+/************************************************************************/
+
+OGRPMTilesWriterDataset::~OGRPMTilesWriterDataset()
+{
+    OGRPMTilesWriterDataset::Close();
+}
+
+/************************************************************************/
+/*                              Create()                                */
+/************************************************************************/
+
+bool OGRPMTilesWriterDataset::Create(const char *pszFilename,
+                                     CSLConstList papszOptions)
+{
+    SetDescription(pszFilename);
+    // The temporary file is created in CPL_TMPDIR, or in the current
+    // directory when it is not set.
+    m_osTmpFilename =
+        std::string(CPLGenerateTempFilename(nullptr)) + ".mbtiles";
+
+    CPLStringList aosOptions(papszOptions);
+    aosOptions.SetNameValue("FORMAT", "MBTILES");
+    m_poMBTilesWriterDS.reset(OGRMVTWriterDatasetCreate(
+        m_osTmpFilename.c_str(), 0, 0, 0, GDT_Unknown, aosOptions.List()));
+    if (!m_poMBTilesWriterDS)
+    {
+        VSIUnlink(m_osTmpFilename.c_str());
+        return false;
+    }
+
+    eAccess = GA_Update;
+    return true;
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+CPLErr OGRPMTilesWriterDataset::Close()
+{
+    CPLErr eErr = CE_None;
+    if (nOpenFlags != OPEN_FLAGS_CLOSED)
+    {
+        if (m_poMBTilesWriterDS)
+        {
+            // Tiles are generated when the MVT writer is destroyed
+            CPLErrorReset();
+            m_poMBTilesWriterDS.reset();
+            if (CPLGetLastErrorType() == CE_Failure)
+                eErr = CE_Failure;
+
+            if (eErr == CE_None &&
+                !OGRPMTilesConvertFromMBTiles(GetDescription(),
+                                              m_osTmpFilename.c_str(),
+                                              nullptr, nullptr))
+            {
+                eErr = CE_Failure;
+            }
+            VSIUnlink(m_osTmpFilename.c_str());
+        }
+
+        if (GDALDataset::Close() != CE_None)
+            eErr = CE_Failure;
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                            ICreateLayer()                            */
+/************************************************************************/
+
+OGRLayer *OGRPMTilesWriterDataset::ICreateLayer(const char *pszLayerName,
+                                                OGRSpatialReference *poSRS,
+                                                OGRwkbGeometryType eGType,
+                                                char **papszOptions)
+{
+    return m_poMBTilesWriterDS->CreateLayer(pszLayerName, poSRS, eGType,
+                                            papszOptions);
+}
+
+/************************************************************************/
+/*                           GetLayerCount()                            */
+/************************************************************************/
+
+int OGRPMTilesWriterDataset::GetLayerCount()
+{
+    return m_poMBTilesWriterDS ? m_poMBTilesWriterDS->GetLayerCount() : 0;
+}
+
+/************************************************************************/
+/*                             GetLayer()                               */
+/************************************************************************/
+
+OGRLayer *OGRPMTilesWriterDataset::GetLayer(int iLayer)
+{
+    return m_poMBTilesWriterDS ? m_poMBTilesWriterDS->GetLayer(iLayer)
+                               : nullptr;
+}
+
+/************************************************************************/
+/*                          TestCapability()                            */
+/************************************************************************/
+
+int OGRPMTilesWriterDataset::TestCapability(const char *pszCap)
+{
+    return m_poMBTilesWriterDS ? m_poMBTilesWriterDS->TestCapability(pszCap)
+                               : false;
+}
+
+#endif  // HAVE_MVT_WRITE_SUPPORT
@@ -137,6 +137,11 @@ struct OGRSpatialReference::Private
 
     double m_coordinateEpoch = 0;  // as decimal year
 
+    // Text representation used by OGRCreateCoordinateTransformation(), and
+    // the value of the configuration options it depends on.
+    std::string m_osCTTextRepresentation{};
+    std::string m_osCTTextRepresentationContext{};
+
     Private();
     ~Private();
     Private(const Private &) = delete;
@@ -169,6 +174,12 @@ struct OGRSpatialReference::Private
     const char *nullifyTargetKeyIfPossible(const char *pszTargetKey);
 
     void refreshAxisMapping();
+
+    void invalidateCTTextRepresentation()
+    {
+        m_osCTTextRepresentation.clear();
+        m_osCTTextRepresentationContext.clear();
+    }
 };
 
 static OSRAxisMappingStrategy GetDefaultAxisMappingStrategy()
@@ -257,6 +268,8 @@ void OGRSpatialReference::Private::clear()
     m_bHasCenterLong = false;
 
     m_coordinateEpoch = 0.0;
+
+    invalidateCTTextRepresentation();
 }
 
 void OGRSpatialReference::Private::setRoot(OGR_SRSNode *poRoot)
@@ -284,6 +297,7 @@ void OGRSpatialReference::Private::setPjCRS(PJ *pj_crsIn,
         m_pj_crs_modified_during_demote = true;
     }
     invalidateNodes();
+    invalidateCTTextRepresentation();
     if (doRefreshAxisMapping)
     {
         refreshAxisMapping();
@@ -502,6 +516,7 @@ void OGRSpatialReference::Private::refreshAxisMapping()
 void OGRSpatialReference::Private::nodesChanged()
 {
     m_bNodesChanged = true;
+    invalidateCTTextRepresentation();
 }
 
 void OGRSpatialReference::Private::invalidateNodes()
@@ -943,6 +958,13 @@ OGRSpatialReference::operator=(const OGRSpatialReference &oSource)
             SetDataAxisToSRSAxisMapping(oSource.d->m_axisMapping);
 
         d->m_coordinateEpoch = oSource.d->m_coordinateEpoch;
+        {
+            // Set by the const GetTextRepresentation() of ogrct.cpp
+            std::lock_guard<std::mutex> oLock(oSource.d->m_mutex);
+            d->m_osCTTextRepresentation = oSource.d->m_osCTTextRepresentation;
+            d->m_osCTTextRepresentationContext =
+                oSource.d->m_osCTTextRepresentationContext;
+        }
     }
 
     return *this;
@@ -1367,6 +1389,13 @@ OGRSpatialReference *OGRSpatialReference::Clone() const
     poNewRef->d->m_axisMapping = d->m_axisMapping;
     poNewRef->d->m_axisMappingStrategy = d->m_axisMappingStrategy;
     poNewRef->d->m_coordinateEpoch = d->m_coordinateEpoch;
+    {
+        // Set by the const GetTextRepresentation() of ogrct.cpp
+        std::lock_guard<std::mutex> oLock(d->m_mutex);
+        poNewRef->d->m_osCTTextRepresentation = d->m_osCTTextRepresentation;
+        poNewRef->d->m_osCTTextRepresentationContext =
+            d->m_osCTTextRepresentationContext;
+    }
     return poNewRef;
 }
 
@@ -11775,6 +11804,7 @@ void OGRSpatialReference::SetAxisMappingStrategy(
 {
     d->m_axisMappingStrategy = strategy;
     d->refreshAxisMapping();
+    d->invalidateCTTextRepresentation();
 }
 
 /************************************************************************/
@@ -11853,6 +11883,7 @@ OGRErr OGRSpatialReference::SetDataAxisToSRSAxisMapping(
         return OGRERR_FAILURE;
     d->m_axisMappingStrategy = OAMS_CUSTOM;
     d->m_axisMapping = mapping;
+    d->invalidateCTTextRepresentation();
     return OGRERR_NONE;
 }
 
@@ -12427,6 +12458,7 @@ int OGRSpatialReference::GetEPSGGeogCS() const
 void OGRSpatialReference::SetCoordinateEpoch(double dfCoordinateEpoch)
 {
     d->m_coordinateEpoch = dfCoordinateEpoch;
+    d->invalidateCTTextRepresentation();
 }
 
 /************************************************************************/
@@ -12491,3 +12523,45 @@ double OSRGetCoordinateEpoch(OGRSpatialReferenceH hSRS)
 
     return OGRSpatialReference::FromHandle(hSRS)->GetCoordinateEpoch();
 }
+
+/*! @cond Doxygen_Suppress */
+
+/************************************************************************/
+/*                  GetCachedCTTextRepresentation()                     */
+/************************************************************************/
+
+/** Return the text representation of this SRS computed by a previous
+ * OGRCreateCoordinateTransformation() call, if it is still valid and was
+ * computed with the same context (value of configuration options).
+ *
+ * The cache is invalidated by any modification of the object.
+ */
+bool OGRSpatialReference::GetCachedCTTextRepresentation(
+    const std::string &osContext, std::string &osText) const
+{
+    std::lock_guard<std::mutex> oLock(d->m_mutex);
+    if (d->m_osCTTextRepresentation.empty() ||
+        d->m_osCTTextRepresentationContext != osContext)
+    {
+        return false;
+    }
+    osText = d->m_osCTTextRepresentation;
+    return true;
+}
+
+/************************************************************************/
+/*                  SetCachedCTTextRepresentation()                     */
+/************************************************************************/
+
+/** Store the text representation of this SRS computed by
+ * OGRCreateCoordinateTransformation().
+ */
+void OGRSpatialReference::SetCachedCTTextRepresentation(
+    const std::string &osContext, const std::string &osText) const
+{
+    std::lock_guard<std::mutex> oLock(d->m_mutex);
+    d->m_osCTTextRepresentation = osText;
+    d->m_osCTTextRepresentationContext = osContext;
+}
+
+/*! @endcond */
@@ -30,9 +30,11 @@
 #include "cpl_port.h"
 #include "cpl_csv.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <string>
 #if HAVE_FCNTL_H
 #include <fcntl.h>
 #endif
@@ -282,60 +284,85 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
     if (pszString == nullptr)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
 
-    char *pszToken = static_cast<char *>(CPLCalloc(10, 1));
-    int nTokenMax = 10;
     const size_t nDelimiterLength = strlen(pszDelimiter);
 
+    // Outside of quoted strings, only double quotes and the first character
+    // of the delimiter need to be looked at: spans of other characters are
+    // located with strcspn() and copied at once.
+    const char szSpecialChars[] = {'"', pszDelimiter[0], '\0'};
+
+    std::string osToken;
     const char *pszIter = pszString;
     while (*pszIter != '\0')
     {
         bool bInString = false;
-
-        int nTokenLen = 0;
+        osToken.clear();
 
         // Try to find the next delimiter, marking end of token.
-        do
+        while (*pszIter != '\0')
         {
-            // End if this is a delimiter skip it and break.
-            if (!bInString &&
-                strncmp(pszIter, pszDelimiter, nDelimiterLength) == 0)
+            if (!bInString)
             {
-                pszIter += nDelimiterLength;
-                if (bMergeDelimiter)
+                const size_t nSpan = strcspn(pszIter, szSpecialChars);
+                osToken.append(pszIter, nSpan);
+                pszIter += nSpan;
+                if (*pszIter == '\0')
+                    break;
+
+                // End if this is a delimiter skip it and break.
+                if (strncmp(pszIter, pszDelimiter, nDelimiterLength) == 0)
                 {
-                    while (strncmp(pszIter, pszDelimiter, nDelimiterLength) ==
-                           0)
-                        pszIter += nDelimiterLength;
+                    pszIter += nDelimiterLength;
+                    if (bMergeDelimiter)
+                    {
+                        while (strncmp(pszIter, pszDelimiter,
+                                       nDelimiterLength) == 0)
+                            pszIter += nDelimiterLength;
+                    }
+                    break;
                 }
-                break;
-            }
 
-            if (*pszIter == '"')
-            {
-                if (!bInString || pszIter[1] != '"')
+                if (*pszIter == '"')
                 {
-                    bInString = !bInString;
-                    if (!bKeepLeadingAndClosingQuotes)
-                        continue;
+                    bInString = true;
+                    if (bKeepLeadingAndClosingQuotes)
+                        osToken += '"';
                 }
-                else  // Doubled quotes in string resolve to one quote.
+                else
                 {
-                    pszIter++;
+                    // First character of a multi-character delimiter.
+                    osToken += *pszIter;
                 }
+                pszIter++;
             }
-
-            if (nTokenLen >= nTokenMax - 2)
+            else
             {
-                nTokenMax = nTokenMax * 2 + 10;
-                pszToken = static_cast<char *>(CPLRealloc(pszToken, nTokenMax));
+                const char *pszQuote = strchr(pszIter, '"');
+                if (pszQuote == nullptr)
+                {
+                    osToken.append(pszIter);
+                    pszIter += strlen(pszIter);
+                    break;
+                }
+                osToken.append(pszIter, pszQuote - pszIter);
+                pszIter = pszQuote;
+                if (pszIter[1] == '"')
+                {
+                    // Doubled quotes in string resolve to one quote.
+                    osToken += '"';
+                    pszIter += 2;
+                }
+                else
+                {
+                    bInString = false;
+                    if (bKeepLeadingAndClosingQuotes)
+                        osToken += '"';
+                    pszIter++;
+                }
             }
+        }
 
-            pszToken[nTokenLen] = *pszIter;
-            nTokenLen++;
-        } while (*(++pszIter) != '\0');
-
-        pszToken[nTokenLen] = '\0';
-        aosRetList.AddString(pszToken);
+        aosRetList.AddString(osToken.c_str());
 
         // If the last token is an empty token, then we have to catch
         // it now, otherwise we won't reenter the loop and it will be lost.
@@ -348,8 +375,6 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
         }
     }
 
-    CPLFree(pszToken);
-
     if (aosRetList.Count() == 0)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
     else
@@ -631,11 +656,12 @@ CSVReadParseLineGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
 
         while (true)
         {
-            for (; i < osWorkLine.size(); i++)
+            for (const char *pszQuote = strchr(osWorkLine.c_str() + i, '\"');
+                 pszQuote != nullptr; pszQuote = strchr(pszQuote + 1, '\"'))
             {
-                if (osWorkLine[i] == '\"')
-                    nCount++;
+                nCount++;
             }
+            i = osWorkLine.size();
 
             if (nCount % 2 == 0)
                 break;
@@ -773,6 +799,104 @@ char **CSVReadParseLine3L(VSILFILE *fp, size_t nMaxLineSize,
         bKeepLeadingAndClosingQuotes, bMergeDelimiter, bSkipBOM);
 }
 
+/************************************************************************/
+/*                          CSVBufferReader                             */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param pszData Data to read, that must remain valid during the lifetime of
+ *                this object. It does not need to be nul-terminated.
+ * @param nSize Size of pszData in bytes.
+ * @since GDAL 3.7
+ */
+CSVBufferReader::CSVBufferReader(const char *pszData, size_t nSize)
+    : m_pszCur(pszData), m_pszEnd(pszData + nSize)
+{
+}
+
+/************************************************************************/
+/*                             ReadLine()                               */
+/************************************************************************/
+
+// Equivalent of CPLReadLine3L() on the buffer.
+const char *CSVBufferReader::ReadLine(size_t nMaxLineSize)
+{
+    if (m_pszCur == m_pszEnd)
+        return nullptr;
+
+    // Lines generally end with \n, and rarely contain \r, so remember where
+    // the next occurrence of each is instead of looking for both at each
+    // call.
+    const size_t nRemaining = static_cast<size_t>(m_pszEnd - m_pszCur);
+    if (m_pszNextLF == nullptr || m_pszNextLF < m_pszCur)
+    {
+        m_pszNextLF =
+            static_cast<const char *>(memchr(m_pszCur, 10, nRemaining));
+        if (m_pszNextLF == nullptr)
+            m_pszNextLF = m_pszEnd;
+    }
+    if (m_pszNextCR == nullptr || m_pszNextCR < m_pszCur)
+    {
+        m_pszNextCR =
+            static_cast<const char *>(memchr(m_pszCur, 13, nRemaining));
+        if (m_pszNextCR == nullptr)
+            m_pszNextCR = m_pszEnd;
+    }
+    const char *pszEOL = std::min(m_pszNextLF, m_pszNextCR);
+    const size_t nLineSize = static_cast<size_t>(pszEOL - m_pszCur);
+    if (nMaxLineSize > 0 && nLineSize >= nMaxLineSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Maximum number of characters allowed reached.");
+        return nullptr;
+    }
+    m_osLine.assign(m_pszCur, nLineSize);
+
+    m_pszCur = pszEOL;
+    if (m_pszCur != m_pszEnd)
+    {
+        // Consume the end-of-line sequence: \r\n and \n\r count as one.
+        const char chEOL = *m_pszCur;
+        m_pszCur++;
+        if (m_pszCur != m_pszEnd && (*m_pszCur == 10 || *m_pszCur == 13) &&
+            *m_pszCur != chEOL)
+        {
+            m_pszCur++;
+        }
+    }
+    return m_osLine.c_str();
+}
+
+/************************************************************************/
+/*                            ReadParseLine()                           */
+/************************************************************************/
+
+const char *CSVBufferReader::ReadLineCbk(void *pReader, size_t nMaxLineSize)
+{
+    return static_cast<CSVBufferReader *>(pReader)->ReadLine(nMaxLineSize);
+}
+
+/** Read one line from the buffer, and return split into fields.
+ *
+ * This is the equivalent of CSVReadParseLine3L() on an in-memory buffer,
+ * and takes the same arguments.
+ *
+ * @return a string list to free with CSLDestroy(), or NULL at the end of
+ * the buffer or in case of error.
+ * @since GDAL 3.7
+ */
+char **CSVBufferReader::ReadParseLine(size_t nMaxLineSize,
+                                      const char *pszDelimiter,
+                                      bool bHonourStrings,
+                                      bool bKeepLeadingAndClosingQuotes,
+                                      bool bMergeDelimiter, bool bSkipBOM)
+{
+    return CSVReadParseLineGeneric(
+        this, ReadLineCbk, nMaxLineSize, pszDelimiter, bHonourStrings,
+        bKeepLeadingAndClosingQuotes, bMergeDelimiter, bSkipBOM);
+}
+
 /************************************************************************/
 /*                             CSVCompare()                             */
 /*                                                                      */
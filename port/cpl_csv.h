@@ -84,4 +84,42 @@ void CPL_DLL SetCSVFilenameHook(const char *(*)(const char *));
 
 CPL_C_END
 
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
+#include <string>
+
+/** Reads CSV records from an in-memory buffer, with the same semantics as
+ * CSVReadParseLine3L().
+ *
+ * Contrary to CSVReadParseLine3L(), several instances may be used
+ * concurrently from different threads, for example to parse different
+ * parts of a file.
+ *
+ * @since GDAL 3.7
+ */
+class CPL_DLL CSVBufferReader
+{
+  public:
+    CSVBufferReader(const char *pszData, size_t nSize);
+
+    char **ReadParseLine(size_t nMaxLineSize, const char *pszDelimiter,
+                         bool bHonourStrings, bool bKeepLeadingAndClosingQuotes,
+                         bool bMergeDelimiter, bool bSkipBOM);
+
+  private:
+    const char *m_pszCur;
+    const char *const m_pszEnd;
+    const char *m_pszNextLF = nullptr;
+    const char *m_pszNextCR = nullptr;
+    std::string m_osLine{};
+
+    const char *ReadLine(size_t nMaxLineSize);
+    static const char *ReadLineCbk(void *pReader, size_t nMaxLineSize);
+
+    CSVBufferReader(const CSVBufferReader &) = delete;
+    CSVBufferReader &operator=(const CSVBufferReader &) = delete;
+};
+
+#endif
+
 #endif /* ndef CPL_CSV_H_INCLUDED */
@@ -251,6 +251,7 @@ def main(argv):
         "gdal_translate",
         "gdalwarp",
         "gdal_viewshed",
+        "gdal_zonalstats",
         "gdal_create",
     ]
 
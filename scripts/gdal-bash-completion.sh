@@ -657,6 +657,21 @@ _gdal_viewshed()
   return 0
 }
 complete -o default -F _gdal_viewshed gdal_viewshed
+_gdal_zonalstats()
+{
+  local cur prev
+  COMPREPLY=()
+  _get_comp_words_by_ref cur prev
+  case "$cur" in
+    -*)
+      key_list="-b -l -at -hist -hist_min -hist_max -nt -f -nln -dsco -lco -q "
+      mapfile -t COMPREPLY < <(compgen -W "$key_list" -- "$cur")
+      return 0
+      ;;
+  esac
+  return 0
+}
+complete -o default -F _gdal_zonalstats gdal_zonalstats
 _gdal_create()
 {
   local cur prev
@@ -1032,6 +1032,14 @@ public:
   }
 %clear char **;
 
+%newobject GetReduced;
+%apply Pointer NONNULL {const char* operation};
+  GDALMDArrayHS* GetReduced(size_t iDim, const char* operation)
+  {
+    return GDALMDArrayGetReduced(self, iDim, operation);
+  }
+%clear const char* operation;
+
 %newobject AsClassicDataset;
   GDALDatasetShadow* AsClassicDataset(size_t iXDim, size_t iYDim)
   {
@@ -329,6 +329,31 @@ int  FPolygonize( GDALRasterBandShadow *srcBand,
 
 %clear GDALRasterBandShadow *srcBand, OGRLayerShadow *outLayer;
 
+/************************************************************************/
+/*                           ZonalStatistics()                          */
+/************************************************************************/
+
+%apply Pointer NONNULL {GDALRasterBandShadow *srcBand, OGRLayerShadow *zoneLayer, OGRLayerShadow *outLayer};
+#ifndef SWIGJAVA
+%feature( "kwargs" ) ZonalStatistics;
+#endif
+%inline %{
+int  ZonalStatistics( GDALRasterBandShadow *srcBand,
+                      OGRLayerShadow *zoneLayer,
+                      OGRLayerShadow *outLayer,
+                      char **options = NULL,
+                      GDALProgressFunc callback=NULL,
+                      void* callback_data=NULL) {
+
+    CPLErrorReset();
+
+    return GDALZonalStatistics( srcBand, zoneLayer, outLayer,
+                                options, callback, callback_data );
+}
+%}
+
+%clear GDALRasterBandShadow *srcBand, OGRLayerShadow *zoneLayer, OGRLayerShadow *outLayer;
+
 /************************************************************************/
 /*                             FillNodata()                             */
 /************************************************************************/
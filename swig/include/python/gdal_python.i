@@ -2996,6 +2996,7 @@ def BuildVRTOptions(options=None,
                     VRTNodata=None,
                     hideNodata=None,
                     strict=False,
+                    numThreads=None,
                     callback=None, callback_data=None):
     """Create a BuildVRTOptions() object that can be passed to gdal.BuildVRT()
 
@@ -3034,6 +3035,8 @@ def BuildVRTOptions(options=None,
         whether to make the VRT band not report the NoData value.
     strict:
         set to True if warnings should be failures
+    numThreads:
+        number of threads (or "ALL_CPUS") used to open input datasets.
     callback:
         callback method.
     callback_data:
@@ -3083,6 +3086,8 @@ def BuildVRTOptions(options=None,
             new_options += ['-hidenodata']
         if strict:
             new_options += ['-strict']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
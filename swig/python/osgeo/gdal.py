@@ -1850,6 +1850,7 @@ def BuildVRTOptions(options=None,
                     VRTNodata=None,
                     hideNodata=None,
                     strict=False,
+                    numThreads=None,
                     callback=None, callback_data=None):
     """Create a BuildVRTOptions() object that can be passed to gdal.BuildVRT()
 
@@ -1888,6 +1889,8 @@ def BuildVRTOptions(options=None,
         whether to make the VRT band not report the NoData value.
     strict:
         set to True if warnings should be failures
+    numThreads:
+        number of threads (or "ALL_CPUS") used to open input datasets.
     callback:
         callback method.
     callback_data:
@@ -1937,6 +1940,8 @@ def BuildVRTOptions(options=None,
             new_options += ['-hidenodata']
         if strict:
             new_options += ['-strict']
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -3630,6 +3635,10 @@ class MDArray(object):
         r"""GetMask(MDArray self, char ** options=None) -> MDArray"""
         return _gdal.MDArray_GetMask(self, *args)
 
+    def GetReduced(self, *args) -> "GDALMDArrayHS *":
+        r"""GetReduced(MDArray self, size_t iDim, char const * operation) -> MDArray"""
+        return _gdal.MDArray_GetReduced(self, *args)
+
     def AsClassicDataset(self, *args) -> "GDALDatasetShadow *":
         r"""AsClassicDataset(MDArray self, size_t iXDim, size_t iYDim) -> Dataset"""
         return _gdal.MDArray_AsClassicDataset(self, *args)
@@ -4925,6 +4934,10 @@ def FPolygonize(*args, **kwargs) -> "int":
     r"""FPolygonize(Band srcBand, Band maskBand, Layer outLayer, int iPixValField, char ** options=None, GDALProgressFunc callback=0, void * callback_data=None) -> int"""
     return _gdal.FPolygonize(*args, **kwargs)
 
+def ZonalStatistics(*args, **kwargs) -> "int":
+    r"""ZonalStatistics(Band srcBand, Layer zoneLayer, Layer outLayer, char ** options=None, GDALProgressFunc callback=0, void * callback_data=None) -> int"""
+    return _gdal.ZonalStatistics(*args, **kwargs)
+
 def FillNodata(*args, **kwargs) -> "int":
     r"""FillNodata(Band targetBand, Band maskBand, double maxSearchDist, int smoothingIterations, char ** options=None, GDALProgressFunc callback=0, void * callback_data=None) -> int"""
     return _gdal.FillNodata(*args, **kwargs)